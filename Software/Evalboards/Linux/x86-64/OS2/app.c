@@ -0,0 +1,3085 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*                          (c) Copyright 2009-2011; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          APPLICATION CODE
+*
+*                                            Linux x86-64
+*
+* Filename      : app.c
+* Version       : V1.00
+* Programmer(s) : JJL
+*                 FGK
+*
+* Note(s)       : (1) The start task measures the cost of a context switch once per second.  It posts a
+*                     semaphore to a higher priority task, which preempts it & pends on the semaphore
+*                     again : each round is two context switches.  The same post & pend without any task
+*                     waiting gives the kernel overhead, which is subtracted.
+*
+*                 (2) The benchmarks enabled in 'app_cfg.h  BENCHMARK CONFIGURATION' run once before, each with
+*                     the results measured on the development host.
+*
+*                 (3) With OS_SMP_EN, the start & pong tasks stay on core 0, so that the context switch
+*                     benchmark switches tasks on one core.
+*
+*                 (4) With OS_MULTI_INST_EN, main() does not select a kernel instance : OSInit() runs the
+*                     default one.  APP_CFG_BENCH_MULTI_EN first runs more instances, one per host thread.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include <includes.h>
+
+#if (APP_CFG_BENCH_MULTI_EN == DEF_ENABLED)
+#include <pthread.h>
+#include <semaphore.h>
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_CTX_SW_ROUNDS                           1000000u   /* Rounds of the context switch benchmark.              */
+
+#if (APP_CFG_BENCH_SMP_EN == DEF_ENABLED)
+#if (OS_SMP_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_SMP_EN needs OS_SMP_EN enabled (1) in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_SMP_TASK_NBR                OS_SMP_CORE_NBR  /* One busy task per core.                              */
+#define  APP_BENCH_SMP_WORK                            4000u    /* Loop iterations of a compute-bound unit of work.     */
+#define  APP_BENCH_SMP_DLY             (OS_TICKS_PER_SEC / 2u)  /* Duration of each measurement, in ticks.              */
+#endif
+
+#if (APP_CFG_BENCH_STEAL_EN == DEF_ENABLED)
+#if (OS_SMP_EN == 0u) || (OS_SMP_STEAL_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_STEAL_EN needs OS_SMP_EN & OS_SMP_STEAL_EN enabled (1) in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_STEAL_TASK_NBR      (2u * OS_SMP_CORE_NBR)   /* Tasks started on core 0, the last one pinned there.  */
+#define  APP_BENCH_STEAL_WORK                         20000u    /* Loop iterations of a unit of work.                   */
+#define  APP_BENCH_STEAL_UNITS                           50u    /* Units of work between delays of one tick.            */
+#define  APP_BENCH_STEAL_DLY               OS_TICKS_PER_SEC     /* Duration of the test, in ticks.                      */
+#endif
+
+#if (APP_CFG_BENCH_FLAG_EN == DEF_ENABLED)
+#if (OS_FLAG_EN == 0u) || (OS_SCHED_RR_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_FLAG_EN needs OS_FLAG_EN & OS_SCHED_RR_EN enabled (1) in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_FLAG_TASK_NBR                        200u    /* Tasks waiting on the group, all at one priority.     */
+#define  APP_BENCH_FLAG_ROUNDS                          100u    /* Posts timed per measurement.                         */
+#if (OS_MAX_TASKS < (APP_BENCH_FLAG_TASK_NBR + 2u))
+#error  "APP_CFG.H, APP_CFG_BENCH_FLAG_EN needs OS_MAX_TASKS >= 202 in 'os_cfg.h'"
+#endif
+#endif
+
+#if (APP_CFG_BENCH_TICK_EN == DEF_ENABLED)
+#if (OS_SCHED_RR_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_TICK_EN needs OS_SCHED_RR_EN enabled (1) in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_TICK_TASK_NBR                        240u    /* Most tasks pending forever, all at one priority.     */
+#define  APP_BENCH_TICK_ROUNDS                         1000u    /* Ticks timed per run.                                 */
+#define  APP_BENCH_TICK_RUNS                              5u    /* Runs per measurement, the fastest is kept.           */
+#define  APP_BENCH_TICK_DLY                     0x7FFFFFFFu     /* Timeout of the delayed task, never reached.          */
+#if (OS_MAX_TASKS < (APP_BENCH_TICK_TASK_NBR + 3u))
+#error  "APP_CFG.H, APP_CFG_BENCH_TICK_EN needs OS_MAX_TASKS >= 243 in 'os_cfg.h'"
+#endif
+#endif
+
+#if (APP_CFG_BENCH_CNTZ_EN == DEF_ENABLED)
+#define  APP_BENCH_CNTZ_MAP_NBR                        4096u    /* Random ready lists looked up per run.                */
+#define  APP_BENCH_CNTZ_RUNS                             20u    /* Runs per measurement, the fastest is kept.           */
+#endif
+
+#if (APP_CFG_BENCH_TMR_EN == DEF_ENABLED)
+#if (OS_TMR_EN == 0u) || (OS_TMR_CFG_POOL_ADD_EN == 0u) || (OS_TASK_PROFILE_EN == 0u) || (OS_TASK_QUERY_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_TMR_EN needs OS_TMR_EN, OS_TMR_CFG_POOL_ADD_EN, OS_TASK_PROFILE_EN & OS_TASK_QUERY_EN enabled (1) in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_TMR_NBR                           100000u    /* Timers added to the pool.                            */
+#define  APP_BENCH_TMR_ROUNDS                          2000u    /* Timer ticks signaled per measurement.                */
+#endif
+
+#if (APP_CFG_BENCH_QV_EN == DEF_ENABLED)
+#if (OS_QV_EN == 0u) || (OS_Q_EN == 0u) || (OS_MEM_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_QV_EN needs OS_QV_EN, OS_Q_EN & OS_MEM_EN enabled (1) in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_QV_MSG_SIZE_MAX                      256u    /* Largest message, in bytes.                           */
+#define  APP_BENCH_QV_MSG_NBR                             8u    /* Messages each queue holds.                           */
+#define  APP_BENCH_QV_ROUNDS                         200000u    /* Messages sent & received per run.                    */
+#define  APP_BENCH_QV_RUNS                                7u    /* Runs per measurement, the fastest is kept.           */
+#endif
+
+#if (APP_CFG_BENCH_THRESHOLD_EN == DEF_ENABLED)
+#if (OS_Q_EN == 0u) || (OS_MAX_QS < 2u) || (OS_SEM_EN == 0u) || (OS_TASK_DEL_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_THRESHOLD_EN needs OS_Q_EN, OS_SEM_EN & OS_TASK_DEL_EN enabled (1) & OS_MAX_QS >= 2 in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_THRESHOLD_MSG_NBR                  10000u    /* Messages sent through the pipeline.                  */
+#define  APP_BENCH_THRESHOLD_DEPTH                        8u    /* Messages in flight.                                  */
+#endif
+
+#if (APP_CFG_BENCH_ISR_EN == DEF_ENABLED)
+#if (OS_MBOX_EN == 0u) || (OS_MBOX_POST_OPT_EN == 0u) || (OS_MBOX_DEL_EN == 0u) || (OS_TASK_DEL_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_ISR_EN needs OS_MBOX_EN, OS_MBOX_POST_OPT_EN, OS_MBOX_DEL_EN & OS_TASK_DEL_EN enabled (1) in 'os_cfg.h'"
+#endif
+#ifndef CPU_CFG_INT_DIS_MEAS_EN
+#error  "APP_CFG.H, APP_CFG_BENCH_ISR_EN needs CPU_CFG_INT_DIS_MEAS_EN defined in 'cpu_cfg.h'"
+#endif
+#define  APP_BENCH_ISR_TASK_NBR                          48u    /* Most tasks waiting on the mailbox.                   */
+#define  APP_BENCH_ISR_ROUNDS                          1000u    /* Broadcasts per measurement.                          */
+#define  APP_BENCH_ISR_INT_SRC                            8u    /* Interrupt source raised by the benchmark.            */
+#if (OS_MAX_TASKS < (APP_BENCH_ISR_TASK_NBR + 4u))
+#error  "APP_CFG.H, APP_CFG_BENCH_ISR_EN needs OS_MAX_TASKS >= 52 in 'os_cfg.h'"
+#endif
+#endif
+
+#if (APP_CFG_BENCH_TICKLESS_EN == DEF_ENABLED)
+#if (OS_TMR_EN == 0u) || (OS_SEM_EN == 0u) || (OS_SEM_DEL_EN == 0u) || (OS_TASK_DEL_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_TICKLESS_EN needs OS_TMR_EN, OS_SEM_EN, OS_SEM_DEL_EN & OS_TASK_DEL_EN enabled (1) in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_TICKLESS_DLY        (3u * OS_TICKS_PER_SEC)  /* Duration of the check, in ticks.                     */
+#define  APP_BENCH_TICKLESS_TMR_RATIO  (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC)    /* Ticks per timer tick.        */
+#define  APP_BENCH_TICKLESS_SRC_DLY_7                     0u    /* Wake-up sources, see AppBenchTicklessPeriodTbl[].    */
+#define  APP_BENCH_TICKLESS_SRC_DLY_13                    1u
+#define  APP_BENCH_TICKLESS_SRC_TIMEOUT                   2u
+#define  APP_BENCH_TICKLESS_SRC_TMR                       3u
+#define  APP_BENCH_TICKLESS_SRC_TMR_ONE_SHOT              4u
+#define  APP_BENCH_TICKLESS_SRC_NBR                       5u
+#endif
+
+#if (APP_CFG_BENCH_SIM_EN == DEF_ENABLED)
+#if (OS_CPU_CFG_SIM_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_SIM_EN needs OS_CPU_CFG_SIM_EN enabled (1) in 'os_cfg.h'"
+#endif
+#if (OS_TMR_EN == 0u) || (OS_SEM_EN == 0u) || (OS_SEM_DEL_EN == 0u) || (OS_TASK_DEL_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_SIM_EN needs OS_TMR_EN, OS_SEM_EN, OS_SEM_DEL_EN & OS_TASK_DEL_EN enabled (1) in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_SIM_DLY         (86400u * OS_TICKS_PER_SEC)  /* One day of virtual time, in ticks.                   */
+#define  APP_BENCH_SIM_RUN_NBR                            2u    /* Runs of the workload, compared with each other.      */
+#define  APP_BENCH_SIM_TASK_NBR                           4u
+#define  APP_BENCH_SIM_SRC_PEND                           2u    /* Task pending on the semaphore posted by the timer.   */
+#define  APP_BENCH_SIM_SRC_TMR                            4u
+#define  APP_BENCH_SIM_SRC_TIMEOUT                     0x80u    /* Set for a pend that timed out.                       */
+#endif
+
+#if (APP_CFG_BENCH_EDF_EN == DEF_ENABLED)
+#if (OS_SCHED_EDF_EN == 0u) || (OS_TASK_QUERY_EN == 0u) || (OS_SEM_EN == 0u) || (OS_TASK_DEL_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_EDF_EN needs OS_SCHED_EDF_EN, OS_TASK_QUERY_EN, OS_SEM_EN & OS_TASK_DEL_EN enabled (1) in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_EDF_TASK_NBR                           3u
+#define  APP_BENCH_EDF_DLY            (10u * OS_TICKS_PER_SEC)  /* Duration of each task set's run, in ticks.           */
+#define  APP_BENCH_EDF_GAP_NS                          5000u    /* Longer gaps in a job are preemptions, not work.      */
+#endif
+
+#if (APP_CFG_BENCH_MULTI_EN == DEF_ENABLED)
+#if (OS_MULTI_INST_EN == 0u) || (OS_SEM_EN == 0u) || (OS_TMR_EN == 0u)
+#error  "APP_CFG.H, APP_CFG_BENCH_MULTI_EN needs OS_MULTI_INST_EN, OS_SEM_EN & OS_TMR_EN enabled (1) in 'os_cfg.h'"
+#endif
+#define  APP_BENCH_MULTI_INST_NBR                         4u    /* Kernel instances, one per host thread.               */
+#define  APP_BENCH_MULTI_TASK_NBR                         4u    /* Tasks of each instance.                              */
+#define  APP_BENCH_MULTI_DLY           (5u * OS_TICKS_PER_SEC)  /* Duration of the workload, in ticks.                  */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_STK     AppTaskStartStk[APP_TASK_START_STK_SIZE];
+static  OS_STK     AppTaskPongStk[APP_TASK_PONG_STK_SIZE];
+
+static  OS_EVENT  *AppSemPong;
+
+#if (APP_CFG_BENCH_SMP_EN == DEF_ENABLED)
+static  OS_STK                 AppTaskBenchStk[APP_BENCH_SMP_TASK_NBR][APP_TASK_BENCH_STK_SIZE];
+static  OS_EVENT              *AppBenchSMPSem[APP_BENCH_SMP_TASK_NBR];
+static  OS_EVENT              *AppBenchSMPSemDone;
+static  volatile  CPU_INT64U   AppBenchSMPCtr[APP_BENCH_SMP_TASK_NBR][8];   /* One cache line per task.                 */
+static  volatile  CPU_INT32U   AppBenchSMPWork;
+static  volatile  CPU_BOOLEAN  AppBenchSMPRun;
+#endif
+
+#if (APP_CFG_BENCH_STEAL_EN == DEF_ENABLED)
+static  OS_STK                 AppTaskStealStk[APP_BENCH_STEAL_TASK_NBR][APP_TASK_BENCH_STK_SIZE];
+static  OS_EVENT              *AppBenchStealSemDone;
+static  volatile  CPU_INT64U   AppBenchStealCtr[OS_SMP_CORE_NBR][8];        /* Units of work run on each core.          */
+static  volatile  OS_CORE_MSK  AppBenchStealMsk[APP_BENCH_STEAL_TASK_NBR];  /* Cores each task ran on.                  */
+static  volatile  CPU_BOOLEAN  AppBenchStealRun;
+#endif
+
+#if (APP_CFG_BENCH_FLAG_EN == DEF_ENABLED)
+static  OS_STK                 AppTaskFlagStk[APP_BENCH_FLAG_TASK_NBR][APP_TASK_BENCH_STK_SIZE];
+static  OS_FLAG_GRP  *volatile AppBenchFlagGrp;
+static  OS_EVENT              *AppBenchFlagSemDone;
+static  volatile  OS_FLAGS     AppBenchFlagMsk[APP_BENCH_FLAG_TASK_NBR];   /* Flags each task waits on (all set).       */
+static  volatile  CPU_INT32U   AppBenchFlagCtr;                             /* Number of times the tasks were readied.   */
+static  volatile  CPU_BOOLEAN  AppBenchFlagRun;
+#endif
+
+#if (APP_CFG_BENCH_TICK_EN == DEF_ENABLED)
+static  OS_STK                 AppTaskTickStk[APP_BENCH_TICK_TASK_NBR + 1u][APP_TASK_BENCH_STK_SIZE];
+static  OS_EVENT              *AppBenchTickSem;
+static  OS_EVENT              *AppBenchTickSemDone;
+static  volatile  CPU_BOOLEAN  AppBenchTickRun;
+#endif
+
+#if (APP_CFG_BENCH_CNTZ_EN == DEF_ENABLED)
+static  CPU_INT16U             AppBenchCntZGrp[APP_BENCH_CNTZ_MAP_NBR];     /* Ready groups, as OSRdyGrp.                */
+static  CPU_INT16U             AppBenchCntZTbl[APP_BENCH_CNTZ_MAP_NBR][16]; /* Ready tables, as OSRdyTbl[].              */
+static  volatile  CPU_INT32U   AppBenchCntZSum;                             /* Sum of the priorities found.              */
+#endif
+
+#if (APP_CFG_BENCH_TMR_EN == DEF_ENABLED)
+static  OS_TMR                 AppBenchTmrTbl[APP_BENCH_TMR_NBR];           /* Storage of the timers added to the pool.  */
+static  OS_TMR                *AppBenchTmrRun[APP_BENCH_TMR_NBR];              /* Timers running.                           */
+static  volatile  CPU_INT32U   AppBenchTmrCtr;                              /* Number of expiries.                       */
+#endif
+
+#if (APP_CFG_BENCH_QV_EN == DEF_ENABLED)
+static  CPU_INT64U             AppBenchQVStorage[APP_BENCH_QV_MSG_NBR][APP_BENCH_QV_MSG_SIZE_MAX / 8u];
+static  CPU_INT64U             AppBenchQVPart[APP_BENCH_QV_MSG_NBR][APP_BENCH_QV_MSG_SIZE_MAX / 8u];
+static  void                  *AppBenchQVQTbl[APP_BENCH_QV_MSG_NBR];
+static  OS_MEM                *AppBenchQVMem;                               /* Partition of the pointer queue's messages.*/
+static  volatile  CPU_INT32U   AppBenchQVSum;                               /* Sum of the bytes received.                */
+#endif
+
+#if (APP_CFG_BENCH_THRESHOLD_EN == DEF_ENABLED)
+static  OS_STK                 AppTaskThresholdStk[3][APP_TASK_BENCH_STK_SIZE];
+static  void                  *AppBenchThresholdQTbl[2][APP_BENCH_THRESHOLD_DEPTH];
+static  OS_EVENT              *AppBenchThresholdQ[2];                       /* Producer to filter, filter to consumer.   */
+static  OS_EVENT              *AppBenchThresholdSemSlot;                    /* Bounds the messages in flight.            */
+static  OS_EVENT              *AppBenchThresholdSemDone;
+static  volatile  CPU_INT32U   AppBenchThresholdErrCtr;                     /* Messages received out of order.           */
+#endif
+
+#if (APP_CFG_BENCH_ISR_EN == DEF_ENABLED)
+static  OS_STK                 AppTaskIsrStk[APP_BENCH_ISR_TASK_NBR + 1u][APP_TASK_BENCH_STK_SIZE];
+static  OS_EVENT              *AppBenchIsrMbox;                             /* Mailbox the ISR broadcasts to.            */
+static  OS_EVENT              *AppBenchIsrSemDone;
+static  volatile  CPU_INT32U   AppBenchIsrCtr;                              /* Number of times the tasks were readied.   */
+static  volatile  CPU_INT64U   AppBenchIsrTime;                             /* Duration of the last ISR, in nanoseconds. */
+static  CPU_INT64U             AppBenchIsrTimeTbl[APP_BENCH_ISR_ROUNDS];    /* ISR durations of a measurement.           */
+static  CPU_INT64U             AppBenchIsrDisTbl[APP_BENCH_ISR_ROUNDS];     /* Longest ints disabled, per broadcast.     */
+#endif
+
+#if (APP_CFG_BENCH_TICKLESS_EN == DEF_ENABLED)
+static  const  INT32U          AppBenchTicklessPeriodTbl[APP_BENCH_TICKLESS_SRC_NBR] = {
+    7u, 13u, 11u, 3u, 5u                                                    /* In ticks, in timer ticks for the timers.  */
+};
+static  OS_STK                 AppTaskTicklessStk[3][APP_TASK_BENCH_STK_SIZE];
+static  OS_EVENT              *AppBenchTicklessSem;                         /* Never posted, pended on with a timeout.   */
+static  OS_EVENT              *AppBenchTicklessSemDone;
+static  INT32U                 AppBenchTicklessTmrNext[APP_BENCH_TICKLESS_SRC_NBR];   /* Next expiry of each timer.  */
+static  volatile  CPU_INT32U   AppBenchTicklessWakeCtr[APP_BENCH_TICKLESS_SRC_NBR];
+static  volatile  CPU_INT32U   AppBenchTicklessErrCtr;                      /* Wake-ups at an unexpected tick.           */
+static  volatile  CPU_BOOLEAN  AppBenchTicklessRun;
+#endif
+
+#if (APP_CFG_BENCH_SIM_EN == DEF_ENABLED)
+static  const  INT32U          AppBenchSimPeriodTbl[APP_BENCH_SIM_TASK_NBR] = {
+    7u, 13u, 11u, OS_TICKS_PER_SEC                                          /* Delay or pend timeout of each task.       */
+};
+static  OS_STK                 AppTaskSimStk[APP_BENCH_SIM_TASK_NBR][APP_TASK_BENCH_STK_SIZE];
+static  OS_EVENT              *AppBenchSimSem;
+static  OS_EVENT              *AppBenchSimSemDone;
+static  INT32U                 AppBenchSimTickStart;
+static  CPU_INT64U             AppBenchSimHash;                             /* Hash of the events of the current run.    */
+static  CPU_INT32U             AppBenchSimEvtCtr;
+static  volatile  CPU_BOOLEAN  AppBenchSimRun;
+#endif
+
+#if (APP_CFG_BENCH_EDF_EN == DEF_ENABLED)
+static  const  INT32U          AppBenchEdfPeriodTbl[APP_BENCH_EDF_TASK_NBR] = {
+    20u, 30u, 50u                                                           /* In ticks.                                 */
+};
+static  const  CPU_INT32U      AppBenchEdfUtilTbl[APP_BENCH_EDF_TASK_NBR] = {
+    10u, 15u, 25u                                                           /* Share of the CPU, in %.                   */
+};
+static  OS_STK                 AppTaskEdfStk[APP_BENCH_EDF_TASK_NBR][APP_TASK_BENCH_STK_SIZE];
+static  OS_EVENT              *AppBenchEdfSemDone;
+static  CPU_INT64U             AppBenchEdfWork[APP_BENCH_EDF_TASK_NBR];     /* Run time of each job, in nanoseconds.     */
+static  volatile  CPU_INT32U   AppBenchEdfJobCtr[APP_BENCH_EDF_TASK_NBR];
+static  volatile  CPU_INT32U   AppBenchEdfMissCtr[APP_BENCH_EDF_TASK_NBR];
+static  volatile  CPU_BOOLEAN  AppBenchEdfRun;
+#endif
+
+#if (APP_CFG_BENCH_MULTI_EN == DEF_ENABLED)
+typedef  struct  app_bench_multi {
+    OS_KERNEL                  Kernel;                                      /* MUST be first (see AppBenchMultiEvt()).   */
+    OS_STK                     Stk[APP_BENCH_MULTI_TASK_NBR][APP_TASK_BENCH_STK_SIZE];
+    OS_EVENT                  *Sem;
+    CPU_INT64U                 Trace;                                       /* Hash of the events & their ticks.         */
+    CPU_INT32U                 EvtCtr;
+    INT32U                     Ticks;                                       /* Ticks counted at the end of the workload. */
+    CPU_BOOLEAN                Done;
+} APP_BENCH_MULTI;
+
+static  APP_BENCH_MULTI        AppBenchMultiTbl[APP_BENCH_MULTI_INST_NBR];
+static  sem_t                  AppBenchMultiDone;                           /* Posted by each instance once done.        */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        AppTaskStart(void  *p_arg);
+static  void        AppTaskPong (void  *p_arg);
+
+static  CPU_INT64U  AppCtxSwMeas(CPU_BOOLEAN  sw);
+
+#if (APP_CFG_BENCH_SMP_EN == DEF_ENABLED)
+static  void        AppBenchSMP      (void);
+static  CPU_INT64U  AppBenchSMPMeas  (CPU_INT08U   core_nbr);
+static  void        AppTaskBenchSMP  (void        *p_arg);
+#endif
+
+#if (APP_CFG_BENCH_STEAL_EN == DEF_ENABLED)
+static  void        AppBenchSteal    (void);
+static  CPU_BOOLEAN AppBenchStealRdyChk(void);
+static  void        AppTaskBenchSteal(void        *p_arg);
+#endif
+
+#if (APP_CFG_BENCH_FLAG_EN == DEF_ENABLED)
+static  void        AppBenchFlag     (void);
+static  void        AppBenchFlagGrpNew(void);
+static  void        AppBenchFlagMeas (CPU_CHAR    *p_name,
+                                      OS_FLAGS     flags);
+static  void        AppTaskBenchFlag (void        *p_arg);
+#endif
+
+#if (APP_CFG_BENCH_TICK_EN == DEF_ENABLED)
+static  void        AppBenchTick     (void);
+static  CPU_INT64U  AppBenchTickMeas (void);
+static  void        AppTaskBenchTick (void        *p_arg);
+#endif
+
+#if (APP_CFG_BENCH_CNTZ_EN == DEF_ENABLED)
+static  void        AppBenchCntZ     (void);
+static  CPU_INT64U  AppBenchCntZMeas (CPU_BOOLEAN  cnt_zeros,
+                                      CPU_BOOLEAN  prio_256);
+#endif
+
+#if (APP_CFG_BENCH_TMR_EN == DEF_ENABLED)
+static  void        AppBenchTmr      (void);
+static  void        AppBenchTmrMeas  (CPU_INT32U   tmr_nbr);
+static  void        AppBenchTmrCallback(void      *ptmr,
+                                        void      *p_arg);
+#endif
+
+#if (APP_CFG_BENCH_QV_EN == DEF_ENABLED)
+static  void        AppBenchQV       (void);
+static  CPU_INT64U  AppBenchQVMeas   (CPU_INT16U   msg_size);
+static  CPU_INT64U  AppBenchQVCopyMeas(CPU_INT16U  msg_size);
+static  CPU_INT64U  AppBenchQMeas    (CPU_INT16U   msg_size);
+#endif
+
+#if (APP_CFG_BENCH_THRESHOLD_EN == DEF_ENABLED)
+static  void        AppBenchThreshold(void);
+static  void        AppBenchThresholdMeas(CPU_BOOLEAN  thres);
+static  void        AppTaskBenchThresholdProducer(void  *p_arg);
+static  void        AppTaskBenchThresholdFilter  (void  *p_arg);
+static  void        AppTaskBenchThresholdConsumer(void  *p_arg);
+#endif
+
+#if (APP_CFG_BENCH_ISR_EN == DEF_ENABLED)
+static  void        AppBenchIsr      (void);
+static  void        AppBenchIsrISR   (void);
+static  void        AppTaskBenchIsr  (void        *p_arg);
+static  void        AppTaskBenchIsrWait(void      *p_arg);
+static  CPU_INT64U  AppBenchIsrMedian(CPU_INT64U  *p_tbl);
+#endif
+
+#if (APP_CFG_BENCH_TICKLESS_EN == DEF_ENABLED)
+static  void        AppBenchTickless (void);
+static  void        AppBenchTicklessChk(CPU_INT08U  src,
+                                        INT32U      tick_expected);
+static  void        AppBenchTicklessTmrCallback(void  *ptmr,
+                                                void  *p_arg);
+static  void        AppTaskBenchTicklessDly (void  *p_arg);
+static  void        AppTaskBenchTicklessPend(void  *p_arg);
+#endif
+
+#if (APP_CFG_BENCH_SIM_EN == DEF_ENABLED)
+static  void        AppBenchSim      (void);
+static  void        AppBenchSimEvt   (CPU_INT08U  src);
+static  void        AppBenchSimTmrCallback(void  *ptmr,
+                                           void  *p_arg);
+static  void        AppTaskBenchSim  (void  *p_arg);
+#endif
+
+#if (APP_CFG_BENCH_EDF_EN == DEF_ENABLED)
+static  void        AppBenchEdf      (void);
+static  void        AppTaskBenchEdf  (void  *p_arg);
+#endif
+
+#if (APP_CFG_BENCH_MULTI_EN == DEF_ENABLED)
+static  void        AppBenchMulti    (void);
+static  void       *AppBenchMultiThread(void      *p_arg);
+static  void        AppBenchMultiEvt (CPU_INT08U   id);
+static  void        AppBenchMultiTmrCallback(void *ptmr,
+                                             void *p_arg);
+static  void        AppTaskBenchMulti(void        *p_arg);
+static  void        AppTaskBenchMultiDly(void     *p_arg);
+static  void        AppTaskBenchMultiPend(void    *p_arg);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                                main()
+*
+* Description : This is the standard entry point for C code.  It is assumed that your code will call
+*               main() once you have performed all necessary initialization.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    setvbuf(stdout, (char *)0, _IOLBF, 0u);                     /* Print each trace line at once, even through a pipe.  */
+
+#if (APP_CFG_BENCH_MULTI_EN == DEF_ENABLED)
+    AppBenchMulti();                                            /* See 'app.c  Note #4'.                                */
+#endif
+
+    OSInit();                                                   /* Init uC/OS-II.                                       */
+
+    OSTaskCreateExt((void(*)(void *))AppTaskStart,              /* Create the start task                                */
+        (void          *) 0,
+        (OS_STK        *)&AppTaskStartStk[APP_TASK_START_STK_SIZE - 1],
+        (INT8U          ) APP_TASK_START_PRIO,
+        (INT16U         ) APP_TASK_START_PRIO,
+        (OS_STK        *)&AppTaskStartStk[0],
+        (INT32U         ) APP_TASK_START_STK_SIZE,
+        (void          *) 0,
+        (INT16U         )(OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR));
+
+    OSStart();                                                  /* Start multitasking (i.e. give control to uC/OS-II).  */
+
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          STARTUP TASK
+*
+* Description : This is an example of a startup task.  As mentioned in the book's text, you MUST
+*               initialize the ticker only once multitasking has started.
+*
+* Argument(s) : p_arg       is the argument passed to 'AppTaskStart()' by 'OSTaskCreate()'.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The first line of code is used to prevent a compiler warning because 'p_arg' is not
+*                   used.  The compiler should not generate any code for this statement.
+*
+*               (2) See 'app.c  Note #1'.
+*
+*               (3) See 'app.c  Note #2'.
+*
+*               (4) See 'app.c  Note #3'.
+*********************************************************************************************************
+*/
+
+static  void  AppTaskStart (void *p_arg)
+{
+    CPU_INT64U  ovrhd;
+    CPU_INT64U  total;
+
+
+   (void)p_arg;
+
+    BSP_Init();                                                 /* Initialize BSP functions                             */
+    CPU_Init();                                                 /* Initialize uC/CPU services                           */
+
+#if OS_TASK_STAT_EN > 0u
+    OSStatInit();                                               /* Compute CPU capacity with no task running            */
+#endif
+
+#if (OS_SMP_EN > 0u)
+    (void)OSTaskAffinitySet(OS_PRIO_SELF, 1u);                  /* See Note #4.                                         */
+#endif
+
+    AppSemPong = OSSemCreate(0u);
+
+    OSTaskCreateExt((void(*)(void *))AppTaskPong,
+        (void          *) 0,
+        (OS_STK        *)&AppTaskPongStk[APP_TASK_PONG_STK_SIZE - 1],
+        (INT8U          ) APP_TASK_PONG_PRIO,
+        (INT16U         ) APP_TASK_PONG_PRIO,
+        (OS_STK        *)&AppTaskPongStk[0],
+        (INT32U         ) APP_TASK_PONG_STK_SIZE,
+        (void          *) 0,
+        (INT16U         )(OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR));
+#if (OS_SMP_EN > 0u)
+    (void)OSTaskAffinitySet(APP_TASK_PONG_PRIO, 1u);
+#endif
+
+    APP_TRACE_INFO(("uCOS-II is Running...\n"));
+
+#if (APP_CFG_BENCH_SMP_EN == DEF_ENABLED)                       /* See Note #3.                                         */
+    AppBenchSMP();
+#endif
+#if (APP_CFG_BENCH_STEAL_EN == DEF_ENABLED)
+    AppBenchSteal();
+#endif
+#if (APP_CFG_BENCH_FLAG_EN == DEF_ENABLED)
+    AppBenchFlag();
+#endif
+#if (APP_CFG_BENCH_TICK_EN == DEF_ENABLED)
+    AppBenchTick();
+#endif
+#if (APP_CFG_BENCH_CNTZ_EN == DEF_ENABLED)
+    AppBenchCntZ();
+#endif
+#if (APP_CFG_BENCH_TMR_EN == DEF_ENABLED)
+    AppBenchTmr();
+#endif
+#if (APP_CFG_BENCH_QV_EN == DEF_ENABLED)
+    AppBenchQV();
+#endif
+#if (APP_CFG_BENCH_THRESHOLD_EN == DEF_ENABLED)
+    AppBenchThreshold();
+#endif
+#if (APP_CFG_BENCH_ISR_EN == DEF_ENABLED)
+    AppBenchIsr();
+#endif
+#if (APP_CFG_BENCH_TICKLESS_EN == DEF_ENABLED)
+    AppBenchTickless();
+#endif
+#if (APP_CFG_BENCH_SIM_EN == DEF_ENABLED)
+    AppBenchSim();
+#endif
+#if (APP_CFG_BENCH_EDF_EN == DEF_ENABLED)
+    AppBenchEdf();
+#endif
+
+    while (DEF_ON) {                                            /* Task body, always written as an infinite loop.       */
+        ovrhd = AppCtxSwMeas(DEF_NO);                           /* See Note #2.                                         */
+        total = AppCtxSwMeas(DEF_YES);
+        if (total < ovrhd) {
+            total = ovrhd;
+        }
+
+        APP_TRACE_INFO(("Context switch: %4u ns (post + pend: %4u ns, round trip: %4u ns)\n",
+                        (unsigned)((total - ovrhd) / 2u),
+                        (unsigned) ovrhd,
+                        (unsigned) total));
+
+        OSTimeDlyHMSM(0u, 0u, 1u, 0u);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                              PONG TASK
+*
+* Description : This task waits on the semaphore posted by the start task.
+*
+* Argument(s) : p_arg       is the argument passed to 'AppTaskPong()' by 'OSTaskCreateExt()'.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+static  void  AppTaskPong (void *p_arg)
+{
+    INT8U  err;
+
+
+   (void)p_arg;
+
+    while (DEF_ON) {
+        OSSemPend(AppSemPong, 0u, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MEASURE CONTEXT SWITCH TIME
+*
+* Description : Times APP_CTX_SW_ROUNDS rounds of the context switch benchmark.
+*
+* Argument(s) : sw          DEF_YES, to post the semaphore 'AppTaskPong()' waits on (two context switches).
+*
+*                           DEF_NO,  to post & accept a semaphore no task waits on (no context switch).
+*
+* Return(s)   : Average time of one round, in nanoseconds.
+*
+* Note(s)     : (1) The CPU timestamp timer counts nanoseconds (see 'cpu_bsp.c  CPU_TS_TmrInit()').
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  AppCtxSwMeas (CPU_BOOLEAN  sw)
+{
+    OS_EVENT   *p_sem;
+    CPU_INT32U  i;
+    CPU_TS64    ts_start;
+    CPU_TS64    ts_end;
+    INT8U       err;
+
+
+    if (sw == DEF_YES) {
+        p_sem = AppSemPong;
+    } else {
+        p_sem = OSSemCreate(0u);
+    }
+
+    ts_start = CPU_TS_Get64();
+    for (i = 0u; i < APP_CTX_SW_ROUNDS; i++) {
+        (void)OSSemPost(p_sem);
+        if (sw == DEF_NO) {
+            (void)OSSemAccept(p_sem);
+        }
+    }
+    ts_end = CPU_TS_Get64();
+
+    if (sw == DEF_NO) {
+        (void)OSSemDel(p_sem, OS_DEL_ALWAYS, &err);
+    }
+
+    return ((ts_end - ts_start) / APP_CTX_SW_ROUNDS);           /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                     MULTI-CORE SCALING BENCHMARK
+*
+* Description : Measures the throughput of one busy task per core as the tasks are allowed on 1, 2, ...
+*               OS_SMP_CORE_NBR cores.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Each unit of work is a loop of 'AppBenchSMPWork' iterations, then a post & accept of the
+*                   task's own semaphore, which takes the kernel's spinlock twice :
+*
+*                   (a) Kernel-bound units (no loop) measure the cost of the spinlock : they cannot scale.
+*                   (b) Compute-bound units (APP_BENCH_SMP_WORK iterations) scale with the number of host
+*                       CPUs, up to the number of cores.
+*
+*               (2) Tasks do not share priorities, so of the tasks on one core only the highest priority
+*                   one runs : the throughput is that of one task per core allowed.
+*
+*               (3) Measured on the development host, which has a single CPU, with OS_SMP_CORE_NBR = 4 :
+*
+*                                  1 core       2 cores      3 cores      4 cores
+*                   kernel-bound   34.2 M/s     32.9 M/s     30.5 M/s     30.1 M/s     units per second
+*                   compute-bound  0.207 M/s    0.211 M/s    0.205 M/s    0.196 M/s
+*
+*                   The cores share the one host CPU, so compute-bound work cannot scale there (the runs
+*                   vary by 10 %).  Running 2 to 4 cores costs up to 15 % of the kernel-bound throughput, for
+*                   the spinlock & the inter-processor interrupts.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_SMP_EN == DEF_ENABLED)
+static  void  AppBenchSMP (void)
+{
+    CPU_INT64U  rate;
+    CPU_INT64U  rate_one;
+    CPU_INT08U  core_nbr;
+    CPU_INT08U  i;
+    CPU_INT08U  pass;
+    INT8U       err;
+
+
+    AppBenchSMPRun     = DEF_TRUE;
+    AppBenchSMPSemDone = OSSemCreate(0u);
+    for (i = 0u; i < APP_BENCH_SMP_TASK_NBR; i++) {
+        AppBenchSMPSem[i] = OSSemCreate(0u);
+        OSTaskCreateExt((void(*)(void *))AppTaskBenchSMP,
+            (void          *)(CPU_ADDR)i,
+            (OS_STK        *)&AppTaskBenchStk[i][APP_TASK_BENCH_STK_SIZE - 1],
+            (INT8U          )(APP_TASK_BENCH_PRIO + i),
+            (INT16U         )(APP_TASK_BENCH_PRIO + i),
+            (OS_STK        *)&AppTaskBenchStk[i][0],
+            (INT32U         ) APP_TASK_BENCH_STK_SIZE,
+            (void          *) 0,
+            (INT16U         ) OS_TASK_OPT_STK_CHK);
+    }
+
+    for (pass = 0u; pass < 2u; pass++) {                        /* See Note #1.                                         */
+        AppBenchSMPWork = (pass == 0u) ? 0u : APP_BENCH_SMP_WORK;
+        rate_one        = 1u;
+        for (core_nbr = 1u; core_nbr <= OS_SMP_CORE_NBR; core_nbr++) {
+            rate = AppBenchSMPMeas(core_nbr);
+            if (core_nbr == 1u) {
+                rate_one = (rate > 0u) ? rate : 1u;
+            }
+            APP_TRACE_INFO(("SMP %s: %2u core(s) %10llu units/s (x%u.%02u)\n",
+                            (pass == 0u) ? "kernel-bound " : "compute-bound",
+                            (unsigned)core_nbr,
+                            (unsigned long long)rate,
+                            (unsigned)( rate * 100u / rate_one) / 100u,
+                            (unsigned)((rate * 100u / rate_one) % 100u)));
+        }
+    }
+
+    AppBenchSMPRun = DEF_FALSE;                                 /* Stop & wait for all the tasks to delete themselves.  */
+    for (i = 0u; i < APP_BENCH_SMP_TASK_NBR; i++) {
+        OSSemPend(AppBenchSMPSemDone, 0u, &err);
+    }
+    OSTimeDly(1u);
+    for (i = 0u; i < APP_BENCH_SMP_TASK_NBR; i++) {
+        (void)OSSemDel(AppBenchSMPSem[i], OS_DEL_ALWAYS, &err);
+    }
+    (void)OSSemDel(AppBenchSMPSemDone, OS_DEL_ALWAYS, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      MEASURE MULTI-CORE THROUGHPUT
+*
+* Description : Allows the benchmark tasks on the first 'core_nbr' cores & measures their throughput.
+*
+* Argument(s) : core_nbr    Number of cores allowed.
+*
+* Return(s)   : Units of work per second, all tasks included.
+*
+* Note(s)     : (1) The tasks move to the cores allowed, or are stolen by idle cores, within a tick.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_SMP_EN == DEF_ENABLED)
+static  CPU_INT64U  AppBenchSMPMeas (CPU_INT08U  core_nbr)
+{
+    CPU_INT64U  ctr_start;
+    CPU_INT64U  ctr_end;
+    CPU_TS64    ts_start;
+    CPU_TS64    ts_end;
+    CPU_INT08U  i;
+
+
+    for (i = 0u; i < APP_BENCH_SMP_TASK_NBR; i++) {
+        (void)OSTaskAffinitySet(APP_TASK_BENCH_PRIO + i, (OS_CORE_MSK)((1uL << core_nbr) - 1u));
+    }
+    OSTimeDly(2u);                                              /* See Note #1.                                         */
+
+    ctr_start = 0u;
+    for (i = 0u; i < APP_BENCH_SMP_TASK_NBR; i++) {
+        ctr_start += AppBenchSMPCtr[i][0];
+    }
+    ts_start = CPU_TS_Get64();
+
+    OSTimeDly(APP_BENCH_SMP_DLY);
+
+    ctr_end = 0u;
+    for (i = 0u; i < APP_BENCH_SMP_TASK_NBR; i++) {
+        ctr_end += AppBenchSMPCtr[i][0];
+    }
+    ts_end = CPU_TS_Get64();
+
+    return ((ctr_end - ctr_start) * 1000000000u / (ts_end - ts_start));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     MULTI-CORE BENCHMARK TASK
+*
+* Description : This task counts units of work until the benchmark ends (see AppBenchSMP()).
+*
+* Argument(s) : p_arg       is the index of the task.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_SMP_EN == DEF_ENABLED)
+static  void  AppTaskBenchSMP (void *p_arg)
+{
+    CPU_INT32U           ix;
+    volatile  CPU_INT32U i;
+
+
+    ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+    while (AppBenchSMPRun == DEF_TRUE) {
+        for (i = 0u; i < AppBenchSMPWork; i++) {
+            ;
+        }
+        (void)OSSemPost(AppBenchSMPSem[ix]);
+        (void)OSSemAccept(AppBenchSMPSem[ix]);
+        AppBenchSMPCtr[ix][0]++;
+    }
+
+    (void)OSSemPost(AppBenchSMPSemDone);
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        TASK STEALING BENCHMARK
+*
+* Description : Creates all the tasks on core 0 & checks that the idle cores steal them.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The tasks are first moved to core 0 & their records cleared.  They are then allowed on
+*                   every core, which does not move them : only stealing can (see 'os_core.c
+*                   OS_SchedSteal()').
+*
+*               (2) Each task delays one tick every APP_BENCH_STEAL_UNITS units of work, so that the tasks
+*                   keep entering & leaving the ready lists while the cores steal them.
+*
+*               (3) The test passes if :
+*
+*                   (a) Every core ran units of work.
+*                   (b) The cores stole tasks (OSCoreStealCtr).
+*                   (c) The last task, kept on core 0, never ran on another core.
+*                   (d) The count of ready tasks of each core always matched its ready list.
+*
+*               (4) Measured on the development host with OS_SMP_CORE_NBR = 4, 8 tasks :
+*
+*                   Steal: units per core 11410 6635 6886 6746, tasks run on several cores 6/7,
+*                          steals 234, migrations 242 -> PASS
+*
+*                   The 8 other migrations are the moves to core 0.  The highest priority task keeps core 0
+*                   & is never stolen.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_STEAL_EN == DEF_ENABLED)
+static  void  AppBenchSteal (void)
+{
+    CPU_INT32U   steal_ctr;
+    CPU_INT32U   migrate_ctr;
+    CPU_INT08U   multi_ctr;
+    CPU_INT08U   core;
+    CPU_INT08U   i;
+    CPU_BOOLEAN  pass;
+    INT8U        err;
+
+
+    AppBenchStealRun     = DEF_TRUE;
+    AppBenchStealSemDone = OSSemCreate(0u);
+    steal_ctr            = 0u;                                  /* Earlier benchmarks may have moved tasks too.         */
+    migrate_ctr          = 0u;
+    for (core = 0u; core < OS_SMP_CORE_NBR; core++) {
+        steal_ctr   -= OSCoreTbl[core].OSCoreStealCtr;
+        migrate_ctr -= OSCoreTbl[core].OSCoreMigrateCtr;
+    }
+    for (i = 0u; i < APP_BENCH_STEAL_TASK_NBR; i++) {           /* See Note #1.                                         */
+        OSTaskCreateExt((void(*)(void *))AppTaskBenchSteal,
+            (void          *)(CPU_ADDR)i,
+            (OS_STK        *)&AppTaskStealStk[i][APP_TASK_BENCH_STK_SIZE - 1],
+            (INT8U          )(APP_TASK_BENCH_PRIO + i),
+            (INT16U         )(APP_TASK_BENCH_PRIO + i),
+            (OS_STK        *)&AppTaskStealStk[i][0],
+            (INT32U         ) APP_TASK_BENCH_STK_SIZE,
+            (void          *) 0,
+            (INT16U         ) OS_TASK_OPT_STK_CHK);
+        (void)OSTaskAffinitySet(APP_TASK_BENCH_PRIO + i, 1u);
+    }
+    OSTimeDly(2u);
+    for (core = 0u; core < OS_SMP_CORE_NBR; core++) {
+        AppBenchStealCtr[core][0] = 0u;
+    }
+    for (i = 0u; i < APP_BENCH_STEAL_TASK_NBR; i++) {
+        AppBenchStealMsk[i] = 0u;
+    }
+    for (i = 0u; i < APP_BENCH_STEAL_TASK_NBR - 1u; i++) {
+        (void)OSTaskAffinitySet(APP_TASK_BENCH_PRIO + i, OS_CORE_MSK_ALL);
+    }
+
+    pass = DEF_OK;
+    for (i = 0u; i < APP_BENCH_STEAL_DLY; i++) {                /* See Note #3d.                                        */
+        OSTimeDly(1u);
+        if (AppBenchStealRdyChk() != DEF_OK) {
+            pass = DEF_FAIL;
+        }
+    }
+
+    AppBenchStealRun = DEF_FALSE;                               /* Stop & wait for all the tasks to delete themselves.  */
+    for (i = 0u; i < APP_BENCH_STEAL_TASK_NBR; i++) {
+        OSSemPend(AppBenchStealSemDone, 0u, &err);
+    }
+    OSTimeDly(1u);
+    (void)OSSemDel(AppBenchStealSemDone, OS_DEL_ALWAYS, &err);
+
+    APP_TRACE_INFO(("Steal: units per core"));
+    for (core = 0u; core < OS_SMP_CORE_NBR; core++) {
+        APP_TRACE_INFO((" %llu", (unsigned long long)AppBenchStealCtr[core][0]));
+        if (AppBenchStealCtr[core][0] == 0u) {                  /* See Note #3a.                                        */
+            pass = DEF_FAIL;
+        }
+    }
+    for (core = 0u; core < OS_SMP_CORE_NBR; core++) {
+        steal_ctr   += OSCoreTbl[core].OSCoreStealCtr;
+        migrate_ctr += OSCoreTbl[core].OSCoreMigrateCtr;
+    }
+    multi_ctr = 0u;
+    for (i = 0u; i < APP_BENCH_STEAL_TASK_NBR - 1u; i++) {
+        if ((AppBenchStealMsk[i] & (AppBenchStealMsk[i] - 1u)) != 0u) {
+            multi_ctr++;
+        }
+    }
+    if ((steal_ctr == 0u) ||                                    /* See Note #3b.                                        */
+        (AppBenchStealMsk[APP_BENCH_STEAL_TASK_NBR - 1u] != 1u)) {  /* See Note #3c.                                    */
+        pass = DEF_FAIL;
+    }
+    APP_TRACE_INFO((", tasks run on several cores %u/%u, steals %u, migrations %u -> %s\n",
+                    (unsigned)multi_ctr,
+                    (unsigned)(APP_BENCH_STEAL_TASK_NBR - 1u),
+                    (unsigned)steal_ctr,
+                    (unsigned)migrate_ctr,
+                    (pass == DEF_OK) ? "PASS" : "FAIL"));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       CHECK READY TASK COUNTS
+*
+* Description : Checks that the count of ready tasks of each core matches its ready list.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if all the counts match,
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The ready lists are read in a critical section, which holds the kernel's spinlock.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_STEAL_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppBenchStealRdyChk (void)
+{
+    CPU_INT32U   rdy_ctr;
+    CPU_INT08U   core;
+    CPU_INT32U   y;
+    CPU_BOOLEAN  ok;
+    OS_CPU_SR    cpu_sr = 0u;
+
+
+    ok = DEF_OK;
+    OS_ENTER_CRITICAL();                                        /* See Note #1.                                         */
+    for (core = 0u; core < OS_SMP_CORE_NBR; core++) {
+        rdy_ctr = 0u;
+        for (y = 0u; y < OS_RDY_TBL_SIZE; y++) {
+            rdy_ctr += (CPU_INT32U)__builtin_popcountll((unsigned long long)OSCoreTbl[core].OSCoreRdyTbl[y]);
+        }
+        if (rdy_ctr != OSCoreTbl[core].OSCoreRdyCtr) {
+            ok = DEF_FAIL;
+        }
+    }
+    OS_EXIT_CRITICAL();
+
+    return (ok);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      TASK STEALING BENCHMARK TASK
+*
+* Description : This task runs units of work & records the cores it runs on until the benchmark ends (see
+*               AppBenchSteal()).
+*
+* Argument(s) : p_arg       is the index of the task.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_STEAL_EN == DEF_ENABLED)
+static  void  AppTaskBenchSteal (void *p_arg)
+{
+    CPU_INT32U           ix;
+    CPU_INT32U           units;
+    INT8U                core;
+    volatile  CPU_INT32U i;
+
+
+    ix    = (CPU_INT32U)(CPU_ADDR)p_arg;
+    units = 0u;
+    while (AppBenchStealRun == DEF_TRUE) {
+        for (i = 0u; i < APP_BENCH_STEAL_WORK; i++) {
+            ;
+        }
+        core                    = OS_CPU_CoreIdGet();
+        AppBenchStealMsk[ix]   |= (OS_CORE_MSK)1u << core;
+        AppBenchStealCtr[core][0]++;
+        units++;
+        if (units >= APP_BENCH_STEAL_UNITS) {                   /* See 'AppBenchSteal()  Note #2'.                      */
+            units = 0u;
+            OSTimeDly(1u);
+        }
+    }
+
+    (void)OSSemPost(AppBenchStealSemDone);
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        EVENT FLAG POST BENCHMARK
+*
+* Description : Times OSFlagPost() on a group that 200 tasks wait on, for posts that ready a few or most
+*               of the tasks, or none of them.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) All the tasks wait for all of their flags to be set (OS_FLAG_WAIT_SET_ALL) :
+*
+*                   (a) With 2 combinations, one task waits on 0x8000 & the others on 0x0003.
+*                   (b) With 200 combinations, task 'n' waits on the flags 'n + 1', so that a post of 0x0080
+*                       readies one task but intersects the flags of half of them.
+*
+*               (2) Each post is timed alone, then undone by clearing the flags.  The tasks readied pend
+*                   again during the tick that separates two posts.
+*
+*               (3) Measured on the development host, average time of one post :
+*
+*                                                       OS_FLAG_INDEX_EN = 1   OS_FLAG_INDEX_EN = 0
+*                     2 combinations,   post readies 1          1.2 us                42.1 us
+*                     2 combinations,   post readies 199       36.1 us                38.7 us
+*                     2 combinations,   post readies none       0.5 us                44.4 us
+*                     200 combinations, post readies 1          1.7 us                44.6 us
+*
+*                   The post costs the tasks it readies, whatever the number of combinations : each
+*                   bucket watches the lowest of its flags, so that a post of 0x0080 only visits the
+*                   bucket of 0x0080 (see 'os_flag.c  OSFlagPost()  Note #1a').  Without the index, it
+*                   walks all the tasks.  The runs vary by 15 %, by 30 % from day to day.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_FLAG_EN == DEF_ENABLED)
+static  void  AppBenchFlag (void)
+{
+    CPU_INT32U  i;
+    INT8U       err;
+
+
+    AppBenchFlagRun     = DEF_TRUE;
+    AppBenchFlagSemDone = OSSemCreate(0u);
+    AppBenchFlagGrp     = OSFlagCreate(0u, &err);
+    for (i = 0u; i < APP_BENCH_FLAG_TASK_NBR; i++) {            /* See Note #1a.                                        */
+        AppBenchFlagMsk[i] = (i == 0u) ? 0x8000u : 0x0003u;
+        OSTaskCreateExt((void(*)(void *))AppTaskBenchFlag,
+            (void          *)(CPU_ADDR)i,
+            (OS_STK        *)&AppTaskFlagStk[i][APP_TASK_BENCH_STK_SIZE - 1],
+            (INT8U          ) APP_TASK_BENCH_PRIO,
+            (INT16U         )(APP_TASK_BENCH_PRIO + i),
+            (OS_STK        *)&AppTaskFlagStk[i][0],
+            (INT32U         ) APP_TASK_BENCH_STK_SIZE,
+            (void          *) 0,
+            (INT16U         ) OS_TASK_OPT_STK_CHK);
+    }
+    OSTimeDly(1u);
+
+    AppBenchFlagMeas((CPU_CHAR *)"2 combinations,   post readies 1   ", 0x8000u);
+    AppBenchFlagMeas((CPU_CHAR *)"2 combinations,   post readies 199 ", 0x0003u);
+    AppBenchFlagMeas((CPU_CHAR *)"2 combinations,   post readies none", 0x0010u);
+
+    for (i = 0u; i < APP_BENCH_FLAG_TASK_NBR; i++) {            /* See Note #1b.                                        */
+        AppBenchFlagMsk[i] = (OS_FLAGS)(i + 1u);
+    }
+    AppBenchFlagGrpNew();
+    AppBenchFlagMeas((CPU_CHAR *)"200 combinations, post readies 1   ", 0x0080u);
+
+    AppBenchFlagRun = DEF_FALSE;                                /* Stop & wait for all the tasks to delete themselves.  */
+    (void)OSFlagDel(AppBenchFlagGrp, OS_DEL_ALWAYS, &err);
+    for (i = 0u; i < APP_BENCH_FLAG_TASK_NBR; i++) {
+        OSSemPend(AppBenchFlagSemDone, 0u, &err);
+    }
+    OSTimeDly(1u);
+    (void)OSSemDel(AppBenchFlagSemDone, OS_DEL_ALWAYS, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      REPLACE EVENT FLAG GROUP
+*
+* Description : Moves the benchmark tasks to a new event flag group, so that they pend on the flags now in
+*               'AppBenchFlagMsk[]'.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Deleting the old group aborts the tasks' pends.  They pend again on the new group.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_FLAG_EN == DEF_ENABLED)
+static  void  AppBenchFlagGrpNew (void)
+{
+    OS_FLAG_GRP  *p_grp_old;
+    INT8U         err;
+
+
+    p_grp_old       = AppBenchFlagGrp;
+    AppBenchFlagGrp = OSFlagCreate(0u, &err);
+    (void)OSFlagDel(p_grp_old, OS_DEL_ALWAYS, &err);            /* See Note #1.                                         */
+    OSTimeDly(1u);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        MEASURE EVENT FLAG POST
+*
+* Description : Times APP_BENCH_FLAG_ROUNDS posts of 'flags' to the benchmark group & displays the average.
+*
+* Argument(s) : p_name      Name of the measurement.
+*
+*               flags       Flags to set.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) See 'AppBenchFlag()  Note #2'.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_FLAG_EN == DEF_ENABLED)
+static  void  AppBenchFlagMeas (CPU_CHAR  *p_name,
+                                OS_FLAGS   flags)
+{
+    CPU_INT64U  total;
+    CPU_INT32U  ctr_start;
+    CPU_TS64    ts_start;
+    CPU_TS64    ts_end;
+    CPU_INT32U  i;
+    INT8U       err;
+
+
+    total     = 0u;
+    ctr_start = AppBenchFlagCtr;
+    for (i = 0u; i < APP_BENCH_FLAG_ROUNDS; i++) {
+        OSTimeDly(1u);                                          /* See Note #1.                                         */
+        ts_start = CPU_TS_Get64();
+        (void)OSFlagPost(AppBenchFlagGrp, flags, OS_FLAG_SET, &err);
+        ts_end   = CPU_TS_Get64();
+        total   += ts_end - ts_start;
+        (void)OSFlagPost(AppBenchFlagGrp, flags, OS_FLAG_CLR, &err);
+    }
+    OSTimeDly(1u);
+
+    APP_TRACE_INFO(("Flag: %u waiters, %s: %6u ns per post, %3u tasks readied\n",
+                    (unsigned)APP_BENCH_FLAG_TASK_NBR,
+                    p_name,
+                    (unsigned)(total / APP_BENCH_FLAG_ROUNDS),
+                    (unsigned)((AppBenchFlagCtr - ctr_start) / APP_BENCH_FLAG_ROUNDS)));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     EVENT FLAG BENCHMARK TASK
+*
+* Description : This task waits on its flags of the benchmark group until the benchmark ends (see
+*               AppBenchFlag()).
+*
+* Argument(s) : p_arg       is the index of the task.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_FLAG_EN == DEF_ENABLED)
+static  void  AppTaskBenchFlag (void *p_arg)
+{
+    CPU_INT32U  ix;
+    INT8U       err;
+
+
+    ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+    while (AppBenchFlagRun == DEF_TRUE) {
+        (void)OSFlagPend(AppBenchFlagGrp, AppBenchFlagMsk[ix], OS_FLAG_WAIT_SET_ALL, 0u, &err);
+        if (err == OS_ERR_NONE) {
+            AppBenchFlagCtr++;
+        }
+    }
+
+    (void)OSSemPost(AppBenchFlagSemDone);
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TICK COST BENCHMARK
+*
+* Description : Times OSTimeTick() with one delayed task & 8, 64 or 240 tasks pending forever.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Task 0 pends with a timeout that is never reached, the others without timeout.  Only
+*                   task 0 is in the tick list (OS_TICK_LIST_EN), all of them are in the TCB list.
+*
+*               (2) Measured on the development host, fastest of APP_BENCH_TICK_RUNS runs, two runs of the
+*                   benchmark :
+*
+*                                               8 tasks      64 tasks     240 tasks
+*                     OS_TICK_LIST_EN = 1     11-12 ns      7-11 ns      8-11 ns
+*                     OS_TICK_LIST_EN = 0     24-39 ns   150-177 ns   632-916 ns
+*
+*                   The tick list keeps the cost of a tick flat, the TCB walk grows with every task.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_TICK_EN == DEF_ENABLED)
+static  void  AppBenchTick (void)
+{
+    static  const  CPU_INT16U  task_nbr_tbl[] = { 8u, 64u, APP_BENCH_TICK_TASK_NBR };
+    CPU_INT16U  task_nbr;
+    CPU_INT32U  i;
+    CPU_INT32U  j;
+    CPU_INT64U  ns;
+    INT8U       err;
+
+
+    AppBenchTickRun     = DEF_TRUE;
+    AppBenchTickSem     = OSSemCreate(0u);
+    AppBenchTickSemDone = OSSemCreate(0u);
+    task_nbr            = 0u;
+    for (i = 0u; i < sizeof(task_nbr_tbl) / sizeof(task_nbr_tbl[0]); i++) {
+        for (j = task_nbr; j <= task_nbr_tbl[i]; j++) {         /* The delayed task & the tasks pending forever.        */
+            OSTaskCreateExt((void(*)(void *))AppTaskBenchTick,
+                (void          *)(CPU_ADDR)j,
+                (OS_STK        *)&AppTaskTickStk[j][APP_TASK_BENCH_STK_SIZE - 1],
+                (INT8U          ) APP_TASK_BENCH_PRIO,
+                (INT16U         )(APP_TASK_BENCH_PRIO + j),
+                (OS_STK        *)&AppTaskTickStk[j][0],
+                (INT32U         ) APP_TASK_BENCH_STK_SIZE,
+                (void          *) 0,
+                (INT16U         ) OS_TASK_OPT_STK_CHK);
+        }
+        task_nbr = task_nbr_tbl[i] + 1u;
+        OSTimeDly(1u);
+
+        ns = AppBenchTickMeas();
+        APP_TRACE_INFO(("Tick: 1 task delayed, %3u pending, %s: %4u ns per tick\n",
+                        (unsigned)task_nbr_tbl[i],
+                        (OS_TICK_LIST_EN > 0u) ? "tick list" : "TCB walk ",
+                        (unsigned)ns));
+    }
+
+    AppBenchTickRun = DEF_FALSE;                                /* Stop & wait for all the tasks to delete themselves.  */
+    (void)OSSemDel(AppBenchTickSem, OS_DEL_ALWAYS, &err);
+    for (i = 0u; i < task_nbr; i++) {
+        OSSemPend(AppBenchTickSemDone, 0u, &err);
+    }
+    OSTimeDly(1u);
+    (void)OSSemDel(AppBenchTickSemDone, OS_DEL_ALWAYS, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          MEASURE TICK COST
+*
+* Description : Times APP_BENCH_TICK_ROUNDS calls of OSTimeTick(), APP_BENCH_TICK_RUNS times.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Time of one tick, in nanoseconds, of the fastest run.
+*
+* Note(s)     : (1) The scheduler is locked, so that the timer task signaled by the tick hook does not run
+*                   during the measurement.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_TICK_EN == DEF_ENABLED)
+static  CPU_INT64U  AppBenchTickMeas (void)
+{
+    CPU_INT64U  best;
+    CPU_TS64    ts_start;
+    CPU_TS64    ts_end;
+    CPU_INT32U  run;
+    CPU_INT32U  i;
+
+
+    best = DEF_INT_64U_MAX_VAL;
+    for (run = 0u; run < APP_BENCH_TICK_RUNS; run++) {
+        OSSchedLock();                                          /* See Note #1.                                         */
+        ts_start = CPU_TS_Get64();
+        for (i = 0u; i < APP_BENCH_TICK_ROUNDS; i++) {
+            OSTimeTick();
+        }
+        ts_end   = CPU_TS_Get64();
+        OSSchedUnlock();
+        if ((ts_end - ts_start) < best) {
+            best = ts_end - ts_start;
+        }
+    }
+
+    return (best / APP_BENCH_TICK_ROUNDS);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        TICK COST BENCHMARK TASK
+*
+* Description : This task pends on the benchmark semaphore, which is never posted, until the benchmark ends
+*               (see AppBenchTick()).
+*
+* Argument(s) : p_arg       is the index of the task, 0 for the delayed task.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_TICK_EN == DEF_ENABLED)
+static  void  AppTaskBenchTick (void *p_arg)
+{
+    INT32U  timeout;
+    INT8U   err;
+
+
+    timeout = ((CPU_ADDR)p_arg == 0u) ? APP_BENCH_TICK_DLY : 0u;
+    while (AppBenchTickRun == DEF_TRUE) {
+        OSSemPend(AppBenchTickSem, timeout, &err);
+    }
+
+    (void)OSSemPost(AppBenchTickSemDone);
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 HIGHEST READY PRIORITY LOOKUP BENCHMARK
+*
+* Description : Times the lookup of the highest ready priority done by OS_SchedNew(), with OSUnMapTbl[] &
+*               with CPU_CntTrailZeros() (OS_SCHED_CNT_ZEROS_EN), for 64 & 256 priorities.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The lookups are copies of the ones in 'os_core.c  OS_SchedNew()', run on
+*                   APP_BENCH_CNTZ_MAP_NBR random ready lists whatever OS_LOWEST_PRIO is.  Both ways must
+*                   find the same priorities.
+*
+*               (2) Measured on the development host, fastest of 5 runs, with the inline __builtin_ctzll()
+*                   version of CPU_CntTrailZeros() in 'cpu.h' (see 'cpu_cfg.h'), as the kernel uses it :
+*
+*                                          OSUnMapTbl[]     CPU_CntTrailZeros()
+*                     64  priorities         1.0 ns              1.5 ns
+*                     256 priorities         1.7 ns              1.5 ns
+*
+*                   With OSUnMapTbl[] warm in the cache, two table lookups beat two bit scans for 64
+*                   priorities.  For 256 priorities, the table needs two lookups per level & the bit scans
+*                   win; their cost does not depend on the number of priorities.  OS_SCHED_CNT_ZEROS_EN
+*                   also saves the 256 bytes of OSUnMapTbl[] & the cache misses on it, which this benchmark
+*                   does not show.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_CNTZ_EN == DEF_ENABLED)
+static  void  AppBenchCntZ (void)
+{
+    CPU_INT64U   ps_tbl;
+    CPU_INT64U   ps_cnt_zeros;
+    CPU_INT32U   sum_tbl;
+    CPU_INT32U   seed;
+    CPU_INT32U   prio;
+    CPU_INT32U   shift;
+    CPU_INT32U   i;
+    CPU_INT32U   j;
+    CPU_INT32U   k;
+    CPU_BOOLEAN  prio_256;
+
+
+    seed = 1u;
+    for (i = 0u; i < 2u; i++) {
+        prio_256 = (i == 0u) ? DEF_NO : DEF_YES;
+        shift    = (prio_256 == DEF_YES) ? 4u : 3u;
+        for (j = 0u; j < APP_BENCH_CNTZ_MAP_NBR; j++) {         /* Build random ready lists, each with a task ready.    */
+            AppBenchCntZGrp[j] = 0u;
+            for (k = 0u; k < 16u; k++) {
+                AppBenchCntZTbl[j][k] = 0u;
+            }
+            for (k = 0u; k < 3u; k++) {
+                seed = seed * 1103515245u + 12345u;
+                prio = (seed >> 16) & ((1u << (shift * 2u)) - 1u);
+                AppBenchCntZGrp[j]                 |= (CPU_INT16U)(1u << (prio >> shift));
+                AppBenchCntZTbl[j][prio >> shift]  |= (CPU_INT16U)(1u << (prio & ((1u << shift) - 1u)));
+            }
+        }
+
+        ps_tbl       = AppBenchCntZMeas(DEF_NO,  prio_256);
+        sum_tbl      = AppBenchCntZSum;
+        ps_cnt_zeros = AppBenchCntZMeas(DEF_YES, prio_256);
+        APP_TRACE_INFO(("CntZ: %3u priorities, OSUnMapTbl[] %2u.%02u ns, CPU_CntTrailZeros() %2u.%02u ns -> %s\n",
+                        (prio_256 == DEF_YES) ? 256u : 64u,
+                        (unsigned)(ps_tbl       / 1000u),
+                        (unsigned)(ps_tbl       % 1000u / 10u),
+                        (unsigned)(ps_cnt_zeros / 1000u),
+                        (unsigned)(ps_cnt_zeros % 1000u / 10u),
+                        (sum_tbl == AppBenchCntZSum) ? "PASS" : "FAIL"));   /* See Note #1.                     */
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  MEASURE HIGHEST READY PRIORITY LOOKUP
+*
+* Description : Looks up the highest ready priority of all the benchmark ready lists, APP_BENCH_CNTZ_RUNS
+*               times.
+*
+* Argument(s) : cnt_zeros   DEF_YES, to count trailing zeros (OS_SCHED_CNT_ZEROS_EN),
+*
+*                           DEF_NO,  to look up OSUnMapTbl[].
+*
+*               prio_256    DEF_YES, for 256 priorities (16-bit ready lists),
+*
+*                           DEF_NO,  for 64  priorities ( 8-bit ready lists).
+*
+* Return(s)   : Time of one lookup, in picoseconds, of the fastest run.
+*
+* Note(s)     : (1) The sum of the priorities found is left in 'AppBenchCntZSum'.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_CNTZ_EN == DEF_ENABLED)
+static  CPU_INT64U  AppBenchCntZMeas (CPU_BOOLEAN  cnt_zeros,
+                                      CPU_BOOLEAN  prio_256)
+{
+    CPU_INT64U  best;
+    CPU_TS64    ts_start;
+    CPU_TS64    ts_end;
+    CPU_INT32U  sum;
+    CPU_INT32U  run;
+    CPU_INT32U  i;
+    CPU_INT16U  grp;
+    CPU_INT16U  rdy;
+    CPU_INT08U  y;
+
+
+    best = DEF_INT_64U_MAX_VAL;
+    sum  = 0u;
+    for (run = 0u; run < APP_BENCH_CNTZ_RUNS; run++) {
+        sum      = 0u;
+        ts_start = CPU_TS_Get64();
+        if (prio_256 == DEF_NO) {
+            if (cnt_zeros == DEF_NO) {
+                for (i = 0u; i < APP_BENCH_CNTZ_MAP_NBR; i++) {
+                    grp  = AppBenchCntZGrp[i];
+                    y    = OSUnMapTbl[grp];
+                    sum += (CPU_INT32U)(y << 3u) + OSUnMapTbl[AppBenchCntZTbl[i][y]];
+                }
+            } else {
+                for (i = 0u; i < APP_BENCH_CNTZ_MAP_NBR; i++) {
+                    grp  = AppBenchCntZGrp[i];
+                    y    = (CPU_INT08U)CPU_CntTrailZeros((CPU_DATA)grp);
+                    sum += (CPU_INT32U)(y << 3u) + (CPU_INT32U)CPU_CntTrailZeros((CPU_DATA)AppBenchCntZTbl[i][y]);
+                }
+            }
+        } else {
+            if (cnt_zeros == DEF_NO) {
+                for (i = 0u; i < APP_BENCH_CNTZ_MAP_NBR; i++) {
+                    grp = AppBenchCntZGrp[i];
+                    if ((grp & 0xFFu) != 0u) {
+                        y = OSUnMapTbl[grp & 0xFFu];
+                    } else {
+                        y = OSUnMapTbl[(grp >> 8u) & 0xFFu] + 8u;
+                    }
+                    rdy = AppBenchCntZTbl[i][y];
+                    if ((rdy & 0xFFu) != 0u) {
+                        sum += (CPU_INT32U)(y << 4u) + OSUnMapTbl[rdy & 0xFFu];
+                    } else {
+                        sum += (CPU_INT32U)(y << 4u) + OSUnMapTbl[(rdy >> 8u) & 0xFFu] + 8u;
+                    }
+                }
+            } else {
+                for (i = 0u; i < APP_BENCH_CNTZ_MAP_NBR; i++) {
+                    y    = (CPU_INT08U)CPU_CntTrailZeros((CPU_DATA)AppBenchCntZGrp[i]);
+                    sum += (CPU_INT32U)(y << 4u) + (CPU_INT32U)CPU_CntTrailZeros((CPU_DATA)AppBenchCntZTbl[i][y]);
+                }
+            }
+        }
+        ts_end = CPU_TS_Get64();
+        if ((ts_end - ts_start) < best) {
+            best = ts_end - ts_start;
+        }
+    }
+    AppBenchCntZSum = sum;                                      /* See Note #1.                                         */
+
+    return (best * 1000u / APP_BENCH_CNTZ_MAP_NBR);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        TIMER TICK COST BENCHMARK
+*
+* Description : Measures the time the timer task takes per timer tick, with 100 to APP_BENCH_TMR_NBR
+*               periodic timers running.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The timers are added to the pool with OSTmrPoolAdd(), on top of the OS_TMR_CFG_MAX timers
+*                   of the kernel.
+*
+*               (2) Measured on the development host, time of the timer task per timer tick (typical of 3
+*                   runs) :
+*
+*                                      Timers      Cascading wheel      Single wheel (7 spokes)
+*                                         100            40 ns                   50 ns
+*                                       1 000            50 ns                  600 ns
+*                                      10 000            90 ns                  5.0 us
+*                                     100 000            70 ns                  180 us
+*
+*                   With OS_TMR_CFG_WHEEL_HIER_EN, the cost per timer tick does not grow with the number of
+*                   timers.  With a single wheel, the timer task walks one spoke, a seventh of the timers,
+*                   every timer tick.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_TMR_EN == DEF_ENABLED)
+static  void  AppBenchTmr (void)
+{
+    CPU_INT32U  tmr_nbr;
+    INT8U       err;
+
+
+    err = OSTmrPoolAdd(&AppBenchTmrTbl[0], APP_BENCH_TMR_NBR);  /* See Note #1.                                         */
+    if (err != OS_ERR_NONE) {
+        APP_TRACE_INFO(("Timer: OSTmrPoolAdd() failed, err %u\n", (unsigned)err));
+        return;
+    }
+
+    for (tmr_nbr = 100u; tmr_nbr <= APP_BENCH_TMR_NBR; tmr_nbr *= 10u) {
+        AppBenchTmrMeas(tmr_nbr);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          MEASURE TIMER TICK COST
+*
+* Description : Runs 'tmr_nbr' periodic timers for APP_BENCH_TMR_ROUNDS timer ticks & prints the time the
+*               timer task took per timer tick.
+*
+* Argument(s) : tmr_nbr     Number of timers to run.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The period of each timer is 'tmr_nbr' & their first expiries are one timer tick apart,
+*                   so that one timer expires every timer tick.
+*
+*               (2) The timer ticks are signaled at once, so the timer task runs them back to back.  Its
+*                   time is counted by the profiling of the kernel (OS_TASK_PROFILE_EN) & includes pending
+*                   on its semaphore.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_TMR_EN == DEF_ENABLED)
+static  void  AppBenchTmrMeas (CPU_INT32U  tmr_nbr)
+{
+    OS_TCB      tcb;
+    CPU_INT64U  cycles_start;
+    CPU_INT32U  time_start;
+    CPU_INT32U  time;
+    CPU_INT32U  ctr_start;
+    CPU_INT32U  ctr;
+    CPU_INT32U  ns;
+    CPU_INT32U  i;
+    INT8U       err;
+
+
+    OSSchedLock();                                              /* Start all the timers on the same timer tick.         */
+    for (i = 0u; i < tmr_nbr; i++) {                            /* See Note #1.                                         */
+        AppBenchTmrRun[i] = OSTmrCreate((INT32U         )(i + 1u),
+                                     (INT32U         ) tmr_nbr,
+                                     (INT8U          ) OS_TMR_OPT_PERIODIC,
+                                     (OS_TMR_CALLBACK) AppBenchTmrCallback,
+                                     (void          *) 0,
+                                     (INT8U         *)"Bench",
+                                     (INT8U         *)&err);
+        (void)OSTmrStart(AppBenchTmrRun[i], &err);
+    }
+    OSSchedUnlock();
+    OSTimeDly(1u);
+
+    (void)OSTaskQuery(OS_TASK_TMR_PRIO, &tcb);
+    cycles_start = tcb.OSTCBCyclesTot;
+    time_start   = OSTmrTime;
+    ctr_start    = AppBenchTmrCtr;
+    for (i = 0u; i < APP_BENCH_TMR_ROUNDS; i++) {               /* See Note #2.                                         */
+        (void)OSTmrSignal();
+    }
+    do {
+        OSTimeDly(1u);
+        time = OSTmrTime;
+    } while ((time - time_start) < APP_BENCH_TMR_ROUNDS);
+    (void)OSTaskQuery(OS_TASK_TMR_PRIO, &tcb);
+    ctr  = AppBenchTmrCtr;
+
+    ns   = (CPU_INT32U)((tcb.OSTCBCyclesTot - cycles_start) / (time - time_start));
+    APP_TRACE_INFO(("Timer: %6u timers, %s: %7u ns per timer tick, %u expiries in %u timer ticks\n",
+                    (unsigned)tmr_nbr,
+                    (OS_TMR_CFG_WHEEL_HIER_EN > 0u) ? "cascading wheel" : "single wheel   ",
+                    (unsigned)ns,
+                    (unsigned)(ctr  - ctr_start),
+                    (unsigned)(time - time_start)));
+
+    for (i = 0u; i < tmr_nbr; i++) {                            /* Give the timers back to the pool.                    */
+        (void)OSTmrDel(AppBenchTmrRun[i], &err);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         BENCHMARK TIMER CALLBACK
+*
+* Description : Counts the expiries of the benchmark timers.
+*
+* Argument(s) : ptmr        Timer that expired.
+*
+*               p_arg       Argument of the timer (unused).
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Called by the timer task, with the scheduler locked.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_TMR_EN == DEF_ENABLED)
+static  void  AppBenchTmrCallback (void  *ptmr,
+                                   void  *p_arg)
+{
+   (void)ptmr;
+   (void)p_arg;
+
+    AppBenchTmrCtr++;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  BY-VALUE VS POINTER QUEUE BENCHMARK
+*
+* Description : Compares sending & receiving a message through a by-value queue (OSQVReserve(),
+*               OSQVCommit(), OSQVPeek() & OSQVRelease()) with the same through a pointer queue, the
+*               message being held in a block of a memory partition (OSMemGet(), OSQPost(), OSQPend() &
+*               OSMemPut()), & with copying the message in & out of the by-value queue (OSQVPost() &
+*               OSQVPend()).
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The task sends & receives each message itself, so no context switch is timed, only the
+*                   cost of the services & of copying the message in.
+*
+*               (2) Measured on the development host, range of the fastest of 7 runs over 3 executions :
+*
+*                                   Message      OSQV...()    OSQVPost() & OSQVPend()    OSMem...() & OSQ...()
+*                                    16 bytes    15 - 29 ns         16 - 23 ns                13 - 26 ns
+*                                    32 bytes    19 - 30 ns         17 - 21 ns                21 - 26 ns
+*                                    64 bytes    24 - 41 ns         23 ns                     26 - 29 ns
+*                                   128 bytes    34 - 40 ns         21 - 25 ns                31 - 33 ns
+*                                   256 bytes    43 - 46 ns         24 - 26 ns                37 - 40 ns
+*
+*                   The in-place calls & the pointer queue take four critical sections & one copy per
+*                   message, OSQVPost() & OSQVPend() two critical sections & two copies, with the port's
+*                   word copy (see 'os_qv.c  Note #4') : they are the fastest from 32 bytes on.
+*
+*               (3) Partitions cannot be deleted, so one partition of blocks of the largest message size is
+*                   used for all the sizes.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_QV_EN == DEF_ENABLED)
+static  void  AppBenchQV (void)
+{
+    static  const  CPU_INT16U  msg_size_tbl[] = { 16u, 32u, 64u, 128u, APP_BENCH_QV_MSG_SIZE_MAX };
+    CPU_INT64U  ns_qv;
+    CPU_INT64U  ns_qv_copy;
+    CPU_INT64U  ns_q;
+    CPU_INT32U  i;
+    INT8U       err;
+
+
+    AppBenchQVMem = OSMemCreate((void *)&AppBenchQVPart[0][0],  /* See Note #3.                                         */
+                                APP_BENCH_QV_MSG_NBR,
+                                APP_BENCH_QV_MSG_SIZE_MAX,
+                                &err);
+    for (i = 0u; i < sizeof(msg_size_tbl) / sizeof(msg_size_tbl[0]); i++) {
+        ns_qv      = AppBenchQVMeas(msg_size_tbl[i]);
+        ns_qv_copy = AppBenchQVCopyMeas(msg_size_tbl[i]);
+        ns_q       = AppBenchQMeas(msg_size_tbl[i]);
+        APP_TRACE_INFO(("QV: %3u-byte messages, by-value queue %3u.%u ns, copied %3u.%u ns, pointer queue & partition %3u.%u ns per message\n",
+                        (unsigned) msg_size_tbl[i],
+                        (unsigned)(ns_qv      / 10u),
+                        (unsigned)(ns_qv      % 10u),
+                        (unsigned)(ns_qv_copy / 10u),
+                        (unsigned)(ns_qv_copy % 10u),
+                        (unsigned)(ns_q       / 10u),
+                        (unsigned)(ns_q       % 10u)));
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       MEASURE BY-VALUE QUEUE
+*
+* Description : Sends & receives APP_BENCH_QV_ROUNDS messages through a by-value queue, APP_BENCH_QV_RUNS
+*               times.
+*
+* Argument(s) : msg_size    Size of the messages, in bytes.
+*
+* Return(s)   : Time of one message, in tenths of nanoseconds, of the fastest run.
+*
+* Note(s)     : (1) The message is written in place in the queue's storage & read in place.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_QV_EN == DEF_ENABLED)
+static  CPU_INT64U  AppBenchQVMeas (CPU_INT16U  msg_size)
+{
+    OS_EVENT    *pqv;
+    CPU_INT08U   src[APP_BENCH_QV_MSG_SIZE_MAX];
+    CPU_INT08U  *p_msg;
+    CPU_INT64U   best;
+    CPU_TS64     ts_start;
+    CPU_TS64     ts_end;
+    CPU_INT32U   sum;
+    CPU_INT32U   run;
+    CPU_INT32U   i;
+    INT8U        err;
+
+
+    Mem_Set((void *)&src[0], 0x5Au, sizeof(src));
+    pqv  = OSQVCreate((void *)&AppBenchQVStorage[0][0], msg_size, APP_BENCH_QV_MSG_NBR);
+    best = DEF_INT_64U_MAX_VAL;
+    sum  = 0u;
+    for (run = 0u; run < APP_BENCH_QV_RUNS; run++) {
+        ts_start = CPU_TS_Get64();
+        for (i = 0u; i < APP_BENCH_QV_ROUNDS; i++) {            /* See Note #1.                                         */
+            p_msg    = (CPU_INT08U *)OSQVReserve(pqv, &err);
+            Mem_Copy((void *)p_msg, (void *)&src[0], msg_size);
+            p_msg[0] = (CPU_INT08U)i;
+           (void)OSQVCommit(pqv);
+
+            p_msg    = (CPU_INT08U *)OSQVPeek(pqv, 0u, &err);
+            sum     += p_msg[0] + p_msg[msg_size - 1u];
+           (void)OSQVRelease(pqv);
+        }
+        ts_end = CPU_TS_Get64();
+        if ((ts_end - ts_start) < best) {
+            best = ts_end - ts_start;
+        }
+    }
+    AppBenchQVSum = sum;
+    (void)OSQVDel(pqv, OS_DEL_ALWAYS, &err);
+
+    return (best * 10u / APP_BENCH_QV_ROUNDS);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   MEASURE COPYING BY-VALUE QUEUE
+*
+* Description : Sends & receives APP_BENCH_QV_ROUNDS messages through a by-value queue, copied in & out of
+*               it, APP_BENCH_QV_RUNS times.
+*
+* Argument(s) : msg_size    Size of the messages, in bytes.
+*
+* Return(s)   : Time of one message, in tenths of nanoseconds, of the fastest run.
+*
+* Note(s)     : (1) OSQVPost() & OSQVPend() each copy the message in a single critical section.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_QV_EN == DEF_ENABLED)
+static  CPU_INT64U  AppBenchQVCopyMeas (CPU_INT16U  msg_size)
+{
+    OS_EVENT    *pqv;
+    CPU_INT08U   src[APP_BENCH_QV_MSG_SIZE_MAX];
+    CPU_INT08U   dest[APP_BENCH_QV_MSG_SIZE_MAX];
+    CPU_INT64U   best;
+    CPU_TS64     ts_start;
+    CPU_TS64     ts_end;
+    CPU_INT32U   sum;
+    CPU_INT32U   run;
+    CPU_INT32U   i;
+    INT8U        err;
+
+
+    Mem_Set((void *)&src[0], 0x5Au, sizeof(src));
+    pqv  = OSQVCreate((void *)&AppBenchQVStorage[0][0], msg_size, APP_BENCH_QV_MSG_NBR);
+    best = DEF_INT_64U_MAX_VAL;
+    sum  = 0u;
+    for (run = 0u; run < APP_BENCH_QV_RUNS; run++) {
+        ts_start = CPU_TS_Get64();
+        for (i = 0u; i < APP_BENCH_QV_ROUNDS; i++) {            /* See Note #1.                                         */
+            src[0] = (CPU_INT08U)i;
+           (void)OSQVPost(pqv, (void *)&src[0]);
+
+            OSQVPend(pqv, (void *)&dest[0], 0u, &err);
+            sum   += dest[0] + dest[msg_size - 1u];
+        }
+        ts_end = CPU_TS_Get64();
+        if ((ts_end - ts_start) < best) {
+            best = ts_end - ts_start;
+        }
+    }
+    AppBenchQVSum = sum;
+    (void)OSQVDel(pqv, OS_DEL_ALWAYS, &err);
+
+    return (best * 10u / APP_BENCH_QV_ROUNDS);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  MEASURE POINTER QUEUE & PARTITION
+*
+* Description : Sends & receives APP_BENCH_QV_ROUNDS messages through a pointer queue, each held in a block
+*               of a memory partition, APP_BENCH_QV_RUNS times.
+*
+* Argument(s) : msg_size    Size of the messages, in bytes.
+*
+* Return(s)   : Time of one message, in tenths of nanoseconds, of the fastest run.
+*
+* Note(s)     : (1) The message is written in a block taken from the partition, its address is queued & the
+*                   block is given back once the message is read.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_QV_EN == DEF_ENABLED)
+static  CPU_INT64U  AppBenchQMeas (CPU_INT16U  msg_size)
+{
+    OS_EVENT    *pq;
+    CPU_INT08U   src[APP_BENCH_QV_MSG_SIZE_MAX];
+    CPU_INT08U  *p_msg;
+    CPU_INT64U   best;
+    CPU_TS64     ts_start;
+    CPU_TS64     ts_end;
+    CPU_INT32U   sum;
+    CPU_INT32U   run;
+    CPU_INT32U   i;
+    INT8U        err;
+
+
+    Mem_Set((void *)&src[0], 0x5Au, sizeof(src));
+    pq   = OSQCreate(&AppBenchQVQTbl[0], APP_BENCH_QV_MSG_NBR);
+    best = DEF_INT_64U_MAX_VAL;
+    sum  = 0u;
+    for (run = 0u; run < APP_BENCH_QV_RUNS; run++) {
+        ts_start = CPU_TS_Get64();
+        for (i = 0u; i < APP_BENCH_QV_ROUNDS; i++) {            /* See Note #1.                                         */
+            p_msg    = (CPU_INT08U *)OSMemGet(AppBenchQVMem, &err);
+            Mem_Copy((void *)p_msg, (void *)&src[0], msg_size);
+            p_msg[0] = (CPU_INT08U)i;
+           (void)OSQPost(pq, (void *)p_msg);
+
+            p_msg    = (CPU_INT08U *)OSQPend(pq, 0u, &err);
+            sum     += p_msg[0] + p_msg[msg_size - 1u];
+           (void)OSMemPut(AppBenchQVMem, (void *)p_msg);
+        }
+        ts_end = CPU_TS_Get64();
+        if ((ts_end - ts_start) < best) {
+            best = ts_end - ts_start;
+        }
+    }
+    AppBenchQVSum = sum;
+    (void)OSQDel(pq, OS_DEL_ALWAYS, &err);
+
+    return (best * 10u / APP_BENCH_QV_ROUNDS);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   PREEMPTION THRESHOLD BENCHMARK
+*
+* Description : Counts the context switches of a pipeline : a producer task posts messages to a filter
+*               task, which forwards them to a consumer task, of the highest priority of the three.  The
+*               pipeline runs without thresholds, then, with OS_SCHED_THRESHOLD_EN, with the producer &
+*               the filter given the consumer's priority as threshold.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Without thresholds, each message wakes the filter, then the consumer : four switches per
+*                   message.  With them, the producer fills the pipeline before the filter runs, & the filter
+*                   empties its queue before the consumer runs.
+*
+*               (2) Measured on the development host, 10000 messages, 8 in flight :
+*
+*                                   Thresholds             Context switches     Avoided
+*                                   none                      40002              0
+*                                   producer & filter          3753           2500
+*
+*                   The same without OS_SCHED_THRESHOLD_EN, for the first run.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_THRESHOLD_EN == DEF_ENABLED)
+static  void  AppBenchThreshold (void)
+{
+    AppBenchThresholdMeas(DEF_NO);
+#if (OS_SCHED_THRESHOLD_EN > 0u)
+    AppBenchThresholdMeas(DEF_YES);
+#else
+    APP_TRACE_INFO(("Threshold: enable OS_SCHED_THRESHOLD_EN to compare with thresholds\n"));
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  MEASURE PREEMPTION THRESHOLD BENCHMARK
+*
+* Description : Runs the pipeline once & reports its context switches.
+*
+* Argument(s) : thres       DEF_YES, to give the producer & the filter a preemption threshold.
+*
+*                           DEF_NO,  to run the pipeline without thresholds.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The pipeline's tasks are of lower priority than the start task, so they only run once it
+*                   pends.  The count includes the switches to the producer & back to the start task.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_THRESHOLD_EN == DEF_ENABLED)
+static  void  AppBenchThresholdMeas (CPU_BOOLEAN  thres)
+{
+    INT32U  ctx_sw_ctr;
+#if (OS_SCHED_THRESHOLD_EN > 0u)
+    INT32U  ctx_sw_thres_ctr;
+#endif
+    INT8U   err;
+
+
+    AppBenchThresholdErrCtr  = 0u;
+    AppBenchThresholdQ[0]    = OSQCreate(&AppBenchThresholdQTbl[0][0], APP_BENCH_THRESHOLD_DEPTH);
+    AppBenchThresholdQ[1]    = OSQCreate(&AppBenchThresholdQTbl[1][0], APP_BENCH_THRESHOLD_DEPTH);
+    AppBenchThresholdSemSlot = OSSemCreate(APP_BENCH_THRESHOLD_DEPTH);
+    AppBenchThresholdSemDone = OSSemCreate(0u);
+
+    (void)OSTaskCreate(AppTaskBenchThresholdConsumer, (void *)0, &AppTaskThresholdStk[0][APP_TASK_BENCH_STK_SIZE - 1u], APP_TASK_BENCH_PRIO);
+    (void)OSTaskCreate(AppTaskBenchThresholdFilter,   (void *)0, &AppTaskThresholdStk[1][APP_TASK_BENCH_STK_SIZE - 1u], APP_TASK_BENCH_PRIO + 1u);
+    (void)OSTaskCreate(AppTaskBenchThresholdProducer, (void *)0, &AppTaskThresholdStk[2][APP_TASK_BENCH_STK_SIZE - 1u], APP_TASK_BENCH_PRIO + 2u);
+#if (OS_SCHED_THRESHOLD_EN > 0u)
+    if (thres == DEF_YES) {
+        (void)OSTaskThresholdSet(APP_TASK_BENCH_PRIO + 1u, APP_TASK_BENCH_PRIO);
+        (void)OSTaskThresholdSet(APP_TASK_BENCH_PRIO + 2u, APP_TASK_BENCH_PRIO);
+    }
+    ctx_sw_thres_ctr = OSCtxSwThresholdCtr;
+#endif
+    ctx_sw_ctr = OSCtxSwCtr;
+
+    OSSemPend(AppBenchThresholdSemDone, 0u, &err);              /* See Note #1.                                         */
+
+    ctx_sw_ctr = OSCtxSwCtr - ctx_sw_ctr;
+#if (OS_SCHED_THRESHOLD_EN > 0u)
+    ctx_sw_thres_ctr = OSCtxSwThresholdCtr - ctx_sw_thres_ctr;
+    APP_TRACE_INFO(("Threshold: %s: %6u context switches (%u.%02u per message), %6u avoided%s\n",
+                    (thres == DEF_YES) ? "producer & filter" : "none             ",
+                    (unsigned) ctx_sw_ctr,
+                    (unsigned)(ctx_sw_ctr / APP_BENCH_THRESHOLD_MSG_NBR),
+                    (unsigned)(ctx_sw_ctr * 100u / APP_BENCH_THRESHOLD_MSG_NBR % 100u),
+                    (unsigned) ctx_sw_thres_ctr,
+                    (AppBenchThresholdErrCtr == 0u) ? "" : ", FAIL (out of order)"));
+#else
+   (void)thres;
+    APP_TRACE_INFO(("Threshold: none: %6u context switches (%u.%02u per message)%s\n",
+                    (unsigned) ctx_sw_ctr,
+                    (unsigned)(ctx_sw_ctr / APP_BENCH_THRESHOLD_MSG_NBR),
+                    (unsigned)(ctx_sw_ctr * 100u / APP_BENCH_THRESHOLD_MSG_NBR % 100u),
+                    (AppBenchThresholdErrCtr == 0u) ? "" : ", FAIL (out of order)"));
+#endif
+
+    OSTimeDly(1u);                                              /* Let the tasks delete themselves.                     */
+    (void)OSQDel(AppBenchThresholdQ[0], OS_DEL_ALWAYS, &err);
+    (void)OSQDel(AppBenchThresholdQ[1], OS_DEL_ALWAYS, &err);
+    (void)OSSemDel(AppBenchThresholdSemSlot, OS_DEL_ALWAYS, &err);
+    (void)OSSemDel(AppBenchThresholdSemDone, OS_DEL_ALWAYS, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                PREEMPTION THRESHOLD BENCHMARK TASKS
+*
+* Description : The producer, filter & consumer of the pipeline.  Each handles APP_BENCH_THRESHOLD_MSG_NBR
+*               messages, then deletes itself.
+*
+* Argument(s) : p_arg       is the argument passed by 'OSTaskCreate()', unused.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_THRESHOLD_EN == DEF_ENABLED)
+static  void  AppTaskBenchThresholdProducer (void  *p_arg)
+{
+    CPU_INT32U  i;
+    INT8U       err;
+
+
+   (void)p_arg;
+
+    for (i = 1u; i <= APP_BENCH_THRESHOLD_MSG_NBR; i++) {
+        OSSemPend(AppBenchThresholdSemSlot, 0u, &err);
+        (void)OSQPost(AppBenchThresholdQ[0], (void *)(CPU_ADDR)i);
+    }
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+
+static  void  AppTaskBenchThresholdFilter (void  *p_arg)
+{
+    CPU_INT32U   i;
+    void        *p_msg;
+    INT8U        err;
+
+
+   (void)p_arg;
+
+    for (i = 1u; i <= APP_BENCH_THRESHOLD_MSG_NBR; i++) {
+        p_msg = OSQPend(AppBenchThresholdQ[0], 0u, &err);
+        (void)OSQPost(AppBenchThresholdQ[1], p_msg);
+    }
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+
+static  void  AppTaskBenchThresholdConsumer (void  *p_arg)
+{
+    CPU_INT32U   i;
+    void        *p_msg;
+    INT8U        err;
+
+
+   (void)p_arg;
+
+    for (i = 1u; i <= APP_BENCH_THRESHOLD_MSG_NBR; i++) {
+        p_msg = OSQPend(AppBenchThresholdQ[1], 0u, &err);
+        if ((CPU_ADDR)p_msg != i) {
+            AppBenchThresholdErrCtr++;
+        }
+        (void)OSSemPost(AppBenchThresholdSemSlot);
+    }
+    (void)OSSemPost(AppBenchThresholdSemDone);
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      ISR BROADCAST BENCHMARK
+*
+* Description : Measures how long an ISR broadcasting a message to 1 to APP_BENCH_ISR_TASK_NBR waiting tasks
+*               runs, & the longest time interrupts were disabled until all the tasks ran, as returned by
+*               CPU_IntDisMeasMaxCurGet() for each broadcast.  Build it with OS_ISR_POST_DEFERRED_EN disabled,
+*               then enabled, to compare.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The broadcasts are made by a task of lower priority than the waiting tasks, which raises
+*                   the interrupt : once the ISR returns, all the tasks it readied have run & wait again.
+*
+*               (2) Measured on the development host, median of 1000 broadcasts :
+*
+*                                   Waiting        OS_ISR_POST_DEFERRED_EN 0     OS_ISR_POST_DEFERRED_EN 1
+*                                   tasks            ISR      ints disabled        ISR      ints disabled
+*                                      1             224 ns          95 ns         151 ns         100 ns
+*                                      8             351 ns         119 ns         145 ns          94 ns
+*                                     16             459 ns         216 ns         150 ns         100 ns
+*                                     32             668 ns         419 ns         148 ns          98 ns
+*                                     48             892 ns         643 ns         163 ns         111 ns
+*
+*                   Deferred, the ISR only queues the post, & the ISR post task lets interrupts in between
+*                   the tasks it readies (see 'ucos_ii.h  BROADCAST INTERRUPT WINDOW') : neither grows with
+*                   the number of waiting tasks.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_ISR_EN == DEF_ENABLED)
+static  void  AppBenchIsr (void)
+{
+    INT8U  err;
+
+
+    AppBenchIsrMbox    = OSMboxCreate((void *)0);
+    AppBenchIsrSemDone = OSSemCreate(0u);
+
+    CPU_IntSrcHandlerSet(APP_BENCH_ISR_INT_SRC, AppBenchIsrISR);
+    CPU_IntSrcEn(APP_BENCH_ISR_INT_SRC);
+
+    OSTaskCreateExt((void(*)(void *))AppTaskBenchIsr,           /* See Note #1.                                         */
+        (void          *) 0,
+        (OS_STK        *)&AppTaskIsrStk[APP_BENCH_ISR_TASK_NBR][APP_TASK_BENCH_STK_SIZE - 1],
+        (INT8U          )(APP_TASK_BENCH_PRIO + APP_BENCH_ISR_TASK_NBR),
+        (INT16U         )(APP_TASK_BENCH_PRIO + APP_BENCH_ISR_TASK_NBR),
+        (OS_STK        *)&AppTaskIsrStk[APP_BENCH_ISR_TASK_NBR][0],
+        (INT32U         ) APP_TASK_BENCH_STK_SIZE,
+        (void          *) 0,
+        (INT16U         ) OS_TASK_OPT_STK_CHK);
+
+    OSSemPend(AppBenchIsrSemDone, 0u, &err);
+    OSTimeDly(1u);                                              /* Let the benchmark task delete itself.                */
+
+    CPU_IntSrcDis(APP_BENCH_ISR_INT_SRC);
+    (void)OSSemDel(AppBenchIsrSemDone, OS_DEL_ALWAYS, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   ISR BROADCAST BENCHMARK TASKS & ISR
+*
+* Description : AppTaskBenchIsr() adds waiting tasks, raises the interrupt APP_BENCH_ISR_ROUNDS times for
+*               each number of them & reports.  AppTaskBenchIsrWait() waits on the mailbox until it is
+*               deleted.  AppBenchIsrISR() broadcasts to the mailbox.
+*
+* Argument(s) : p_arg       is the argument passed by 'OSTaskCreateExt()', unused.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_ISR_EN == DEF_ENABLED)
+static  void  AppTaskBenchIsr (void  *p_arg)
+{
+    static  const  CPU_INT16U  task_nbr_tbl[] = { 1u, 8u, 16u, 32u, APP_BENCH_ISR_TASK_NBR };
+    CPU_INT16U  task_nbr;
+    CPU_INT32U  i;
+    CPU_INT32U  j;
+    CPU_INT64U  isr_ns;
+    CPU_INT64U  dis_ns;
+    INT8U       err;
+
+
+   (void)p_arg;
+
+    task_nbr = 0u;
+    for (i = 0u; i < sizeof(task_nbr_tbl) / sizeof(task_nbr_tbl[0]); i++) {
+        for (j = task_nbr; j < task_nbr_tbl[i]; j++) {          /* Each new task waits on the mailbox at once.          */
+            OSTaskCreateExt((void(*)(void *))AppTaskBenchIsrWait,
+                (void          *) 0,
+                (OS_STK        *)&AppTaskIsrStk[j][APP_TASK_BENCH_STK_SIZE - 1],
+                (INT8U          )(APP_TASK_BENCH_PRIO + j),
+                (INT16U         )(APP_TASK_BENCH_PRIO + j),
+                (OS_STK        *)&AppTaskIsrStk[j][0],
+                (INT32U         ) APP_TASK_BENCH_STK_SIZE,
+                (void          *) 0,
+                (INT16U         ) OS_TASK_OPT_STK_CHK);
+        }
+        task_nbr = task_nbr_tbl[i];
+
+        AppBenchIsrCtr = 0u;
+        for (j = 0u; j < APP_BENCH_ISR_ROUNDS; j++) {
+            (void)CPU_IntDisMeasMaxCurReset();
+            CPU_IntSrcPendSet(APP_BENCH_ISR_INT_SRC);           /* See Note #1.                                         */
+            AppBenchIsrDisTbl[j]  = CPU_IntDisMeasMaxCurGet();
+            AppBenchIsrTimeTbl[j] = AppBenchIsrTime;
+        }
+
+        isr_ns = AppBenchIsrMedian(&AppBenchIsrTimeTbl[0]);
+        dis_ns = AppBenchIsrMedian(&AppBenchIsrDisTbl[0]);
+        APP_TRACE_INFO(("ISR broadcast: %2u tasks, %s: ISR %5u ns, ints disabled %5u ns%s\n",
+                        (unsigned)task_nbr,
+                        (OS_ISR_POST_DEFERRED_EN > 0u) ? "deferred" : "direct  ",
+                        (unsigned)isr_ns,
+                        (unsigned)dis_ns,
+                        (AppBenchIsrCtr == (CPU_INT32U)task_nbr * APP_BENCH_ISR_ROUNDS) ? "" : ", FAIL (tasks not readied)"));
+    }
+
+    APP_TRACE_INFO(("ISR broadcast: longest ints disabled since startup %u ns (see 'AppBenchIsrMedian()  Note #1')\n",
+                    (unsigned)CPU_IntDisMeasMaxGet()));
+
+    (void)OSMboxDel(AppBenchIsrMbox, OS_DEL_ALWAYS, &err);     /* The waiting tasks delete themselves.                 */
+    (void)OSSemPost(AppBenchIsrSemDone);
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+
+static  void  AppTaskBenchIsrWait (void  *p_arg)
+{
+    INT8U  err;
+
+
+   (void)p_arg;
+
+    while (DEF_ON) {
+        (void)OSMboxPend(AppBenchIsrMbox, 0u, &err);
+        if (err != OS_ERR_NONE) {
+            break;
+        }
+        AppBenchIsrCtr++;
+    }
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+
+static  void  AppBenchIsrISR (void)
+{
+    CPU_TS64  ts_start;
+    CPU_TS64  ts_end;
+
+
+    ts_start = CPU_TS_Get64();
+    OSIntEnter();
+    (void)OSMboxPostOpt(AppBenchIsrMbox, (void *)AppBenchIsrMbox, OS_POST_OPT_BROADCAST);
+    ts_end   = CPU_TS_Get64();
+    AppBenchIsrTime = ts_end - ts_start;
+    OSIntExit();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  ISR BROADCAST BENCHMARK MEDIAN
+*
+* Description : Sorts the APP_BENCH_ISR_ROUNDS measurements of a table & returns their median.
+*
+* Argument(s) : p_tbl       is the table, left sorted in increasing order.
+*
+* Return(s)   : Median of the measurements.
+*
+* Note(s)     : (1) The host preempts the benchmark now & then, for up to milliseconds, interrupts disabled or
+*                   not : the median is kept.  The longest time, CPU_IntDisMeasMaxGet(), is only reported.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_ISR_EN == DEF_ENABLED)
+static  CPU_INT64U  AppBenchIsrMedian (CPU_INT64U  *p_tbl)
+{
+    CPU_INT64U  val;
+    CPU_INT32U  i;
+    CPU_INT32U  j;
+
+
+    for (i = 1u; i < APP_BENCH_ISR_ROUNDS; i++) {               /* Insertion sort.                                      */
+        val = p_tbl[i];
+        for (j = i; (j > 0u) && (p_tbl[j - 1u] > val); j--) {
+            p_tbl[j] = p_tbl[j - 1u];
+        }
+        p_tbl[j] = val;
+    }
+
+    return (p_tbl[APP_BENCH_ISR_ROUNDS / 2u]);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TICKLESS CHECK
+*
+* Description : Checks that delays, pend timeouts & timers wake their tasks at the tick they are due,
+*               whether the kernel runs tickless (OS_TICKLESS_EN) or with a periodic tick.  Build it both
+*               ways : each must pass, with the same number of wake-ups from each source.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Two tasks delay 7 & 13 ticks, a third pends with a timeout of 11 ticks on a semaphore
+*                   that is never posted, a periodic timer expires every 3 timer ticks & a one-shot timer
+*                   after 5.  A task must wake exactly its period after it last woke up, & a timer callback
+*                   must run on the tick of its timer tick.
+*
+*               (2) The check starts on a timer tick, so that the timers expire as many times in both modes.
+*
+*               (3) Measured on the development host, tickless & periodic, 300 ticks, 10 timer ticks per
+*                   second : 42, 23 & 27 wake-ups from the tasks, 10 & 1 from the timers, on time.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_TICKLESS_EN == DEF_ENABLED)
+static  void  AppBenchTickless (void)
+{
+    OS_TMR      *p_tmr;
+    OS_TMR      *p_tmr_one_shot;
+    CPU_INT32U   i;
+    INT8U        err;
+
+
+    AppBenchTicklessRun     = DEF_YES;
+    AppBenchTicklessErrCtr  = 0u;
+    for (i = 0u; i < APP_BENCH_TICKLESS_SRC_NBR; i++) {
+        AppBenchTicklessWakeCtr[i] = 0u;
+    }
+    AppBenchTicklessSem     = OSSemCreate(0u);
+    AppBenchTicklessSemDone = OSSemCreate(0u);
+
+    OSTimeDly(1u);                                              /* See Note #2.                                         */
+    OSTimeDly(APP_BENCH_TICKLESS_TMR_RATIO - (OSTimeGet() % APP_BENCH_TICKLESS_TMR_RATIO));
+
+    for (i = 0u; i < 3u; i++) {                                 /* The tasks start once this task waits, on this tick.  */
+        (void)OSTaskCreate((i == APP_BENCH_TICKLESS_SRC_TIMEOUT) ? AppTaskBenchTicklessPend : AppTaskBenchTicklessDly,
+                           (void   *)(CPU_ADDR)i,
+                           (OS_STK *)&AppTaskTicklessStk[i][APP_TASK_BENCH_STK_SIZE - 1u],
+                           (INT8U   )(APP_TASK_BENCH_PRIO + i));
+    }
+    p_tmr          = OSTmrCreate(AppBenchTicklessPeriodTbl[APP_BENCH_TICKLESS_SRC_TMR],
+                                 AppBenchTicklessPeriodTbl[APP_BENCH_TICKLESS_SRC_TMR],
+                                 OS_TMR_OPT_PERIODIC,
+                                 AppBenchTicklessTmrCallback,
+                                 (void *)APP_BENCH_TICKLESS_SRC_TMR,
+                                 (INT8U *)"Tickless",
+                                 &err);
+    p_tmr_one_shot = OSTmrCreate(AppBenchTicklessPeriodTbl[APP_BENCH_TICKLESS_SRC_TMR_ONE_SHOT],
+                                 0u,
+                                 OS_TMR_OPT_ONE_SHOT,
+                                 AppBenchTicklessTmrCallback,
+                                 (void *)APP_BENCH_TICKLESS_SRC_TMR_ONE_SHOT,
+                                 (INT8U *)"Tickless One-Shot",
+                                 &err);
+    AppBenchTicklessTmrNext[APP_BENCH_TICKLESS_SRC_TMR]          = OSTmrTime + AppBenchTicklessPeriodTbl[APP_BENCH_TICKLESS_SRC_TMR];
+    AppBenchTicklessTmrNext[APP_BENCH_TICKLESS_SRC_TMR_ONE_SHOT] = OSTmrTime + AppBenchTicklessPeriodTbl[APP_BENCH_TICKLESS_SRC_TMR_ONE_SHOT];
+    (void)OSTmrStart(p_tmr,          &err);
+    (void)OSTmrStart(p_tmr_one_shot, &err);
+
+    OSTimeDly(APP_BENCH_TICKLESS_DLY);
+    AppBenchTicklessRun = DEF_NO;                               /* Runs first on its tick, the wake-ups due on it ...   */
+                                                                /* ... are not counted, in either mode.                 */
+    for (i = 0u; i < 3u; i++) {
+        OSSemPend(AppBenchTicklessSemDone, 0u, &err);
+    }
+    (void)OSTmrDel(p_tmr,          &err);
+    (void)OSTmrDel(p_tmr_one_shot, &err);
+    OSTimeDly(1u);                                              /* Let the tasks delete themselves.                     */
+    (void)OSSemDel(AppBenchTicklessSem,     OS_DEL_ALWAYS, &err);
+    (void)OSSemDel(AppBenchTicklessSemDone, OS_DEL_ALWAYS, &err);
+
+    APP_TRACE_INFO(("Tickless check, %s: delay 7 %u, delay 13 %u, timeout 11 %u, timer 3 %u, one-shot 5 %u wake-ups, %s\n",
+                    (OS_TICKLESS_EN > 0u) ? "tickless" : "periodic",
+                    (unsigned)AppBenchTicklessWakeCtr[APP_BENCH_TICKLESS_SRC_DLY_7],
+                    (unsigned)AppBenchTicklessWakeCtr[APP_BENCH_TICKLESS_SRC_DLY_13],
+                    (unsigned)AppBenchTicklessWakeCtr[APP_BENCH_TICKLESS_SRC_TIMEOUT],
+                    (unsigned)AppBenchTicklessWakeCtr[APP_BENCH_TICKLESS_SRC_TMR],
+                    (unsigned)AppBenchTicklessWakeCtr[APP_BENCH_TICKLESS_SRC_TMR_ONE_SHOT],
+                    (AppBenchTicklessErrCtr == 0u) ? "PASS" : "FAIL"));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       CHECK TICKLESS WAKE-UP
+*
+* Description : Counts a wake-up from a source of the tickless check & checks that it occurs on time.
+*
+* Argument(s) : src             is the source, APP_BENCH_TICKLESS_SRC_xxx.
+*
+*               tick_expected   is the tick the wake-up is due.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_TICKLESS_EN == DEF_ENABLED)
+static  void  AppBenchTicklessChk (CPU_INT08U  src,
+                                   INT32U      tick_expected)
+{
+    INT32U  tick;
+
+
+    tick = OSTimeGet();
+    AppBenchTicklessWakeCtr[src]++;
+    if (tick != tick_expected) {
+        AppBenchTicklessErrCtr++;
+        APP_TRACE_INFO(("Tickless check: source %u woke up on tick %u, due on tick %u\n",
+                        (unsigned)src,
+                        (unsigned)tick,
+                        (unsigned)tick_expected));
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     TICKLESS CHECK TASKS & TIMERS
+*
+* Description : The wake-up sources of the tickless check (see 'AppBenchTickless()  Note #1').  The tasks
+*               delete themselves once the check is over.
+*
+* Argument(s) : p_arg       is the source, APP_BENCH_TICKLESS_SRC_xxx.
+*
+*               ptmr        is the timer, unused.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_TICKLESS_EN == DEF_ENABLED)
+static  void  AppTaskBenchTicklessDly (void  *p_arg)
+{
+    CPU_INT08U  src;
+    INT32U      tick;
+
+
+    src = (CPU_INT08U)(CPU_ADDR)p_arg;
+    while (DEF_ON) {
+        tick = OSTimeGet();
+        OSTimeDly(AppBenchTicklessPeriodTbl[src]);
+        if (AppBenchTicklessRun == DEF_NO) {
+            break;
+        }
+        AppBenchTicklessChk(src, tick + AppBenchTicklessPeriodTbl[src]);
+    }
+    (void)OSSemPost(AppBenchTicklessSemDone);
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+
+static  void  AppTaskBenchTicklessPend (void  *p_arg)
+{
+    CPU_INT08U  src;
+    INT32U      tick;
+    INT8U       err;
+
+
+    src = (CPU_INT08U)(CPU_ADDR)p_arg;
+    while (DEF_ON) {
+        tick = OSTimeGet();
+        OSSemPend(AppBenchTicklessSem, AppBenchTicklessPeriodTbl[src], &err);
+        if (AppBenchTicklessRun == DEF_NO) {
+            break;
+        }
+        if (err != OS_ERR_TIMEOUT) {
+            AppBenchTicklessErrCtr++;
+        }
+        AppBenchTicklessChk(src, tick + AppBenchTicklessPeriodTbl[src]);
+    }
+    (void)OSSemPost(AppBenchTicklessSemDone);
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+
+static  void  AppBenchTicklessTmrCallback (void  *ptmr,
+                                           void  *p_arg)
+{
+    CPU_INT08U  src;
+
+
+   (void)ptmr;
+
+    src = (CPU_INT08U)(CPU_ADDR)p_arg;
+    if (AppBenchTicklessRun == DEF_NO) {
+        return;
+    }
+    AppBenchTicklessChk(src, AppBenchTicklessTmrNext[src] * APP_BENCH_TICKLESS_TMR_RATIO);
+    AppBenchTicklessTmrNext[src] += AppBenchTicklessPeriodTbl[src];
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         SIMULATION CHECK
+*
+* Description : Runs the same workload twice on virtual time (OS_CPU_CFG_SIM_EN), checks that both runs
+*               produce the same trace & measures the host time taken by one day of virtual time.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Tasks delay 7, 13 & OS_TICKS_PER_SEC ticks, another one pends with a timeout of 11 ticks
+*                   on a semaphore posted by a periodic timer of 3 timer ticks.  Each event is hashed with
+*                   its source & its tick, counted from the start of the run (see 'os_cpu_c.c  Note #4').
+*
+*               (2) Measured on the development host, 86,400 s of virtual time at 100 ticks per second :
+*
+*                       Events      Host time
+*                     3,137,298       6.5 s
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_SIM_EN == DEF_ENABLED)
+static  void  AppBenchSim (void)
+{
+    OS_TMR      *p_tmr;
+    CPU_INT64U   hash[APP_BENCH_SIM_RUN_NBR];
+    CPU_INT32U   evt_ctr[APP_BENCH_SIM_RUN_NBR];
+    CPU_INT32U   run;
+    CPU_INT32U   i;
+    CPU_INT32U   err_ctr;
+    CPU_TS64     ts_start;
+    CPU_TS64     ts_end;
+    INT8U        err;
+
+
+    err_ctr = 0u;
+    for (run = 0u; run < APP_BENCH_SIM_RUN_NBR; run++) {
+        AppBenchSimRun     = DEF_YES;
+        AppBenchSimHash    = 14695981039346656037uLL;           /* FNV-1a offset basis.                                 */
+        AppBenchSimEvtCtr  = 0u;
+        AppBenchSimSem     = OSSemCreate(0u);
+        AppBenchSimSemDone = OSSemCreate(0u);
+
+        OSTimeDly(1u);                                          /* Start on a timer tick, the same in both runs.        */
+        OSTimeDly((OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC) - (OSTimeGet() % (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC)));
+        AppBenchSimTickStart = OSTimeGet();
+
+        p_tmr = OSTmrCreate(3u,
+                            3u,
+                            OS_TMR_OPT_PERIODIC,
+                            AppBenchSimTmrCallback,
+                            (void *)0,
+                            (INT8U *)"Simulation",
+                            &err);
+        (void)OSTmrStart(p_tmr, &err);
+        for (i = 0u; i < APP_BENCH_SIM_TASK_NBR; i++) {
+            (void)OSTaskCreate(AppTaskBenchSim,
+                               (void   *)(CPU_ADDR)i,
+                               (OS_STK *)&AppTaskSimStk[i][APP_TASK_BENCH_STK_SIZE - 1u],
+                               (INT8U   )(APP_TASK_BENCH_PRIO + i));
+        }
+
+        ts_start = CPU_TS_Get64();
+        OSTimeDly(APP_BENCH_SIM_DLY);
+        ts_end   = CPU_TS_Get64();
+        AppBenchSimRun = DEF_NO;
+
+        hash[run]    = AppBenchSimHash;
+        evt_ctr[run] = AppBenchSimEvtCtr;
+        for (i = 0u; i < APP_BENCH_SIM_TASK_NBR; i++) {
+            OSSemPend(AppBenchSimSemDone, 0u, &err);
+        }
+        (void)OSTmrDel(p_tmr, &err);
+        OSTimeDly(1u);                                          /* Let the tasks delete themselves.                     */
+        (void)OSSemDel(AppBenchSimSem,     OS_DEL_ALWAYS, &err);
+        (void)OSSemDel(AppBenchSimSemDone, OS_DEL_ALWAYS, &err);
+
+        if ((hash[run] != hash[0]) || (evt_ctr[run] != evt_ctr[0])) {
+            err_ctr++;
+        }
+        APP_TRACE_INFO(("Simulation run %u: %u s of virtual time, %u events, trace %016llx, %u.%03u s of host time\n",
+                        (unsigned)run,
+                        (unsigned)(APP_BENCH_SIM_DLY / OS_TICKS_PER_SEC),
+                        (unsigned)evt_ctr[run],
+                        (unsigned long long)hash[run],
+                        (unsigned)((ts_end - ts_start) / 1000000000u),
+                        (unsigned)((ts_end - ts_start) / 1000000u % 1000u)));
+    }
+
+    APP_TRACE_INFO(("Simulation check: %s\n", (err_ctr == 0u) ? "PASS" : "FAIL"));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SIMULATION CHECK EVENT
+*
+* Description : Adds an event to the trace hash of the simulation check (see 'AppBenchSim()  Note #1').
+*
+* Argument(s) : src         is the source of the event : the task, APP_BENCH_SIM_SRC_TMR or a pend
+*                           timeout (APP_BENCH_SIM_SRC_TIMEOUT).
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Events after the end of the run are not hashed : the tasks finish on their next wake-up.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_SIM_EN == DEF_ENABLED)
+static  void  AppBenchSimEvt (CPU_INT08U  src)
+{
+    CPU_INT64U  evt;
+
+
+    if (AppBenchSimRun == DEF_NO) {                             /* See Note #1.                                         */
+        return;
+    }
+    evt             = ((CPU_INT64U)(OSTimeGet() - AppBenchSimTickStart) << 8u) | src;
+    AppBenchSimHash = (AppBenchSimHash ^ evt) * 1099511628211uLL;   /* FNV-1a prime.                                    */
+    AppBenchSimEvtCtr++;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  SIMULATION CHECK TASKS & TIMER
+*
+* Description : The sources of events of the simulation check.  The tasks delete themselves once the run is
+*               over.
+*
+* Argument(s) : p_arg       is the task's index in AppBenchSimPeriodTbl[], unused by the timer.
+*
+*               ptmr        is the timer, unused.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_SIM_EN == DEF_ENABLED)
+static  void  AppTaskBenchSim (void  *p_arg)
+{
+    CPU_INT08U  src;
+    INT8U       err;
+
+
+    src = (CPU_INT08U)(CPU_ADDR)p_arg;
+    while (AppBenchSimRun == DEF_YES) {
+        if (src == APP_BENCH_SIM_SRC_PEND) {
+            OSSemPend(AppBenchSimSem, AppBenchSimPeriodTbl[src], &err);
+            AppBenchSimEvt((err == OS_ERR_TIMEOUT) ? (src | APP_BENCH_SIM_SRC_TIMEOUT) : src);
+        } else {
+            OSTimeDly(AppBenchSimPeriodTbl[src]);
+            AppBenchSimEvt(src);
+        }
+    }
+    (void)OSSemPost(AppBenchSimSemDone);
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+
+static  void  AppBenchSimTmrCallback (void  *ptmr,
+                                      void  *p_arg)
+{
+   (void)ptmr;
+   (void)p_arg;
+
+    AppBenchSimEvt(APP_BENCH_SIM_SRC_TMR);
+    (void)OSSemPost(AppBenchSimSem);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            EDF CHECK
+*
+* Description : Runs a set of periodic EDF tasks & counts the jobs that complete after their deadline.  The
+*               same set runs twice : feasible (50% of the CPU), where no job may miss its deadline, then
+*               overloaded (150%), where the miss counters must show it.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Each job runs for its share of the CPU (AppBenchEdfUtilTbl[]) of its period, not counting
+*                   the time it was preempted (see AppTaskBenchEdf()).  Its deadline is its period.
+*
+*               (2) The feasible set leaves half the CPU idle & its periods are long : the host may take the
+*                   CPU away for tens of milliseconds, which a set closer to 100% does not always absorb.
+*
+*               (3) Measured on the development host, 10 s per run, periods of 20, 30 & 50 ticks :
+*
+*                                   Jobs           Deadline misses
+*                     Feasible     50 / 34 / 20       0 /  0 /  0
+*                     Overloaded   32 / 21 / 13      30 / 20 / 13
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_EDF_EN == DEF_ENABLED)
+static  void  AppBenchEdf (void)
+{
+    CPU_INT32U  pass;
+    CPU_INT32U  scale;
+    CPU_INT32U  ix;
+    CPU_INT32U  miss_ctr;
+    INT8U       err;
+
+
+    for (pass = 0u; pass < 2u; pass++) {
+        scale = (pass == 0u) ? 100u : 300u;                     /* 50% of the CPU, then 150%.                           */
+        for (ix = 0u; ix < APP_BENCH_EDF_TASK_NBR; ix++) {
+            AppBenchEdfWork[ix]    = (CPU_INT64U)AppBenchEdfPeriodTbl[ix] * (1000000000u / OS_TICKS_PER_SEC)
+                                   *  AppBenchEdfUtilTbl[ix] * scale / 10000u;  /* See Note #1.                    */
+            AppBenchEdfJobCtr[ix]  = 0u;
+            AppBenchEdfMissCtr[ix] = 0u;
+        }
+        AppBenchEdfRun     = DEF_YES;
+        AppBenchEdfSemDone = OSSemCreate(0u);
+
+        OSTimeDly(1u);                                          /* Release the first jobs together, on a tick.          */
+        for (ix = 0u; ix < APP_BENCH_EDF_TASK_NBR; ix++) {
+            (void)OSTaskCreateEDF(AppTaskBenchEdf,
+                                  (void   *)(CPU_ADDR)ix,
+                                  (OS_STK *)&AppTaskEdfStk[ix][APP_TASK_BENCH_STK_SIZE - 1u],
+                                  (INT8U   )(OS_SCHED_EDF_PRIO + ix),
+                                  (INT16U  )(OS_SCHED_EDF_PRIO + ix),
+                                  (OS_STK *)&AppTaskEdfStk[ix][0],
+                                  (INT32U  ) APP_TASK_BENCH_STK_SIZE,
+                                  (void   *) 0,
+                                  (INT16U  )(OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR),
+                                  (INT32U  ) 0u,
+                                  (INT32U  ) AppBenchEdfPeriodTbl[ix]);
+        }
+
+        OSTimeDly(APP_BENCH_EDF_DLY);
+        AppBenchEdfRun = DEF_NO;
+        for (ix = 0u; ix < APP_BENCH_EDF_TASK_NBR; ix++) {
+            OSSemPend(AppBenchEdfSemDone, 0u, &err);
+        }
+        OSTimeDly(1u);                                          /* Let the tasks delete themselves.                     */
+        (void)OSSemDel(AppBenchEdfSemDone, OS_DEL_ALWAYS, &err);
+
+        miss_ctr = 0u;
+        for (ix = 0u; ix < APP_BENCH_EDF_TASK_NBR; ix++) {
+            miss_ctr += AppBenchEdfMissCtr[ix];
+        }
+        APP_TRACE_INFO(("EDF check, %3u%% of the CPU: jobs %u / %u / %u, deadline misses %u / %u / %u, %s\n",
+                        (unsigned)(50u * scale / 100u),
+                        (unsigned)AppBenchEdfJobCtr[0],
+                        (unsigned)AppBenchEdfJobCtr[1],
+                        (unsigned)AppBenchEdfJobCtr[2],
+                        (unsigned)AppBenchEdfMissCtr[0],
+                        (unsigned)AppBenchEdfMissCtr[1],
+                        (unsigned)AppBenchEdfMissCtr[2],
+                        (((pass == 0u) && (miss_ctr == 0u)) || ((pass != 0u) && (miss_ctr != 0u))) ? "PASS" : "FAIL"));
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            EDF CHECK TASK
+*
+* Description : Periodic EDF task of the EDF check : runs one job per period, until the end of the run.  It
+*               then reports its deadline miss counter & deletes itself.
+*
+* Argument(s) : p_arg       is the task's index in AppBenchEdfPeriodTbl[].
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A job polls the timestamp until it has run for AppBenchEdfWork[] : a gap longer than
+*                   APP_BENCH_EDF_GAP_NS between two readings is a preemption, by another task or by the
+*                   host, & does not count.  A loop count would not do : the speed of the host varies.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_EDF_EN == DEF_ENABLED)
+static  void  AppTaskBenchEdf (void  *p_arg)
+{
+    OS_TCB      tcb;
+    CPU_INT32U  ix;
+    CPU_INT64U  run;
+    CPU_TS64    ts;
+    CPU_TS64    ts_prev;
+
+
+    ix = (CPU_INT32U)(CPU_ADDR)p_arg;
+    while (AppBenchEdfRun == DEF_YES) {
+        run     = 0u;
+        ts_prev = CPU_TS_Get64();
+        while (run < AppBenchEdfWork[ix]) {                     /* See Note #1.                                         */
+            ts = CPU_TS_Get64();
+            if ((ts - ts_prev) < APP_BENCH_EDF_GAP_NS) {
+                run += ts - ts_prev;
+            }
+            ts_prev = ts;
+        }
+        AppBenchEdfJobCtr[ix]++;
+        (void)OSTimeDlyPeriod();
+    }
+
+    (void)OSTaskQuery(OS_PRIO_SELF, &tcb);
+    AppBenchEdfMissCtr[ix] = tcb.OSTCBEdfMissCtr;
+    (void)OSSemPost(AppBenchEdfSemDone);
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     MULTI-INSTANCE BENCHMARK
+*
+* Description : Runs APP_BENCH_MULTI_INST_NBR kernel instances side by side, each in its own host thread,
+*               & checks that they all run the same workload the same way.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Each host thread selects its instance with OSKernelSet(), then calls OSInit() & OSStart(),
+*                   as main() does for the default instance.  The instances keep running once the workload
+*                   is done, idle.
+*
+*               (2) The workload of each instance is two periodic delays, a semaphore pend with a timeout
+*                   & a periodic timer posting the semaphore.  It only depends on the instance's own ticks,
+*                   so all the instances must record the same trace.
+*
+*               (3) Measured on the development host, 4 instances at 100 ticks/s : 174 events each over the
+*                   500 ticks, all the traces equal.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_MULTI_EN == DEF_ENABLED)
+static  void  AppBenchMulti (void)
+{
+    pthread_t         thread;
+    APP_BENCH_MULTI  *p_inst;
+    CPU_INT32U        diff_ctr;
+    CPU_INT32U        i;
+
+
+    CPU_Init();
+    (void)sem_init(&AppBenchMultiDone, 0, 0u);
+
+    for (i = 0u; i < APP_BENCH_MULTI_INST_NBR; i++) {
+        if (pthread_create(&thread, (pthread_attr_t *)0, AppBenchMultiThread, (void *)&AppBenchMultiTbl[i]) != 0) {
+            APP_TRACE_INFO(("Multi-instance: cannot create the host thread of instance %u\n", (unsigned)i));
+            return;
+        }
+        (void)pthread_detach(thread);
+    }
+    for (i = 0u; i < APP_BENCH_MULTI_INST_NBR; i++) {
+        while (sem_wait(&AppBenchMultiDone) != 0) {             /* Retry when interrupted by a signal.                  */
+            ;
+        }
+    }
+
+    diff_ctr = 0u;
+    for (i = 0u; i < APP_BENCH_MULTI_INST_NBR; i++) {
+        p_inst = &AppBenchMultiTbl[i];
+        APP_TRACE_INFO(("Multi-instance %u: %4u events in %u ticks, trace %016llx\n",
+                        (unsigned)i,
+                        (unsigned)p_inst->EvtCtr,
+                        (unsigned)p_inst->Ticks,
+                        (unsigned long long)p_inst->Trace));
+        if ((p_inst->Trace != AppBenchMultiTbl[0].Trace) ||
+            (p_inst->Ticks != AppBenchMultiTbl[0].Ticks)) {
+            diff_ctr++;
+        }
+    }
+    APP_TRACE_INFO(("Multi-instance: %u instances, %s\n",
+                    (unsigned)APP_BENCH_MULTI_INST_NBR,
+                    (diff_ctr == 0u) ? "PASS" : "FAIL (traces differ)"));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  MULTI-INSTANCE BENCHMARK HOST THREAD
+*
+* Description : Initializes & starts one kernel instance.
+*
+* Argument(s) : p_arg       is the instance, an APP_BENCH_MULTI.
+*
+* Return(s)   : none, multitasking never returns.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_MULTI_EN == DEF_ENABLED)
+static  void  *AppBenchMultiThread (void  *p_arg)
+{
+    APP_BENCH_MULTI  *p_inst;
+
+
+    p_inst        = (APP_BENCH_MULTI *)p_arg;
+    p_inst->Trace =  0xCBF29CE484222325u;                       /* FNV-1a offset basis.                                 */
+
+    OSKernelSet(&p_inst->Kernel);                               /* See 'AppBenchMulti()  Note #1'.                      */
+    OSInit();
+
+    (void)OSTaskCreate((void(*)(void *))AppTaskBenchMulti,
+                       (void   *) 0,
+                       (OS_STK *)&p_inst->Stk[0][APP_TASK_BENCH_STK_SIZE - 1u],
+                       (INT8U   ) APP_TASK_BENCH_PRIO);
+
+    OSStart();
+
+    return ((void *)0);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    MULTI-INSTANCE BENCHMARK EVENT
+*
+* Description : Adds an event & the tick it occurred at to the trace of the calling task's instance, until
+*               the workload is done.
+*
+* Argument(s) : id          identifies the event.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The instance's OS_KERNEL is the first member of its APP_BENCH_MULTI.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_MULTI_EN == DEF_ENABLED)
+static  void  AppBenchMultiEvt (CPU_INT08U  id)
+{
+    APP_BENCH_MULTI  *p_inst;
+    CPU_INT64U        evt;
+
+
+    p_inst = (APP_BENCH_MULTI *)OSKernelGet();                  /* See Note #1.                                         */
+    if (p_inst->Done == DEF_YES) {
+        return;
+    }
+    evt           = ((CPU_INT64U)OSTimeGet() << 8u) | id;
+    p_inst->Trace = (p_inst->Trace ^ evt) * 0x100000001B3u;     /* FNV-1a step.                                         */
+    p_inst->EvtCtr++;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 MULTI-INSTANCE BENCHMARK TASKS & TIMER
+*
+* Description : The workload of each instance (see 'AppBenchMulti()  Note #2').  AppTaskBenchMulti()
+*               creates the other tasks & the timer, waits APP_BENCH_MULTI_DLY ticks & reports.
+*
+* Argument(s) : p_arg       is the period of AppTaskBenchMultiDly(), in ticks, unused otherwise.
+*
+*               ptmr        is the timer, unused.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_MULTI_EN == DEF_ENABLED)
+static  void  AppTaskBenchMulti (void  *p_arg)
+{
+    APP_BENCH_MULTI  *p_inst;
+    OS_TMR           *p_tmr;
+    INT8U             err;
+
+
+   (void)p_arg;
+
+    p_inst      = (APP_BENCH_MULTI *)OSKernelGet();
+    p_inst->Sem =  OSSemCreate(0u);
+    p_tmr       =  OSTmrCreate(3u, 3u, OS_TMR_OPT_PERIODIC, AppBenchMultiTmrCallback, (void *)0, (INT8U *)"Multi", &err);
+    (void)OSTmrStart(p_tmr, &err);
+
+    (void)OSTaskCreate(AppTaskBenchMultiDly,  (void *)(CPU_ADDR) 7u, &p_inst->Stk[1][APP_TASK_BENCH_STK_SIZE - 1u], APP_TASK_BENCH_PRIO + 1u);
+    (void)OSTaskCreate(AppTaskBenchMultiDly,  (void *)(CPU_ADDR)13u, &p_inst->Stk[2][APP_TASK_BENCH_STK_SIZE - 1u], APP_TASK_BENCH_PRIO + 2u);
+    (void)OSTaskCreate(AppTaskBenchMultiPend, (void *) 0,            &p_inst->Stk[3][APP_TASK_BENCH_STK_SIZE - 1u], APP_TASK_BENCH_PRIO + 3u);
+
+    OSTimeDly(APP_BENCH_MULTI_DLY);
+    p_inst->Ticks = OSTimeGet();                                /* Highest priority : runs first at its tick.           */
+    p_inst->Done  = DEF_YES;                                    /* Freeze the trace.                                    */
+    (void)sem_post(&AppBenchMultiDone);
+
+    while (DEF_ON) {
+        OSTimeDlyHMSM(0u, 0u, 1u, 0u);
+    }
+}
+
+static  void  AppTaskBenchMultiDly (void  *p_arg)
+{
+    INT32U  dly;
+
+
+    dly = (INT32U)(CPU_ADDR)p_arg;
+    while (DEF_ON) {
+        OSTimeDly(dly);
+        AppBenchMultiEvt((CPU_INT08U)dly);
+    }
+}
+
+static  void  AppTaskBenchMultiPend (void  *p_arg)
+{
+    APP_BENCH_MULTI  *p_inst;
+    INT8U             err;
+
+
+   (void)p_arg;
+
+    p_inst = (APP_BENCH_MULTI *)OSKernelGet();
+    while (DEF_ON) {
+        OSSemPend(p_inst->Sem, 11u, &err);
+        AppBenchMultiEvt((err == OS_ERR_TIMEOUT) ? 1u : 2u);
+    }
+}
+
+static  void  AppBenchMultiTmrCallback (void  *ptmr,
+                                        void  *p_arg)
+{
+    APP_BENCH_MULTI  *p_inst;
+
+
+   (void)ptmr;
+   (void)p_arg;
+
+    p_inst = (APP_BENCH_MULTI *)OSKernelGet();
+    AppBenchMultiEvt(3u);
+    (void)OSSemPost(p_inst->Sem);
+}
+#endif
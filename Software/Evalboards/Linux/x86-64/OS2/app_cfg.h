@@ -0,0 +1,118 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*                          (c) Copyright 2009-2011; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      APPLICATION CONFIGURATION
+*
+*                                            Linux x86-64
+*
+* Filename      : app_cfg.h
+* Version       : V1.00
+* Programmer(s) : FGK
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CFG_MODULE_PRESENT
+#define  APP_CFG_MODULE_PRESENT
+
+
+#define  OS_TASK_TMR_PRIO                        (OS_LOWEST_PRIO - 2)
+#define  OS_TASK_INT_Q_PRIO                                0u
+#define  OS_TASK_TMR_WORKER_PRIO                (OS_LOWEST_PRIO - 20)
+#define  OS_TASK_HRT_PRIO                                  1u
+
+/*
+*********************************************************************************************************
+*                                          TASKS PRIORITIES
+*********************************************************************************************************
+*/
+
+#define  APP_TASK_PONG_PRIO                                3u
+#define  APP_TASK_START_PRIO                               4u
+#define  APP_TASK_BENCH_PRIO                              10u   /* First of the benchmark tasks' priorities.            */
+
+/*
+*********************************************************************************************************
+*                                          TASK STACK SIZES
+*********************************************************************************************************
+*/
+
+#define  APP_TASK_PONG_STK_SIZE                         2048u
+#define  APP_TASK_START_STK_SIZE                        2048u
+#define  APP_TASK_BENCH_STK_SIZE                        2048u
+
+/*
+*********************************************************************************************************
+*                                        BENCHMARK CONFIGURATION
+*
+* Note(s) : (1) The start task runs each benchmark enabled here once, before the context switch benchmark
+*               (see 'app.c  Note #2').  Each needs the kernel option given with it, in 'os_cfg.h'.
+*
+*           (2) The multi-instance benchmark runs from main() instead, before the default kernel instance
+*               is initialized (see 'app.c  Note #4').
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_BENCH_SMP_EN                   DEF_DISABLED    /* Throughput vs nbr of cores      (OS_SMP_EN).         */
+#define  APP_CFG_BENCH_STEAL_EN                 DEF_DISABLED    /* Tasks stolen by idle cores      (OS_SMP_STEAL_EN).   */
+#define  APP_CFG_BENCH_FLAG_EN                  DEF_DISABLED    /* Post to 200 flag waiters        (OS_SCHED_RR_EN).    */
+#define  APP_CFG_BENCH_TICK_EN                  DEF_DISABLED    /* Tick cost vs nbr of tasks       (OS_SCHED_RR_EN).    */
+#define  APP_CFG_BENCH_CNTZ_EN                  DEF_DISABLED    /* Highest ready prio lookup       (none).              */
+#define  APP_CFG_BENCH_TMR_EN                   DEF_DISABLED    /* Timer tick cost vs nbr of timers (OS_TMR_EN).        */
+#define  APP_CFG_BENCH_QV_EN                    DEF_DISABLED    /* By-value vs pointer queue       (OS_QV_EN).          */
+#define  APP_CFG_BENCH_THRESHOLD_EN             DEF_DISABLED    /* Switches in a pipeline          (OS_Q_EN).           */
+#define  APP_CFG_BENCH_ISR_EN                   DEF_DISABLED    /* Broadcast from an ISR           (OS_MBOX_EN).        */
+#define  APP_CFG_BENCH_TICKLESS_EN              DEF_DISABLED    /* Same wake ticks, tickless or not (OS_TMR_EN).        */
+#define  APP_CFG_BENCH_SIM_EN                   DEF_DISABLED    /* Same trace twice, host time (OS_CPU_CFG_SIM_EN).     */
+#define  APP_CFG_BENCH_EDF_EN                   DEF_DISABLED    /* Deadline misses of EDF tasks    (OS_SCHED_EDF_EN).   */
+#define  APP_CFG_BENCH_MULTI_EN                 DEF_DISABLED    /* Kernel instances, one per thread (OS_MULTI_INST_EN). */
+
+/*
+*********************************************************************************************************
+*                                     TRACE / DEBUG CONFIGURATION
+*********************************************************************************************************
+*/
+
+#define  TRACE_LEVEL_OFF                       0u
+#define  TRACE_LEVEL_INFO                      1u
+#define  TRACE_LEVEL_DBG                       2u
+
+#define  APP_TRACE_LEVEL                TRACE_LEVEL_DBG
+#define  APP_TRACE                      printf
+
+#define  APP_TRACE_INFO(x)            ((APP_TRACE_LEVEL >= TRACE_LEVEL_INFO) ? (void)(APP_TRACE x) : (void)0)
+#define  APP_TRACE_DBG(x)             ((APP_TRACE_LEVEL >= TRACE_LEVEL_DBG)  ? (void)(APP_TRACE x) : (void)0)
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of APP cfg module include.                       */
@@ -0,0 +1,57 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*                          (c) Copyright 2009-2011; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                         MASTER INCLUDE FILE
+*
+*                                            Linux x86-64
+*
+* Filename      : includes.h
+* Version       : V1.00
+* Programmer(s) : FGK
+*********************************************************************************************************
+*/
+
+                                                                /* ---------------- STANDARD LIBRARIES ---------------- */
+#include  <stdarg.h>
+#include  <stdio.h>
+#include  <string.h>
+#include  <ctype.h>
+#include  <stdlib.h>
+
+
+                                                                /* ----------------- MICRIUM LIBRARIES ---------------- */
+#include  <cpu.h>
+
+#include  <lib_def.h>
+#include  <lib_ascii.h>
+#include  <lib_math.h>
+#include  <lib_mem.h>
+#include  <lib_str.h>
+
+
+                                                                /* ----------------- APPLICATION / BSP ---------------- */
+#include  <app_cfg.h>
+#include  <bsp.h>
+
+
+                                                                /* --------------------- uC/OS-II --------------------- */
+#include  <os.h>
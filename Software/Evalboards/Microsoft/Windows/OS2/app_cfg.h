@@ -42,6 +42,9 @@
 
 
 #define  OS_TASK_TMR_PRIO                        (OS_LOWEST_PRIO - 2)
+#define  OS_TASK_INT_Q_PRIO                                0u
+#define  OS_TASK_TMR_WORKER_PRIO                (OS_LOWEST_PRIO - 20)
+#define  OS_TASK_HRT_PRIO                                  1u
 
 /*
 *********************************************************************************************************
@@ -128,6 +128,18 @@
 *                   for the majority of non-cached interrupts disabled time measurements.
 *
 *                   See also 'cpu_core.c  CPU_IntDisMeasInit()  Note #3a'.
+*
+*               (c) Configure CPU_CFG_INT_DIS_PROF_EN to attribute each interrupts disabled time measured
+*                   to the source file & line of its critical section enter :
+*
+*                   (a)  Enabled,       if CPU_CFG_INT_DIS_PROF_EN      #define'd in 'cpu_cfg.h'
+*
+*                   (b) Disabled,       if CPU_CFG_INT_DIS_PROF_EN  NOT #define'd in 'cpu_cfg.h'
+*
+*                   CPU_CFG_INT_DIS_PROF_SITE_NBR configures the number of critical section sites
+*                   profiled.  CPU_CFG_INT_DIS_MEAS_EN MUST also be #define'd.
+*
+*                   See also 'cpu_core.c  CPU_IntDisProfGet()'.
 *********************************************************************************************************
 */
 
@@ -138,6 +150,13 @@
                                                                 /* Configure number of interrupts disabled overhead ... */
 #define  CPU_CFG_INT_DIS_MEAS_OVRHD_NBR                    1    /* ... time measurements (see Note #1b).                */
 
+#if 0                                                           /* Configure CPU interrupts disabled time profiler ...  */
+#define  CPU_CFG_INT_DIS_PROF_EN                                /* ... per critical section site (see Note #1c).        */
+#endif
+
+                                                                /* Configure number of critical section sites ...       */
+#define  CPU_CFG_INT_DIS_PROF_SITE_NBR                    64    /* ... profiled (see Note #1c).                         */
+
 
 /*$PAGE*/
 /*
@@ -162,6 +181,30 @@
 #endif
 
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                               CPU COUNT TRAILING ZEROS CONFIGURATION
+*
+* Note(s) : (1) Configure CPU_CFG_TRAIL_ZEROS_ASM_PRESENT to prototype/define count trailing zeros bits 
+*               function(s) in :
+*
+*               (a) 'cpu.h'/'cpu_c.c',         if CPU_CFG_TRAIL_ZEROS_ASM_PRESENT     #define'd in 'cpu.h'/
+*                                                 'cpu_cfg.h' to enable compiler intrinsic-version function
+*
+*               (b) 'cpu_core.h'/'cpu_core.c', if CPU_CFG_TRAIL_ZEROS_ASM_PRESENT NOT #define'd in 'cpu.h'/
+*                                                 'cpu_cfg.h' to enable C-source-version function otherwise
+*
+*           (2) uC/OS-II uses CPU_CntTrailZeros() to find the highest priority ready task when 
+*               OS_SCHED_CNT_ZEROS_EN is enabled in 'os_cfg.h'.
+*********************************************************************************************************
+*/
+
+#ifdef  _MSC_VER                                                /* Configure CPU count trailing zeros bits ...          */
+#define  CPU_CFG_TRAIL_ZEROS_ASM_PRESENT                        /* ... _BitScanForward() version (see Note #1).         */
+#endif
+
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
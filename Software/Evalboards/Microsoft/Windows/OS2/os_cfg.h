@@ -36,27 +36,50 @@
 #define OS_EVENT_MULTI_EN         1u   /* Include code for OSEventPendMulti()                          */
 #define OS_EVENT_NAME_EN          1u   /* Enable names for Sem, Mutex, Mbox and Q                      */
 
+#define OS_INT_Q_SIZE            16u   /* Number of ISR posts that can be deferred at once             */
+#define OS_ISR_POST_DEFERRED_EN   0u   /* ISRs queue their posts, a kernel task performs them          */
+
 #define OS_LOWEST_PRIO           63u   /* Defines the lowest priority that can be assigned ...         */
-                                       /* ... MUST NEVER be higher than 254!                           */
+                                       /* ... MUST NEVER be higher than 4095!                          */
 
 #define OS_MAX_EVENTS            10u   /* Max. number of event control blocks in your application      */
 #define OS_MAX_FLAGS              5u   /* Max. number of Event Flag Groups    in your application      */
 #define OS_MAX_MEM_PART           5u   /* Max. number of memory partitions                             */
 #define OS_MAX_QS                 4u   /* Max. number of queue control blocks in your application      */
+#define OS_MAX_QVS                4u   /* Max. number of by-value queues in your application           */
 #define OS_MAX_TASKS             20u   /* Max. number of tasks in your application, MUST be >= 2       */
 
+#define OS_MULTI_INST_EN          0u   /* One kernel instance per host thread (OSKernelSet())          */
+
+#define OS_SCHED_CNT_ZEROS_EN     0u   /* Find highest ready prio with CPU_CntTrailZeros(), no table   */
+#define OS_SCHED_EDF_EN           0u   /* Schedule the EDF priority band by earliest deadline first    */
+#define OS_SCHED_EDF_PRIO        32u   /* Highest priority of the EDF band (EDF tasks use >= this)     */
+#define OS_SCHED_RR_EN            0u   /* Let tasks share a priority, time sliced round-robin          */
+#define OS_SCHED_RR_QUANTUM      10u   /* Default time quantum of a shared priority (in ticks)         */
+#define OS_SCHED_THRESHOLD_EN     0u   /* Let tasks set a preemption threshold above their priority    */
 #define OS_SCHED_LOCK_EN          1u   /* Include code for OSSchedLock() and OSSchedUnlock()           */
+#define OS_SMP_EN                 0u   /* Run the kernel on several cores, one ready list per core     */
+#define OS_SMP_CORE_NBR           4u   /* Number of cores when OS_SMP_EN is enabled (2..32)            */
+#define OS_SMP_STEAL_EN           1u   /* Let an idle core steal ready tasks from the busiest core     */
 
+#define OS_TICK_LIST_EN           1u   /* Keep delayed tasks in a delta list: tick cost O(expired)     */
 #define OS_TICK_STEP_EN           1u   /* Enable tick stepping feature for uC/OS-View                  */
+#define OS_TICKLESS_EN            0u   /* Suppress idle ticks, wake at next deadline (needs tick list) */
 #define OS_TICKS_PER_SEC        100u   /* Set the number of ticks in one second                        */
 
 #define OS_TLS_TBL_SIZE           0u   /* Size of Thread-Local Storage Table                           */
 
+#define OS_TRACE_EN               0u   /* Record kernel events into a trace buffer per core            */
+#define OS_TRACE_BUF_SIZE      1024u   /* Trace records buffered per core (power of 2)                 */
+
 
                                        /* --------------------- TASK STACK SIZE ---------------------- */
 #define OS_TASK_TMR_STK_SIZE    128u   /* Timer      task stack size (# of OS_STK wide entries)        */
 #define OS_TASK_STAT_STK_SIZE   128u   /* Statistics task stack size (# of OS_STK wide entries)        */
 #define OS_TASK_IDLE_STK_SIZE   128u   /* Idle       task stack size (# of OS_STK wide entries)        */
+#define OS_TASK_INT_Q_STK_SIZE  128u   /* ISR post   task stack size (# of OS_STK wide entries)        */
+#define OS_TASK_TMR_WORKER_STK_SIZE 128u /* Timer worker task stack size (# of OS_STK wide entries)    */
+#define OS_TASK_HRT_STK_SIZE    128u   /* HR timer   task stack size (# of OS_STK wide entries)        */
 
 
                                        /* --------------------- TASK MANAGEMENT ---------------------- */
@@ -64,6 +87,8 @@
 #define OS_TASK_CREATE_EN         1u   /*     Include code for OSTaskCreate()                          */
 #define OS_TASK_CREATE_EXT_EN     1u   /*     Include code for OSTaskCreateExt()                       */
 #define OS_TASK_DEL_EN            1u   /*     Include code for OSTaskDel()                             */
+#define OS_TASK_LAT_EN            0u   /*     Histogram of ISR post to task run latency, per task      */
+#define OS_TASK_LAT_HIST_SIZE    24u   /*     Latency buckets per task (bucket n: 2^n TS counts)       */
 #define OS_TASK_NAME_EN           1u   /*     Enable task names                                        */
 #define OS_TASK_PROFILE_EN        1u   /*     Include variables in OS_TCB for profiling                */
 #define OS_TASK_QUERY_EN          1u   /*     Include code for OSTaskQuery()                           */
@@ -78,10 +103,12 @@
 #define OS_FLAG_EN                1u   /* Enable (1) or Disable (0) code generation for EVENT FLAGS    */
 #define OS_FLAG_ACCEPT_EN         1u   /*     Include code for OSFlagAccept()                          */
 #define OS_FLAG_DEL_EN            1u   /*     Include code for OSFlagDel()                             */
+#define OS_FLAG_INDEX_EN          1u   /*     Bucket waiters by flags, for faster OSFlagPost()         */
+#define OS_FLAG_MULTI_EN          1u   /*     Include code for OSFlagPendMulti()                       */
 #define OS_FLAG_NAME_EN           1u   /*     Enable names for event flag group                        */
 #define OS_FLAG_QUERY_EN          1u   /*     Include code for OSFlagQuery()                           */
 #define OS_FLAG_WAIT_CLR_EN       1u   /* Include code for Wait on Clear EVENT FLAGS                   */
-#define OS_FLAGS_NBITS           16u   /* Size in #bits of OS_FLAGS data type (8, 16 or 32)            */
+#define OS_FLAGS_NBITS           16u   /* Size in #bits of OS_FLAGS data type (8, 16, 32 or 64)        */
 
 
                                        /* -------------------- MESSAGE MAILBOXES --------------------- */
@@ -119,6 +146,10 @@
 #define OS_Q_QUERY_EN             1u   /*     Include code for OSQQuery()                              */
 
 
+                                       /* ------------------ BY-VALUE MESSAGE QUEUES ----------------- */
+#define OS_QV_EN                  0u   /* Enable (1) or Disable (0) code generation for BY-VALUE Qs    */
+
+
                                        /* ------------------------ SEMAPHORES ------------------------ */
 #define OS_SEM_EN                 1u   /* Enable (1) or Disable (0) code generation for SEMAPHORES     */
 #define OS_SEM_ACCEPT_EN          1u   /*    Include code for OSSemAccept()                            */
@@ -139,7 +170,18 @@
 #define OS_TMR_EN                 1u   /* Enable (1) or Disable (0) code generation for TIMERS         */
 #define OS_TMR_CFG_MAX           16u   /*     Maximum number of timers                                 */
 #define OS_TMR_CFG_NAME_EN        1u   /*     Determine timer names                                    */
+#define OS_TMR_CFG_POOL_ADD_EN    1u   /*     Include code for OSTmrPoolAdd()                          */
+#define OS_TMR_CFG_WHEEL_HIER_EN  1u   /*     Cascading wheel, 6 levels of 64 spokes (no WHEEL_SIZE)   */
 #define OS_TMR_CFG_WHEEL_SIZE     7u   /*     Size of timer wheel (#Spokes)                            */
+#define OS_TMR_CFG_SLACK_EN       0u   /*     Coalesce timer expiries within a per-timer slack         */
+#define OS_TMR_CFG_WORKER_EN      0u   /*     Run timer callbacks in worker tasks, scheduler unlocked  */
+#define OS_TMR_CFG_WORKER_NBR     2u   /*     Number of timer worker tasks (1..16)                     */
+#define OS_TMR_CFG_WORKER_Q_SIZE 32u   /*     Callbacks queued per worker task                         */
 #define OS_TMR_CFG_TICKS_PER_SEC 10u   /*     Rate at which timer management task runs (Hz)            */
 
+
+                                       /* ------------------ HIGH-RESOLUTION TIMERS ------------------ */
+#define OS_HRT_EN                 0u   /* One-shot timers on CPU timestamps, independent of the tick   */
+#define OS_HRT_CFG_MAX           16u   /*     Maximum number of high-resolution timers                 */
+
 #endif
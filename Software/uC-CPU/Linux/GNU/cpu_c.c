@@ -0,0 +1,710 @@
+/*
+*********************************************************************************************************
+*                                                uC/CPU
+*                                    CPU CONFIGURATION & PORT LAYER
+*
+*                          (c) Copyright 2004-2013; Micrium, Inc.; Weston, FL
+*
+*               All rights reserved.  Protected by international copyright laws.
+*
+*               uC/CPU is provided in source form to registered licensees ONLY.  It is
+*               illegal to distribute this source code to any third party unless you receive
+*               written permission by an authorized Micrium representative.  Knowledge of
+*               the source code may NOT be used to develop a similar product.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                            CPU PORT FILE
+*
+*                                            Linux x86-64
+*                                                 GNU
+*
+* Filename      : cpu_c.c
+* Version       : V1.29.02.00
+* Programmer(s) : FGK
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  <cpu.h>
+#include  <cpu_core.h>
+
+#include  <errno.h>
+#include  <pthread.h>
+#include  <signal.h>
+#include  <string.h>
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  CPU_INT_SRC_NONE                                0xFFu  /* No source wired to a signal.                         */
+
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+__thread  volatile  CPU_SR        CPU_IntDisFlag;               /* See 'cpu.h  SIMULATED INTERRUPTS  Note #1'.          */
+__thread  volatile  CPU_INT64U    CPU_IntEnMask;
+__thread  volatile  CPU_INT08U    CPU_IntPrioCur;
+__thread            CPU_INT_CTRL  CPU_IntCtrl;
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  __thread  CPU_FNCT_VOID  CPU_IntSrcHandlerTbl[CPU_INT_SRC_NBR_MAX];
+static  __thread  CPU_INT08U     CPU_IntSrcPrioTbl[CPU_INT_SRC_NBR_MAX];
+
+static  CPU_INT08U     CPU_IntSigSrcTbl[CPU_INT_SIG_NBR_MAX];   /* Source wired to each signal, on all the controllers. */
+static  CPU_INT_CTRL  *CPU_IntCtrlDflt;                         /* Controller initialized first (see 'cpu.h  SIMULATED  */
+                                                                /* ... INTERRUPTS  Note #1e').                          */
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        CPU_IntSigHandler(int          sig);
+
+static  void        CPU_IntSigInstall(CPU_INT32U   sig);
+
+static  CPU_INT08U  CPU_IntSrcNext   (CPU_INT08U   prio);
+
+
+/*
+*********************************************************************************************************
+*                                            CPU_IntInit()
+*
+* Description : This function initializes the simulated interrupt controller.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : 1) CPU_IntInit() MUST be called by the host thread that runs the tasks, prior to use any
+*                  other CPU_Int...() function.  Each host thread calling it gets a controller of its own.
+*
+*               2) Interrupts are left disabled until the first task runs.  All the sources are disabled &
+*                  at the lowest priority.
+*
+*               3) The signal wiring is shared by all the controllers & only cleared by the first one.
+*********************************************************************************************************
+*/
+
+void  CPU_IntInit (void)
+{
+    CPU_INT32U     i;
+    CPU_INT_CTRL  *p_ctrl;
+
+
+    CPU_IntDisFlag       = 1u;                                  /* See Note #2.                                         */
+    CPU_IntEnMask        = 0u;
+    CPU_IntPrioCur       = CPU_INT_PRIO_THREAD;
+    CPU_IntCtrl.PendMask = 0u;
+    CPU_IntCtrl.Thread   = pthread_self();
+
+    for (i = 0u; i < CPU_INT_SRC_NBR_MAX; i++) {
+        CPU_IntSrcHandlerTbl[i] = (CPU_FNCT_VOID)0;
+        CPU_IntSrcPrioTbl[i]    =  CPU_INT_PRIO_LOWEST;
+    }
+
+    p_ctrl = (CPU_INT_CTRL *)0;
+    if (__atomic_compare_exchange_n(&CPU_IntCtrlDflt, &p_ctrl, &CPU_IntCtrl,
+                                     0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) != 0) {
+        for (i = 0u; i < CPU_INT_SIG_NBR_MAX; i++) {            /* See Note #3.                                         */
+            CPU_IntSigSrcTbl[i] = CPU_INT_SRC_NONE;
+        }
+        CPU_IntSigInstall(CPU_INT_SIG_RAISE);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          CPU_IntCtrlGet()
+*
+* Description : Get the interrupt controller of the calling host thread.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Pointer to the controller, to raise its sources from other threads (see CPU_IntCtrlSrcPendSet()).
+*
+* Note(s)     : (1) The controller lives as long as the host thread that called CPU_IntInit().
+*********************************************************************************************************
+*/
+
+CPU_INT_CTRL  *CPU_IntCtrlGet (void)
+{
+    return (&CPU_IntCtrl);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            CPU_IntDis()
+*
+* Description : This function disables interrupts for critical sections of code.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  CPU_IntDis (void)
+{
+    (void)CPU_SR_Save();
+}
+
+
+/*
+*********************************************************************************************************
+*                                             CPU_IntEn()
+*
+* Description : This function enables interrupts after critical sections of code.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  CPU_IntEn (void)
+{
+    CPU_SR_Restore(0u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       CPU_IntSrcHandlerSet()
+*
+* Description : Install the interrupt service routine of an interrupt source.
+*
+* Argument(s) : src         Interrupt source (0 to CPU_INT_SRC_NBR_MAX - 1).
+*
+*               isr         Interrupt service routine.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The routine runs on the stack of the interrupted task, as an interrupt does on a real
+*                   CPU.  Task stacks MUST be large enough to hold the signal frame & the nested routines.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcHandlerSet (CPU_INT08U     src,
+                            CPU_FNCT_VOID  isr)
+{
+    CPU_SR_ALLOC();
+
+
+    if (src >= CPU_INT_SRC_NBR_MAX) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    CPU_IntSrcHandlerTbl[src] = isr;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_IntSrcSigSet()
+*
+* Description : Wire a host signal to an interrupt source.
+*
+* Argument(s) : src         Interrupt source (0 to CPU_INT_SRC_NBR_MAX - 1).
+*
+*               sig         Signal number (1 to CPU_INT_SIG_NBR_MAX - 1) raising the source.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A signal delivered to another host thread is forwarded to the kernel thread (see
+*                   'CPU_IntSigHandler()').  Timers should rather signal the kernel thread directly.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcSigSet (CPU_INT08U  src,
+                        CPU_INT32U  sig)
+{
+    if ((src >= CPU_INT_SRC_NBR_MAX) ||
+        (sig == 0u)                  ||
+        (sig >= CPU_INT_SIG_NBR_MAX) ||
+        (sig == CPU_INT_SIG_RAISE)) {
+        return;
+    }
+
+    CPU_IntSigSrcTbl[sig] = src;
+    CPU_IntSigInstall(sig);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_IntSrcDis()
+*
+* Description : Disable an interrupt source.
+*
+* Argument(s) : src         Interrupt source (0 to CPU_INT_SRC_NBR_MAX - 1).
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A disabled source may still be raised; it is serviced once enabled again.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcDis (CPU_INT08U  src)
+{
+    if (src >= CPU_INT_SRC_NBR_MAX) {
+        return;
+    }
+
+    __atomic_fetch_and(&CPU_IntEnMask, ~((CPU_INT64U)1u << src), __ATOMIC_SEQ_CST);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_IntSrcEn()
+*
+* Description : Enable an interrupt source.
+*
+* Argument(s) : src         Interrupt source (0 to CPU_INT_SRC_NBR_MAX - 1).
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A source raised while it was disabled is serviced as soon as interrupts are enabled.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcEn (CPU_INT08U  src)
+{
+    CPU_SR_ALLOC();
+
+
+    if (src >= CPU_INT_SRC_NBR_MAX) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    __atomic_fetch_or(&CPU_IntEnMask, (CPU_INT64U)1u << src, __ATOMIC_SEQ_CST);
+    CPU_CRITICAL_EXIT();                                        /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_IntSrcPendSet()
+*
+* Description : Raise an interrupt source.
+*
+* Argument(s) : src         Interrupt source (0 to CPU_INT_SRC_NBR_MAX - 1).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application, from any host thread or signal handler.
+*
+* Note(s)     : (1) Raised by a host thread without a controller of its own, the source is raised on the
+*                   controller initialized first (see 'cpu.h  SIMULATED INTERRUPTS  Note #1e').
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcPendSet (CPU_INT08U  src)
+{
+    if (pthread_equal(pthread_self(), CPU_IntCtrl.Thread) != 0) {
+        CPU_IntCtrlSrcPendSet(&CPU_IntCtrl, src);
+    } else {
+        CPU_IntCtrlSrcPendSet(CPU_IntCtrlDflt, src);            /* See Note #1.                                         */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       CPU_IntCtrlSrcPendSet()
+*
+* Description : Raise an interrupt source of a given controller.
+*
+* Argument(s) : p_ctrl      Pointer to the controller (see CPU_IntCtrlGet()).
+*
+*               src         Interrupt source (0 to CPU_INT_SRC_NBR_MAX - 1).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application, from any host thread or signal handler.
+*
+* Note(s)     : (1) The controller's thread is only signaled when the source was not already pending : a
+*                   source raised again before its routine runs is serviced once (see 'cpu.h  SIMULATED
+*                   INTERRUPTS  Note #1b').  This also keeps the signal rate bounded at high raise rates.
+*
+*               (2) Raised by the controller's thread itself, e.g. by a task, the source behaves like a
+*                   software interrupt & is serviced at once if interrupts are enabled & its priority is
+*                   high enough.
+*********************************************************************************************************
+*/
+
+void  CPU_IntCtrlSrcPendSet (CPU_INT_CTRL  *p_ctrl,
+                             CPU_INT08U     src)
+{
+    CPU_INT64U  pend;
+    CPU_SR_ALLOC();
+
+
+    if ((p_ctrl == (CPU_INT_CTRL *)0) ||
+        (src    >= CPU_INT_SRC_NBR_MAX)) {
+        return;
+    }
+
+    if (p_ctrl != &CPU_IntCtrl) {
+        pend = __atomic_fetch_or(&p_ctrl->PendMask, (CPU_INT64U)1u << src, __ATOMIC_SEQ_CST);
+        if ((pend & ((CPU_INT64U)1u << src)) == 0u) {           /* See Note #1.                                         */
+            (void)pthread_kill(p_ctrl->Thread, CPU_INT_SIG_RAISE);
+        }
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    __atomic_fetch_or(&CPU_IntCtrl.PendMask, (CPU_INT64U)1u << src, __ATOMIC_SEQ_CST);
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_IntSrcPendClr()
+*
+* Description : Clear the pending state of an interrupt source.
+*
+* Argument(s) : src         Interrupt source (0 to CPU_INT_SRC_NBR_MAX - 1).
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcPendClr (CPU_INT08U  src)
+{
+    if (src >= CPU_INT_SRC_NBR_MAX) {
+        return;
+    }
+
+    __atomic_fetch_and(&CPU_IntCtrl.PendMask, ~((CPU_INT64U)1u << src), __ATOMIC_SEQ_CST);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_IntSrcPrioSet()
+*
+* Description : Set the priority of an interrupt source.
+*
+* Argument(s) : src         Interrupt source (0 to CPU_INT_SRC_NBR_MAX - 1).
+*
+*               prio        Priority, 0 (highest) to CPU_INT_PRIO_LOWEST.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  CPU_IntSrcPrioSet (CPU_INT08U  src,
+                         CPU_INT08U  prio)
+{
+    CPU_SR_ALLOC();
+
+
+    if (src >= CPU_INT_SRC_NBR_MAX) {
+        return;
+    }
+
+    if (prio > CPU_INT_PRIO_LOWEST) {
+        prio = CPU_INT_PRIO_LOWEST;
+    }
+
+    CPU_CRITICAL_ENTER();
+    CPU_IntSrcPrioTbl[src] = prio;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_IntSrcPrioGet()
+*
+* Description : Get the priority of an interrupt source.
+*
+* Argument(s) : src         Interrupt source (0 to CPU_INT_SRC_NBR_MAX - 1).
+*
+* Return(s)   : Priority of the source, if no error(s).
+*
+*               DEF_INT_16S_MIN_VAL, otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT16S  CPU_IntSrcPrioGet (CPU_INT08U  src)
+{
+    if (src >= CPU_INT_SRC_NBR_MAX) {
+        return (DEF_INT_16S_MIN_VAL);
+    }
+
+    return ((CPU_INT16S)CPU_IntSrcPrioTbl[src]);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntPendService()
+*
+* Description : Run the interrupt service routines of the pending sources of higher priority than the
+*               running priority, highest priority first.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_SR_Restore(),
+*               CPU_IntSigHandler().
+*
+* Note(s)     : (1) The pending bit is cleared before the routine runs, so that a source raised again
+*                   meanwhile is serviced once more.
+*
+*               (2) The routine runs with interrupts enabled at the priority of its source, so that only
+*                   sources of higher priority nest.  OSIntEnter() & OSIntExit() track the nesting for the
+*                   kernel.
+*
+*               (3) A routine may switch to another task through OSIntExit().  The rest of the loop then
+*                   runs once this task is resumed.  The running priority is saved with the task (see
+*                   'os_cpu_c.c  OSCtxSw()'), so the other task runs at its own priority meanwhile.
+*
+*               (4) A source raised after the last check but before interrupts are re-enabled is only
+*                   recorded, so the pending sources are checked once more with interrupts enabled.
+*********************************************************************************************************
+*/
+
+void  CPU_IntPendService (void)
+{
+    CPU_INT08U     prio_prev;
+    CPU_INT08U     src;
+    CPU_FNCT_VOID  isr;
+
+
+    prio_prev = CPU_IntPrioCur;
+    do {
+        CPU_IntDisFlag = 1u;
+        CPU_SIG_FENCE();
+
+        src = CPU_IntSrcNext(prio_prev);
+        while (src != CPU_INT_SRC_NONE) {
+                                                                /* See Note #1.                                         */
+            __atomic_fetch_and(&CPU_IntCtrl.PendMask, ~((CPU_INT64U)1u << src), __ATOMIC_SEQ_CST);
+            isr            = CPU_IntSrcHandlerTbl[src];
+            CPU_IntPrioCur = CPU_IntSrcPrioTbl[src];
+            if (isr != (CPU_FNCT_VOID)0) {
+                CPU_SIG_FENCE();
+                CPU_IntDisFlag = 0u;                            /* See Note #2.                                         */
+                isr();                                          /* See Note #3.                                         */
+                CPU_IntDisFlag = 1u;
+                CPU_SIG_FENCE();
+            }
+            CPU_IntPrioCur = prio_prev;
+            src            = CPU_IntSrcNext(prio_prev);
+        }
+
+        CPU_SIG_FENCE();
+        CPU_IntDisFlag = 0u;
+    } while (CPU_IntSrcNext(prio_prev) != CPU_INT_SRC_NONE);    /* See Note #4.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                          CPU_IntSrcNext()
+*
+* Description : Find the pending & enabled source of highest priority.
+*
+* Argument(s) : prio        Running priority.
+*
+* Return(s)   : Pending source of higher priority than 'prio', if any.
+*
+*               CPU_INT_SRC_NONE,                              otherwise.
+*
+* Note(s)     : (1) Of two sources with the same priority, the lowest numbered is serviced first.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  CPU_IntSrcNext (CPU_INT08U  prio)
+{
+    CPU_INT64U  pend;
+    CPU_INT08U  src;
+    CPU_INT08U  src_next;
+
+
+    pend     = CPU_IntCtrl.PendMask & CPU_IntEnMask;
+    src_next = CPU_INT_SRC_NONE;
+    while (pend != 0u) {
+        src   = (CPU_INT08U)__builtin_ctzll(pend);
+        pend &= pend - 1u;
+        if (CPU_IntSrcPrioTbl[src] < prio) {                    /* See Note #1.                                         */
+            prio     = CPU_IntSrcPrioTbl[src];
+            src_next = src;
+        }
+    }
+
+    return (src_next);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntSigInstall()
+*
+* Description : Install the common handler of the signals used as interrupts.
+*
+* Argument(s) : sig         Signal number.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The signal is not blocked while its handler runs (SA_NODEFER), so that a routine of
+*                   higher priority may nest & so that OSIntCtxSw() may switch to another task from within
+*                   the handler without leaving the signal blocked for the whole host thread.
+*********************************************************************************************************
+*/
+
+static  void  CPU_IntSigInstall (CPU_INT32U  sig)
+{
+    struct  sigaction  act;
+
+
+    memset(&act, 0, sizeof(act));
+    sigemptyset(&act.sa_mask);
+    act.sa_handler = CPU_IntSigHandler;
+    act.sa_flags   = SA_NODEFER | SA_RESTART;                   /* See Note #1.                                         */
+    (void)sigaction((int)sig, &act, (struct sigaction *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntSigHandler()
+*
+* Description : Common handler of the signals used as interrupts.
+*
+* Argument(s) : sig         Signal number.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A process-directed signal may be delivered to any host thread that does not block it.
+*                   Caught by a thread without a controller, it is only forwarded (see CPU_IntSrcPendSet()).
+*
+*               (2) 'errno' is shared by all the tasks of the host thread & is preserved for the task this
+*                   signal interrupts.
+*********************************************************************************************************
+*/
+
+static  void  CPU_IntSigHandler (int  sig)
+{
+    CPU_INT08U  src;
+    int         err;
+
+
+    err = errno;                                                /* See Note #2.                                         */
+    src = CPU_IntSigSrcTbl[sig];
+                                                                /* See Note #1.                                         */
+    if (pthread_equal(pthread_self(), CPU_IntCtrl.Thread) == 0) {
+        if (src != CPU_INT_SRC_NONE) {
+            CPU_IntSrcPendSet(src);
+        }
+        errno = err;
+        return;
+    }
+
+    if (src != CPU_INT_SRC_NONE) {
+        __atomic_fetch_or(&CPU_IntCtrl.PendMask, (CPU_INT64U)1u << src, __ATOMIC_SEQ_CST);
+    }
+    if ((CPU_IntDisFlag                            == 0u) &&
+        ((CPU_IntCtrl.PendMask & CPU_IntEnMask) != 0u)) {
+        CPU_IntPendService();
+    }
+    errno = err;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_CntLeadZeros()
+*
+* Description : Count the number of contiguous, most-significant, leading zero bits in a data value.
+*
+* Argument(s) : val         Data value to count leading zero bits.
+*
+* Return(s)   : Number of contiguous, most-significant, leading zero bits in 'val'.
+*
+* Caller(s)   : Application.
+*
+*               This function is an INTERNAL CPU module function but MAY be called by application
+*               function(s).
+*
+* Note(s)     : (1) Supports 64-bit data values; see 'cpu_core.c  CPU_CntLeadZeros()  Note #1' for the
+*                   expected results.
+*
+*               (2) MUST be implemented in cpu_a.asm if and only if CPU_CFG_LEAD_ZEROS_ASM_PRESENT
+*                   is #define'd in 'cpu_cfg.h' or 'cpu.h'.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_LEAD_ZEROS_ASM_PRESENT
+CPU_DATA  CPU_CntLeadZeros (CPU_DATA  val)
+{
+    if (val == 0u) {
+        return (64u);
+    }
+
+    return ((CPU_DATA)__builtin_clzll(val));
+}
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
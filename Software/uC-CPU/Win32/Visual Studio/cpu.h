@@ -318,10 +318,18 @@ typedef  CPU_INT32U                 CPU_SR;                     /* Defines   CPU
 
 
 #ifdef   CPU_CFG_INT_DIS_MEAS_EN
+#ifdef   CPU_CFG_INT_DIS_PROF_EN
+                                                                        /* Disable interrupts, ...                      */
+                                                                        /* & start interrupts disabled time measurement */
+                                                                        /* ... of this critical section site.           */
+#define  CPU_CRITICAL_ENTER()  do { CPU_INT_DIS();                               \
+                                    CPU_IntDisProfStart(__FILE__, __LINE__); } while (0)
+#else
                                                                         /* Disable interrupts, ...                      */
                                                                         /* & start interrupts disabled time measurement.*/
 #define  CPU_CRITICAL_ENTER()  do { CPU_INT_DIS();         \
                                     CPU_IntDisMeasStart(); } while (0)
+#endif
                                                                         /* Stop & measure   interrupts disabled time,   */
                                                                         /* ...  & re-enable interrupts.                 */
 #define  CPU_CRITICAL_EXIT()   do { CPU_IntDisMeasStop();  \
@@ -160,6 +160,11 @@ static  CPU_TS_TMR  CPU_IntDisMeasMaxCalc(CPU_TS_TMR  time_tot_cnts);
 #endif
 
 
+#ifdef  CPU_CFG_INT_DIS_PROF_EN                                     /* --------- CPU INT DIS TIME PROF FNCTS ---------- */
+static  void        CPU_IntDisProfRec    (CPU_TS_TMR  time_tot_cnts);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                     LOCAL CONFIGURATION ERRORS
@@ -1037,11 +1042,176 @@ void  CPU_IntDisMeasStop (void)
         if (CPU_IntDisMeasMax_cnts    < time_ints_disd_cnts) {
             CPU_IntDisMeasMax_cnts    = time_ints_disd_cnts;
         }
+#ifdef  CPU_CFG_INT_DIS_PROF_EN
+        CPU_IntDisProfRec(time_ints_disd_cnts);                     /* Attribute time to crit section site.             */
+#endif
     }
 }
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                         CPU_IntDisProfGet()
+*
+* Description : Get the critical section sites with the longest interrupts disabled times.
+*
+* Argument(s) : p_sites     Pointer to an array of 'nbr_max' sites to receive the sites, sorted by
+*                               decreasing maximum interrupts disabled time.
+*
+*               nbr_max     Maximum number of sites to get.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               CPU_ERR_NONE                    Sites successfully returned.
+*                               CPU_ERR_NULL_PTR                Argument 'p_sites' passed a NULL pointer.
+*
+* Return(s)   : Number of sites returned.
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function 
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) After initialization, 'CPU_IntDisProfSiteTbl[]' MUST ALWAYS be accessed exclusively
+*                   with interrupts disabled -- but NOT with critical sections.
+*
+*               (2) Interrupts are disabled for ONE site at a time, NOT while ALL sites are returned.
+*
+*               (3) The times returned have the interrupts disabled time measurement overhead already
+*                   subtracted (see 'CPU_IntDisMeasMaxCalc()  Note #1b').
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_PROF_EN
+CPU_SIZE_T  CPU_IntDisProfGet (CPU_INT_DIS_PROF_SITE  *p_sites,
+                               CPU_SIZE_T              nbr_max,
+                               CPU_ERR                *p_err)
+{
+    CPU_INT_DIS_PROF_SITE  site;
+    CPU_SIZE_T             nbr;
+    CPU_SIZE_T             ix;
+    CPU_SIZE_T             pos;
+    CPU_SR_ALLOC();
+
+
+    if (p_err == (CPU_ERR *)0) {
+        CPU_SW_EXCEPTION(0u);
+    }
+
+    if (p_sites == (CPU_INT_DIS_PROF_SITE *)0) {
+       *p_err = CPU_ERR_NULL_PTR;
+        return (0u);
+    }
+
+    nbr = 0u;
+    for (ix = 0u; ix < CPU_CFG_INT_DIS_PROF_SITE_NBR; ix++) {
+        CPU_INT_DIS();                                              /* Copy one site at a time (see Note #2).           */
+        site = CPU_IntDisProfSiteTbl[ix];
+        CPU_INT_EN();
+        if (site.FileNamePtr == (const CPU_CHAR *)0) {              /* Skip unused sites.                               */
+            continue;
+        }
+                                                                    /* Insert site by decreasing max time, ...          */
+        pos = nbr;
+        while ((pos > 0u) &&
+               (p_sites[pos - 1u].Max_cnts < site.Max_cnts)) {
+            if (pos < nbr_max) {
+                p_sites[pos] = p_sites[pos - 1u];
+            }
+            pos--;
+        }
+        if (pos < nbr_max) {                                        /* ... keeping only the 'nbr_max' longest.          */
+            p_sites[pos] = site;
+            if (nbr < nbr_max) {
+                nbr++;
+            }
+        }
+    }
+
+   *p_err = CPU_ERR_NONE;
+
+    return (nbr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntDisProfReset()
+*
+* Description : Reset the interrupts disabled time profiler sites.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_IntDisMeasInit(),
+*               Application.
+*
+*               This function is a CPU module application programming interface (API) function 
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) After initialization, 'CPU_IntDisProfSiteTbl[]' MUST ALWAYS be accessed exclusively
+*                   with interrupts disabled -- but NOT with critical sections.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_PROF_EN
+void  CPU_IntDisProfReset (void)
+{
+    CPU_SIZE_T  ix;
+    CPU_SR_ALLOC();
+
+
+    for (ix = 0u; ix < CPU_CFG_INT_DIS_PROF_SITE_NBR; ix++) {
+        CPU_INT_DIS();
+        Mem_Clr((void     *)&CPU_IntDisProfSiteTbl[ix],
+                (CPU_SIZE_T) sizeof(CPU_INT_DIS_PROF_SITE));
+        CPU_INT_EN();
+    }
+    CPU_INT_DIS();
+    CPU_IntDisProfLostCtr = 0u;
+    CPU_INT_EN();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntDisProfStart()
+*
+* Description : Start interrupts disabled time measurement of a critical section site.
+*
+* Argument(s) : p_file_name     Source file of the critical section enter (__FILE__).
+*
+*               line_nbr        Source line of the critical section enter (__LINE__).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_CRITICAL_ENTER().
+*
+*               This function is an INTERNAL CPU module function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) Only the outermost critical section enter identifies the site (see 'cpu_core.h
+*                   CPU INTERRUPTS DISABLED TIME PROFILER SITE DATA TYPE  Note #1').
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_PROF_EN
+void  CPU_IntDisProfStart (const  CPU_CHAR    *p_file_name,
+                                  CPU_INT32U   line_nbr)
+{
+    if (CPU_IntDisNestCtr == 0u) {                                  /* If ints NOT yet dis'd, ...                       */
+        CPU_IntDisProfFileNamePtr = p_file_name;                    /* ... save crit section site (see Note #1).        */
+        CPU_IntDisProfLineNbr     = line_nbr;
+    }
+    CPU_IntDisMeasStart();
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         CPU_CntLeadZeros()
@@ -2248,6 +2418,11 @@ static  void  CPU_IntDisMeasInit (void)
     CPU_IntDisMeasMaxCur_cnts = 0u;
     CPU_IntDisMeasMax_cnts    = 0u;
     CPU_IntDisMeasOvrhd_cnts  = 0u;
+#ifdef  CPU_CFG_INT_DIS_PROF_EN
+    CPU_IntDisProfFileNamePtr = (const CPU_CHAR *)0;            /* See 'CPU_IntDisProfRec()  Note #2'.                  */
+    CPU_IntDisProfLineNbr     = 0u;
+    CPU_IntDisProfReset();
+#endif
 
                                                                 /* ----------- CALC INT DIS TIME MEAS OVRHD ----------- */
     time_meas_tot_cnts = 0u;
@@ -2279,7 +2454,8 @@ static  void  CPU_IntDisMeasInit (void)
 * Return(s)   : Maximum interrupts disabled time (in CPU timestamp timer counts).
 *
 * Caller(s)   : CPU_IntDisMeasMaxCurGet(),
-*               CPU_IntDisMeasMaxGet().
+*               CPU_IntDisMeasMaxGet(),
+*               CPU_IntDisProfRec().
 *
 * Note(s)     : (1) (a) The total amount of time interrupts are disabled by system &/or application code
 *                       during critical sections is calculated by the following equations :
@@ -2383,3 +2559,87 @@ static  CPU_TS_TMR  CPU_IntDisMeasMaxCalc (CPU_TS_TMR  time_tot_cnts)
 }
 #endif
 
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntDisProfRec()
+*
+* Description : Attribute an interrupts disabled time to the current critical section site.
+*
+* Argument(s) : time_tot_cnts   Total interrupt disabled time, in timer counts.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_IntDisMeasStop().
+*
+* Note(s)     : (1) Sites are found by hashing their source file & line into 'CPU_IntDisProfSiteTbl[]',
+*                   probing linearly.  When ALL sites are used, the time is NOT attributed but counted
+*                   in 'CPU_IntDisProfLostCtr'.
+*
+*               (2) Times measured before any critical section enter, such as the measurement overhead
+*                   calibration in CPU_IntDisMeasInit(), are NOT attributed.
+*
+*               (3) Interrupts MUST be disabled.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_PROF_EN
+static  void  CPU_IntDisProfRec (CPU_TS_TMR  time_tot_cnts)
+{
+           CPU_INT_DIS_PROF_SITE  *p_site;
+    const  CPU_CHAR               *p_file_name;
+           CPU_INT32U              line_nbr;
+           CPU_TS_TMR              time_cnts;
+           CPU_SIZE_T              ix;
+           CPU_SIZE_T              ix_start;
+           CPU_DATA                hist_ix;
+
+
+    p_file_name = CPU_IntDisProfFileNamePtr;
+    line_nbr    = CPU_IntDisProfLineNbr;
+    if (p_file_name == (const CPU_CHAR *)0) {                   /* See Note #2.                                         */
+        return;
+    }
+                                                                /* Find site (see Note #1).                             */
+    ix       = (CPU_SIZE_T)((((CPU_ADDR)p_file_name >> 2u) ^ (line_nbr * 31u)) % CPU_CFG_INT_DIS_PROF_SITE_NBR);
+    ix_start =  ix;
+    p_site   = &CPU_IntDisProfSiteTbl[ix];
+    while ((p_site->FileNamePtr != p_file_name) ||
+           (p_site->LineNbr     != line_nbr)) {
+        if (p_site->FileNamePtr == (const CPU_CHAR *)0) {       /* Claim unused site.                                   */
+            p_site->FileNamePtr = p_file_name;
+            p_site->LineNbr     = line_nbr;
+            break;
+        }
+        ix++;
+        if (ix >= CPU_CFG_INT_DIS_PROF_SITE_NBR) {
+            ix = 0u;
+        }
+        if (ix == ix_start) {                                   /* All sites used.                                      */
+            CPU_IntDisProfLostCtr++;
+            return;
+        }
+        p_site = &CPU_IntDisProfSiteTbl[ix];
+    }
+
+    time_cnts         = CPU_IntDisMeasMaxCalc(time_tot_cnts);   /* Adj time by meas ovrhd.                              */
+    p_site->Ctr++;
+    p_site->Tot_cnts += time_cnts;
+    if (p_site->Max_cnts < time_cnts) {
+        p_site->Max_cnts = time_cnts;
+    }
+                                                                /* Histogram bucket = log2(time).                       */
+    if (time_cnts < 2u) {
+        hist_ix = 0u;
+    } else if ((CPU_INT64U)time_cnts > DEF_INT_32U_MAX_VAL) {
+        hist_ix = CPU_INT_DIS_PROF_HIST_NBR - 1u;
+    } else {
+        hist_ix = 31u - CPU_CntLeadZeros32((CPU_INT32U)time_cnts);
+    }
+    if (hist_ix >= CPU_INT_DIS_PROF_HIST_NBR) {
+        hist_ix  = CPU_INT_DIS_PROF_HIST_NBR - 1u;
+    }
+    p_site->Hist[hist_ix]++;
+}
+#endif
+
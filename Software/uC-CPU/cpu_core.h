@@ -157,6 +157,8 @@
 #define  CPU_TIME_MEAS_NBR_MIN                             1u
 #define  CPU_TIME_MEAS_NBR_MAX                           128u
 
+#define  CPU_INT_DIS_PROF_HIST_NBR                        24u   /* Nbr of ints dis'd time histogram buckets.            */
+
 
 /*
 *********************************************************************************************************
@@ -220,6 +222,32 @@ typedef  CPU_INT32U  CPU_TS_TMR;
 typedef  CPU_INT32U  CPU_TS_TMR_FREQ;
 
 
+/*
+*********************************************************************************************************
+*                          CPU INTERRUPTS DISABLED TIME PROFILER SITE DATA TYPE
+*
+* Note(s) : (1) A critical section site is identified by the source file & line of its outermost
+*               CPU_CRITICAL_ENTER(), so ALL the interrupts disabled time until the matching
+*               CPU_CRITICAL_EXIT() is attributed to that site.
+*
+*           (2) Histogram bucket 'n' counts the interrupts disabled times of 2^n to (2^(n+1) - 1) CPU
+*               timestamp timer counts; bucket 0 also counts times of 0 counts & the last bucket counts
+*               ALL longer times.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_PROF_EN
+typedef  struct  cpu_int_dis_prof_site {
+    const  CPU_CHAR    *FileNamePtr;                            /* Src file of crit section enter (see Note #1).        */
+           CPU_INT32U   LineNbr;                                /* Src line of crit section enter.                      */
+           CPU_INT32U   Ctr;                                    /* Nbr of crit sections measured.                       */
+           CPU_TS_TMR   Max_cnts;                               /* Max ints dis'd time (in ts tmr cnts).                */
+           CPU_INT64U   Tot_cnts;                               /* Tot ints dis'd time (in ts tmr cnts).                */
+           CPU_INT32U   Hist[CPU_INT_DIS_PROF_HIST_NBR];        /* Ints dis'd time histogram (see Note #2).             */
+} CPU_INT_DIS_PROF_SITE;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -259,6 +287,14 @@ CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMaxCur_cnts;       /* ...     reset
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMax_cnts;          /* ... non-resetable max time dis'd.                    */
 #endif
 
+#ifdef  CPU_CFG_INT_DIS_PROF_EN
+                                                                /* Ints dis'd time profiler sites.                      */
+CPU_CORE_EXT  CPU_INT_DIS_PROF_SITE  CPU_IntDisProfSiteTbl[CPU_CFG_INT_DIS_PROF_SITE_NBR];
+CPU_CORE_EXT  const  CPU_CHAR  *CPU_IntDisProfFileNamePtr;      /* Cur crit section src file ...                        */
+CPU_CORE_EXT  CPU_INT32U        CPU_IntDisProfLineNbr;          /* ... & line.                                          */
+CPU_CORE_EXT  CPU_INT32U        CPU_IntDisProfLostCtr;          /* Nbr of ints dis'd times NOT profiled (tbl full).     */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -557,6 +593,19 @@ void             CPU_IntDisMeasStop       (void);
 #endif
 
 
+#ifdef  CPU_CFG_INT_DIS_PROF_EN                                         /* -------- CPU INT DIS TIME PROF FNCTS ------- */
+CPU_SIZE_T       CPU_IntDisProfGet        (CPU_INT_DIS_PROF_SITE  *p_sites,
+                                           CPU_SIZE_T              nbr_max,
+                                           CPU_ERR                *p_err);
+
+void             CPU_IntDisProfReset      (void);
+
+
+void             CPU_IntDisProfStart      (const  CPU_CHAR        *p_file_name,
+                                                  CPU_INT32U       line_nbr);
+#endif
+
+
 
                                                                         /* ----------- CPU CNT ZEROS FNCTS ------------ */
 #ifdef  CPU_CFG_LEAD_ZEROS_ASM_PRESENT
@@ -974,6 +1023,26 @@ CPU_INT64U  CPU_TS64_to_uSec(CPU_TS64  ts_cnts);
 
 
 
+#ifdef   CPU_CFG_INT_DIS_PROF_EN
+
+#ifndef  CPU_CFG_INT_DIS_MEAS_EN
+#error  "CPU_CFG_INT_DIS_PROF_EN               #define'd in 'cpu_cfg.h'     "
+#error  "                                [MUST also #define CPU_CFG_INT_DIS_MEAS_EN]"
+#endif
+
+#ifndef  CPU_CFG_INT_DIS_PROF_SITE_NBR
+#error  "CPU_CFG_INT_DIS_PROF_SITE_NBR         not #define'd in 'cpu_cfg.h' "
+#error  "                                [MUST be  >= 1]"
+
+#elif   (CPU_CFG_INT_DIS_PROF_SITE_NBR < 1)
+#error  "CPU_CFG_INT_DIS_PROF_SITE_NBR   illegally #define'd in 'cpu_cfg.h' "
+#error  "                                [MUST be  >= 1]"
+#endif
+
+#endif
+
+
+
 
 #ifndef  CPU_CFG_LEAD_ZEROS_ASM_PRESENT
 #if 0                                                           /* Optionally configured in 'cpu_cfg.h'; DO NOT MODIFY. */
@@ -3517,6 +3517,7 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
                                                                 /* ----------------- PREPARE NBR FMT ------------------ */
     pstr_fmt    = pstr;
     lead_char_0 = DEF_NO;
+    nbr_fmt     = 0u;
 
     if (fmt_invalid == DEF_NO) {
         nbr_fmt     = nbr;
@@ -0,0 +1,249 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                       Linux x86-64 Specific code
+*
+*                                 (c) Copyright 2008; Micrium; Weston, FL
+*                                           All Rights Reserved
+*
+* File    : OS_CPU.H
+* By      : FGK
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrium to properly  license
+* its use in your product.  We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source  is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_H
+#define  OS_CPU_H
+
+#include  <cpu.h>
+
+#ifdef    OS_CPU_GLOBALS
+#define   OS_CPU_EXT
+#else
+#define   OS_CPU_EXT  extern
+#endif
+
+
+/*
+**********************************************************************************************************
+*                                           DATA TYPES
+**********************************************************************************************************
+*/
+
+typedef  CPU_BOOLEAN    BOOLEAN;
+typedef  CPU_INT08U     INT8U;                                          /* Unsigned  8 bit quantity                                 */
+typedef  CPU_INT08S     INT8S;                                          /* Signed    8 bit quantity                                 */
+typedef  CPU_INT16U     INT16U;                                         /* Unsigned 16 bit quantity                                 */
+typedef  CPU_INT16S     INT16S;                                         /* Signed   16 bit quantity                                 */
+typedef  CPU_INT32U     INT32U;                                         /* Unsigned 32 bit quantity                                 */
+typedef  CPU_INT32S     INT32S;                                         /* Signed   32 bit quantity                                 */
+typedef  CPU_INT64U     INT64U;                                         /* Unsigned 64 bit quantity                                 */
+typedef  CPU_FP32       FP32;                                           /* Single precision floating point                          */
+typedef  CPU_FP64       FP64;                                           /* Double precision floating point                          */
+
+typedef  CPU_STK        OS_STK;                                         /* Define size of CPU stack entry                           */
+typedef  CPU_SR         OS_CPU_SR;                                      /* Define size of CPU status register                       */
+
+
+/*
+*********************************************************************************************************
+*                                           Critical Method MACROS
+*
+* Note(s) : 1) Interrupts are host signals & disabling them only sets a flag (see 'cpu.h  SIMULATED
+*              INTERRUPTS').  A critical section costs a few instructions instead of a system call.
+*
+*           2) With OS_SMP_EN, a critical section also takes the spinlock shared by the cores (see
+*              'MULTI-CORE CONFIGURATION').  'cpu_sr' records whether it was taken, so that a nested section
+*              neither takes it again nor releases it.
+*********************************************************************************************************
+*/
+
+#define  OS_CRITICAL_METHOD     3u
+
+#if (OS_SMP_EN > 0u)
+#define  OS_CPU_SR_LOCK         2u                                      /* 'cpu_sr' bit : the section took the spinlock             */
+
+#define  OS_ENTER_CRITICAL()  { CPU_CRITICAL_ENTER(); cpu_sr |= OS_CPU_SpinLock(); }
+#define  OS_EXIT_CRITICAL()   { cpu_sr = OS_CPU_SpinUnlock(cpu_sr); CPU_CRITICAL_EXIT(); }
+#else
+#define  OS_ENTER_CRITICAL()  { CPU_CRITICAL_ENTER(); }
+#define  OS_EXIT_CRITICAL()   { CPU_CRITICAL_EXIT();  }
+#endif
+
+/*
+*********************************************************************************************************
+*                                        TICK INTERRUPT CONFIGURATION
+*
+* Note(s) : 1) Source & priority of the tick on the simulated interrupt controller (see 'cpu.h  SIMULATED
+*              INTERRUPTS').  Application sources of higher priority (lower value) preempt the tick.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_CFG_TICK_INT_SRC
+#define  OS_CPU_CFG_TICK_INT_SRC                                 0u
+#endif
+
+#ifndef  OS_CPU_CFG_TICK_INT_PRIO
+#define  OS_CPU_CFG_TICK_INT_PRIO                              128u
+#endif
+
+/*
+*********************************************************************************************************
+*                                  HIGH-RESOLUTION TIMER CONFIGURATION
+*
+* Note(s) : 1) Source & priority of the one-shot timer of the high-resolution timers (see os_hrt.c).  Its
+*              interrupt only moves the expired timers to a list, so it may preempt the tick.
+*
+*           2) High-resolution timers expire on the host's monotonic clock, which does not advance in
+*              simulation mode.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_CFG_HRT_INT_SRC
+#define  OS_CPU_CFG_HRT_INT_SRC                                  1u
+#endif
+
+#ifndef  OS_CPU_CFG_HRT_INT_PRIO
+#define  OS_CPU_CFG_HRT_INT_PRIO                                64u
+#endif
+
+/*
+*********************************************************************************************************
+*                                       SIMULATION CONFIGURATION
+*
+* Note(s) : 1) With OS_CPU_CFG_SIM_EN, time is virtual : when all the tasks are blocked, the idle task
+*              advances the time straight to the next delay, timeout or timer expiry (see 'os_cpu_c.c
+*              OSTaskIdleHook()').  Builds on the tickless mode.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_CFG_SIM_EN
+#define  OS_CPU_CFG_SIM_EN                                       0u
+#endif
+
+#if (OS_CPU_CFG_SIM_EN > 0u) && (OS_TICKLESS_EN == 0u)
+#error  "OS_CPU.H, OS_TICKLESS_EN must be enabled (1) when enabling OS_CPU_CFG_SIM_EN"
+#endif
+
+#if (OS_CPU_CFG_SIM_EN > 0u) && (OS_HRT_EN > 0u)                       /* See 'HIGH-RESOLUTION TIMER CONFIGURATION  Note #2'.       */
+#error  "OS_CPU.H, OS_HRT_EN must be disabled (0) when enabling OS_CPU_CFG_SIM_EN"
+#endif
+
+/*
+*********************************************************************************************************
+*                                       MESSAGE COPY CONFIGURATION
+*
+* Note(s) : 1) By-value queues copy messages with interrupts disabled (see 'os_qv.c  Note #4').  The
+*              compiler's copy moves them a word or more at a time, unlike OS_MemCopy().
+*********************************************************************************************************
+*/
+
+#define  OS_QV_MSG_COPY(pdest, psrc, size)                  __builtin_memcpy((pdest), (psrc), (size))
+
+/*
+*********************************************************************************************************
+*                                      MULTI-INSTANCE CONFIGURATION
+*
+* Note(s) : 1) With OS_MULTI_INST_EN, each host thread that calls OSKernelSet() & OSInit() runs a kernel
+*              of its own.  The pointer to the running instance, the port's tick state & the simulated
+*              interrupt controller are all thread-local, so an instance is resolved with one load from
+*              the thread pointer & the instances need no locking.
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_TLS                                        __thread
+
+/*
+*********************************************************************************************************
+*                                        MULTI-CORE CONFIGURATION
+*
+* Note(s) : 1) With OS_SMP_EN, each core is a host thread with a simulated interrupt controller of its own
+*              (see 'cpu.h  SIMULATED INTERRUPTS  Note #1e').  Core 0 is the thread that calls OSStart(),
+*              OS_CPU_CoreStart() creates the others.  The cores run in parallel on a multi-processor host.
+*
+*           2) OS_CPU_CoreSignal() raises the inter-processor interrupt source on the controller of the
+*              core, whose routine reschedules that core.  Its priority is the lowest, like a deferred
+*              context switch.
+*
+*           3) The tick & the one-shot timer of the high-resolution timers interrupt core 0 only.
+*
+*           4) All the cores use one kernel : the kernel instances of OS_MULTI_INST_EN are not available.
+*
+*           5) uC/CPU's interrupts disabled time measurements (CPU_CFG_INT_DIS_MEAS_EN) are shared by the
+*              host threads & are only meaningful with a single core.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_CFG_IPI_INT_SRC
+#define  OS_CPU_CFG_IPI_INT_SRC                                  2u
+#endif
+
+#ifndef  OS_CPU_CFG_IPI_INT_PRIO
+#define  OS_CPU_CFG_IPI_INT_PRIO                               254u
+#endif
+
+#if (OS_SMP_EN > 0u) && (OS_MULTI_INST_EN > 0u)                         /* See Note #4.                                             */
+#error  "OS_CPU.H, OS_MULTI_INST_EN must be disabled (0) when enabling OS_SMP_EN"
+#endif
+
+
+/*
+**********************************************************************************************************
+*                                          Miscellaneous
+**********************************************************************************************************
+*/
+
+#define  OS_STK_GROWTH          1u                                      /* Stack grows from HIGH to LOW memory on x86-64            */
+
+#define  OS_TASK_SW()         { OSCtxSw(); }                            /* Perform task switch                                      */
+
+/*
+**********************************************************************************************************
+*                                         Function Prototypes
+**********************************************************************************************************
+*/
+
+void         OSCtxSw   (void);
+void         OSIntCtxSw(void);
+
+void         OSStartHighRdy(void);
+
+void         OSDebuggerBreak(void);
+
+void         OS_CPU_StkSwitch(OS_STK  **p_stk_save,                     /* See os_cpu_a.S                                           */
+                              OS_STK   *p_stk_new);
+
+void         OS_CPU_TaskEntry(void);
+
+void         OS_CPU_TaskStart(void   (*task)(void *p_arg),
+                              void    *p_arg);
+
+#if (OS_SMP_EN > 0u)
+INT8U        OS_CPU_CoreIdGet (void);
+
+void         OS_CPU_CoreSignal(INT8U       core);
+
+void         OS_CPU_CoreStart (INT8U       core);
+
+OS_CPU_SR    OS_CPU_SpinLock  (void);
+
+OS_CPU_SR    OS_CPU_SpinUnlock(OS_CPU_SR   cpu_sr);
+#endif
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*
+* Note(s) : (1) See 'lib_def.h  MODULE'.
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of os cpu module include.                        */
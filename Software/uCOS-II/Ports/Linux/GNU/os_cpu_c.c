@@ -0,0 +1,1280 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                       Linux x86-64 Specific code
+*
+*                                 (c) Copyright 2008; Micrium; Weston, FL
+*                                           All Rights Reserved
+*
+* File    : OS_CPU_C.C
+* By      : FGK
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrium to properly  license
+* its use in your product.  We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source  is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*********************************************************************************************************
+*/
+
+#define   OS_CPU_GLOBALS
+
+
+/*
+*********************************************************************************************************
+*
+*                                            uC/OS-II Port
+*
+*                                             Linux x86-64
+*
+* Filename      : os_cpu_c.c
+* Version       : V2.90
+* Programmer(s) : FGK
+*
+* Note(s)       : (1) Unlike the Win32 port, which runs each task in its own host thread, all the tasks run
+*                     on the host thread that calls OSStart().  A context switch only swaps stack pointers
+*                     in user space (see os_cpu_a.S), without any system call or host scheduler involved.
+*
+*                 (2) The tick interrupt is an interrupt source of the simulated interrupt controller, raised
+*                     by the SIGALRM signal of a POSIX timer.  Its handler runs on the stack of the interrupted
+*                     task (see 'cpu.h  SIMULATED INTERRUPTS').
+*
+*                 (3) Tasks may be preempted anywhere, including inside the C library.  Functions that are
+*                     not reentrant, such as malloc() or printf(), MUST be protected against preemption
+*                     when several tasks call them (e.g. with a mutex or with OSSchedLock()).
+*
+*                 (4) With OS_CPU_CFG_SIM_EN, time is virtual & there is no tick timer.  Tasks take no time
+*                     to run : time only advances when they are all blocked, from one deadline straight to
+*                     the next.  The same application therefore always produces the same schedule, as
+*                     fast as the host runs it, unless other host threads raise interrupts.
+*
+*                 (5) The port's variables are thread-local (see 'os_cpu.h  MULTI-INSTANCE CONFIGURATION').
+*                     With OS_MULTI_INST_EN, several host threads each run their own kernel & tick timer.
+*
+*                 (6) High-resolution timers (see os_hrt.c) have a one-shot POSIX timer of their own, on the
+*                     same monotonic clock as the CPU timestamps.  Its signal raises a second interrupt source,
+*                     of higher priority than the tick (see 'os_cpu.h  HIGH-RESOLUTION TIMER CONFIGURATION').
+*
+*                 (7) With OS_SMP_EN, each core is a host thread (see 'os_cpu.h  MULTI-CORE CONFIGURATION') &
+*                     a task switched out on one core may be resumed on another.  The simulated interrupt
+*                     state is thread-local & always addressed from the thread pointer, so that a task uses
+*                     the state of the core it runs on.  The tick & timer variables are shared by the cores.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <lib_def.h>
+#include  <ucos_ii.h>
+
+#include  <pthread.h>
+#include  <sched.h>
+#include  <signal.h>
+#include  <string.h>
+#include  <sys/syscall.h>
+#include  <time.h>
+#include  <unistd.h>
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_TICK_SIG                              SIGALRM           /* Signal used as the tick interrupt.                       */
+#define  OS_CPU_TICK_PERIOD_NS     (1000000000uL / OS_TICKS_PER_SEC)    /* Tick period in nanoseconds.                              */
+#define  OS_CPU_HRT_SIG                               SIGRTMIN          /* Signal used as the HR timer interrupt (see Note #6).     */
+
+#define  OS_CPU_STK_FPU_CTRL         ((0x037FuLL << 32u) | 0x1F80uL)    /* Default x87 control word & MXCSR.                        */
+
+#ifndef  sigev_notify_thread_id                                         /* Not defined by older C libraries.                        */
+#define  sigev_notify_thread_id                    _sigev_un._tid
+#endif
+
+#if (OS_SMP_EN > 0u)
+#define  OS_CPU_TMR_TLS                                                 /* Shared by the cores (see Note #7).                       */
+#define  OS_CPU_CORE_NONE                        ((INT8U)0xFFu)         /* Owner of the spinlock when free.                         */
+#define  OS_CPU_SPIN_CNT                              1000u             /* Spins before yielding the host CPU to the lock owner.    */
+#else
+#define  OS_CPU_TMR_TLS                              OS_CPU_TLS
+#endif
+
+#if (OS_TICKLESS_EN > 0u)
+#define  OS_TICK_WAKE_NEVER                      ((CPU_INT64U)-1)       /* No delay or timer pending, tick may stop indefinitely.   */
+#endif
+
+                                                                        /* Start & stop uC/CPU's interrupts disabled time ...     */
+                                                                        /* ... measurement without changing the interrupt state.  */
+#if   defined(CPU_CFG_INT_DIS_PROF_EN)
+#define  OS_CPU_INT_DIS_MEAS_START()    CPU_IntDisProfStart(__FILE__, __LINE__)
+#elif defined(CPU_CFG_INT_DIS_MEAS_EN)
+#define  OS_CPU_INT_DIS_MEAS_START()    CPU_IntDisMeasStart()
+#else
+#define  OS_CPU_INT_DIS_MEAS_START()
+#endif
+
+#ifdef   CPU_CFG_INT_DIS_MEAS_EN
+#define  OS_CPU_INT_DIS_MEAS_STOP()     CPU_IntDisMeasStop()
+#else
+#define  OS_CPU_INT_DIS_MEAS_STOP()
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+#if ((OS_VERSION >= 281u) && (OS_TMR_EN > 0u)) || (OS_TICKLESS_EN > 0u)
+static  OS_CPU_TMR_TLS  INT32U       OSTmrCtr;                          /* Also read by OSTimeTickAnnounce() & OSTimeTickWakeGet(). */
+#endif
+
+static  OS_CPU_TLS  OS_STK          *OS_CPU_MainStkPtr;                 /* Context of main(), never resumed.                        */
+
+#if (OS_SMP_EN > 0u)
+static  OS_CPU_TLS  INT8U            OS_CPU_CoreId;                     /* Core run by the host thread.                             */
+static  INT8U            OS_CPU_SpinOwner = OS_CPU_CORE_NONE;           /* Core holding the kernel's spinlock.                      */
+static  CPU_INT_CTRL    *OS_CPU_CoreCtrlTbl[OS_SMP_CORE_NBR];           /* Interrupt controller of each core started.               */
+#endif
+
+#if (OS_CPU_CFG_SIM_EN > 0u)
+static  OS_CPU_TMR_TLS  CPU_INT64U   OSTick_TimeSim;                    /* Virtual time, in nanoseconds (see Note #4).              */
+#else
+static  OS_CPU_TMR_TLS  timer_t      OSTickTmr;
+#if (OS_TICKLESS_EN > 0u)
+static  OS_CPU_TMR_TLS  struct timespec  OSTick_TimeStart;
+#endif
+#endif
+
+#if (OS_TICKLESS_EN > 0u)
+static  OS_CPU_TMR_TLS  CPU_INT64U   OSTick_Announced;                  /* Nbr of ticks announced to the kernel so far.             */
+#endif
+
+#if (OS_HRT_EN > 0u)
+static  OS_CPU_TMR_TLS  timer_t      OSHrtTmr;                          /* One-shot timer of the HR timers (see Note #6).           */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        OSTickISR   (void);
+
+#if (OS_CPU_CFG_SIM_EN == 0u)
+static  void        OSTickTmrSet(CPU_INT64U  delay_ns,
+                                 CPU_INT64U  period_ns);
+#endif
+
+#if (OS_TICKLESS_EN > 0u)
+static  CPU_INT64U  OSTickTimeGet(void);
+#endif
+
+#if (OS_HRT_EN > 0u)
+static  void        OSHrtISR    (void);
+#endif
+
+#if (OS_SMP_EN > 0u)
+static  void        OS_CPU_CoreInit(INT8U   core);
+
+static  void       *OS_CPU_CoreMain(void   *p_arg);
+
+static  void        OS_CPU_CoreISR (void);
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*                                            (BEGINNING)
+*
+* Description: This function is called by OSInit() at the beginning of OSInit().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts should be disabled during this call.  They remain disabled until the first
+*                 task runs.
+*
+*              2) With OS_SMP_EN, the calling host thread is core 0 (see 'os_cpu.h  MULTI-CORE CONFIGURATION').
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_VERSION > 203u)
+void  OSInitHookBegin (void)
+{
+#if ((OS_VERSION >= 281u) && (OS_TMR_EN > 0u)) || (OS_TICKLESS_EN > 0u)
+    OSTmrCtr = 0u;
+#endif
+
+#if (OS_TICKLESS_EN > 0u)
+    OSTick_Announced = 0u;
+#endif
+
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    OSTick_TimeSim   = 0u;
+#endif
+
+    CPU_IntInit();                                                      /* See Note #1.                                             */
+#if (OS_SMP_EN > 0u)
+    OS_CPU_CoreInit(0u);                                                /* See Note #2.                                             */
+#endif
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*                                               (END)
+*
+* Description: This function is called by OSInit() at the end of OSInit().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts should be disabled during this call.
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_VERSION > 203u)
+void  OSInitHookEnd (void)
+{
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         TASK CREATION HOOK
+*
+* Description: This function is called when a task is created.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being created.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0u)
+void  OSTaskCreateHook (OS_TCB  *p_tcb)
+{
+#if (OS_APP_HOOKS_EN > 0u)
+    App_TaskCreateHook(p_tcb);
+#else
+    (void)p_tcb;                                                        /* Prevent compiler warning                                 */
+#endif
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         TASK DELETION HOOK
+*
+* Description: This function is called when a task is deleted.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being deleted.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*
+*              2) The task's stack belongs to the application, there is no host resource to release.
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0u)
+void  OSTaskDelHook (OS_TCB  *p_tcb)
+{
+#if (OS_APP_HOOKS_EN > 0u)
+    App_TaskDelHook(p_tcb);
+#else
+    (void)p_tcb;                                                        /* Prevent compiler warning                                 */
+#endif
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           IDLE TASK HOOK
+*
+* Description: This function is called by the idle task.  This hook has been added to allow you to do
+*              such things as STOP the CPU to conserve power.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts are enabled during this call.
+*
+*              2) The host thread sleeps until the next signal, as a CPU would until the next interrupt.
+*
+*              3) In tickless mode the idle task computes the next tick at which a delay, a pend timeout
+*                 or a software timer expires (see OSTimeTickWakeGet()) & programs a single timeout for it.
+*                 No tick is generated in between.  Signals are blocked from the moment the timeout is
+*                 computed until sigsuspend() atomically unblocks them, so that the wake-up signal cannot be
+*                 lost.
+*
+*              4) Interrupts stay disabled while the host thread sleeps, so the source that wakes it up is
+*                 only recorded.  The ticks elapsed while asleep are announced first & the tick restarts,
+*                 whatever the source : a task made ready by another interrupt then delays or times out
+*                 from the current tick.
+*
+*              5) In simulation mode (see 'os_cpu_c.c  Note #4') the virtual time jumps to the next tick at
+*                 which something expires & the ticks are announced at once, without sleeping.  With no
+*                 deadline at all the host thread sleeps until another host thread raises an interrupt;
+*                 no virtual time elapses meanwhile.
+*
+*              6) OSTickISR() runs as if the tick interrupt were taken : uC/CPU's interrupts disabled time
+*                 measurement stops around it, since it may switch to a task that ends the critical section
+*                 it is switched in from.
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_VERSION >= 251u)
+void  OSTaskIdleHook (void)
+{
+#if (OS_TICKLESS_EN > 0u)
+    sigset_t    sig_all;
+    sigset_t    sig_prev;
+    INT32U      next;
+    CPU_INT64U  tick_wake;
+#if (OS_CPU_CFG_SIM_EN == 0u)
+    CPU_INT64U  time_wake;
+    CPU_INT64U  time_now;
+#endif
+    CPU_SR_ALLOC();
+#endif
+
+
+#if (OS_APP_HOOKS_EN > 0u)
+    App_TaskIdleHook();
+#endif
+
+#if (OS_TICKLESS_EN > 0u)
+#if (OS_CPU_CFG_SIM_EN == 0u)
+    sigfillset(&sig_all);                                               /* See Note #3.                                             */
+    sigprocmask(SIG_BLOCK, &sig_all, &sig_prev);
+#endif
+
+    CPU_CRITICAL_ENTER();
+    next = OSTimeTickWakeGet(OSTmrCtr);                                 /* Ticks until the next delay, timeout or timer expiry.     */
+    if (next == 0u) {
+        tick_wake = OS_TICK_WAKE_NEVER;
+    } else {
+        tick_wake = OSTick_Announced + next;
+    }
+
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    if (tick_wake != OS_TICK_WAKE_NEVER) {                              /* See Note #5.                                             */
+        OSTick_TimeSim = tick_wake * OS_CPU_TICK_PERIOD_NS;
+        OS_CPU_INT_DIS_MEAS_STOP();                                     /* See Note #6.                                             */
+        OSTickISR();
+        OS_CPU_INT_DIS_MEAS_START();
+    } else if ((CPU_IntCtrl.PendMask & CPU_IntEnMask) == 0u) {          /* Wait for an interrupt raised by another host thread.     */
+        sigfillset(&sig_all);
+        sigprocmask(SIG_BLOCK, &sig_all, &sig_prev);
+        sigsuspend(&sig_prev);
+        sigprocmask(SIG_SETMASK, &sig_prev, (sigset_t *)0);
+    }
+    CPU_CRITICAL_EXIT();
+#else
+    if (tick_wake == OS_TICK_WAKE_NEVER) {                              /* Program the single timeout.                              */
+        OSTickTmrSet(0u, 0u);
+    } else {
+        time_wake = tick_wake * OS_CPU_TICK_PERIOD_NS;
+        time_now  = OSTickTimeGet();
+        if (time_wake <= time_now) {
+            time_wake = time_now + 1u;
+        }
+        OSTickTmrSet(time_wake - time_now, OS_CPU_TICK_PERIOD_NS);      /* Tick periodically again once woken up.                   */
+    }
+
+    sigsuspend(&sig_prev);                                              /* See Note #4.                                             */
+    sigprocmask(SIG_SETMASK, &sig_prev, (sigset_t *)0);
+
+    time_now = OSTickTimeGet();                                         /* Tick periodically again, on the tick boundaries.         */
+    OSTickTmrSet(OS_CPU_TICK_PERIOD_NS - (time_now % OS_CPU_TICK_PERIOD_NS), OS_CPU_TICK_PERIOD_NS);
+    OS_CPU_INT_DIS_MEAS_STOP();                                         /* See Note #6.                                             */
+    OSTickISR();                                                        /* Announce the ticks elapsed while asleep.                 */
+    OS_CPU_INT_DIS_MEAS_START();
+    CPU_CRITICAL_EXIT();                                                /* Service the source(s) that woke the host thread up.      */
+#endif
+#else
+    pause();                                                            /* See Note #2.                                             */
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TASK RETURN HOOK
+*
+* Description: This function is called if a task accidentally returns.  In other words, a task should
+*              either be an infinite loop or delete itself when done.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task that is returning.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_HOOKS_EN > 0u)
+void  OSTaskReturnHook (OS_TCB  *p_tcb)
+{
+#if (OS_APP_HOOKS_EN > 0u)
+    App_TaskReturnHook(p_tcb);
+#else
+    (void)p_tcb;                                                        /* Prevent compiler warning                                 */
+#endif
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         STATISTIC TASK HOOK
+*
+* Description: This function is called every second by uC/OS-II's statistics task.  This allows your
+*              application to add functionality to the statistics task.
+*
+* Arguments  : None.
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0u)
+void  OSTaskStatHook (void)
+{
+#if (OS_APP_HOOKS_EN > 0u)
+    App_TaskStatHook();
+#endif
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      INITIALIZE A TASK'S STACK
+*
+* Description: This function is called by either OSTaskCreate() or OSTaskCreateExt() to initialize the
+*              stack frame of the task being created. This function is highly processor specific.
+*
+* Arguments  : task         Pointer to the task code.
+*
+*              p_arg        Pointer to a user supplied data area that will be passed to the task
+*                               when the task first executes.
+*
+*              ptos         Pointer to the top of stack. It is assumed that 'ptos' points to the
+*                               highest valid address on the stack.
+*
+*              opt          Options used to alter the behavior of OSTaskStkInit().
+*                               (see uCOS_II.H for OS_TASK_OPT_???).
+*
+* Returns    : Always returns the location of the new top-of-stack' once the processor registers have
+*              been placed on the stack in the proper order.
+*
+* Note(s)    : 1) The frame is the one OS_CPU_StkSwitch() saves (see os_cpu_a.S), so that the first switch
+*                 to the task 'returns' to OS_CPU_TaskEntry() with the task's code in R12 & its argument
+*                 in R13.
+*
+*              2) The stack is aligned on 16 bytes & RSP is 16-byte aligned once OS_CPU_TaskEntry() runs,
+*                 as the System V ABI requires before a call.  The two zero entries above are a null return
+*                 address & frame pointer that end stack back-traces.
+*********************************************************************************************************
+*/
+
+OS_STK  *OSTaskStkInit (void  (*task)(void  *pd), void  *p_arg, OS_STK  *ptos, INT16U  opt)
+{
+    OS_STK  *p_stk;
+
+
+    (void)opt;                                                          /* Prevent compiler warning                                 */
+
+    p_stk    = (OS_STK *)((CPU_ADDR)(ptos + 1u) & ~(CPU_ADDR)0xFu);     /* See Note #2.                                             */
+    *--p_stk = (OS_STK)0u;
+    *--p_stk = (OS_STK)0u;
+    *--p_stk = (OS_STK)(CPU_ADDR)OS_CPU_TaskEntry;                      /* Return address of OS_CPU_StkSwitch()                     */
+    *--p_stk = (OS_STK)0u;                                              /* RBP                                                      */
+    *--p_stk = (OS_STK)0u;                                              /* RBX                                                      */
+    *--p_stk = (OS_STK)(CPU_ADDR)task;                                  /* R12                                                      */
+    *--p_stk = (OS_STK)(CPU_ADDR)p_arg;                                 /* R13                                                      */
+    *--p_stk = (OS_STK)0u;                                              /* R14                                                      */
+    *--p_stk = (OS_STK)0u;                                              /* R15                                                      */
+    *--p_stk = (OS_STK)OS_CPU_STK_FPU_CTRL;                             /* x87 control word & MXCSR                                 */
+
+    return (p_stk);
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) It is assumed that the global pointer 'OSTCBHighRdy' points to the TCB of the task that
+*                 will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCur' points to the
+*                 task being switched out (i.e. the preempted task).
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_TASK_SW_HOOK_EN > 0u)
+void  OSTaskSwHook (void)
+{
+#if OS_TASK_PROFILE_EN > 0u
+    OS_TaskSwProfile();                                                 /* Charge the task switched out with its run time           */
+#endif
+#if OS_TASK_LAT_EN > 0u
+    OS_TaskLatSw();                                                     /* Record the latency of the task switched in               */
+#endif
+    OS_TRACE_TASK_SW();                                                 /* Record the context switch (see OS_TRACE.C)               */
+
+#if (OS_APP_HOOKS_EN > 0u)
+    App_TaskSwHook();
+#endif
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          OS_TCBInit() HOOK
+*
+* Description: This function is called by OS_TCBInit() after setting up most of the task control block.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being created.
+*
+* Note(s)    : 1) Interrupts may or may not be ENABLED during this call.
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_VERSION > 203u)
+void  OSTCBInitHook (OS_TCB  *p_tcb)
+{
+#if (OS_APP_HOOKS_EN > 0u)
+    App_TCBInitHook(p_tcb);
+#else
+    (void)p_tcb;                                                        /* Prevent compiler warning                                 */
+#endif
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              TICK HOOK
+*
+* Description: This function is called every tick.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts may or may not be ENABLED during this call.
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_TIME_TICK_HOOK_EN > 0u)
+void  OSTimeTickHook (void)
+{
+#if (OS_APP_HOOKS_EN > 0u)
+    App_TimeTickHook();
+#endif
+
+#if (OS_VERSION >= 281u) && (OS_TMR_EN > 0u)
+    OSTmrCtr++;
+    if (OSTmrCtr >= (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC)) {
+        OSTmrCtr = 0u;
+        OSTmrSignal();
+    }
+#endif
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                              START HIGHEST PRIORITY TASK READY-TO-RUN
+*
+* Description: This function is called by OSStart() to start the highest priority task that was created
+*              by your application before calling OSStart().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) OSStartHighRdy() MUST:
+*                      a) Call OSTaskSwHook() then,
+*                      b) Set OSRunning to TRUE,
+*                      c) Switch to the highest priority task.
+*
+*              2) The tick starts with multitasking.  Interrupts are still disabled & are enabled by the
+*                 first task (see OS_CPU_TaskStart()).  The timer signals the host thread running the tasks
+*                 rather than the whole process, in case the application creates other host threads.
+*                 Interrupts are disabled as by a critical section, which the first task ends, so that the
+*                 interrupts disabled time measurements of uC/CPU stay balanced.
+*
+*              3) The context of main() is saved but never resumed: OSStart() does not return.
+*
+*              4) There is no tick timer in simulation mode (see 'os_cpu_c.c  Note #4').
+*
+*              5) High-resolution timers started before OSStart() could not program the one-shot timer (see
+*                 OSHrtTmrSet()).  Its source is raised once so that OSHrtSignal() programs it.
+*
+*              6) With OS_SMP_EN, OSStart() & OSStartCore() already entered the critical section that the
+*                 first task ends, spinlock included.  Only core 0 starts the tick & the HR timer (see
+*                 'os_cpu.h  MULTI-CORE CONFIGURATION  Note #3').
+*********************************************************************************************************
+*/
+
+void  OSStartHighRdy (void)
+{
+#if (OS_CPU_CFG_SIM_EN == 0u)
+    struct  sigevent  sev;
+#endif
+
+
+#if (OS_SMP_EN == 0u)                                                   /* See Note #6.                                             */
+    CPU_IntDis();
+    OS_CPU_INT_DIS_MEAS_START();                                        /* See Note #2.                                             */
+#endif
+
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_TASK_SW_HOOK_EN > 0u)
+    OSTaskSwHook();
+#endif
+
+    OSRunning = OS_TRUE;
+
+#if (OS_SMP_EN > 0u)
+    if (OS_CPU_CoreId != 0u) {                                          /* See Note #6.                                             */
+        OS_CPU_StkSwitch(&OS_CPU_MainStkPtr, OSTCBHighRdy->OSTCBStkPtr);
+    }
+#endif
+
+#if (OS_CPU_CFG_SIM_EN == 0u)                                           /* See Note #4.                                             */
+    CPU_IntSrcHandlerSet(OS_CPU_CFG_TICK_INT_SRC, OSTickISR);           /* See Note #2.                                             */
+    CPU_IntSrcPrioSet   (OS_CPU_CFG_TICK_INT_SRC, OS_CPU_CFG_TICK_INT_PRIO);
+    CPU_IntSrcSigSet    (OS_CPU_CFG_TICK_INT_SRC, OS_CPU_TICK_SIG);
+    CPU_IntSrcEn        (OS_CPU_CFG_TICK_INT_SRC);
+
+    memset(&sev, 0, sizeof(sev));
+    sev.sigev_notify           = SIGEV_THREAD_ID;
+    sev.sigev_signo            = OS_CPU_TICK_SIG;
+    sev.sigev_notify_thread_id = (pid_t)syscall(SYS_gettid);
+    (void)timer_create(CLOCK_MONOTONIC, &sev, &OSTickTmr);
+#if (OS_TICKLESS_EN > 0u)
+    clock_gettime(CLOCK_MONOTONIC, &OSTick_TimeStart);
+#endif
+    OSTickTmrSet(OS_CPU_TICK_PERIOD_NS, OS_CPU_TICK_PERIOD_NS);
+#endif
+
+#if (OS_HRT_EN > 0u)
+    CPU_IntSrcHandlerSet(OS_CPU_CFG_HRT_INT_SRC, OSHrtISR);
+    CPU_IntSrcPrioSet   (OS_CPU_CFG_HRT_INT_SRC, OS_CPU_CFG_HRT_INT_PRIO);
+    CPU_IntSrcSigSet    (OS_CPU_CFG_HRT_INT_SRC, OS_CPU_HRT_SIG);
+    CPU_IntSrcEn        (OS_CPU_CFG_HRT_INT_SRC);
+
+    memset(&sev, 0, sizeof(sev));
+    sev.sigev_notify           = SIGEV_THREAD_ID;
+    sev.sigev_signo            = OS_CPU_HRT_SIG;
+    sev.sigev_notify_thread_id = (pid_t)syscall(SYS_gettid);
+    (void)timer_create(CLOCK_MONOTONIC, &sev, &OSHrtTmr);
+    CPU_IntSrcPendSet(OS_CPU_CFG_HRT_INT_SRC);                          /* See Note #5.                                             */
+#endif
+
+    OS_CPU_StkSwitch(&OS_CPU_MainStkPtr, OSTCBHighRdy->OSTCBStkPtr);    /* See Note #3.                                             */
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      TASK LEVEL CONTEXT SWITCH
+*
+* Description: This function is called when a task makes a higher priority task ready-to-run.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Upon entry,
+*                 OSTCBCur     points to the OS_TCB of the task to suspend
+*                 OSTCBHighRdy points to the OS_TCB of the task to resume
+*
+*              2) OSCtxSw() MUST:
+*                      a) Save processor registers then,
+*                      b) Save current task's stack pointer into the current task's OS_TCB,
+*                      c) Call OSTaskSwHook(),
+*                      d) Set OSTCBCur = OSTCBHighRdy,
+*                      e) Set OSPrioCur = OSPrioHighRdy,
+*                      f) Switch to the highest priority task.
+*
+*                      pseudo-code:
+*                           void  OSCtxSw (void)
+*                           {
+*                               Save processor registers;
+*
+*                               OSTCBCur->OSTCBStkPtr =  SP;
+*
+*                               OSTaskSwHook();
+*
+*                               OSTCBCur              =  OSTCBHighRdy;
+*                               OSPrioCur             =  OSPrioHighRdy;
+*
+*                               Restore processor registers from (OSTCBHighRdy->OSTCBStkPtr);
+*                           }
+*
+*              3) The kernel variables are updated before the registers are saved.  Nothing reads them in
+*                 between since interrupts are disabled, so only OS_CPU_StkSwitch() needs to be written in
+*                 assembly.
+*
+*              4) A task switched out from within an interrupt service routine is resumed at the priority
+*                 of that routine, which is saved with the task (see 'cpu_c.c  CPU_IntPendService()').
+*********************************************************************************************************
+*/
+
+void  OSCtxSw (void)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT08U   prio_cur;
+
+
+    p_tcb     = OSTCBCur;
+    prio_cur  = CPU_IntPrioCur;                                         /* See Note #4.                                             */
+
+#if (OS_CPU_HOOKS_EN > 0u) && (OS_TASK_SW_HOOK_EN > 0u)
+    OSTaskSwHook();
+#endif
+
+    OSTCBCur  = OSTCBHighRdy;                                           /* See Note #3.                                             */
+    OSPrioCur = OSPrioHighRdy;
+
+    OS_CPU_StkSwitch(&p_tcb->OSTCBStkPtr, OSTCBHighRdy->OSTCBStkPtr);
+
+    CPU_IntPrioCur = prio_cur;
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   INTERRUPT LEVEL CONTEXT SWITCH
+*
+* Description: This function is called by OSIntExit() to perform a context switch from an ISR.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) OSIntCtxSw() MUST:
+*                      a) Call OSTaskSwHook() then,
+*                      b) Set OSTCBCur = OSTCBHighRdy,
+*                      c) Set OSPrioCur = OSPrioHighRdy,
+*                      d) Switch to the highest priority task.
+*
+*              2) ISRs run on the stack of the interrupted task, so the switch is the same as OSCtxSw().
+*                 When the interrupted task is resumed it returns through OSIntExit() & the ISR to the
+*                 signal handler, & sigreturn() restores the registers the signal interrupted.
+*********************************************************************************************************
+*/
+
+void  OSIntCtxSw (void)
+{
+    OSCtxSw();                                                          /* See Note #2.                                             */
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           DEBUGGER BREAK
+*
+* Description: This function stops the application in the debugger.
+*
+* Arguments  : None.
+*********************************************************************************************************
+*/
+
+void  OSDebuggerBreak (void)
+{
+    raise(SIGTRAP);
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             START A TASK
+*
+* Description: This function is called by OS_CPU_TaskEntry() the first time a task runs.
+*
+* Arguments  : task         Pointer to the task code.
+*
+*              p_arg        Argument passed to the task.
+*
+* Note(s)    : 1) Tasks are switched in with interrupts disabled.  A task resumed in OS_CPU_StkSwitch()
+*                 re-enables them on its way out of the kernel; a new task must do so here, ending the
+*                 critical section it was switched in from.
+*
+*              2) A new task may be switched in from within an interrupt service routine & MUST leave the
+*                 priority of that routine (see OSCtxSw()).
+*
+*              3) With OS_SMP_EN, that critical section also holds the spinlock, which the new task releases
+*                 (see 'ucos_ii.h  MULTI-CORE PORT SUPPORT  Note #3').
+*********************************************************************************************************
+*/
+
+void  OS_CPU_TaskStart (void  (*task)(void *p_arg), void  *p_arg)
+{
+    CPU_IntPrioCur = CPU_INT_PRIO_THREAD;                               /* See Note #2.                                             */
+#if (OS_SMP_EN > 0u)
+    (void)OS_CPU_SpinUnlock(OS_CPU_SR_LOCK);                            /* See Note #3.                                             */
+#endif
+    OS_CPU_INT_DIS_MEAS_STOP();
+    CPU_IntEn();                                                        /* See Note #1.                                             */
+
+    task(p_arg);
+
+    OS_TaskReturn();
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        TICK INTERRUPT HANDLER
+*
+* Description: This function is the interrupt service routine of the tick interrupt source.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts are enabled during this call.  Sources of higher priority than the tick may
+*                 nest (see 'cpu.h  SIMULATED INTERRUPTS').
+*
+*              2) OSIntExit() may switch to another task.  Nothing may follow it.
+*
+*              3) In tickless mode the number of elapsed ticks is read from the monotonic clock & all the
+*                 suppressed ticks are announced at once (see OSTimeTickAnnounce()).  A signal arriving before the next tick boundary
+*                 is ignored.  The idle task also calls this function, with interrupts disabled, when the
+*                 host thread wakes up (see 'OSTaskIdleHook()  Note #4').
+*********************************************************************************************************
+*/
+
+static  void  OSTickISR (void)
+{
+#if (OS_TICKLESS_EN > 0u)
+    CPU_INT64U  tick_now;
+    INT32U      elapsed;
+
+
+    tick_now = OSTickTimeGet() / OS_CPU_TICK_PERIOD_NS;
+    if (tick_now <= OSTick_Announced) {                                 /* Woke up early (timer granularity), nothing to do.        */
+        return;
+    }
+
+    elapsed           = (INT32U)(tick_now - OSTick_Announced);
+    OSTick_Announced += elapsed;
+    OSIntEnter();
+    OSTimeTickAnnounce(elapsed, &OSTmrCtr);                             /* Announce all the elapsed ticks at once.                  */
+    OSIntExit();                                                        /* See Note #2.                                             */
+#else
+    OSIntEnter();
+    OSTimeTick();
+    OSIntExit();                                                        /* See Note #2.                                             */
+#endif
+}
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         PROGRAM TICK TIMER
+*
+* Description: This function programs the POSIX timer that raises the tick signal.
+*
+* Arguments  : delay_ns     Time until the next tick signal, 0 to stop the timer.
+*
+*              period_ns    Period of the following tick signals, 0 for a single one.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_SIM_EN == 0u)
+static  void  OSTickTmrSet (CPU_INT64U  delay_ns,
+                            CPU_INT64U  period_ns)
+{
+    struct  itimerspec  tmr;
+
+
+    tmr.it_value.tv_sec     = (time_t)(delay_ns  / 1000000000u);
+    tmr.it_value.tv_nsec    = (long  )(delay_ns  % 1000000000u);
+    tmr.it_interval.tv_sec  = (time_t)(period_ns / 1000000000u);
+    tmr.it_interval.tv_nsec = (long  )(period_ns % 1000000000u);
+
+    (void)timer_settime(OSTickTmr, 0, &tmr, (struct itimerspec *)0);
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        GET TICK TIME BASE
+*
+* Description: This function returns the time elapsed since multitasking started.
+*
+* Arguments  : None.
+*
+* Returns    : Elapsed time, in nanoseconds.
+*
+* Note(s)    : 1) In simulation mode this is the virtual time (see 'os_cpu_c.c  Note #4').
+*********************************************************************************************************
+*/
+
+#if (OS_TICKLESS_EN > 0u)
+static  CPU_INT64U  OSTickTimeGet (void)
+{
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    return (OSTick_TimeSim);                                            /* See Note #1.                                             */
+#else
+    struct timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((CPU_INT64U)(ts.tv_sec  - OSTick_TimeStart.tv_sec) * 1000000000u
+          + (CPU_INT64U) ts.tv_nsec - (CPU_INT64U)OSTick_TimeStart.tv_nsec);
+#endif
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  HIGH-RESOLUTION TIMER INTERRUPT HANDLER
+*
+* Description: This function is the interrupt service routine of the one-shot timer of the high-resolution
+*              timers.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) OSIntExit() may switch to the HR timer task.  Nothing may follow it.
+*********************************************************************************************************
+*/
+
+#if (OS_HRT_EN > 0u)
+static  void  OSHrtISR (void)
+{
+    OSIntEnter();
+    OSHrtSignal();
+    OSIntExit();                                                        /* See Note #1.                                             */
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  PROGRAM HIGH-RESOLUTION TIMER
+*
+* Description: This function programs the one-shot timer of the high-resolution timers.  It is called by
+*              the kernel with interrupts disabled (see os_hrt.c).
+*
+* Arguments  : dly          Time until the next deadline, in CPU timestamp counts, 0 to stop the timer.
+*
+* Note(s)    : 1) The timer only exists once multitasking has started.  OSStartHighRdy() then raises its
+*                 interrupt to program it (see 'OSStartHighRdy()  Note #5').
+*
+*              2) The delay is converted to nanoseconds in two parts so that the product cannot overflow.
+*********************************************************************************************************
+*/
+
+#if (OS_HRT_EN > 0u)
+void  OSHrtTmrSet (OS_TS  dly)
+{
+    struct  itimerspec  tmr;
+    CPU_INT64U          freq;
+    CPU_INT64U          dly_ns;
+    CPU_ERR             err;
+
+
+    if (OSRunning != OS_TRUE) {                                         /* See Note #1.                                             */
+        return;
+    }
+
+    freq = (CPU_INT64U)CPU_TS_TmrFreqGet(&err);
+    if ((err != CPU_ERR_NONE) || (freq == 0u)) {
+        freq = 1000000000u;                                             /* Same clock as the timestamps, in nanoseconds.            */
+    }
+    dly_ns = ((CPU_INT64U)dly / freq) * 1000000000u                     /* See Note #2.                                             */
+           + ((CPU_INT64U)dly % freq) * 1000000000u / freq;
+    if ((dly != 0u) && (dly_ns == 0u)) {                                /* Less than a nanosecond, must not stop the timer.         */
+        dly_ns = 1u;
+    }
+
+    tmr.it_value.tv_sec     = (time_t)(dly_ns / 1000000000u);
+    tmr.it_value.tv_nsec    = (long  )(dly_ns % 1000000000u);
+    tmr.it_interval.tv_sec  = 0;
+    tmr.it_interval.tv_nsec = 0;
+
+    (void)timer_settime(OSHrtTmr, 0, &tmr, (struct itimerspec *)0);
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           GET CORE INDEX
+*
+* Description: This function returns the index of the core the caller runs on.
+*
+* Arguments  : None.
+*
+* Returns    : Index of the core, 0 for the host thread that called OSInit().
+*********************************************************************************************************
+*/
+
+#if (OS_SMP_EN > 0u)
+INT8U  OS_CPU_CoreIdGet (void)
+{
+    return (OS_CPU_CoreId);
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        INTERRUPT ANOTHER CORE
+*
+* Description: This function raises the inter-processor interrupt of a core, so that it reschedules.
+*
+* Arguments  : core         Index of the core to interrupt.
+*
+* Note(s)    : 1) A core that is not started yet has no controller : it schedules its tasks once it starts
+*                 (see OSStartCore()), so the interrupt is not needed.
+*
+*              2) The kernel calls this function with the spinlock held.  The controller only signals the
+*                 host thread when the source was not already pending, so that a core is signaled once per
+*                 reschedule at most (see 'cpu_c.c  CPU_IntCtrlSrcPendSet()').
+*********************************************************************************************************
+*/
+
+#if (OS_SMP_EN > 0u)
+void  OS_CPU_CoreSignal (INT8U  core)
+{
+    CPU_INT_CTRL  *p_ctrl;
+
+
+    p_ctrl = __atomic_load_n(&OS_CPU_CoreCtrlTbl[core], __ATOMIC_ACQUIRE);
+    if (p_ctrl != (CPU_INT_CTRL *)0) {                                  /* See Note #1.                                             */
+        CPU_IntCtrlSrcPendSet(p_ctrl, OS_CPU_CFG_IPI_INT_SRC);          /* See Note #2.                                             */
+    }
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             START A CORE
+*
+* Description: This function is called by OSStart() to start each core other than core 0.
+*
+* Arguments  : core         Index of the core to start.
+*
+* Note(s)    : 1) The core is a new host thread, which calls OSStartCore() once its interrupt controller is
+*                 initialized (see OS_CPU_CoreMain()).
+*********************************************************************************************************
+*/
+
+#if (OS_SMP_EN > 0u)
+void  OS_CPU_CoreStart (INT8U  core)
+{
+    pthread_t  thread;
+
+
+    if (pthread_create(&thread, (pthread_attr_t *)0, OS_CPU_CoreMain, (void *)(CPU_ADDR)core) == 0) {
+        (void)pthread_detach(thread);
+    }
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           ACQUIRE SPINLOCK
+*
+* Description: This function acquires the spinlock shared by the cores, unless the calling core holds it
+*              already.  It is called by OS_ENTER_CRITICAL() with the core's interrupts disabled.
+*
+* Arguments  : None.
+*
+* Returns    : OS_CPU_SR_LOCK,  if the lock was acquired,
+*
+*              0,               if the core held it already (nested critical section).
+*
+* Note(s)    : 1) Only the calling core can have made itself the owner, so a relaxed read is enough to
+*                 detect a nested section.
+*
+*              2) The lock is only written when it looks free, so that the waiting cores spin on a shared
+*                 cache line.  A host CPU may run several cores : after a few spins the waiter yields its
+*                 host CPU, to the owner in particular.
+*********************************************************************************************************
+*/
+
+#if (OS_SMP_EN > 0u)
+OS_CPU_SR  OS_CPU_SpinLock (void)
+{
+    INT8U   core;
+    INT8U   owner;
+    INT32U  spin;
+
+
+    core = OS_CPU_CoreId;
+    if (__atomic_load_n(&OS_CPU_SpinOwner, __ATOMIC_RELAXED) == core) { /* See Note #1.                                             */
+        return (0u);
+    }
+
+    spin = 0u;
+    for (;;) {
+        owner = OS_CPU_CORE_NONE;
+        if (__atomic_compare_exchange_n(&OS_CPU_SpinOwner, &owner, core, 0,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) != 0) {
+            return (OS_CPU_SR_LOCK);
+        }
+        while (__atomic_load_n(&OS_CPU_SpinOwner, __ATOMIC_RELAXED) != OS_CPU_CORE_NONE) {
+            spin++;                                                     /* See Note #2.                                             */
+            if (spin < OS_CPU_SPIN_CNT) {
+                __builtin_ia32_pause();
+            } else {
+                spin = 0u;
+                (void)sched_yield();
+            }
+        }
+    }
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           RELEASE SPINLOCK
+*
+* Description: This function releases the spinlock shared by the cores if the critical section that ends
+*              acquired it.  It is called by OS_EXIT_CRITICAL() before the core's interrupts are restored.
+*
+* Arguments  : cpu_sr       Status saved by OS_ENTER_CRITICAL().
+*
+* Returns    : The status without OS_CPU_SR_LOCK, to restore the core's interrupts.
+*
+* Note(s)    : 1) The section may have been entered on another core : a task switched out within a critical
+*                 section is resumed by the core that switched it in, which holds the lock (see 'ucos_ii.h
+*                 MULTI-CORE PORT SUPPORT  Note #3').
+*********************************************************************************************************
+*/
+
+#if (OS_SMP_EN > 0u)
+OS_CPU_SR  OS_CPU_SpinUnlock (OS_CPU_SR  cpu_sr)
+{
+    if ((cpu_sr & OS_CPU_SR_LOCK) != 0u) {                              /* See Note #1.                                             */
+        __atomic_store_n(&OS_CPU_SpinOwner, OS_CPU_CORE_NONE, __ATOMIC_RELEASE);
+    }
+
+    return (cpu_sr & ~(OS_CPU_SR)OS_CPU_SR_LOCK);
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         INITIALIZE A CORE
+*
+* Description: This function makes the calling host thread core 'core' & installs its inter-processor
+*              interrupt.
+*
+* Arguments  : core         Index of the core.
+*
+* Note(s)    : 1) The simulated interrupt controller of the host thread MUST be initialized.
+*
+*              2) The controller is published last : OS_CPU_CoreSignal() may then raise the interrupt.
+*********************************************************************************************************
+*/
+
+#if (OS_SMP_EN > 0u)
+static  void  OS_CPU_CoreInit (INT8U  core)
+{
+    CPU_INT_CTRL  *p_ctrl;
+
+
+    OS_CPU_CoreId = core;
+
+    CPU_IntSrcHandlerSet(OS_CPU_CFG_IPI_INT_SRC, OS_CPU_CoreISR);       /* See Note #1.                                             */
+    CPU_IntSrcPrioSet   (OS_CPU_CFG_IPI_INT_SRC, OS_CPU_CFG_IPI_INT_PRIO);
+    CPU_IntSrcEn        (OS_CPU_CFG_IPI_INT_SRC);
+
+    p_ctrl = CPU_IntCtrlGet();
+    __atomic_store_n(&OS_CPU_CoreCtrlTbl[core], p_ctrl, __ATOMIC_RELEASE);  /* See Note #2.                                         */
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           CORE HOST THREAD
+*
+* Description: This function is the host thread of each core other than core 0 (see OS_CPU_CoreStart()).
+*
+* Arguments  : p_arg        Index of the core.
+*
+* Returns    : None, OSStartCore() does not return.
+*
+* Note(s)    : 1) CPU_IntInit() leaves the interrupts of the core disabled, as OSStartCore() requires.
+*********************************************************************************************************
+*/
+
+#if (OS_SMP_EN > 0u)
+static  void  *OS_CPU_CoreMain (void  *p_arg)
+{
+    CPU_IntInit();                                                      /* See Note #1.                                             */
+    OS_CPU_CoreInit((INT8U)(CPU_ADDR)p_arg);
+
+    OSStartCore();
+
+    return ((void *)0);
+}
+#endif
+
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                INTER-PROCESSOR INTERRUPT HANDLER
+*
+* Description: This function is the interrupt service routine of the inter-processor interrupt source.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) OSIntExit() reschedules the core & may switch to another task.  Nothing may follow it.
+*********************************************************************************************************
+*/
+
+#if (OS_SMP_EN > 0u)
+static  void  OS_CPU_CoreISR (void)
+{
+    OSIntEnter();
+    OSIntExit();                                                        /* See Note #1.                                             */
+}
+#endif
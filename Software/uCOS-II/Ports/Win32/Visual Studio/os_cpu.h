@@ -45,6 +45,7 @@ typedef  CPU_INT16U     INT16U;                                         /* Unsig
 typedef  CPU_INT16S     INT16S;                                         /* Signed   16 bit quantity                                 */
 typedef  CPU_INT32U     INT32U;                                         /* Unsigned 32 bit quantity                                 */
 typedef  CPU_INT32S     INT32S;                                         /* Signed   32 bit quantity                                 */
+typedef  CPU_INT64U     INT64U;                                         /* Unsigned 64 bit quantity                                 */
 typedef  CPU_FP32       FP32;                                           /* Single precision floating point                          */
 typedef  CPU_FP64       FP64;                                           /* Double precision floating point                          */
 
@@ -63,6 +64,14 @@ typedef  CPU_SR         OS_CPU_SR;                                      /* Defin
 #define  OS_ENTER_CRITICAL()  { CPU_CRITICAL_ENTER(); }
 #define  OS_EXIT_CRITICAL()   { CPU_CRITICAL_EXIT();  }
 
+#if (OS_SMP_EN > 0u)                                                    /* Tasks share one simulated core                           */
+#error  "OS_CPU.H, the Win32 port runs uC/OS-II on a single core, OS_SMP_EN must be disabled (0)"
+#endif
+
+#if (OS_HRT_EN > 0u)                                                    /* No one-shot timer for OSHrtTmrSet()                      */
+#error  "OS_CPU.H, the Win32 port has no high-resolution timer, OS_HRT_EN must be disabled (0)"
+#endif
+
 /*
 **********************************************************************************************************
 *                                          Miscellaneous
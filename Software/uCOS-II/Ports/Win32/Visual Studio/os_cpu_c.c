@@ -70,6 +70,10 @@
 
 #define  OS_MSG_TRACE                                       1u          /* Allow print trace messages.                              */
 
+#if (OS_TICKLESS_EN > 0u)
+#define  OS_TICK_WAKE_NEVER                        ((LONGLONG)-1)       /* No delay or timer pending, tick may stop indefinitely.   */
+#endif
+
 #ifdef  _MSC_VER
 #define  MS_VC_EXCEPTION                           0x406D1388
 #endif
@@ -132,9 +136,9 @@ typedef  struct  threadname_info {
 *********************************************************************************************************
 */
 
-#if (OS_VERSION >= 281u) && (OS_TMR_EN > 0u)
-static  INT16U    OSTmrCtr;
-#endif                                                                  /* #if (OS_VERSION >= 281) && (OS_TMR_EN > 0)               */
+#if ((OS_VERSION >= 281u) && (OS_TMR_EN > 0u)) || (OS_TICKLESS_EN > 0u)
+static  INT32U    OSTmrCtr;                                             /* Also read by OSTimeTickAnnounce() & OSTimeTickWakeGet(). */
+#endif
 
 static  HANDLE    OSTerminate_SignalPtr;
 
@@ -145,6 +149,15 @@ static  HANDLE    OSTick_SignalPtr;
 static  TIMECAPS  OSTick_TimerCap;
 static  MMRESULT  OSTick_TimerId;
 #endif
+#if (OS_TICKLESS_EN > 0u)
+static  HANDLE             OSTick_RearmSignalPtr;                       /* Idle task changed the wake-up tick.                      */
+static  HANDLE             OSTick_IdleSignalPtr;                        /* Ticks have been announced to the kernel.                 */
+static  LARGE_INTEGER      OSTick_CntFreq;
+static  LARGE_INTEGER      OSTick_CntStart;
+static  LONGLONG           OSTick_Announced;                            /* Nbr of ticks announced to the kernel so far.             */
+static  LONGLONG           OSTick_WakeTick;                             /* Tick at which OSTickW32 must wake up next.               */
+static  CPU_BOOLEAN        OSTick_IdleWait;                             /* Idle task is blocked on OSTick_IdleSignalPtr.            */
+#endif
 
 
 /*
@@ -190,7 +203,7 @@ void  OSInitHookBegin (void)
     HANDLE  hProc;
 
 
-#if (OS_VERSION >= 281u) && (OS_TMR_EN > 0u)
+#if ((OS_VERSION >= 281u) && (OS_TMR_EN > 0u)) || (OS_TICKLESS_EN > 0u)
     OSTmrCtr = 0u;
 #endif
 
@@ -206,6 +219,13 @@ void  OSInitHookBegin (void)
 #if (TIMER_METHOD == WIN32_MM_TMR)
     OSTick_SignalPtr      = NULL;
 #endif
+#if (OS_TICKLESS_EN > 0u)
+    OSTick_RearmSignalPtr = NULL;
+    OSTick_IdleSignalPtr  = NULL;
+    OSTick_Announced      = 0;
+    OSTick_WakeTick       = 1;                                          /* Tick periodically until the idle task runs.              */
+    OSTick_IdleWait       = DEF_FALSE;
+#endif
 
 
     CPU_IntInit();                                                      /* Initialize Critical Section objects.                     */
@@ -272,6 +292,7 @@ void  OSInitHookBegin (void)
         return;
     }
 
+#if (OS_TICKLESS_EN == 0u)                                              /* Tickless mode programs its own one-shot timeouts.        */
     OSTick_SignalPtr = CreateEvent(NULL, TRUE, FALSE, NULL);
     if (OSTick_SignalPtr == NULL) {
 #if (OS_MSG_TRACE > 0u)
@@ -313,6 +334,35 @@ void  OSInitHookBegin (void)
         return;
     }
 #endif
+#endif
+
+#if (OS_TICKLESS_EN > 0u)
+    OSTick_RearmSignalPtr = CreateEvent(NULL, FALSE, FALSE, NULL);
+    OSTick_IdleSignalPtr  = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if ((OSTick_RearmSignalPtr == NULL) ||
+        (OSTick_IdleSignalPtr  == NULL)) {
+#if (OS_MSG_TRACE > 0u)
+        OS_Printf("Error: CreateEvent [OSTick tickless] failed.\n");
+#endif
+        if (OSTick_RearmSignalPtr != NULL) {
+            CloseHandle(OSTick_RearmSignalPtr);
+        }
+        if (OSTick_IdleSignalPtr != NULL) {
+            CloseHandle(OSTick_IdleSignalPtr);
+        }
+#if (TIMER_METHOD == WIN32_MM_TMR)
+        timeEndPeriod(OSTick_TimerCap.wPeriodMin);
+#endif
+        CloseHandle(OSTick_Thread);
+        CloseHandle(OSTerminate_SignalPtr);
+
+        OSTick_RearmSignalPtr = NULL;
+        OSTick_IdleSignalPtr  = NULL;
+        OSTick_Thread         = NULL;
+        OSTerminate_SignalPtr = NULL;
+        return;
+    }
+#endif
 }
 #endif
 
@@ -429,16 +479,44 @@ void  OSTaskDelHook (OS_TCB  *p_tcb)
 * Arguments  : None.
 *
 * Note(s)    : 1) Interrupts are enabled during this call.
+*
+*              2) In tickless mode the idle task computes the next tick at which a delay, a pend timeout
+*                 or a software timer expires (see OSTimeTickWakeGet()), hands it to OSTickW32() and blocks
+*                 until OSTickW32() has announced ticks again.  No tick is generated in between.
+*
+*              3) OSTick_IdleWait tells OSTickW32() that the idle task is blocked, so that it is signaled
+*                 once per sleep rather than on every tick.
 *********************************************************************************************************
 */
 #if (OS_CPU_HOOKS_EN > 0u) && (OS_VERSION >= 251u)
 void  OSTaskIdleHook (void)
 {
+#if (OS_TICKLESS_EN > 0u)
+    INT32U  next;
+    CPU_SR_ALLOC();
+#endif
+
+
 #if (OS_APP_HOOKS_EN > 0u)
     App_TaskIdleHook();
 #endif
 
+#if (OS_TICKLESS_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    next = OSTimeTickWakeGet(OSTmrCtr);                                 /* Ticks until the next delay, timeout or timer expiry.     */
+    if (next == 0u) {
+        OSTick_WakeTick = OS_TICK_WAKE_NEVER;
+    } else {
+        OSTick_WakeTick = OSTick_Announced + next;
+    }
+    OSTick_IdleWait = DEF_TRUE;                                         /* See Note #3.                                             */
+    CPU_CRITICAL_EXIT();
+
+    SetEvent(OSTick_RearmSignalPtr);                                    /* Have OSTickW32 re-program its timeout ...                */
+    WaitForSingleObject(OSTick_IdleSignalPtr, INFINITE);                /* ... and sleep until ticks have been announced.           */
+#else
     Sleep(1u);                                                          /* Reduce CPU utilization.                                  */
+#endif
 }
 #endif
 
@@ -553,6 +631,14 @@ OS_STK  *OSTaskStkInit (void  (*task)(void  *pd), void  *p_arg, OS_STK  *ptos, I
 #if (OS_CPU_HOOKS_EN > 0u) && (OS_TASK_SW_HOOK_EN > 0u)
 void  OSTaskSwHook (void)
 {
+#if OS_TASK_PROFILE_EN > 0u
+    OS_TaskSwProfile();                                                 /* Charge the task switched out with its run time           */
+#endif
+#if OS_TASK_LAT_EN > 0u
+    OS_TaskLatSw();                                                     /* Record the latency of the task switched in               */
+#endif
+    OS_TRACE_TASK_SW();                                                 /* Record the context switch (see OS_TRACE.C)               */
+
 #if (OS_APP_HOOKS_EN > 0u)
     App_TaskSwHook();
 #endif
@@ -683,7 +769,7 @@ void  OSStartHighRdy (void)
 {
     OS_TASK_STK  *p_stk;
     OS_TCB       *p_tcb;
-    INT8U         prio;
+    OS_PRIO_NBR   prio;
     CPU_SR_ALLOC();
 
 
@@ -1139,9 +1225,121 @@ CPU_BOOLEAN  OSIntCurTaskResume (void)
 * Arguments  : p_arg        Pointer to argument of the task.
 *
 * Note(s)    : 1) Priorities of these tasks are very important.
+*
+*              2) In tickless mode the thread does not wake up periodically.  It sleeps until the tick
+*                 requested by the idle task (see OSTaskIdleHook()), then announces every tick that elapsed
+*                 on the performance counter in a single interrupt (see OSTimeTickAnnounce()).  While tasks
+*                 are running the requested tick is always the next one, so ticks are generated at the
+*                 normal rate.
+*
+*              3) The idle task is only signaled when ticks were announced while it is blocked (see
+*                 'OSTaskIdleHook()  Note #3').
 *********************************************************************************************************
 */
 
+#if (OS_TICKLESS_EN > 0u)
+static  DWORD  WINAPI  OSTickW32 (LPVOID  p_arg)
+{
+    CPU_BOOLEAN    terminate;
+    CPU_BOOLEAN    suspended;
+    HANDLE         wait_signal[2];
+    LARGE_INTEGER  cnt;
+    LONGLONG       cnt_wake;
+    LONGLONG       tick_now;
+    LONGLONG       tick_wake;
+    DWORD          timeout;
+    INT32U         elapsed;
+    CPU_BOOLEAN    idle_signal;
+    CPU_SR_ALLOC();
+
+
+    wait_signal[0] = OSTerminate_SignalPtr;
+    wait_signal[1] = OSTick_RearmSignalPtr;
+
+    (void)p_arg;                                                        /* Prevent compiler warning                                 */
+
+    QueryPerformanceFrequency(&OSTick_CntFreq);
+    QueryPerformanceCounter(&OSTick_CntStart);
+
+    terminate = DEF_FALSE;
+    while (!terminate) {
+        CPU_CRITICAL_ENTER();
+        tick_wake = OSTick_WakeTick;
+        if ((tick_wake != OS_TICK_WAKE_NEVER) &&
+            (tick_wake <= OSTick_Announced)) {                          /* Deadline already announced, wait for next tick.          */
+            tick_wake = OSTick_Announced + 1;
+        }
+        CPU_CRITICAL_EXIT();
+
+        if (tick_wake == OS_TICK_WAKE_NEVER) {                          /* Program the one-shot timeout.                            */
+            timeout = INFINITE;
+        } else {
+            QueryPerformanceCounter(&cnt);
+            cnt_wake = OSTick_CntStart.QuadPart
+                     + (tick_wake * OSTick_CntFreq.QuadPart + OS_TICKS_PER_SEC - 1) / OS_TICKS_PER_SEC;
+            if (cnt_wake <= cnt.QuadPart) {
+                timeout = 0u;
+            } else {
+                timeout = (DWORD)(((cnt_wake - cnt.QuadPart) * 1000 + OSTick_CntFreq.QuadPart - 1) / OSTick_CntFreq.QuadPart);
+            }
+        }
+
+        switch (WaitForMultipleObjects(2, wait_signal, FALSE, timeout)) {
+            case WAIT_TIMEOUT:
+                 QueryPerformanceCounter(&cnt);
+                 tick_now = ((cnt.QuadPart - OSTick_CntStart.QuadPart) * OS_TICKS_PER_SEC) / OSTick_CntFreq.QuadPart;
+
+                 idle_signal = DEF_FALSE;
+                 CPU_CRITICAL_ENTER();
+                 if (tick_now > OSTick_Announced) {                     /* Woke up early (timer granularity), nothing to do.        */
+                     elapsed   = (INT32U)(tick_now - OSTick_Announced);
+                     suspended = OSIntCurTaskSuspend();
+                     if (suspended == DEF_TRUE) {
+                         OSTick_Announced += elapsed;
+                         OSIntEnter();
+                         OSTimeTickAnnounce(elapsed, &OSTmrCtr);        /* Announce all the elapsed ticks at once.                  */
+                         OSIntExit();
+                         OSIntCurTaskResume();
+                         if (OSTick_IdleWait == DEF_TRUE) {             /* Wake up the idle task once, see Note #3.                 */
+                             OSTick_IdleWait = DEF_FALSE;
+                             idle_signal     = DEF_TRUE;
+                         }
+                     }
+                     OSTick_WakeTick = OSTick_Announced + 1;            /* Tick periodically until the idle task runs again.        */
+                 }
+                 CPU_CRITICAL_EXIT();
+
+                 if (idle_signal == DEF_TRUE) {
+                     SetEvent(OSTick_IdleSignalPtr);
+                 }
+                 break;
+
+
+            case WAIT_OBJECT_0 + 1u:                                    /* Idle task changed the wake-up tick.                      */
+                 break;
+
+
+            case WAIT_OBJECT_0 + 0u:
+                 terminate = DEF_TRUE;
+                 break;
+
+
+            default:
+#if (OS_MSG_TRACE > 0u)
+                 OS_Printf("[OSTickW32] Error: Invalid signal.\n");
+#endif
+                 terminate = DEF_TRUE;
+                 break;
+        }
+    }
+
+#if (OS_MSG_TRACE > 0u)
+    OS_Printf("[OSTickW32] Terminated.\n");
+#endif
+
+    return (0u);
+}
+#else
 static  DWORD  WINAPI  OSTickW32 (LPVOID  p_arg)
 {
     CPU_BOOLEAN  terminate;
@@ -1204,6 +1402,7 @@ static  DWORD  WINAPI  OSTickW32 (LPVOID  p_arg)
 
     return (0u);
 }
+#endif
 
 
 /*$PAGE*/
@@ -56,6 +56,37 @@ INT8U  const  OSUnMapTbl[256] = {
     4u, 0u, 1u, 0u, 2u, 0u, 1u, 0u, 3u, 0u, 1u, 0u, 2u, 0u, 1u, 0u  /* 0xF0 to 0xFF                   */
 };
 
+/*
+*********************************************************************************************************
+*                                 LOWEST SET BIT OF A 16-BIT BITMAP WORD
+*
+* Note: Used to walk the three level ready and wait lists when OS_LOWEST_PRIO > 254, and the ready lists
+*       of other cores when stealing tasks (OS_SMP_STEAL_EN).  'bits' MUST NOT be 0.
+*********************************************************************************************************
+*/
+
+#if (OS_LOWEST_PRIO > 254u) || ((OS_SMP_EN > 0u) && (OS_SMP_STEAL_EN > 0u))
+#if OS_SCHED_CNT_ZEROS_EN > 0u
+#define  OS_PRIO_BIT_LOW(bits)  ((INT8U)CPU_CntTrailZeros((CPU_DATA)(bits)))
+#else
+#define  OS_PRIO_BIT_LOW(bits)  ((((bits) & 0xFFu) != 0u) ?  OSUnMapTbl[(bits) & 0xFFu]                    \
+                                                          : (INT8U)(OSUnMapTbl[((bits) >> 8u) & 0xFFu] + 8u))
+#endif
+#endif
+
+/*
+*********************************************************************************************************
+*                                       DEFAULT KERNEL INSTANCE
+*
+* Note: With OS_MULTI_INST_EN, OSInit() selects this instance when the calling host thread did not call
+*       OSKernelSet() first.  Only one host thread may run it.
+*********************************************************************************************************
+*/
+
+#if OS_MULTI_INST_EN > 0u
+static  OS_KERNEL  OSKernelDflt;
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -71,6 +102,8 @@ static  void  OS_InitRdyList(void);
 
 static  void  OS_InitTaskIdle(void);
 
+static  void  OS_InitTaskIdleCreate(OS_STK *pstk);
+
 #if OS_TASK_STAT_EN > 0u
 static  void  OS_InitTaskStat(void);
 #endif
@@ -79,6 +112,38 @@ static  void  OS_InitTCBList(void);
 
 static  void  OS_SchedNew(void);
 
+#if OS_SMP_EN > 0u
+static  void  OS_SchedAffinityChk(void);
+
+#if OS_SMP_STEAL_EN > 0u
+static  OS_TCB  *OS_SchedSteal(void);
+#endif
+#endif
+
+#if OS_SCHED_THRESHOLD_EN > 0u
+static  void  OS_SchedThreshold(void);
+#endif
+
+#if OS_SCHED_RR_EN > 0u
+static  void  OS_SchedRoundRobin(void);
+
+#if (OS_EVENT_EN)
+static  OS_TCB  *OS_EventTaskPrioFind(OS_EVENT *pevent, OS_PRIO_NBR prio, OS_TCB *pexcl);
+#endif
+#endif
+
+#if OS_SCHED_EDF_EN > 0u
+static  void  OS_EdfHeapInsert(OS_TCB *ptcb);
+
+static  void  OS_EdfHeapRemove(OS_TCB *ptcb);
+#endif
+
+static  void  OS_TickExpire(OS_TCB *ptcb);
+
+#if (OS_TASK_STAT_EN > 0u) && (OS_TASK_PROFILE_EN > 0u)
+static  INT64U  OS_TaskStatCPUUsageTCB(OS_TCB *ptcb, INT64U cycles_tot);
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -144,6 +209,7 @@ INT8U  OSEventNameGet (OS_EVENT   *pevent,
         case OS_EVENT_TYPE_MUTEX:
         case OS_EVENT_TYPE_MBOX:
         case OS_EVENT_TYPE_Q:
+        case OS_EVENT_TYPE_QV:
              break;
 
         default:
@@ -223,6 +289,7 @@ void  OSEventNameSet (OS_EVENT  *pevent,
         case OS_EVENT_TYPE_MUTEX:
         case OS_EVENT_TYPE_MBOX:
         case OS_EVENT_TYPE_Q:
+        case OS_EVENT_TYPE_QV:
              break;
 
         default:
@@ -476,7 +543,11 @@ INT16U  OSEventPendMulti (OS_EVENT  **pevents_pend,
     OSTCBCur->OSTCBStat     |= events_stat  |           /* Resource not available, ...                 */
                                OS_STAT_MULTI;           /* ... pend on multiple events                 */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur, timeout);               /* Store pend timeout in TCB & tick list       */
+#else
     OSTCBCur->OSTCBDly       = timeout;                 /* Store pend timeout in TCB                   */
+#endif
     OS_EventTaskWaitMulti(pevents_pend);                /* Suspend task until events or timeout occurs */
 
     OS_EXIT_CRITICAL();
@@ -578,12 +649,29 @@ void  OSInit (void)
 #if defined(OS_TLS_TBL_SIZE) && (OS_TLS_TBL_SIZE > 0u)
     INT8U  err;
 #endif
+#endif
+#if OS_MULTI_INST_EN > 0u
+    INT8U   *pclr;
+    INT32U   size;
+
+
+    if (OSKernelCur == (OS_KERNEL *)0) {                         /* No instance selected, run the default one */
+        OSKernelCur = &OSKernelDflt;
+    }
+    pclr = (INT8U *)OSKernelCur;                                 /* Start from a cleared kernel instance      */
+    for (size = (INT32U)sizeof(OS_KERNEL); size > 0u; size--) {
+        *pclr++ = (INT8U)0;
+    }
 #endif
 
     OSInitHookBegin();                                           /* Call port specific initialization code   */
 
     OS_InitMisc();                                               /* Initialize miscellaneous variables       */
 
+#if OS_TRACE_EN > 0u
+    OS_TraceInit();                                              /* Initialize the trace recorder            */
+#endif
+
     OS_InitRdyList();                                            /* Initialize the Ready List                */
 
     OS_InitTCBList();                                            /* Initialize the free list of OS_TCBs      */
@@ -602,6 +690,10 @@ void  OSInit (void)
     OS_QInit();                                                  /* Initialize the message queue structures  */
 #endif
 
+#if (OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)
+    OS_QVInit();                                                 /* Initialize the by-value queue structures */
+#endif
+
 #if OS_TASK_CREATE_EXT_EN > 0u
 #if defined(OS_TLS_TBL_SIZE) && (OS_TLS_TBL_SIZE > 0u)
     OS_TLS_Init(&err);                                           /* Initialize TLS, before creating tasks    */
@@ -620,6 +712,14 @@ void  OSInit (void)
     OSTmr_Init();                                                /* Initialize the Timer Manager             */
 #endif
 
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    OS_IntQInit();                                               /* Create the ISR post task                 */
+#endif
+
+#if OS_HRT_EN > 0u
+    OS_HrtInit();                                                /* Create the HR timer task                 */
+#endif
+
     OSInitHookEnd();                                             /* Call port specific init. code            */
 
 #if OS_DEBUG_EN > 0u
@@ -649,15 +749,31 @@ void  OSInit (void)
 *              5) You are allowed to nest interrupts up to 255 levels deep.
 *              6) I removed the OS_ENTER_CRITICAL() and OS_EXIT_CRITICAL() around the increment because
 *                 OSIntEnter() is always called with interrupts disabled.
+*              7) With OS_TASK_PROFILE_EN, the time from the outermost OSIntEnter() to the matching
+*                 OSIntExit() is charged to the ISRs (OSIntCyclesTot) rather than to the interrupted
+*                 task.  ISRs that increment OSIntNesting directly are charged to the task.
 *********************************************************************************************************
 */
 
 void  OSIntEnter (void)
 {
+#if OS_TASK_PROFILE_EN > 0u
+    OS_TS  ts;
+#endif
+
+
     if (OSRunning == OS_TRUE) {
         if (OSIntNesting < 255u) {
             OSIntNesting++;                      /* Increment ISR nesting level                        */
         }
+#if OS_TASK_PROFILE_EN > 0u
+        if (OSIntNesting == 1u) {                /* Charge the interrupted task up to now (Note #7)    */
+            ts                          = OS_TS_GET();
+            OSTCBCur->OSTCBCyclesTot   += (OS_TS)(ts - OSTCBCur->OSTCBCyclesStart);
+            OSTCBCur->OSTCBCyclesStart  = ts;
+        }
+#endif
+        OS_TRACE_INT_ENTER();
     }
 }
 /*$PAGE*/
@@ -682,6 +798,9 @@ void  OSIntEnter (void)
 
 void  OSIntExit (void)
 {
+#if OS_TASK_PROFILE_EN > 0u
+    OS_TS      ts;
+#endif
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -690,14 +809,24 @@ void  OSIntExit (void)
 
     if (OSRunning == OS_TRUE) {
         OS_ENTER_CRITICAL();
+        OS_TRACE_INT_EXIT();
         if (OSIntNesting > 0u) {                           /* Prevent OSIntNesting from wrapping       */
             OSIntNesting--;
         }
+#if OS_TASK_PROFILE_EN > 0u
+        if (OSIntNesting == 0u) {                          /* Charge the ISRs since OSIntEnter()       */
+            ts                          = OS_TS_GET();
+            OSIntCyclesTot             += (OS_TS)(ts - OSTCBCur->OSTCBCyclesStart);
+            OSTCBCur->OSTCBCyclesStart  = ts;
+        }
+#endif
         if (OSIntNesting == 0u) {                          /* Reschedule only if all ISRs complete ... */
             if (OSLockNesting == 0u) {                     /* ... and not locked.                      */
+#if OS_SMP_EN > 0u
+                OS_SchedAffinityChk();                     /* Current task may have to leave the core  */
+#endif
                 OS_SchedNew();
-                OSTCBHighRdy = OSTCBPrioTbl[OSPrioHighRdy];
-                if (OSPrioHighRdy != OSPrioCur) {          /* No Ctx Sw if current task is highest rdy */
+                if (OSTCBHighRdy != OSTCBCur) {            /* No Ctx Sw if current task is highest rdy */
 #if OS_TASK_PROFILE_EN > 0u
                     OSTCBHighRdy->OSTCBCtxSwCtr++;         /* Inc. # of context switches to this task  */
 #endif
@@ -719,6 +848,51 @@ void  OSIntExit (void)
 /*$PAGE*/
 /*
 *********************************************************************************************************
+*                                      GET THE KERNEL INSTANCE
+*
+* Description: This function returns the kernel instance run by the calling host thread.
+*
+* Arguments  : none
+*
+* Returns    : A pointer to the kernel instance, (OS_KERNEL *)0 if none was selected.
+*********************************************************************************************************
+*/
+
+#if OS_MULTI_INST_EN > 0u
+OS_KERNEL  *OSKernelGet (void)
+{
+    return (OSKernelCur);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     SELECT THE KERNEL INSTANCE
+*
+* Description: This function selects the kernel instance run by the calling host thread.  Every kernel
+*              service called by this thread, its tasks and its ISRs then works on that instance.
+*
+* Arguments  : p_kernel     is a pointer to the kernel instance.  OSInit() clears it.
+*
+* Returns    : none
+*
+* Notes      : 1) OSKernelSet() MUST be called before OSInit(), by the host thread that then calls OSInit()
+*                 and OSStart().  Each host thread runs its own instance, independently of the others.  A
+*                 host thread that does not call OSKernelSet() runs the default instance (see OSInit()),
+*                 which only one host thread may use.
+*              2) Kernel objects, such as events or tasks, MUST NOT be shared between instances.
+*********************************************************************************************************
+*/
+
+#if OS_MULTI_INST_EN > 0u
+void  OSKernelSet (OS_KERNEL  *p_kernel)
+{
+    OSKernelCur = p_kernel;
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
 *                         INDICATE THAT IT'S NO LONGER SAFE TO CREATE OBJECTS
 *
 * Description: This function is called by the application code to indicate that all initialization has
@@ -793,6 +967,8 @@ void  OSSchedLock (void)
 *
 * Notes      : 1) You MUST invoke OSSchedLock() and OSSchedUnlock() in pair.  In other words, for every
 *                 call to OSSchedLock() you MUST have a call to OSSchedUnlock().
+*              2) The tasks made ready while the scheduler was locked preempt the calling task only if
+*                 they are above its preemption threshold (see OSTaskThresholdSet()).
 *********************************************************************************************************
 */
 
@@ -826,6 +1002,51 @@ void  OSSchedUnlock (void)
 }
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  SET THE TIME QUANTUM OF A PRIORITY
+*
+* Description: This function sets the time slice given to each task that shares priority 'prio' with
+*              other ready tasks.  When the running task has used up its time slice, OSTimeTick() moves it
+*              to the tail of its priority's ready ring and the next task in the ring runs.
+*
+* Arguments  : prio      is the priority whose time quantum is set.
+*
+*              quanta    is the time quantum in clock ticks.  0 disables time slicing at that priority:
+*                        the tasks then run in FIFO order, each until it blocks.
+*
+* Returns    : OS_ERR_NONE            if the call was successful.
+*              OS_ERR_PRIO_INVALID    if the priority you specify is higher that the maximum allowed
+*                                     (i.e. > OS_LOWEST_PRIO)
+*
+* Note(s)    : 1) The new quantum applies from the next time slice of each task.
+*              2) All priorities start with a quantum of OS_SCHED_RR_QUANTUM ticks.
+*********************************************************************************************************
+*/
+
+#if OS_SCHED_RR_EN > 0u
+INT8U  OSSchedQuantaSet (OS_PRIO_NBR  prio,
+                         INT16U       quanta)
+{
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (prio > OS_LOWEST_PRIO) {                 /* Make sure priority is within allowable range       */
+        return (OS_ERR_PRIO_INVALID);
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    OSSchedQuantaTbl[prio] = quanta;
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -839,24 +1060,85 @@ void  OSSchedUnlock (void)
 *
 * Returns    : none
 *
-* Note       : OSStartHighRdy() MUST:
+* Note       : 1) OSStartHighRdy() MUST:
 *                 a) Call OSTaskSwHook() then,
 *                 b) Set OSRunning to OS_TRUE.
 *                 c) Load the context of the task pointed to by OSTCBHighRdy.
 *                 d_ Execute the task.
+*              2) With OS_SMP_EN, OSStart() is called by core 0 and has the port start the other cores,
+*                 see OSStartCore().  OSStartHighRdy() is then called with the kernel spinlock held, as
+*                 OSCtxSw() is.
 *********************************************************************************************************
 */
 
 void  OSStart (void)
 {
+#if OS_SMP_EN > 0u
+    INT8U      core;
+#if OS_CRITICAL_METHOD == 3u                         /* Allocate storage for CPU status register       */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+#endif
+
+
     if (OSRunning == OS_FALSE) {
-        OS_SchedNew();                               /* Find highest priority's task priority number   */
+#if OS_SMP_EN > 0u
+        OS_ENTER_CRITICAL();                         /* Released by the first task to run (see note 2) */
+#endif
+        OS_SchedNew();                               /* Find highest priority task ready to run        */
         OSPrioCur     = OSPrioHighRdy;
-        OSTCBHighRdy  = OSTCBPrioTbl[OSPrioHighRdy]; /* Point to highest priority task ready to run    */
         OSTCBCur      = OSTCBHighRdy;
+#if OS_TASK_PROFILE_EN > 0u
+        OSTCBCur->OSTCBCyclesStart = OS_TS_GET(); /* Start timing the first task                       */
+#endif
+#if OS_SMP_EN > 0u
+        OSRunning     = OS_TRUE;                     /* Other cores may use the kernel from now on     */
+        for (core = 1u; core < OS_SMP_CORE_NBR; core++) {
+            OS_CPU_CoreStart(core);                  /* Core calls OSStartCore() once it is up         */
+        }
+        cpu_sr        = cpu_sr;                      /* Prevent compiler warning if not used           */
+#endif
         OSStartHighRdy();                            /* Execute target specific code to start task     */
     }
 }
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   START MULTITASKING ON ANOTHER CORE
+*
+* Description: This function is called by the port on each core other than core 0, once OSStart() has
+*              started that core.  It runs the highest priority task of the core's ready list.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST only be called by the port (see OS_CPU_CoreStart()).
+*              2) OSStartHighRdy() is called with the kernel spinlock held, as OSCtxSw() is.
+*********************************************************************************************************
+*/
+
+#if OS_SMP_EN > 0u
+void  OSStartCore (void)
+{
+#if OS_CRITICAL_METHOD == 3u                         /* Allocate storage for CPU status register       */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();                             /* Released by the first task to run              */
+    OS_SchedNew();                                   /* Find highest priority task ready on this core  */
+    OSPrioCur     = OSPrioHighRdy;
+    OSTCBCur      = OSTCBHighRdy;
+#if OS_TASK_PROFILE_EN > 0u
+    OSTCBCur->OSTCBCyclesStart = OS_TS_GET();        /* Start timing the first task                    */
+#endif
+    cpu_sr        = cpu_sr;                          /* Prevent compiler warning if not used           */
+    OSStartHighRdy();                                /* Execute target specific code to start task     */
+}
+#endif
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -958,146 +1240,422 @@ void  OSTimeTick (void)
             return;
         }
 #endif
+#if OS_TICK_LIST_EN > 0u
+        OS_ENTER_CRITICAL();
+        ptcb = OSTickList;                                 /* Only the head of the delta list is aged      */
+        if (ptcb != (OS_TCB *)0) {
+            ptcb->OSTCBTickDelta--;
+            while (ptcb != (OS_TCB *)0) {                  /* Ready every task whose delay has expired     */
+                if (ptcb->OSTCBTickDelta != 0u) {
+                    break;
+                }
+                OS_TickListRemove(ptcb);
+                OS_TickExpire(ptcb);
+                OS_EXIT_CRITICAL();                        /* Give interrupts a chance between expiries    */
+                OS_ENTER_CRITICAL();
+                ptcb = OSTickList;
+            }
+        }
+        OS_EXIT_CRITICAL();
+#else
         ptcb = OSTCBList;                                  /* Point at first TCB in TCB list               */
         while (ptcb->OSTCBPrio != OS_TASK_IDLE_PRIO) {     /* Go through all TCBs in TCB list              */
             OS_ENTER_CRITICAL();
             if (ptcb->OSTCBDly != 0u) {                    /* No, Delayed or waiting for event with TO     */
                 ptcb->OSTCBDly--;                          /* Decrement nbr of ticks to end of delay       */
                 if (ptcb->OSTCBDly == 0u) {                /* Check for timeout                            */
-
-                    if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) != OS_STAT_RDY) {
-                        ptcb->OSTCBStat  &= (INT8U)~(INT8U)OS_STAT_PEND_ANY;          /* Yes, Clear status flag   */
-                        ptcb->OSTCBStatPend = OS_STAT_PEND_TO;                 /* Indicate PEND timeout    */
-                    } else {
-                        ptcb->OSTCBStatPend = OS_STAT_PEND_OK;
-                    }
-
-                    if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY) {  /* Is task suspended?       */
-                        OSRdyGrp               |= ptcb->OSTCBBitY;             /* No,  Make ready          */
-                        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
-                    }
+                    OS_TickExpire(ptcb);
                 }
             }
             ptcb = ptcb->OSTCBNext;                        /* Point at next TCB in TCB list                */
             OS_EXIT_CRITICAL();
         }
+#endif
+#if OS_SCHED_RR_EN > 0u
+        OS_ENTER_CRITICAL();
+        OS_SchedRoundRobin();                              /* Charge the tick to the running time slice    */
+        OS_EXIT_CRITICAL();
+#endif
     }
 }
 
 /*$PAGE*/
 /*
 *********************************************************************************************************
-*                                             GET VERSION
+*                                    PROCESS SEVERAL SYSTEM TICKS AT ONCE
 *
-* Description: This function is used to return the version number of uC/OS-II.  The returned value 
-*              corresponds to uC/OS-II's version number multiplied by 10000.  In other words, version 
-*              2.01.00 would be returned as 20100.
+* Description: This function is called by a tickless tick source to announce that 'ticks' clock ticks
+*              have elapsed since the last tick was processed.  OSTime is advanced by 'ticks' and every
+*              task whose delay or timeout expired during that interval is made ready, exactly as if
+*              OSTimeTick() had been called 'ticks' times.
 *
-* Arguments  : none
+* Arguments  : ticks     is the number of clock ticks that elapsed since the last announced tick.
 *
-* Returns    : The version number of uC/OS-II multiplied by 10000.
+* Returns    : none
+*
+* Notes      : 1) This function must be called from the tick ISR, bracketed by OSIntEnter()/OSIntExit().
+*              2) OSTimeTickHook() is NOT called.  The port is responsible for catching up whatever its
+*                 tick hook does (e.g. signaling the timer task) for the suppressed ticks.
 *********************************************************************************************************
 */
 
-INT16U  OSVersion (void)
+#if OS_TICKLESS_EN > 0u
+void  OSTimeTickCatchUp (INT32U ticks)
 {
-    return (OS_VERSION);
+    OS_TCB    *ptcb;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    if (ticks == 0u) {
+        return;
+    }
+#if OS_TIME_GET_SET_EN > 0u
+    OS_ENTER_CRITICAL();                                   /* Update the 32-bit tick counter               */
+    OSTime += ticks;
+    OS_EXIT_CRITICAL();
+#endif
+    if (OSRunning == OS_TRUE) {
+        OS_ENTER_CRITICAL();
+        ptcb = OSTickList;
+        while (ptcb != (OS_TCB *)0) {                      /* Ready every task expiring within 'ticks'     */
+            if (ptcb->OSTCBTickDelta > ticks) {
+                ptcb->OSTCBTickDelta -= ticks;             /* Head outlives the interval, age it and stop  */
+                break;
+            }
+            ticks                -= ptcb->OSTCBTickDelta;  /* Consume the ticks up to this expiry          */
+            ptcb->OSTCBTickDelta  = 0u;
+            OS_TickListRemove(ptcb);
+            OS_TickExpire(ptcb);
+            OS_EXIT_CRITICAL();                            /* Give interrupts a chance between expiries    */
+            OS_ENTER_CRITICAL();
+            ptcb = OSTickList;
+        }
+        OS_EXIT_CRITICAL();
+    }
 }
+#endif
 
 /*$PAGE*/
 /*
 *********************************************************************************************************
-*                                           DUMMY FUNCTION
+*                                   GET NUMBER OF TICKS TO NEXT EXPIRY
 *
-* Description: This function doesn't do anything.  It is called by OSTaskDel().
+* Description: This function is called by the idle task hook of a tickless port to find out how long the
+*              tick source may stay silent.  It returns the number of clock ticks until the earliest task
+*              delay or pend timeout expires.
 *
 * Arguments  : none
 *
-* Returns    : none
+* Returns    : The number of ticks until the next delay or timeout expires, or
+*              0 if no task is waiting for time to elapse (the tick may be stopped indefinitely).
+*
+* Notes      : 1) Interrupts MUST be disabled when calling this function so that the value cannot be
+*                 invalidated by a tick before the port has programmed its one-shot timer.
+*              2) Software timers are handled separately, see OSTmrNextGet().
 *********************************************************************************************************
 */
 
-#if OS_TASK_DEL_EN > 0u
-void  OS_Dummy (void)
+#if OS_TICKLESS_EN > 0u
+INT32U  OSTimeTickNextGet (void)
 {
+    if (OSTickList == (OS_TCB *)0) {                       /* No task is delayed or pending with timeout   */
+        return (0u);
+    }
+    return (OSTickList->OSTCBTickDelta);                   /* The head's delta is its absolute expiry      */
 }
 #endif
 
-/*$PAGE*/
+/*$PAGE*/
 /*
 *********************************************************************************************************
-*                           MAKE TASK READY TO RUN BASED ON EVENT OCCURING
-*
-* Description: This function is called by other uC/OS-II services and is used to ready a task that was
-*              waiting for an event to occur.
+*                                 ANNOUNCE THE TICKS OF A TICKLESS PORT
 *
-* Arguments  : pevent      is a pointer to the event control block corresponding to the event.
-*
-*              pmsg        is a pointer to a message.  This pointer is used by message oriented services
-*                          such as MAILBOXEs and QUEUEs.  The pointer is not used when called by other
-*                          service functions.
-*
-*              msk         is a mask that is used to clear the status byte of the TCB.  For example,
-*                          OSSemPost() will pass OS_STAT_SEM, OSMboxPost() will pass OS_STAT_MBOX etc.
+* Description: This function is called by the tick ISR of a tickless port to announce the clock ticks that
+*              elapsed since the last one it announced.  A single tick is processed by OSTimeTick().
+*              Several ticks are processed at once by OSTimeTickCatchUp() and the timer task is caught up
+*              on the signals that the tick hook would have given it during the suppressed ticks.
 *
-*              pend_stat   is used to indicate the readied task's pending status:
+* Arguments  : ticks      is the number of clock ticks that elapsed, 1 or more.
 *
-*                          OS_STAT_PEND_OK      Task ready due to a post (or delete), not a timeout or
-*                                               an abort.
-*                          OS_STAT_PEND_ABORT   Task ready due to an abort.
+*              ptmr_ctr   is a pointer to the port's count of ticks since the timer task was last signaled,
+*                         which its OSTimeTickHook() increments.  It is not used without OS_TMR_EN.
 *
 * Returns    : none
 *
-* Note       : This function is INTERNAL to uC/OS-II and your application should not call it.
+* Notes      : 1) This function must be called from the tick ISR, bracketed by OSIntEnter()/OSIntExit().
+*              2) When the last suppressed timer signal is due on the tick just announced, the timer task is
+*                 signaled rather than caught up, as the tick hook would have done.
 *********************************************************************************************************
 */
-#if (OS_EVENT_EN)
-INT8U  OS_EventTaskRdy (OS_EVENT  *pevent,
-                        void      *pmsg,
-                        INT8U      msk,
-                        INT8U      pend_stat)
+
+#if OS_TICKLESS_EN > 0u
+void  OSTimeTickAnnounce (INT32U   ticks,
+                          INT32U  *ptmr_ctr)
 {
-    OS_TCB   *ptcb;
-    INT8U     y;
-    INT8U     x;
-    INT8U     prio;
-#if OS_LOWEST_PRIO > 63u
-    OS_PRIO  *ptbl;
+#if OS_TMR_EN > 0u
+    INT32U  nbr_signal;
 #endif
 
 
-#if OS_LOWEST_PRIO <= 63u
-    y    = OSUnMapTbl[pevent->OSEventGrp];              /* Find HPT waiting for message                */
-    x    = OSUnMapTbl[pevent->OSEventTbl[y]];
-    prio = (INT8U)((y << 3u) + x);                      /* Find priority of task getting the msg       */
-#else
-    if ((pevent->OSEventGrp & 0xFFu) != 0u) {           /* Find HPT waiting for message                */
-        y = OSUnMapTbl[ pevent->OSEventGrp & 0xFFu];
-    } else {
-        y = OSUnMapTbl[(OS_PRIO)(pevent->OSEventGrp >> 8u) & 0xFFu] + 8u;
-    }
-    ptbl = &pevent->OSEventTbl[y];
-    if ((*ptbl & 0xFFu) != 0u) {
-        x = OSUnMapTbl[*ptbl & 0xFFu];
+    if (ticks == 1u) {
+        OSTimeTick();                                      /* Normal tick, including OSTimeTickHook()      */
     } else {
-        x = OSUnMapTbl[(OS_PRIO)(*ptbl >> 8u) & 0xFFu] + 8u;
+        OSTimeTickCatchUp(ticks);                          /* Announce all suppressed ticks at once ...    */
+#if OS_TMR_EN > 0u
+        *ptmr_ctr  += ticks;                               /* ... and the timer signals they would give    */
+        nbr_signal  = *ptmr_ctr / (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC);
+        *ptmr_ctr   = *ptmr_ctr % (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC);
+        if (nbr_signal > 0u) {
+            if (*ptmr_ctr == 0u) {                         /* Last signal due on this tick (see Note #2)   */
+                OSTmrTimeCatchUp(nbr_signal - 1u);
+                (void)OSTmrSignal();
+            } else {
+                OSTmrTimeCatchUp(nbr_signal);
+            }
+        }
+#endif
     }
-    prio = (INT8U)((y << 4u) + x);                      /* Find priority of task getting the msg       */
+#if OS_TMR_EN == 0u
+    ptmr_ctr = ptmr_ctr;                                   /* Prevent compiler warning if not used         */
 #endif
-
-    ptcb                  =  OSTCBPrioTbl[prio];        /* Point to this task's OS_TCB                 */
-    ptcb->OSTCBDly        =  0u;                        /* Prevent OSTimeTick() from readying task     */
-#if ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u)
-    ptcb->OSTCBMsg        =  pmsg;                      /* Send message directly to waiting task       */
-#else
-    pmsg                  =  pmsg;                      /* Prevent compiler warning if not used        */
+}
 #endif
-    ptcb->OSTCBStat      &= (INT8U)~msk;                /* Clear bit associated with event type        */
-    ptcb->OSTCBStatPend   =  pend_stat;                 /* Set pend status of post or abort            */
-                                                        /* See if task is ready (could be susp'd)      */
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                               GET NUMBER OF TICKS TO NEXT TICKLESS WAKE-UP
+*
+* Description: This function is called by the idle task hook of a tickless port to find out how long the
+*              tick source may stay silent.  It returns the number of clock ticks until the earliest task
+*              delay, pend timeout or software timer expires.
+*
+* Arguments  : tmr_ctr    is the port's count of ticks since the timer task was last signaled (see
+*                         OSTimeTickAnnounce()).  It is not used without OS_TMR_EN.
+*
+* Returns    : The number of ticks until the next expiry, or
+*              0 if nothing is waiting for time to elapse (the tick may be stopped indefinitely).
+*
+* Notes      : 1) Interrupts MUST be disabled when calling this function (see OSTimeTickNextGet()).
+*              2) A timer tick is converted to clock ticks with the divider of the port's tick hook, which
+*                 signals the timer task every OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC ticks.
+*********************************************************************************************************
+*/
+
+#if OS_TICKLESS_EN > 0u
+INT32U  OSTimeTickWakeGet (INT32U  tmr_ctr)
+{
+    INT32U  next;
+#if OS_TMR_EN > 0u
+    INT32U  next_tmr;
+#endif
+
+
+    next = OSTimeTickNextGet();                            /* Ticks until the next delay or timeout        */
+#if OS_TMR_EN > 0u
+    next_tmr = OSTmrNextGet();                             /* Timer ticks until the next timer expiry      */
+    if (next_tmr > 0u) {                                   /* Convert to ticks (see Note #2)               */
+        next_tmr = (next_tmr - 1u) * (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC)
+                 + ((OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC) - tmr_ctr);
+        if ((next == 0u) || (next_tmr < next)) {
+            next = next_tmr;
+        }
+    }
+#else
+    tmr_ctr = tmr_ctr;                                     /* Prevent compiler warning if not used         */
+#endif
+    return (next);
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             GET VERSION
+*
+* Description: This function is used to return the version number of uC/OS-II.  The returned value 
+*              corresponds to uC/OS-II's version number multiplied by 10000.  In other words, version 
+*              2.01.00 would be returned as 20100.
+*
+* Arguments  : none
+*
+* Returns    : The version number of uC/OS-II multiplied by 10000.
+*********************************************************************************************************
+*/
+
+INT16U  OSVersion (void)
+{
+    return (OS_VERSION);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  SELECT THE CORE TO PLACE A TASK ON
+*
+* Description: This function is called by other uC/OS-II services to choose, among a set of cores, the one
+*              with the fewest tasks assigned to it.
+*
+* Arguments  : msk       is the set of cores to choose from (bit 'n' set == core 'n').  At least one of the
+*                        cores of the system MUST be in the set.
+*
+* Returns    : The index of the selected core (the lowest one in case of a tie).
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+#if OS_SMP_EN > 0u
+INT8U  OS_CoreSelect (OS_CORE_MSK  msk)
+{
+    INT8U  core;
+    INT8U  best;
+
+
+    best = OS_SMP_CORE_NBR;
+    for (core = 0u; core < OS_SMP_CORE_NBR; core++) {
+        if ((msk & ((OS_CORE_MSK)1u << core)) != 0u) {
+            if (best == OS_SMP_CORE_NBR) {
+                best = core;
+            } else if (OSCoreTbl[core].OSCoreTaskCtr < OSCoreTbl[best].OSCoreTaskCtr) {
+                best = core;
+            }
+        }
+    }
+    return (best);
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           DUMMY FUNCTION
+*
+* Description: This function doesn't do anything.  It is called by OSTaskDel().
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+#if OS_TASK_DEL_EN > 0u
+void  OS_Dummy (void)
+{
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                           MAKE TASK READY TO RUN BASED ON EVENT OCCURING
+*
+* Description: This function is called by other uC/OS-II services and is used to ready a task that was
+*              waiting for an event to occur.
+*
+* Arguments  : pevent      is a pointer to the event control block corresponding to the event.
+*
+*              pmsg        is a pointer to a message.  This pointer is used by message oriented services
+*                          such as MAILBOXEs and QUEUEs.  The pointer is not used when called by other
+*                          service functions.
+*
+*              msk         is a mask that is used to clear the status byte of the TCB.  For example,
+*                          OSSemPost() will pass OS_STAT_SEM, OSMboxPost() will pass OS_STAT_MBOX etc.
+*
+*              pend_stat   is used to indicate the readied task's pending status:
+*
+*                          OS_STAT_PEND_OK      Task ready due to a post (or delete), not a timeout or
+*                                               an abort.
+*                          OS_STAT_PEND_ABORT   Task ready due to an abort.
+*
+* Returns    : A pointer to the OS_TCB of the task made ready.
+*
+* Note       : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) When several tasks share the priority found, the first one (in creation order) that
+*                 waits for the event is made ready.
+*********************************************************************************************************
+*/
+#if (OS_EVENT_EN)
+OS_TCB  *OS_EventTaskRdy (OS_EVENT  *pevent,
+                          void      *pmsg,
+                          INT8U      msk,
+                          INT8U      pend_stat)
+{
+    OS_TCB      *ptcb;
+#if OS_SCHED_RR_EN > 0u
+    OS_TCB      *pwait;
+#endif
+    INT8U        y;
+    INT8U        x;
+    OS_PRIO_NBR  prio;
+#if (OS_LOWEST_PRIO > 63u) && (OS_LOWEST_PRIO <= 254u) && (OS_SCHED_CNT_ZEROS_EN == 0u)
+    OS_PRIO     *ptbl;
+#endif
+
+
+#if OS_LOWEST_PRIO > 254u                               /* Find HPT waiting for message                */
+    x    = OS_PRIO_BIT_LOW(pevent->OSEventGrp);         /* ... through the three levels of wait list   */
+    y    = (INT8U)((x << 4u) + OS_PRIO_BIT_LOW(pevent->OSEventGrpTbl[x]));
+    x    = OS_PRIO_BIT_LOW(pevent->OSEventTbl[y]);
+    prio = (OS_PRIO_NBR)(((OS_PRIO_NBR)y << 4u) + x);   /* Find priority of task getting the msg       */
+#elif OS_SCHED_CNT_ZEROS_EN > 0u
+                                                        /* Find HPT waiting for message                */
+    y    = (INT8U)CPU_CntTrailZeros((CPU_DATA)pevent->OSEventGrp);
+    x    = (INT8U)CPU_CntTrailZeros((CPU_DATA)pevent->OSEventTbl[y]);
+#if OS_LOWEST_PRIO <= 63u
+    prio = (INT8U)((y << 3u) + x);                      /* Find priority of task getting the msg       */
+#else
+    prio = (INT8U)((y << 4u) + x);                      /* Find priority of task getting the msg       */
+#endif
+#elif OS_LOWEST_PRIO <= 63u
+    y    = OSUnMapTbl[pevent->OSEventGrp];              /* Find HPT waiting for message                */
+    x    = OSUnMapTbl[pevent->OSEventTbl[y]];
+    prio = (INT8U)((y << 3u) + x);                      /* Find priority of task getting the msg       */
+#else
+    if ((pevent->OSEventGrp & 0xFFu) != 0u) {           /* Find HPT waiting for message                */
+        y = OSUnMapTbl[ pevent->OSEventGrp & 0xFFu];
+    } else {
+        y = OSUnMapTbl[(OS_PRIO)(pevent->OSEventGrp >> 8u) & 0xFFu] + 8u;
+    }
+    ptbl = &pevent->OSEventTbl[y];
+    if ((*ptbl & 0xFFu) != 0u) {
+        x = OSUnMapTbl[*ptbl & 0xFFu];
+    } else {
+        x = OSUnMapTbl[(OS_PRIO)(*ptbl >> 8u) & 0xFFu] + 8u;
+    }
+    prio = (INT8U)((y << 4u) + x);                      /* Find priority of task getting the msg       */
+#endif
+
+    ptcb                  =  OSTCBPrioTbl[prio];        /* Point to this task's OS_TCB                 */
+#if OS_SCHED_RR_EN > 0u
+    pwait                 =  OS_EventTaskPrioFind(pevent, prio, (OS_TCB *)0);
+    if (pwait != (OS_TCB *)0) {                         /* Pick the waiting task among those at 'prio' */
+        ptcb              =  pwait;
+    }
+#endif
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListRemove(ptcb);                            /* Prevent OSTimeTick() from readying task     */
+#else
+    ptcb->OSTCBDly        =  0u;                        /* Prevent OSTimeTick() from readying task     */
+#endif
+#if ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u) || \
+    ((OS_QV_EN > 0u) && (OS_MAX_QVS > 0u))
+    ptcb->OSTCBMsg        =  pmsg;                      /* Send message directly to waiting task       */
+#else
+    pmsg                  =  pmsg;                      /* Prevent compiler warning if not used        */
+#endif
+    ptcb->OSTCBStat      &= (INT8U)~msk;                /* Clear bit associated with event type        */
+    ptcb->OSTCBStatPend   =  pend_stat;                 /* Set pend status of post or abort            */
+                                                        /* See if task is ready (could be susp'd)      */
     if ((ptcb->OSTCBStat &   OS_STAT_SUSPEND) == OS_STAT_RDY) {
-        OSRdyGrp         |=  ptcb->OSTCBBitY;           /* Put task in the ready to run list           */
-        OSRdyTbl[y]      |=  ptcb->OSTCBBitX;
+        OS_RdyListInsert(ptcb);                         /* Put task in the ready to run list           */
+#if OS_TASK_LAT_EN > 0u
+        OS_TaskLatRdy(ptcb);                            /* Start its latency if posted by an ISR       */
+#endif
     }
 
     OS_EventTaskRemove(ptcb, pevent);                   /* Remove this task from event   wait list     */
@@ -1108,7 +1666,7 @@ INT8U  OS_EventTaskRdy (OS_EVENT  *pevent,
     }
 #endif
 
-    return (prio);
+    return (ptcb);
 }
 #endif
 /*$PAGE*/
@@ -1129,19 +1687,11 @@ INT8U  OS_EventTaskRdy (OS_EVENT  *pevent,
 #if (OS_EVENT_EN)
 void  OS_EventTaskWait (OS_EVENT *pevent)
 {
-    INT8U  y;
-
-
     OSTCBCur->OSTCBEventPtr               = pevent;                 /* Store ptr to ECB in TCB         */
 
-    pevent->OSEventTbl[OSTCBCur->OSTCBY] |= OSTCBCur->OSTCBBitX;    /* Put task in waiting list        */
-    pevent->OSEventGrp                   |= OSTCBCur->OSTCBBitY;
+    OS_EventWaitBitSet(OSTCBCur, pevent);                           /* Put task in waiting list        */
 
-    y             =  OSTCBCur->OSTCBY;            /* Task no longer ready                              */
-    OSRdyTbl[y]  &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
-    if (OSRdyTbl[y] == 0u) {                      /* Clear event grp bit if this was only task pending */
-        OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
-    }
+    OS_RdyListRemove(OSTCBCur);                   /* Task no longer ready                              */
 }
 #endif
 /*$PAGE*/
@@ -1165,7 +1715,6 @@ void  OS_EventTaskWaitMulti (OS_EVENT **pevents_wait)
 {
     OS_EVENT **pevents;
     OS_EVENT  *pevent;
-    INT8U      y;
 
 
     OSTCBCur->OSTCBEventPtr      = (OS_EVENT  *)0;
@@ -1174,17 +1723,12 @@ void  OS_EventTaskWaitMulti (OS_EVENT **pevents_wait)
     pevents =  pevents_wait;
     pevent  = *pevents;
     while (pevent != (OS_EVENT *)0) {                               /* Put task in waiting lists       */
-        pevent->OSEventTbl[OSTCBCur->OSTCBY] |= OSTCBCur->OSTCBBitX;
-        pevent->OSEventGrp                   |= OSTCBCur->OSTCBBitY;
+        OS_EventWaitBitSet(OSTCBCur, pevent);
         pevents++;
         pevent = *pevents;
     }
 
-    y             =  OSTCBCur->OSTCBY;            /* Task no longer ready                              */
-    OSRdyTbl[y]  &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
-    if (OSRdyTbl[y] == 0u) {                      /* Clear event grp bit if this was only task pending */
-        OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
-    }
+    OS_RdyListRemove(OSTCBCur);                   /* Task no longer ready                              */
 }
 #endif
 /*$PAGE*/
@@ -1207,15 +1751,8 @@ void  OS_EventTaskWaitMulti (OS_EVENT **pevents_wait)
 void  OS_EventTaskRemove (OS_TCB   *ptcb,
                           OS_EVENT *pevent)
 {
-    INT8U  y;
-
-
-    y                       =  ptcb->OSTCBY;
-    pevent->OSEventTbl[y]  &= (OS_PRIO)~ptcb->OSTCBBitX;    /* Remove task from wait list              */
-    if (pevent->OSEventTbl[y] == 0u) {
-        pevent->OSEventGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
-    }
-    ptcb->OSTCBEventPtr     = (OS_EVENT  *)0;               /* Unlink OS_EVENT from OS_TCB             */
+    OS_EventWaitBitClr(ptcb, pevent);                       /* Remove task from wait list              */
+    ptcb->OSTCBEventPtr = (OS_EVENT  *)0;                   /* Unlink OS_EVENT from OS_TCB             */
 }
 #endif
 /*$PAGE*/
@@ -1240,21 +1777,12 @@ void  OS_EventTaskRemoveMulti (OS_TCB    *ptcb,
 {
     OS_EVENT **pevents;
     OS_EVENT  *pevent;
-    INT8U      y;
-    OS_PRIO    bity;
-    OS_PRIO    bitx;
 
 
-    y       =  ptcb->OSTCBY;
-    bity    =  ptcb->OSTCBBitY;
-    bitx    =  ptcb->OSTCBBitX;
     pevents =  pevents_multi;
     pevent  = *pevents;
     while (pevent != (OS_EVENT *)0) {                   /* Remove task from all events' wait lists     */
-        pevent->OSEventTbl[y]  &= (OS_PRIO)~bitx;
-        if (pevent->OSEventTbl[y] == 0u) {
-            pevent->OSEventGrp &= (OS_PRIO)~bity;
-        }
+        OS_EventWaitBitClr(ptcb, pevent);
         pevents++;
         pevent = *pevents;
     }
@@ -1263,6 +1791,135 @@ void  OS_EventTaskRemoveMulti (OS_TCB    *ptcb,
 /*$PAGE*/
 /*
 *********************************************************************************************************
+*                              SET/CLEAR A TASK'S BIT IN AN EVENT WAIT LIST
+*
+* Description: These functions are called by other uC/OS-II services to set or clear the bit of a task's
+*              priority in an event's wait list.  When several tasks share that priority (OS_SCHED_RR_EN),
+*              the bit is only cleared if no other task at that priority still waits for the event.
+*
+* Arguments  : ptcb     is a pointer to the task entering or leaving the wait list.
+*
+*              pevent   is a pointer to the event control block.
+*
+* Returns    : none
+*
+* Note       : 1) These functions are INTERNAL to uC/OS-II and your application should not call them.
+*              2) Interrupts are assumed to be disabled when these functions are called.
+*              3) With more than 255 priorities (OS_LOWEST_PRIO > 254), the wait list has three levels:
+*                 OSEventGrp flags the non-empty entries of OSEventGrpTbl[], which flag the non-empty
+*                 entries of OSEventTbl[].
+*********************************************************************************************************
+*/
+#if (OS_EVENT_EN)
+void  OS_EventWaitBitClr (OS_TCB   *ptcb,
+                          OS_EVENT *pevent)
+{
+    INT8U  y;
+
+
+#if OS_SCHED_RR_EN > 0u
+    if (OS_EventTaskPrioFind(pevent, ptcb->OSTCBPrio, ptcb) != (OS_TCB *)0) {
+        return;                                             /* Another task at this prio still waits   */
+    }
+#endif
+    y                       =  ptcb->OSTCBY;
+    pevent->OSEventTbl[y]  &= (OS_PRIO)~ptcb->OSTCBBitX;
+    if (pevent->OSEventTbl[y] == 0u) {
+#if OS_LOWEST_PRIO <= 254u
+        pevent->OSEventGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
+#else
+        pevent->OSEventGrpTbl[y >> 4u] &= (OS_PRIO)~ptcb->OSTCBBitY;
+        if (pevent->OSEventGrpTbl[y >> 4u] == 0u) {
+            pevent->OSEventGrp         &= (OS_PRIO)~ptcb->OSTCBBitZ;
+        }
+#endif
+    }
+}
+
+
+void  OS_EventWaitBitSet (OS_TCB   *ptcb,
+                          OS_EVENT *pevent)
+{
+    pevent->OSEventTbl[ptcb->OSTCBY]           |= ptcb->OSTCBBitX;
+#if OS_LOWEST_PRIO <= 254u
+    pevent->OSEventGrp                         |= ptcb->OSTCBBitY;
+#else
+    pevent->OSEventGrpTbl[ptcb->OSTCBY >> 4u]  |= ptcb->OSTCBBitY;
+    pevent->OSEventGrp                         |= ptcb->OSTCBBitZ;
+#endif
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                            FIND A TASK WAITING FOR AN EVENT AT A PRIORITY
+*
+* Description: This function looks for a task that waits for 'pevent' among the tasks sharing priority
+*              'prio'.  The tasks are visited in the order they were created at that priority.
+*
+* Arguments  : pevent   is a pointer to the event control block.
+*
+*              prio     is the priority to look at.
+*
+*              pexcl    is a task to skip (or NULL).
+*
+* Returns    : A pointer to the OS_TCB of the first waiting task found, or NULL if none waits.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) A multi-pend task still waits as long as none of its events made it ready, i.e. while
+*                 its OSTCBEventPtr is NULL.
+*********************************************************************************************************
+*/
+#if (OS_EVENT_EN) && (OS_SCHED_RR_EN > 0u)
+static  OS_TCB  *OS_EventTaskPrioFind (OS_EVENT     *pevent,
+                                       OS_PRIO_NBR   prio,
+                                       OS_TCB       *pexcl)
+{
+    OS_TCB     *ptcb;
+    BOOLEAN     waits;
+#if (OS_EVENT_MULTI_EN > 0u)
+    OS_EVENT  **pevents;
+#endif
+
+
+    ptcb = OSTCBPrioTbl[prio];
+    if (ptcb == OS_TCB_RESERVED) {                          /* Priority reserved by a mutex            */
+        return ((OS_TCB *)0);
+    }
+    while (ptcb != (OS_TCB *)0) {
+        if (ptcb != pexcl) {
+            if (ptcb->OSTCBEventPtr == pevent) {
+                waits = OS_TRUE;
+            } else {
+                waits = OS_FALSE;
+            }
+#if (OS_EVENT_MULTI_EN > 0u)
+            if (ptcb->OSTCBEventMultiPtr != (OS_EVENT **)0) {
+                waits = OS_FALSE;
+                if (ptcb->OSTCBEventPtr == (OS_EVENT *)0) { /* Not made ready by any event yet?        */
+                    pevents = ptcb->OSTCBEventMultiPtr;
+                    while (*pevents != (OS_EVENT *)0) {
+                        if (*pevents == pevent) {
+                            waits = OS_TRUE;
+                        }
+                        pevents++;
+                    }
+                }
+            }
+#endif
+            if (waits == OS_TRUE) {
+                return (ptcb);
+            }
+        }
+        ptcb = ptcb->OSTCBPrioNext;
+    }
+    return ((OS_TCB *)0);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
 *                             INITIALIZE EVENT CONTROL BLOCK'S WAIT LIST
 *
 * Description: This function is called by other uC/OS-II services to initialize the event wait list.
@@ -1277,10 +1934,15 @@ void  OS_EventTaskRemoveMulti (OS_TCB    *ptcb,
 #if (OS_EVENT_EN)
 void  OS_EventWaitListInit (OS_EVENT *pevent)
 {
-    INT8U  i;
+    INT16U  i;
 
 
     pevent->OSEventGrp = 0u;                     /* No task waiting on event                           */
+#if OS_LOWEST_PRIO > 254u
+    for (i = 0u; i < OS_EVENT_GRP_TBL_SIZE; i++) {
+        pevent->OSEventGrpTbl[i] = 0u;
+    }
+#endif
     for (i = 0u; i < OS_EVENT_TBL_SIZE; i++) {
         pevent->OSEventTbl[i] = 0u;
     }
@@ -1310,26 +1972,28 @@ static  void  OS_InitEventList (void)
     OS_EVENT  *pevent2;
 
 
-    OS_MemClr((INT8U *)&OSEventTbl[0], sizeof(OSEventTbl)); /* Clear the event table                   */
+                                                            /* Clear the event table                   */
+    OS_MemClr((INT8U *)&OS_KERNEL_VAR(OSEventTbl)[0], sizeof(OS_KERNEL_VAR(OSEventTbl)));
     for (ix = 0u; ix < (OS_MAX_EVENTS - 1u); ix++) {        /* Init. list of free EVENT control blocks */
         ix_next = ix + 1u;
-        pevent1 = &OSEventTbl[ix];
-        pevent2 = &OSEventTbl[ix_next];
+        pevent1 = &OS_KERNEL_VAR(OSEventTbl)[ix];
+        pevent2 = &OS_KERNEL_VAR(OSEventTbl)[ix_next];
         pevent1->OSEventType    = OS_EVENT_TYPE_UNUSED;
         pevent1->OSEventPtr     = pevent2;
 #if OS_EVENT_NAME_EN > 0u
         pevent1->OSEventName    = (INT8U *)(void *)"?";     /* Unknown name                            */
 #endif
     }
-    pevent1                         = &OSEventTbl[ix];
+    pevent1                         = &OS_KERNEL_VAR(OSEventTbl)[ix];
     pevent1->OSEventType            = OS_EVENT_TYPE_UNUSED;
     pevent1->OSEventPtr             = (OS_EVENT *)0;
 #if OS_EVENT_NAME_EN > 0u
     pevent1->OSEventName            = (INT8U *)(void *)"?"; /* Unknown name                            */
 #endif
-    OSEventFreeList                 = &OSEventTbl[0];
+    OSEventFreeList                 = &OS_KERNEL_VAR(OSEventTbl)[0];
 #else
-    OSEventFreeList                 = &OSEventTbl[0];       /* Only have ONE event control block       */
+                                                            /* Only have ONE event control block       */
+    OSEventFreeList                 = &OS_KERNEL_VAR(OSEventTbl)[0];
     OSEventFreeList->OSEventType    = OS_EVENT_TYPE_UNUSED;
     OSEventFreeList->OSEventPtr     = (OS_EVENT *)0;
 #if OS_EVENT_NAME_EN > 0u
@@ -1358,6 +2022,10 @@ static  void  OS_InitMisc (void)
     OSTime                    = 0uL;                       /* Clear the 32-bit system clock            */
 #endif
 
+#if OS_TICK_LIST_EN > 0u
+    OSTickList                = (OS_TCB *)0;               /* No task is delayed                       */
+#endif
+
     OSIntNesting              = 0u;                        /* Clear the interrupt nesting counter      */
     OSLockNesting             = 0u;                        /* Clear the scheduling lock counter        */
 
@@ -1366,6 +2034,9 @@ static  void  OS_InitMisc (void)
     OSRunning                 = OS_FALSE;                  /* Indicate that multitasking not started   */
 
     OSCtxSwCtr                = 0u;                        /* Clear the context switch counter         */
+#if OS_SCHED_THRESHOLD_EN > 0u
+    OSCtxSwThresholdCtr       = 0u;                        /* Clear the avoided context switch counter */
+#endif
     OSIdleCtr                 = 0uL;                       /* Clear the 32-bit idle counter            */
 
 #if OS_TASK_STAT_EN > 0u
@@ -1374,6 +2045,15 @@ static  void  OS_InitMisc (void)
     OSStatRdy                 = OS_FALSE;                  /* Statistic task is not ready              */
 #endif
 
+#if OS_TASK_PROFILE_EN > 0u
+    OSIntCyclesTot            = 0u;                        /* No time spent in ISRs yet                */
+#if OS_TASK_STAT_EN > 0u
+    OSIntCyclesTotPrev        = 0u;
+    OSIntCPUUsage             = 0u;
+    OSStatCyclesStart         = 0u;                        /* First period starts at timestamp 0       */
+#endif
+#endif
+
 #ifdef OS_SAFETY_CRITICAL_IEC61508
     OSSafetyCriticalStartFlag = OS_FALSE;                  /* Still allow creation of objects          */
 #endif
@@ -1398,10 +2078,18 @@ static  void  OS_InitMisc (void)
 
 static  void  OS_InitRdyList (void)
 {
-    INT8U  i;
+    INT16U  i;
 
 
+#if OS_SMP_EN > 0u
+    OS_MemClr((INT8U *)&OSCoreTbl[0], sizeof(OSCoreTbl));   /* Clear the state of the other cores too   */
+#endif
     OSRdyGrp      = 0u;                                    /* Clear the ready list                     */
+#if OS_LOWEST_PRIO > 254u
+    for (i = 0u; i < OS_RDY_GRP_TBL_SIZE; i++) {
+        OSRdyGrpTbl[i] = 0u;
+    }
+#endif
     for (i = 0u; i < OS_RDY_TBL_SIZE; i++) {
         OSRdyTbl[i] = 0u;
     }
@@ -1411,6 +2099,16 @@ static  void  OS_InitRdyList (void)
 
     OSTCBHighRdy  = (OS_TCB *)0;
     OSTCBCur      = (OS_TCB *)0;
+
+#if OS_SCHED_EDF_EN > 0u
+    OSEdfHeapSize = 0u;                                    /* No EDF task is ready                     */
+#endif
+#if OS_SCHED_RR_EN > 0u
+    for (i = 0u; i <= OS_LOWEST_PRIO; i++) {               /* No task ready at any priority ...        */
+        OSRdyRingTbl[i]     = (OS_TCB *)0;
+        OSSchedQuantaTbl[i] = OS_SCHED_RR_QUANTUM;         /* ... and default time quantum everywhere  */
+    }
+#endif
 }
 
 /*$PAGE*/
@@ -1424,34 +2122,77 @@ static  void  OS_InitRdyList (void)
 * Arguments  : none
 *
 * Returns    : none
+*
+* Note(s)    : 1) With OS_SMP_EN, every core gets its own idle task at OS_TASK_IDLE_PRIO.  Only the idle
+*                 task of core 0 can be found through OSTCBPrioTbl[], OS_SchedNew() picks the others from
+*                 OSCoreTbl[].
 *********************************************************************************************************
 */
 
 static  void  OS_InitTaskIdle (void)
 {
-#if OS_TASK_NAME_EN > 0u
-    INT8U  err;
+#if OS_SMP_EN > 0u
+    INT8U    core;
+    OS_TCB  *ptcb;
+
+
+    for (core = OS_SMP_CORE_NBR - 1u; core > 0u; core--) {   /* Core 0's idle task is created last ...   */
+        OS_InitTaskIdleCreate(&OSTaskIdleCoreStk[core - 1u][0]);
+        ptcb                            = OSTCBPrioTbl[OS_TASK_IDLE_PRIO];
+        ptcb->OSTCBCoreMsk              = (OS_CORE_MSK)1u << core;
+        OS_TaskCoreSet(ptcb, core);
+        OSCoreTbl[core].OSCoreTCBIdle   = ptcb;
+        OSTCBPrioTbl[OS_TASK_IDLE_PRIO] = (OS_TCB *)0;         /* ... and keeps the idle priority entry    */
+    }
+    OS_InitTaskIdleCreate(&OSTaskIdleStk[0]);
+    ptcb                                = OSTCBPrioTbl[OS_TASK_IDLE_PRIO];
+    ptcb->OSTCBCoreMsk                  = (OS_CORE_MSK)1u;
+    OS_TaskCoreSet(ptcb, 0u);
+    OSCoreTbl[0].OSCoreTCBIdle          = ptcb;
+#else
+    OS_InitTaskIdleCreate(&OSTaskIdleStk[0]);
 #endif
+}
 
-
-#if OS_TASK_CREATE_EXT_EN > 0u
-    #if OS_STK_GROWTH == 1u
-    (void)OSTaskCreateExt(OS_TaskIdle,
-                          (void *)0,                                 /* No arguments passed to OS_TaskIdle() */
-                          &OSTaskIdleStk[OS_TASK_IDLE_STK_SIZE - 1u],/* Set Top-Of-Stack                     */
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             INITIALIZATION
+*                                      CREATE AN IDLE TASK ON A STACK
+*
+* Description: This function is called by OS_InitTaskIdle() to create an idle task.
+*
+* Arguments  : pstk      is a pointer to the lowest entry of the stack of the idle task.
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+static  void  OS_InitTaskIdleCreate (OS_STK  *pstk)
+{
+#if OS_TASK_NAME_EN > 0u
+    INT8U  err;
+#endif
+
+
+#if OS_TASK_CREATE_EXT_EN > 0u
+    #if OS_STK_GROWTH == 1u
+    (void)OSTaskCreateExt(OS_TaskIdle,
+                          (void *)0,                                 /* No arguments passed to OS_TaskIdle() */
+                          &pstk[OS_TASK_IDLE_STK_SIZE - 1u],         /* Set Top-Of-Stack                     */
                           OS_TASK_IDLE_PRIO,                         /* Lowest priority level                */
                           OS_TASK_IDLE_ID,
-                          &OSTaskIdleStk[0],                         /* Set Bottom-Of-Stack                  */
+                          &pstk[0],                                  /* Set Bottom-Of-Stack                  */
                           OS_TASK_IDLE_STK_SIZE,
                           (void *)0,                                 /* No TCB extension                     */
                           OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);/* Enable stack checking + clear stack  */
     #else
     (void)OSTaskCreateExt(OS_TaskIdle,
                           (void *)0,                                 /* No arguments passed to OS_TaskIdle() */
-                          &OSTaskIdleStk[0],                         /* Set Top-Of-Stack                     */
+                          &pstk[0],                                  /* Set Top-Of-Stack                     */
                           OS_TASK_IDLE_PRIO,                         /* Lowest priority level                */
                           OS_TASK_IDLE_ID,
-                          &OSTaskIdleStk[OS_TASK_IDLE_STK_SIZE - 1u],/* Set Bottom-Of-Stack                  */
+                          &pstk[OS_TASK_IDLE_STK_SIZE - 1u],         /* Set Bottom-Of-Stack                  */
                           OS_TASK_IDLE_STK_SIZE,
                           (void *)0,                                 /* No TCB extension                     */
                           OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);/* Enable stack checking + clear stack  */
@@ -1460,12 +2201,12 @@ static  void  OS_InitTaskIdle (void)
     #if OS_STK_GROWTH == 1u
     (void)OSTaskCreate(OS_TaskIdle,
                        (void *)0,
-                       &OSTaskIdleStk[OS_TASK_IDLE_STK_SIZE - 1u],
+                       &pstk[OS_TASK_IDLE_STK_SIZE - 1u],
                        OS_TASK_IDLE_PRIO);
     #else
     (void)OSTaskCreate(OS_TaskIdle,
                        (void *)0,
-                       &OSTaskIdleStk[0],
+                       &pstk[0],
                        OS_TASK_IDLE_PRIO);
     #endif
 #endif
@@ -1553,15 +2294,15 @@ static  void  OS_InitTaskStat (void)
 
 static  void  OS_InitTCBList (void)
 {
-    INT8U    ix;
-    INT8U    ix_next;
+    INT16U   ix;
+    INT16U   ix_next;
     OS_TCB  *ptcb1;
     OS_TCB  *ptcb2;
 
 
     OS_MemClr((INT8U *)&OSTCBTbl[0],     sizeof(OSTCBTbl));      /* Clear all the TCBs                 */
     OS_MemClr((INT8U *)&OSTCBPrioTbl[0], sizeof(OSTCBPrioTbl));  /* Clear the priority table           */
-    for (ix = 0u; ix < (OS_MAX_TASKS + OS_N_SYS_TASKS - 1u); ix++) {    /* Init. list of free TCBs     */
+    for (ix = 0u; ix < (OS_MAX_TASKS + OS_N_SYS_TASKS + OS_N_CORE_TASKS - 1u); ix++) { /* Free TCBs   */
         ix_next =  ix + 1u;
         ptcb1   = &OSTCBTbl[ix];
         ptcb2   = &OSTCBTbl[ix_next];
@@ -1641,6 +2382,358 @@ void  OS_MemCopy (INT8U  *pdest,
         size--;
     }
 }
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                               INSERT/REMOVE A TASK IN THE PRIORITY TABLE
+*
+* Description: These functions are called by other uC/OS-II services to register a task at its priority
+*              in OSTCBPrioTbl[] or to unregister it.  When tasks share priorities (OS_SCHED_RR_EN), the
+*              tasks created at a priority are chained through OSTCBPrioNext in creation order, and the
+*              table points to the first of them.  Services that designate a task by its priority act on
+*              that first task.
+*
+* Arguments  : ptcb        is a pointer to the OS_TCB of the task.
+*
+*              prio        is the priority the task is removed from.
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-II and your application should not call them.
+*              2) Interrupts are assumed to be disabled when these functions are called.
+*              3) The task is inserted at its current priority, ptcb->OSTCBPrio.  It is removed from the
+*                 priority it was designated by, which is not its current priority when the task was
+*                 raised to a mutex' ceiling priority without OS_SCHED_RR_EN.  With OS_SCHED_RR_EN, a
+*                 raised task is moved to the ceiling priority and back (see OSMutexPend()).
+*********************************************************************************************************
+*/
+
+void  OS_PrioTblInsert (OS_TCB  *ptcb)
+{
+#if OS_SCHED_RR_EN > 0u
+    OS_TCB  *pprev;
+
+
+    ptcb->OSTCBPrioNext = (OS_TCB *)0;
+    pprev               = OSTCBPrioTbl[ptcb->OSTCBPrio];
+    if ((pprev != (OS_TCB *)0) &&                          /* Other tasks already at this priority?    */
+        (pprev != OS_TCB_RESERVED)) {
+        while (pprev->OSTCBPrioNext != (OS_TCB *)0) {      /* Yes, link task after the last one        */
+            pprev = pprev->OSTCBPrioNext;
+        }
+        pprev->OSTCBPrioNext = ptcb;
+        return;
+    }
+#endif
+    OSTCBPrioTbl[ptcb->OSTCBPrio] = ptcb;
+}
+
+
+void  OS_PrioTblRemove (OS_TCB       *ptcb,
+                        OS_PRIO_NBR   prio)
+{
+#if OS_SCHED_RR_EN > 0u
+    OS_TCB  *pprev;
+
+
+    pprev = OSTCBPrioTbl[prio];
+    if (pprev != ptcb) {                                   /* Not the first task at this priority      */
+        while (pprev != (OS_TCB *)0) {
+            if (pprev->OSTCBPrioNext == ptcb) {
+                pprev->OSTCBPrioNext = ptcb->OSTCBPrioNext;
+                break;
+            }
+            pprev = pprev->OSTCBPrioNext;
+        }
+        ptcb->OSTCBPrioNext = (OS_TCB *)0;
+        return;
+    }
+    OSTCBPrioTbl[prio]  = ptcb->OSTCBPrioNext;             /* Next task (if any) becomes the first one */
+    ptcb->OSTCBPrioNext = (OS_TCB *)0;
+#else
+    ptcb                = ptcb;                            /* Prevent compiler warning if not used     */
+    OSTCBPrioTbl[prio]  = (OS_TCB *)0;
+#endif
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  INSERT/REMOVE A TASK IN THE READY LIST
+*
+* Description: These functions are called by other uC/OS-II services to make a task ready to run or to
+*              remove it from the ready list.  The task is placed in (or removed from) the ready bitmap
+*              at its current priority and, in EDF mode, in (or from) the deadline-ordered ready heap.
+*              When tasks share priorities (OS_SCHED_RR_EN), a task made ready is appended to the ready
+*              ring of its priority with a fresh time slice, and the priority's bit is only cleared once
+*              the ring is empty.
+*
+* Arguments  : ptcb        is a pointer to the OS_TCB of the task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-II and your application should not call them.
+*              2) Interrupts are assumed to be disabled when these functions are called.
+*              3) Both functions may be called whether or not the task is already (or still) ready.
+*              4) With OS_SMP_EN, the task is inserted in (removed from) the ready list of its core.  When
+*                 that core has to reschedule as a result, it is interrupted with OS_CPU_CoreSignal().
+*********************************************************************************************************
+*/
+
+void  OS_RdyListInsert (OS_TCB  *ptcb)
+{
+#if OS_SCHED_RR_EN > 0u
+    OS_TCB  *phead;
+#endif
+#if OS_SMP_EN > 0u
+    INT8U    core;
+#if OS_SMP_STEAL_EN > 0u
+    INT8U    i;
+    BOOLEAN  rdy;
+#endif
+#endif
+
+
+#if (OS_SMP_EN > 0u) && (OS_SMP_STEAL_EN > 0u)
+    rdy = (BOOLEAN)((OS_RDY_TBL(ptcb)[ptcb->OSTCBY] & ptcb->OSTCBBitX) != 0u);
+    if (rdy == OS_FALSE) {
+        OSCoreTbl[ptcb->OSTCBCore].OSCoreRdyCtr++;         /* Count each ready task only once          */
+    }
+#endif
+#if OS_SCHED_RR_EN > 0u
+    if (ptcb->OSTCBRdyNext == (OS_TCB *)0) {               /* Append task at the tail of the ring      */
+        phead = OSRdyRingTbl[ptcb->OSTCBPrio];
+        if (phead == (OS_TCB *)0) {                        /* First ready task at this priority        */
+            ptcb->OSTCBRdyNext                = ptcb;
+            ptcb->OSTCBRdyPrev                = ptcb;
+            OSRdyRingTbl[ptcb->OSTCBPrio]     = ptcb;
+        } else {
+            ptcb->OSTCBRdyNext                = phead;
+            ptcb->OSTCBRdyPrev                = phead->OSTCBRdyPrev;
+            phead->OSTCBRdyPrev->OSTCBRdyNext = ptcb;
+            phead->OSTCBRdyPrev               = ptcb;
+        }
+        ptcb->OSTCBQuantaCtr = OSSchedQuantaTbl[ptcb->OSTCBPrio];    /* Start a fresh time slice     */
+    }
+#endif
+    OS_RDY_TBL(ptcb)[ptcb->OSTCBY]             |= ptcb->OSTCBBitX;
+#if OS_LOWEST_PRIO <= 254u
+    OS_RDY_GRP(ptcb)                           |= ptcb->OSTCBBitY;
+#else
+    OS_RDY_GRP_TBL(ptcb)[ptcb->OSTCBY >> 4u]   |= ptcb->OSTCBBitY;
+    OS_RDY_GRP(ptcb)                           |= ptcb->OSTCBBitZ;
+#endif
+#if OS_SCHED_EDF_EN > 0u
+    if (ptcb->OSTCBEdfPeriod != 0u) {                      /* EDF task: order by deadline as well      */
+        if (ptcb->OSTCBEdfHeapIx == 0u) {
+            OS_EdfHeapInsert(ptcb);
+        }
+    }
+#endif
+#if OS_SMP_EN > 0u
+    if (OSRunning == OS_TRUE) {
+        core = ptcb->OSTCBCore;
+        if (ptcb->OSTCBPrio < OSCoreTbl[core].OSCorePrioCur) {
+            if (core != OS_CPU_CoreIdGet()) {              /* Task preempts another core ...           */
+                OS_CPU_CoreSignal(core);                   /* ... have it reschedule                   */
+            }
+#if OS_SMP_STEAL_EN > 0u
+        } else if (rdy == OS_FALSE) {                      /* Task has to wait for its core ...        */
+            for (i = 0u; i < OS_SMP_CORE_NBR; i++) {       /* ... unless an idle core may steal it     */
+                if ((i != core) &&
+                    ((ptcb->OSTCBCoreMsk & ((OS_CORE_MSK)1u << i)) != 0u) &&
+                    (OSCoreTbl[i].OSCorePrioCur == OS_TASK_IDLE_PRIO)) {
+                    if (i != OS_CPU_CoreIdGet()) {
+                        OS_CPU_CoreSignal(i);
+                    }
+                    break;
+                }
+            }
+#endif
+        }
+    }
+#endif
+}
+
+
+void  OS_RdyListRemove (OS_TCB  *ptcb)
+{
+    INT8U  y;
+#if OS_SMP_EN > 0u
+    INT8U  core;
+#endif
+
+
+#if OS_SMP_EN > 0u
+    if (OSRunning == OS_TRUE) {
+        core = ptcb->OSTCBCore;
+        if (core != OS_CPU_CoreIdGet()) {                  /* Task running on another core ...         */
+            if (ptcb == OSCoreTbl[core].OSCoreTCBCur) {
+                OS_CPU_CoreSignal(core);                   /* ... must stop: have it reschedule        */
+            }
+        }
+    }
+#endif
+#if OS_SCHED_EDF_EN > 0u
+    if (ptcb->OSTCBEdfHeapIx != 0u) {
+        OS_EdfHeapRemove(ptcb);
+    }
+#endif
+#if OS_SCHED_RR_EN > 0u
+    if (ptcb->OSTCBRdyNext != (OS_TCB *)0) {               /* Unlink task from the ring                */
+        if (ptcb->OSTCBRdyNext == ptcb) {                  /* Last ready task at this priority         */
+            OSRdyRingTbl[ptcb->OSTCBPrio]     = (OS_TCB *)0;
+        } else {
+            ptcb->OSTCBRdyPrev->OSTCBRdyNext = ptcb->OSTCBRdyNext;
+            ptcb->OSTCBRdyNext->OSTCBRdyPrev = ptcb->OSTCBRdyPrev;
+            if (OSRdyRingTbl[ptcb->OSTCBPrio] == ptcb) {   /* Next task gets its turn, full slice      */
+                OSRdyRingTbl[ptcb->OSTCBPrio] = ptcb->OSTCBRdyNext;
+                ptcb->OSTCBRdyNext->OSTCBQuantaCtr = OSSchedQuantaTbl[ptcb->OSTCBPrio];
+            }
+        }
+        ptcb->OSTCBRdyNext = (OS_TCB *)0;
+        ptcb->OSTCBRdyPrev = (OS_TCB *)0;
+    }
+    if (OSRdyRingTbl[ptcb->OSTCBPrio] != (OS_TCB *)0) {    /* Other tasks still ready at this prio?    */
+        return;
+    }
+#endif
+    y                     =  ptcb->OSTCBY;
+#if (OS_SMP_EN > 0u) && (OS_SMP_STEAL_EN > 0u)
+    if ((OS_RDY_TBL(ptcb)[y] & ptcb->OSTCBBitX) != 0u) {
+        OSCoreTbl[ptcb->OSTCBCore].OSCoreRdyCtr--;
+    }
+#endif
+    OS_RDY_TBL(ptcb)[y]  &= (OS_PRIO)~ptcb->OSTCBBitX;
+    if (OS_RDY_TBL(ptcb)[y] == 0u) {                       /* Clear group bit if no other task ready   */
+#if OS_LOWEST_PRIO <= 254u
+        OS_RDY_GRP(ptcb) &= (OS_PRIO)~ptcb->OSTCBBitY;
+#else
+        OS_RDY_GRP_TBL(ptcb)[y >> 4u] &= (OS_PRIO)~ptcb->OSTCBBitY;
+        if (OS_RDY_GRP_TBL(ptcb)[y >> 4u] == 0u) {
+            OS_RDY_GRP(ptcb)          &= (OS_PRIO)~ptcb->OSTCBBitZ;
+        }
+#endif
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   INSERT A TASK IN THE EDF READY HEAP
+*
+* Description: This function is called by OS_RdyListInsert() to add a ready EDF task to the binary
+*              min-heap of ready EDF tasks.  The heap is keyed by absolute deadline (ties are broken by
+*              priority) so that OSEdfHeap[0] is always the task to run.  Insertion costs O(log n).
+*
+* Arguments  : ptcb        is a pointer to the OS_TCB of the task to insert.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) Deadlines are compared as signed differences so that OSTime may wrap around.
+*              4) OSTCBEdfHeapIx holds the task's position in the heap plus one, 0 means not in the heap.
+*********************************************************************************************************
+*/
+
+#if OS_SCHED_EDF_EN > 0u
+#define  OS_EDF_BEFORE(a, b)   (((INT32S)((a)->OSTCBEdfDeadline - (b)->OSTCBEdfDeadline) <  0) ||  \
+                                (((a)->OSTCBEdfDeadline == (b)->OSTCBEdfDeadline)  &&             \
+                                 ((a)->OSTCBPrio        <  (b)->OSTCBPrio)))
+
+static  void  OS_EdfHeapInsert (OS_TCB  *ptcb)
+{
+    INT16U   ix;
+    INT16U   ix_parent;
+    OS_TCB  *pparent;
+
+
+    ix = OSEdfHeapSize;                                    /* Start at the first free leaf             */
+    OSEdfHeapSize++;
+    while (ix > 0u) {                                      /* Sift up while earlier than the parent    */
+        ix_parent = (INT16U)((ix - 1u) / 2u);
+        pparent   = OSEdfHeap[ix_parent];
+        if (!OS_EDF_BEFORE(ptcb, pparent)) {
+            break;
+        }
+        OSEdfHeap[ix]           = pparent;
+        pparent->OSTCBEdfHeapIx = (INT16U)(ix + 1u);
+        ix                      = ix_parent;
+    }
+    OSEdfHeap[ix]        = ptcb;
+    ptcb->OSTCBEdfHeapIx = (INT16U)(ix + 1u);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  REMOVE A TASK FROM THE EDF READY HEAP
+*
+* Description: This function is called by OS_RdyListRemove() to take a task out of the heap of ready EDF
+*              tasks.  The last leaf is moved into the vacated slot and sifted up or down.  Removal costs
+*              O(log n).
+*
+* Arguments  : ptcb        is a pointer to the OS_TCB of the task to remove.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static  void  OS_EdfHeapRemove (OS_TCB  *ptcb)
+{
+    INT16U   ix;
+    INT16U   ix_parent;
+    INT16U   ix_child;
+    OS_TCB  *plast;
+    OS_TCB  *pparent;
+    OS_TCB  *pchild;
+
+
+    ix                   = (INT16U)(ptcb->OSTCBEdfHeapIx - 1u);
+    ptcb->OSTCBEdfHeapIx = 0u;
+    OSEdfHeapSize--;
+    if (ix == OSEdfHeapSize) {                             /* Removing the last leaf, nothing to fix   */
+        return;
+    }
+    plast = OSEdfHeap[OSEdfHeapSize];
+    while (ix > 0u) {                                      /* Sift up while earlier than the parent    */
+        ix_parent = (INT16U)((ix - 1u) / 2u);
+        pparent   = OSEdfHeap[ix_parent];
+        if (!OS_EDF_BEFORE(plast, pparent)) {
+            break;
+        }
+        OSEdfHeap[ix]           = pparent;
+        pparent->OSTCBEdfHeapIx = (INT16U)(ix + 1u);
+        ix                      = ix_parent;
+    }
+    for (;;) {                                             /* Sift down while later than a child       */
+        ix_child = (INT16U)(ix * 2u + 1u);
+        if (ix_child >= OSEdfHeapSize) {
+            break;
+        }
+        pchild = OSEdfHeap[ix_child];
+        if ((ix_child + 1u) < OSEdfHeapSize) {             /* Pick the earlier of both children        */
+            if (OS_EDF_BEFORE(OSEdfHeap[ix_child + 1u], pchild)) {
+                ix_child++;
+                pchild = OSEdfHeap[ix_child];
+            }
+        }
+        if (!OS_EDF_BEFORE(pchild, plast)) {
+            break;
+        }
+        OSEdfHeap[ix]          = pchild;
+        pchild->OSTCBEdfHeapIx = (INT16U)(ix + 1u);
+        ix                     = ix_child;
+    }
+    OSEdfHeap[ix]         = plast;
+    plast->OSTCBEdfHeapIx = (INT16U)(ix + 1u);
+}
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -1670,9 +2763,11 @@ void  OS_Sched (void)
     OS_ENTER_CRITICAL();
     if (OSIntNesting == 0u) {                          /* Schedule only if all ISRs done and ...       */
         if (OSLockNesting == 0u) {                     /* ... scheduler is not locked                  */
+#if OS_SMP_EN > 0u
+            OS_SchedAffinityChk();                     /* Current task may have to leave the core      */
+#endif
             OS_SchedNew();
-            OSTCBHighRdy = OSTCBPrioTbl[OSPrioHighRdy];
-            if (OSPrioHighRdy != OSPrioCur) {          /* No Ctx Sw if current task is highest rdy     */
+            if (OSTCBHighRdy != OSTCBCur) {            /* No Ctx Sw if current task is highest rdy     */
 #if OS_TASK_PROFILE_EN > 0u
                 OSTCBHighRdy->OSTCBCtxSwCtr++;         /* Inc. # of context switches to this task      */
 #endif
@@ -1692,12 +2787,192 @@ void  OS_Sched (void)
 }
 
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                              MOVE THE CURRENT TASK OFF A DISALLOWED CORE
+*
+* Description: This function is called by OS_Sched() and OSIntExit() before looking for the task to run.
+*              If the affinity of the core's current task no longer includes this core (see
+*              OSTaskAffinitySet()), the task is moved to the least loaded core of its affinity.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) The running task is only moved here, by its own core, because the kernel spinlock is
+*                 held until its context has been saved: the new core cannot resume it too early.
+*********************************************************************************************************
+*/
+
+#if OS_SMP_EN > 0u
+static  void  OS_SchedAffinityChk (void)
+{
+    OS_TCB  *ptcb;
+    INT8U    core;
+
+
+    core = OS_CPU_CoreIdGet();
+    ptcb = OSCoreTbl[core].OSCoreTCBCur;
+    if (ptcb != (OS_TCB *)0) {
+        if ((ptcb->OSTCBCoreMsk & ((OS_CORE_MSK)1u << core)) == 0u) {
+            OS_TaskCoreSet(ptcb, OS_CoreSelect(ptcb->OSTCBCoreMsk));
+        }
+    }
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 STEAL A READY TASK FROM THE BUSIEST CORE
+*
+* Description: This function is called by OS_SchedNew() when the calling core has nothing but its idle
+*              task to run.  The cores are visited from the one with the most ready tasks down, and the
+*              highest priority task found ready (but not running) whose affinity includes the calling
+*              core is moved to the calling core.
+*
+* Arguments  : none
+*
+* Returns    : A pointer to the OS_TCB of the stolen task, now ready on the calling core, or,
+*              a NULL pointer if no other core has a task to give away.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) The ready lists of the other cores are read under the kernel spinlock, a task found
+*                 ready but not current on its core has had its context saved and can be resumed by any
+*                 core.
+*              4) A core with two ready tasks or less (its idle task and the running one) is skipped.
+*********************************************************************************************************
+*/
+
+#if (OS_SMP_EN > 0u) && (OS_SMP_STEAL_EN > 0u)
+static  OS_TCB  *OS_SchedSteal (void)
+{
+    OS_CORE      *pcore;
+    OS_TCB       *ptcb;
+    OS_CORE_MSK   done;
+    OS_CORE_MSK   bit;
+    OS_PRIO       bits;
+    OS_PRIO_NBR   prio;
+    INT16U        y;
+    INT8U         i;
+    INT8U         core;
+    INT8U         victim;
+
+
+    core = OS_CPU_CoreIdGet();
+    bit  = (OS_CORE_MSK)1u << core;
+    done = bit;
+    for (;;) {
+        victim = OS_SMP_CORE_NBR;                          /* Find the busiest core not visited yet    */
+        for (i = 0u; i < OS_SMP_CORE_NBR; i++) {
+            if ((done & ((OS_CORE_MSK)1u << i)) == 0u) {
+                if (OSCoreTbl[i].OSCoreRdyCtr > 2u) {
+                    if (victim == OS_SMP_CORE_NBR) {
+                        victim = i;
+                    } else if (OSCoreTbl[i].OSCoreRdyCtr > OSCoreTbl[victim].OSCoreRdyCtr) {
+                        victim = i;
+                    }
+                }
+            }
+        }
+        if (victim == OS_SMP_CORE_NBR) {                   /* No core has work to spare                */
+            return ((OS_TCB *)0);
+        }
+        done  |= (OS_CORE_MSK)1u << victim;
+        pcore  = &OSCoreTbl[victim];
+        for (y = 0u; y < OS_RDY_TBL_SIZE; y++) {           /* Walk its ready list, highest prio first  */
+            bits = pcore->OSCoreRdyTbl[y];
+            while (bits != 0u) {
+#if OS_LOWEST_PRIO <= 63u
+                prio  = (OS_PRIO_NBR)((y << 3u) + OS_PRIO_BIT_LOW(bits));
+#else
+                prio  = (OS_PRIO_NBR)((y << 4u) + OS_PRIO_BIT_LOW(bits));
+#endif
+                bits &= (OS_PRIO)(bits - 1u);              /* Clear the bit just visited               */
+                if (prio == OS_TASK_IDLE_PRIO) {           /* Idle tasks stay on their core            */
+                    break;
+                }
+                ptcb = OSTCBPrioTbl[prio];
+                if ((ptcb != pcore->OSCoreTCBCur) &&       /* Not running and allowed on this core?    */
+                    ((ptcb->OSTCBCoreMsk & bit) != 0u)) {
+                    OS_TaskCoreSet(ptcb, core);
+                    OSCoreTbl[core].OSCoreStealCtr++;
+                    return (ptcb);
+                }
+            }
+        }
+    }
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  APPLY THE CURRENT TASK'S PREEMPTION THRESHOLD
+*
+* Description: This function is called by OS_SchedNew() once it has found the task to run.  If the
+*              current task is still ready and has a preemption threshold (see OSTaskThresholdSet()),
+*              the task found only gets to run if its priority is above the threshold.  Otherwise, the
+*              current task is kept and the context switch avoided is counted in OSCtxSwThresholdCtr.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) A task raised to a mutex priority above its threshold loses the threshold until it
+*                 returns to its own priority.
+*********************************************************************************************************
+*/
+
+#if OS_SCHED_THRESHOLD_EN > 0u
+static  void  OS_SchedThreshold (void)
+{
+    OS_TCB  *ptcb;
+
+
+    ptcb = OSTCBCur;
+    if ((ptcb == (OS_TCB *)0) ||                     /* Multitasking not started yet                   */
+        (ptcb == OSTCBHighRdy)) {                    /* Current task runs anyway                       */
+        return;
+    }
+    if (ptcb->OSTCBThreshold >= ptcb->OSTCBPrio) {   /* No threshold                                   */
+        return;
+    }
+    if (OSPrioHighRdy < ptcb->OSTCBThreshold) {      /* Task found is above the threshold              */
+        return;
+    }
+#if OS_SMP_EN > 0u
+    if (ptcb->OSTCBCore != OS_CPU_CoreIdGet()) {     /* Task was moved to another core                 */
+        return;
+    }
+#endif
+#if OS_SCHED_RR_EN > 0u
+    if (ptcb->OSTCBRdyNext == (OS_TCB *)0) {         /* Task no longer ready (it pends, sleeps ...)    */
+#else
+    if ((OS_RDY_TBL(ptcb)[ptcb->OSTCBY] & ptcb->OSTCBBitX) == 0u) {
+#endif
+        return;
+    }
+    OSTCBHighRdy  = ptcb;                            /* Current task goes on running                   */
+    OSPrioHighRdy = ptcb->OSTCBPrio;
+    OSCtxSwThresholdCtr++;
+}
+#endif
+
+/*$PAGE*/
 /*
 *********************************************************************************************************
 *                               FIND HIGHEST PRIORITY TASK READY TO RUN
 *
 * Description: This function is called by other uC/OS-II services to determine the highest priority task
-*              that is ready to run.  The global variable 'OSPrioHighRdy' is changed accordingly.
+*              that is ready to run.  The global variables 'OSPrioHighRdy' and 'OSTCBHighRdy' are changed
+*              accordingly.
 *
 * Arguments  : none
 *
@@ -1705,12 +2980,39 @@ void  OS_Sched (void)
 *
 * Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
 *              2) Interrupts are assumed to be disabled when this function is called.
+*              3) With OS_SCHED_CNT_ZEROS_EN, the lowest set bit of OSRdyGrp and of OSRdyTbl[] is found
+*                 with CPU_CntTrailZeros() (a single instruction on most CPUs) instead of OSUnMapTbl[].
+*              4) With OS_SMP_STEAL_EN, a core that would run its idle task first tries to steal a task
+*                 from another core (see OS_SchedSteal()).
+*              5) With OS_SCHED_THRESHOLD_EN, the current task is kept if it is still ready and the task
+*                 found is not above its preemption threshold (see OS_SchedThreshold()).
 *********************************************************************************************************
 */
 
 static  void  OS_SchedNew (void)
 {
-#if OS_LOWEST_PRIO <= 63u                        /* See if we support up to 64 tasks                   */
+#if (OS_SMP_EN > 0u) && (OS_SMP_STEAL_EN > 0u)
+    OS_TCB  *ptcb;
+#endif
+#if OS_LOWEST_PRIO > 254u                        /* We support up to 4096 tasks, three levels          */
+    INT8U   z;
+    INT8U   y;
+
+
+    z             = OS_PRIO_BIT_LOW(OSRdyGrp);
+    y             = (INT8U)((z << 4u) + OS_PRIO_BIT_LOW(OSRdyGrpTbl[z]));
+    OSPrioHighRdy = (OS_PRIO_NBR)(((OS_PRIO_NBR)y << 4u) + OS_PRIO_BIT_LOW(OSRdyTbl[y]));
+#elif OS_SCHED_CNT_ZEROS_EN > 0u                 /* Lowest set bits found by count trailing zeros      */
+    INT8U   y;
+
+
+    y             = (INT8U)CPU_CntTrailZeros((CPU_DATA)OSRdyGrp);
+#if OS_LOWEST_PRIO <= 63u
+    OSPrioHighRdy = (INT8U)((y << 3u) + (INT8U)CPU_CntTrailZeros((CPU_DATA)OSRdyTbl[y]));
+#else
+    OSPrioHighRdy = (INT8U)((y << 4u) + (INT8U)CPU_CntTrailZeros((CPU_DATA)OSRdyTbl[y]));
+#endif
+#elif OS_LOWEST_PRIO <= 63u                      /* See if we support up to 64 tasks                   */
     INT8U   y;
 
 
@@ -1733,7 +3035,91 @@ static  void  OS_SchedNew (void)
         OSPrioHighRdy = (INT8U)((y << 4u) + OSUnMapTbl[(OS_PRIO)(*ptbl >> 8u) & 0xFFu] + 8u);
     }
 #endif
+#if OS_SCHED_RR_EN > 0u
+    OSTCBHighRdy  = OSRdyRingTbl[OSPrioHighRdy]; /* Run the task at the head of the prio's ready ring  */
+#elif OS_SMP_EN > 0u
+    if (OSPrioHighRdy == OS_TASK_IDLE_PRIO) {    /* Each core runs its own idle task                   */
+        OSTCBHighRdy = OSCoreTbl[OS_CPU_CoreIdGet()].OSCoreTCBIdle;
+#if OS_SMP_STEAL_EN > 0u
+        ptcb         = OS_SchedSteal();          /* ... unless it can take work from a busier core     */
+        if (ptcb != (OS_TCB *)0) {
+            OSTCBHighRdy  = ptcb;
+            OSPrioHighRdy = ptcb->OSTCBPrio;
+        }
+#endif
+    } else {
+        OSTCBHighRdy = OSTCBPrioTbl[OSPrioHighRdy];
+    }
+#else
+    OSTCBHighRdy  = OSTCBPrioTbl[OSPrioHighRdy];
+#endif
+#if OS_SCHED_EDF_EN > 0u
+    if ((OSPrioHighRdy >= OS_SCHED_EDF_PRIO) &&  /* No fixed priority task above the EDF band ready?   */
+        (OSEdfHeapSize  > 0u)) {
+        OSTCBHighRdy  = OSEdfHeap[0];            /* Yes, run the EDF task with the earliest deadline   */
+        OSPrioHighRdy = OSTCBHighRdy->OSTCBPrio;
+    }
+#endif
+#if OS_SCHED_THRESHOLD_EN > 0u
+    OS_SchedThreshold();                         /* Keep the current task if it can't be preempted     */
+#endif
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     ROUND-ROBIN TIME SLICING
+*
+* Description: This function is called by OSTimeTick() to charge a tick to the time slice of the running
+*              task.  When the task has used up its time slice and other tasks are ready at its priority,
+*              it is moved to the tail of the priority's ready ring so that OSIntExit() switches to the
+*              next task in the ring.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) No time slicing takes place while the scheduler is locked.
+*********************************************************************************************************
+*/
+
+#if OS_SCHED_RR_EN > 0u
+static  void  OS_SchedRoundRobin (void)
+{
+    OS_TCB       *ptcb;
+    OS_PRIO_NBR   prio;
+
+
+    if (OSLockNesting > 0u) {                    /* Don't slice while the scheduler is locked          */
+        return;
+    }
+    ptcb = OSTCBCur;
+    prio = ptcb->OSTCBPrio;
+    if (OSRdyRingTbl[prio] != ptcb) {            /* Running task must be at the head of its ring ...   */
+        return;
+    }
+    if (ptcb->OSTCBRdyNext == ptcb) {            /* ... and share it with another ready task           */
+        return;
+    }
+    if (OSSchedQuantaTbl[prio] == 0u) {          /* Time slicing disabled at this priority             */
+        return;
+    }
+#if OS_SCHED_THRESHOLD_EN > 0u
+    if (ptcb->OSTCBThreshold < prio) {           /* A preemption threshold also disables time slicing  */
+        return;
+    }
+#endif
+    if (ptcb->OSTCBQuantaCtr > 1u) {             /* Time slice not used up yet                         */
+        ptcb->OSTCBQuantaCtr--;
+        return;
+    }
+    ptcb                 = ptcb->OSTCBRdyNext;       /* Move task to the tail of the ring ...          */
+    OSRdyRingTbl[prio]   = ptcb;
+    ptcb->OSTCBQuantaCtr = OSSchedQuantaTbl[prio];   /* ... and give the next task a full time slice   */
 }
+#endif
 
 /*$PAGE*/
 /*
@@ -1745,33 +3131,81 @@ static  void  OS_SchedNew (void)
 *
 * Arguments  : psrc     is a pointer to the string for which we need to know the size.
 *
-* Returns    : The size of the string (excluding the NUL terminating character)
+* Returns    : The size of the string (excluding the NUL terminating character)
+*
+* Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) The string to check must be less than 255 characters long.
+*********************************************************************************************************
+*/
+
+#if (OS_EVENT_NAME_EN > 0u) || (OS_FLAG_NAME_EN > 0u) || (OS_MEM_NAME_EN > 0u) || (OS_TASK_NAME_EN > 0u) || (OS_TMR_CFG_NAME_EN > 0u)
+INT8U  OS_StrLen (INT8U *psrc)
+{
+    INT8U  len;
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (psrc == (INT8U *)0) {
+        return (0u);
+    }
+#endif
+
+    len = 0u;
+    while (*psrc != OS_ASCII_NUL) {
+        psrc++;
+        len++;
+    }
+    return (len);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    ASSIGN A TASK TO ANOTHER CORE
+*
+* Description: This function is called by other uC/OS-II services to move a task to the ready list of
+*              another core.
+*
+* Arguments  : ptcb      is a pointer to the OS_TCB of the task to move.
+*
+*              core      is the index of the core the task is assigned to.
+*
+* Returns    : none
 *
-* Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
-*              2) The string to check must be less than 255 characters long.
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) The task MUST NOT be running on a core other than the calling one.
 *********************************************************************************************************
 */
 
-#if (OS_EVENT_NAME_EN > 0u) || (OS_FLAG_NAME_EN > 0u) || (OS_MEM_NAME_EN > 0u) || (OS_TASK_NAME_EN > 0u) || (OS_TMR_CFG_NAME_EN > 0u)
-INT8U  OS_StrLen (INT8U *psrc)
+#if OS_SMP_EN > 0u
+void  OS_TaskCoreSet (OS_TCB  *ptcb,
+                      INT8U    core)
 {
-    INT8U  len;
+    BOOLEAN  rdy;
 
 
-#if OS_ARG_CHK_EN > 0u
-    if (psrc == (INT8U *)0) {
-        return (0u);
+    if (ptcb->OSTCBCore == core) {
+        return;
     }
-#endif
-
-    len = 0u;
-    while (*psrc != OS_ASCII_NUL) {
-        psrc++;
-        len++;
+    if ((OS_RDY_TBL(ptcb)[ptcb->OSTCBY] & ptcb->OSTCBBitX) != 0u) {
+        OS_RdyListRemove(ptcb);                            /* Leave the ready list of the old core ... */
+        rdy = OS_TRUE;
+    } else {
+        rdy = OS_FALSE;
+    }
+    OSCoreTbl[ptcb->OSTCBCore].OSCoreTaskCtr--;
+    ptcb->OSTCBCore = core;
+    OSCoreTbl[core].OSCoreTaskCtr++;
+    if (OSRunning == OS_TRUE) {
+        OSCoreTbl[core].OSCoreMigrateCtr++;
+    }
+    if (rdy == OS_TRUE) {
+        OS_RdyListInsert(ptcb);                            /* ... and join the one of the new core     */
     }
-    return (len);
 }
 #endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -1791,11 +3225,16 @@ INT8U  OS_StrLen (INT8U *psrc)
 *                 interrupts.
 *              2) This hook has been added to allow you to do such things as STOP the CPU to conserve
 *                 power.
+*              3) With OS_SMP_STEAL_EN, the idle task of a core reschedules as soon as another core has
+*                 tasks waiting to run, so that work queued before the core went idle is stolen as well.
 *********************************************************************************************************
 */
 
 void  OS_TaskIdle (void *p_arg)
 {
+#if (OS_SMP_EN > 0u) && (OS_SMP_STEAL_EN > 0u)
+    INT8U      core;
+#endif
 #if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -1806,6 +3245,14 @@ void  OS_TaskIdle (void *p_arg)
     for (;;) {
         OS_ENTER_CRITICAL();
         OSIdleCtr++;
+#if (OS_SMP_EN > 0u) && (OS_SMP_STEAL_EN > 0u)
+        for (core = 0u; core < OS_SMP_CORE_NBR; core++) {
+            if (OSCoreTbl[core].OSCoreRdyCtr > 2u) { /* Tasks waiting on a core: try to steal one      */
+                OS_Sched();
+                break;
+            }
+        }
+#endif
         OS_EXIT_CRITICAL();
         OSTaskIdleHook();                        /* Call user definable HOOK                           */
     }
@@ -1832,6 +3279,10 @@ void  OS_TaskIdle (void *p_arg)
 *              2) You can disable this task by setting the configuration #define OS_TASK_STAT_EN to 0.
 *              3) You MUST have at least a delay of 2/10 seconds to allow for the system to establish the
 *                 maximum value for the idle counter.
+*              4) With OS_TASK_PROFILE_EN, the CPU usage of each task and of the ISRs is also computed,
+*                 see OS_TaskStatCPUUsage().  When the idle counter cannot be used (the idle task sleeps
+*                 or never ran during OSStatInit()), OSCPUUsage is then derived from the run time of the
+*                 idle task instead.
 *********************************************************************************************************
 */
 
@@ -1851,12 +3302,14 @@ void  OS_TaskStat (void *p_arg)
     OSIdleCtrMax /= 100uL;
     if (OSIdleCtrMax == 0uL) {
         OSCPUUsage = 0u;
+#if OS_TASK_PROFILE_EN == 0u                     /* Run times give the CPU usage (see Note #4)         */
 #if OS_TASK_SUSPEND_EN > 0u
         (void)OSTaskSuspend(OS_PRIO_SELF);
 #else
         for (;;) {
             OSTimeDly(OS_TICKS_PER_SEC);
         }
+#endif
 #endif
     }
     OS_ENTER_CRITICAL();
@@ -1867,7 +3320,12 @@ void  OS_TaskStat (void *p_arg)
         OSIdleCtrRun = OSIdleCtr;                /* Obtain the of the idle counter for the past second */
         OSIdleCtr    = 0uL;                      /* Reset the idle counter for the next second         */
         OS_EXIT_CRITICAL();
-        OSCPUUsage   = (INT8U)(100uL - OSIdleCtrRun / OSIdleCtrMax);
+        if (OSIdleCtrMax > 0uL) {
+            OSCPUUsage = (INT8U)(100uL - OSIdleCtrRun / OSIdleCtrMax);
+        }
+#if OS_TASK_PROFILE_EN > 0u
+        OS_TaskStatCPUUsage();                   /* Compute the CPU usage of each task (see Note #4)   */
+#endif
         OSTaskStatHook();                        /* Invoke user definable hook                         */
 #if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
         OS_TaskStatStkChk();                     /* Check the stacks for each task                     */
@@ -1879,6 +3337,280 @@ void  OS_TaskStat (void *p_arg)
 /*$PAGE*/
 /*
 *********************************************************************************************************
+*                                       COMPUTE TASK CPU USAGE
+*
+* Description: This function is called by OS_TaskStat() to compute the share of the CPU time each task,
+*              and the ISRs, used since the previous call:
+*
+*                                            OSTCBCyclesTot - OSTCBCyclesTotPrev
+*                 OSTCBCPUUsage = 10000 * ---------------------------------------     (units are 0.01 %)
+*                                           Cycles elapsed since the previous call
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) The running time of a task is accumulated by OSTaskSwHook() (see OS_TaskSwProfile())
+*                 and OSIntEnter(), in 64 bits so it does not wrap.
+*              2) With OS_SMP_EN, the shares are of the time of all the cores.  The task running on each
+*                 core is charged up to now first, unless the core is in an ISR, so that a task which
+*                 never switches out is not left at 0 %.
+*              3) Each task is sampled and reset in a critical section of its own, found from its priority
+*                 like OS_TaskStatStkChk() does, so interrupts are never disabled for the whole task list.
+*                 Since the tasks are not all sampled at the same instant, the elapsed time rather than the
+*                 sum of the samples is the reference, and a share is limited to 100 %.  A task created or
+*                 deleted at a shared priority during the walk may be missed for one period.
+*              4) OSCPUUsage is set from the share of the idle task(s) when OSIdleCtrMax is 0 (see
+*                 OS_TaskStat()  Note #4).
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_STAT_EN > 0u) && (OS_TASK_PROFILE_EN > 0u)
+void  OS_TaskStatCPUUsage (void)
+{
+    OS_TCB      *ptcb;
+    OS_TS        ts;
+    INT64U       cycles;
+    INT64U       cycles_idle;
+    INT64U       cycles_tot;
+    OS_PRIO_NBR  prio;
+    INT16U       ix;
+#if OS_SCHED_RR_EN > 0u
+    INT16U       i;
+#endif
+#if OS_SMP_EN > 0u
+    INT8U        core;
+#endif
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR    cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    ts                          = OS_TS_GET();
+#if OS_SMP_EN > 0u
+    for (core = 0u; core < OS_SMP_CORE_NBR; core++) {   /* Charge the running tasks (Note #2)     */
+        ptcb = OSCoreTbl[core].OSCoreTCBCur;
+        if ((ptcb != (OS_TCB *)0) &&
+            (OSCoreTbl[core].OSCoreIntNesting == 0u)) {
+            ptcb->OSTCBCyclesTot   += (OS_TS)(ts - ptcb->OSTCBCyclesStart);
+            ptcb->OSTCBCyclesStart  = ts;
+        }
+    }
+#else
+    OSTCBCur->OSTCBCyclesTot   += (OS_TS)(ts - OSTCBCur->OSTCBCyclesStart);
+    OSTCBCur->OSTCBCyclesStart  = ts;            /* Charge the statistic task up to now                */
+#endif
+    cycles_tot                  = (INT64U)(OS_TS)(ts - OSStatCyclesStart) * (OS_N_CORE_TASKS + 1u);
+    OSStatCyclesStart           = ts;            /* Time elapsed on all the cores (see Note #3)        */
+    cycles                      = OSIntCyclesTot - OSIntCyclesTotPrev;
+    OSIntCyclesTotPrev          = OSIntCyclesTot;
+    OS_EXIT_CRITICAL();
+    if (cycles_tot == 0u) {                      /* Timer stopped or disabled, all usages are 0        */
+        cycles_tot = 1u;
+    }
+    cycles = (cycles * 10000u) / cycles_tot;
+    if (cycles > 10000u) {
+        cycles = 10000u;
+    }
+    OSIntCPUUsage = (INT16U)cycles;
+
+    cycles_idle = 0u;
+    for (prio = 0u; prio <= OS_TASK_IDLE_PRIO; prio++) {
+        ix = 0u;
+        do {
+            OS_ENTER_CRITICAL();                 /* One task per critical section (see Note #3)        */
+            ptcb = OSTCBPrioTbl[prio];
+#if OS_SCHED_RR_EN > 0u
+            i    = 0u;
+            while ((ptcb != (OS_TCB *)0) && (ptcb != OS_TCB_RESERVED) && (i < ix)) {
+                ptcb = ptcb->OSTCBPrioNext;      /* Skip the tasks at 'prio' already sampled           */
+                i++;
+            }
+#else
+            if (ix > 0u) {                       /* Only one task per priority                         */
+                ptcb = (OS_TCB *)0;
+            }
+#endif
+            if ((ptcb != (OS_TCB *)0) && (ptcb != OS_TCB_RESERVED)) {
+                cycles = OS_TaskStatCPUUsageTCB(ptcb, cycles_tot);
+                if (prio == OS_TASK_IDLE_PRIO) {
+                    cycles_idle += cycles;
+                }
+                ix++;
+            } else {
+                ix = 0u;                         /* No more tasks at 'prio'                            */
+            }
+            OS_EXIT_CRITICAL();
+        } while (ix > 0u);
+    }
+#if OS_SMP_EN > 0u
+    for (core = 1u; core < OS_SMP_CORE_NBR; core++) {
+        OS_ENTER_CRITICAL();                     /* Idle tasks not in OSTCBPrioTbl[]                   */
+        cycles_idle += OS_TaskStatCPUUsageTCB(OSCoreTbl[core].OSCoreTCBIdle, cycles_tot);
+        OS_EXIT_CRITICAL();
+    }
+#endif
+    if (OSIdleCtrMax == 0uL) {                   /* See Note #4                                        */
+        cycles_idle = (cycles_idle * 100u) / cycles_tot;
+        if (cycles_idle > 100u) {
+            cycles_idle = 100u;
+        }
+        OSCPUUsage = (INT8U)(100u - cycles_idle);
+    }
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       SAMPLE TASK CPU USAGE
+*
+* Description: This function is called by OS_TaskStatCPUUsage() to compute the CPU usage of a task since
+*              the previous period and to start the next period.
+*
+* Arguments  : ptcb          is a pointer to the task's TCB.
+*
+*              cycles_tot    is the number of cycles elapsed since the previous period (never 0).
+*
+* Returns    : The number of cycles the task ran since the previous period.
+*
+* Note(s)    : 1) Interrupts MUST be disabled when calling this function.
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_STAT_EN > 0u) && (OS_TASK_PROFILE_EN > 0u)
+static  INT64U  OS_TaskStatCPUUsageTCB (OS_TCB  *ptcb,
+                                        INT64U   cycles_tot)
+{
+    INT64U  cycles;
+    INT64U  usage;
+
+
+    cycles                   = ptcb->OSTCBCyclesTot - ptcb->OSTCBCyclesTotPrev;
+    ptcb->OSTCBCyclesTotPrev = ptcb->OSTCBCyclesTot;
+    usage                    = (cycles * 10000u) / cycles_tot;
+    if (usage > 10000u) {                        /* Limit to 100 % (see OS_TaskStatCPUUsage() Note #3) */
+        usage = 10000u;
+    }
+    ptcb->OSTCBCPUUsage      = (INT16U)usage;
+    return (cycles);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    ACCOUNT FOR A CONTEXT SWITCH
+*
+* Description: This function is called by OSTaskSwHook() to charge the task being switched out with the
+*              time it ran since it was switched in, or since the last ISR, and to start timing the task
+*              being switched in.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are disabled when OSTaskSwHook() is called.
+*********************************************************************************************************
+*/
+
+#if OS_TASK_PROFILE_EN > 0u
+void  OS_TaskSwProfile (void)
+{
+    OS_TS  ts;
+
+
+    ts                             = OS_TS_GET();
+    OSTCBCur->OSTCBCyclesTot      += (OS_TS)(ts - OSTCBCur->OSTCBCyclesStart);
+    OSTCBHighRdy->OSTCBCyclesStart = ts;
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    START MEASURING A TASK LATENCY
+*
+* Description: This function is called when a post readies a task.  When the post was made by an ISR, it
+*              timestamps the task, whose latency is measured when it is switched in (see OS_TaskLatSw()).
+*
+* Arguments  : ptcb      is a pointer to the TCB of the task made ready
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) A post deferred by an ISR (OS_ISR_POST_DEFERRED_EN) is timestamped when the ISR makes
+*                 it, so the latency includes the ISR post task.
+*              3) When several ISR posts ready a task before it runs, the latency is measured from the
+*                 first one.
+*********************************************************************************************************
+*/
+
+#if OS_TASK_LAT_EN > 0u
+void  OS_TaskLatRdy (OS_TCB  *ptcb)
+{
+    if (ptcb->OSTCBLatPend == OS_TRUE) {                /* See Note #3                                 */
+        return;
+    }
+    if (OSIntNesting > 0u) {
+        ptcb->OSTCBLatTS   = (INT32U)CPU_TS_Get32();
+        ptcb->OSTCBLatPend = OS_TRUE;
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    } else if (OSIntQLatEn == OS_TRUE) {                /* See Note #2                                 */
+        ptcb->OSTCBLatTS   = OSIntQLatTS;
+        ptcb->OSTCBLatPend = OS_TRUE;
+#endif
+    }
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       RECORD A TASK LATENCY
+*
+* Description: This function is called by OSTaskSwHook().  When the task being switched in was readied
+*              by an ISR post, its latency is added to its histogram.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are disabled when OSTaskSwHook() is called.
+*********************************************************************************************************
+*/
+
+#if OS_TASK_LAT_EN > 0u
+void  OS_TaskLatSw (void)
+{
+    OS_TCB  *ptcb;
+    INT32U   lat;
+    INT8U    bucket;
+
+
+    ptcb = OSTCBHighRdy;
+    if (ptcb->OSTCBLatPend == OS_FALSE) {
+        return;
+    }
+    ptcb->OSTCBLatPend = OS_FALSE;
+    lat                = (INT32U)CPU_TS_Get32() - ptcb->OSTCBLatTS;
+    if (lat > ptcb->OSTCBLatMax) {
+        ptcb->OSTCBLatMax = lat;
+    }
+    if (lat > 1u) {                                     /* Bucket is log2(latency) (see OS_TASK_LAT)   */
+        bucket = (INT8U)(31u - CPU_CntLeadZeros32(lat));
+        if (bucket >= OS_TASK_LAT_HIST_SIZE) {
+            bucket = OS_TASK_LAT_HIST_SIZE - 1u;
+        }
+    } else {
+        bucket = 0u;
+    }
+    ptcb->OSTCBLatHist[bucket]++;
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
 *                                        CHECK ALL TASK STACKS
 *
 * Description: This function is called by OS_TaskStat() to check the stacks of each active task.
@@ -1895,7 +3627,7 @@ void  OS_TaskStatStkChk (void)
     OS_TCB      *ptcb;
     OS_STK_DATA  stk_data;
     INT8U        err;
-    INT8U        prio;
+    OS_PRIO_NBR  prio;
 
 
     for (prio = 0u; prio <= OS_TASK_IDLE_PRIO; prio++) {
@@ -1954,21 +3686,31 @@ void  OS_TaskStatStkChk (void)
 *              opt           options as passed to 'OSTaskCreateExt()' or,
 *                            0 if called from 'OSTaskCreate()'.
 *
+*              deadline      is the relative deadline of each job of an EDF task, in clock ticks (see
+*                            'OSTaskCreateEDF()').
+*
+*              period        is the period of an EDF task, in clock ticks, 0 for a fixed priority task.
+*
 * Returns    : OS_ERR_NONE              if the call was successful
 *              OS_ERR_TASK_NO_MORE_TCB  if there are no more free TCBs to be allocated and thus, the task
 *                                       cannot be created.
 *
-* Note       : This function is INTERNAL to uC/OS-II and your application should not call it.
+* Note       : 1) The first job of an EDF task is released when the task is made ready, with its deadline
+*                 already set : the task can run as soon as it is inserted in the ready list.
+*
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.
 *********************************************************************************************************
 */
 
-INT8U  OS_TCBInit (INT8U    prio,
-                   OS_STK  *ptos,
-                   OS_STK  *pbos,
-                   INT16U   id,
-                   INT32U   stk_size,
-                   void    *pext,
-                   INT16U   opt)
+INT8U  OS_TCBInit (OS_PRIO_NBR  prio,
+                   OS_STK      *ptos,
+                   OS_STK      *pbos,
+                   INT16U       id,
+                   INT32U       stk_size,
+                   void        *pext,
+                   INT16U       opt,
+                   INT32U       deadline,
+                   INT32U       period)
 {
     OS_TCB    *ptcb;
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
@@ -1990,10 +3732,35 @@ INT8U  OS_TCBInit (INT8U    prio,
         OSTCBFreeList            = ptcb->OSTCBNext;        /* Update pointer to free TCB list          */
         OS_EXIT_CRITICAL();
         ptcb->OSTCBStkPtr        = ptos;                   /* Load Stack pointer in TCB                */
-        ptcb->OSTCBPrio          = prio;                   /* Load task priority into TCB              */
+        OS_TCBPrioSet(ptcb, prio);                         /* Load task priority into TCB              */
+#if OS_SCHED_THRESHOLD_EN > 0u
+        ptcb->OSTCBThreshold     = prio;                   /* No preemption threshold                  */
+#endif
         ptcb->OSTCBStat          = OS_STAT_RDY;            /* Task is ready to run                     */
         ptcb->OSTCBStatPend      = OS_STAT_PEND_OK;        /* Clear pend status                        */
         ptcb->OSTCBDly           = 0u;                     /* Task is not delayed                      */
+#if OS_TICK_LIST_EN > 0u
+        ptcb->OSTCBTickNext      = (OS_TCB *)0;            /* Task is not in the tick list             */
+        ptcb->OSTCBTickPrev      = (OS_TCB *)0;
+        ptcb->OSTCBTickDelta     = 0u;
+#endif
+#if OS_SCHED_EDF_EN > 0u
+        ptcb->OSTCBEdfPeriod      = period;                /* 0 for a fixed priority task (not EDF)    */
+        ptcb->OSTCBEdfRelDeadline = deadline;
+        ptcb->OSTCBEdfRelease     = 0u;                    /* Set when made ready (see Note #1)        */
+        ptcb->OSTCBEdfDeadline    = 0u;
+        ptcb->OSTCBEdfMissCtr     = 0u;
+        ptcb->OSTCBEdfHeapIx      = 0u;
+#else
+        deadline                  = deadline;              /* Prevent compiler warning if not used     */
+        period                    = period;
+#endif
+#if OS_SCHED_RR_EN > 0u
+        ptcb->OSTCBPrioNext      = (OS_TCB *)0;            /* Task is not linked at its priority yet   */
+        ptcb->OSTCBRdyNext       = (OS_TCB *)0;            /* Task is not in a ready ring              */
+        ptcb->OSTCBRdyPrev       = (OS_TCB *)0;
+        ptcb->OSTCBQuantaCtr     = 0u;
+#endif
 
 #if OS_TASK_CREATE_EXT_EN > 0u
         ptcb->OSTCBExtPtr        = pext;                   /* Store pointer to TCB extension           */
@@ -2013,16 +3780,6 @@ INT8U  OS_TCBInit (INT8U    prio,
         ptcb->OSTCBDelReq        = OS_ERR_NONE;
 #endif
 
-#if OS_LOWEST_PRIO <= 63u                                         /* Pre-compute X, Y                  */
-        ptcb->OSTCBY             = (INT8U)(prio >> 3u);
-        ptcb->OSTCBX             = (INT8U)(prio & 0x07u);
-#else                                                             /* Pre-compute X, Y                  */
-        ptcb->OSTCBY             = (INT8U)((INT8U)(prio >> 4u) & 0xFFu);
-        ptcb->OSTCBX             = (INT8U) (prio & 0x0Fu);
-#endif
-                                                                  /* Pre-compute BitX and BitY         */
-        ptcb->OSTCBBitY          = (OS_PRIO)(1uL << ptcb->OSTCBY);
-        ptcb->OSTCBBitX          = (OS_PRIO)(1uL << ptcb->OSTCBX);
 
 #if (OS_EVENT_EN)
         ptcb->OSTCBEventPtr      = (OS_EVENT  *)0;         /* Task is not pending on an  event         */
@@ -2034,8 +3791,14 @@ INT8U  OS_TCBInit (INT8U    prio,
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u) && (OS_TASK_DEL_EN > 0u)
         ptcb->OSTCBFlagNode      = (OS_FLAG_NODE *)0;      /* Task is not pending on an event flag     */
 #endif
+#if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u) && (OS_FLAG_MULTI_EN > 0u)
+        ptcb->OSTCBFlagMultiPtr  = (OS_FLAG_PEND_DATA *)0; /* Task is not pending on flag conditions   */
+        ptcb->OSTCBFlagMultiSize = 0u;
+        ptcb->OSTCBFlagMultiRdy  = (OS_FLAG_NODE *)0;
+#endif
 
-#if (OS_MBOX_EN > 0u) || ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u))
+#if (OS_MBOX_EN > 0u) || ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || \
+    ((OS_QV_EN > 0u) && (OS_MAX_QVS > 0u))
         ptcb->OSTCBMsg           = (void *)0;              /* No message received                      */
 #endif
 
@@ -2043,10 +3806,21 @@ INT8U  OS_TCBInit (INT8U    prio,
         ptcb->OSTCBCtxSwCtr      = 0uL;                    /* Initialize profiling variables           */
         ptcb->OSTCBCyclesStart   = 0uL;
         ptcb->OSTCBCyclesTot     = 0uL;
+#if OS_TASK_STAT_EN > 0u
+        ptcb->OSTCBCyclesTotPrev = 0uL;
+        ptcb->OSTCBCPUUsage      = 0u;
+#endif
         ptcb->OSTCBStkBase       = (OS_STK *)0;
         ptcb->OSTCBStkUsed       = 0uL;
 #endif
 
+#if OS_TASK_LAT_EN > 0u
+        ptcb->OSTCBLatPend       = OS_FALSE;               /* No latency measured yet                  */
+        ptcb->OSTCBLatTS         = 0u;
+        ptcb->OSTCBLatMax        = 0u;
+        OS_MemClr((INT8U *)&ptcb->OSTCBLatHist[0], sizeof(ptcb->OSTCBLatHist));
+#endif
+
 #if OS_TASK_NAME_EN > 0u
         ptcb->OSTCBTaskName      = (INT8U *)(void *)"?";
 #endif
@@ -2060,10 +3834,11 @@ INT8U  OS_TCBInit (INT8U    prio,
         OSTCBInitHook(ptcb);
 
         OS_ENTER_CRITICAL();
-        OSTCBPrioTbl[prio] = ptcb;
+        OS_PrioTblInsert(ptcb);
         OS_EXIT_CRITICAL();
 
         OSTaskCreateHook(ptcb);                            /* Call user defined hook                   */
+        OS_TRACE_TASK_CREATE(ptcb);
 
 #if OS_TASK_CREATE_EXT_EN > 0u
 #if defined(OS_TLS_TBL_SIZE) && (OS_TLS_TBL_SIZE > 0u)
@@ -2081,8 +3856,18 @@ INT8U  OS_TCBInit (INT8U    prio,
             OSTCBList->OSTCBPrev = ptcb;
         }
         OSTCBList               = ptcb;
-        OSRdyGrp               |= ptcb->OSTCBBitY;         /* Make task ready to run                   */
-        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+#if OS_SMP_EN > 0u
+        ptcb->OSTCBCoreMsk      = OS_CORE_MSK_ALL;         /* Task may run on any core, start it ...   */
+        ptcb->OSTCBCore         = OS_CoreSelect(OS_CORE_MSK_ALL);   /* ... on the least loaded one     */
+        OSCoreTbl[ptcb->OSTCBCore].OSCoreTaskCtr++;
+#endif
+#if OS_SCHED_EDF_EN > 0u
+        if (period != 0u) {                                /* Release the first job now (see Note #1)  */
+            ptcb->OSTCBEdfRelease  = OSTime;
+            ptcb->OSTCBEdfDeadline = OSTime + deadline;
+        }
+#endif
+        OS_RdyListInsert(ptcb);                            /* Make task ready to run                   */
         OSTaskCtr++;                                       /* Increment the #tasks counter             */
         OS_EXIT_CRITICAL();
         return (OS_ERR_NONE);
@@ -2090,3 +3875,181 @@ INT8U  OS_TCBInit (INT8U    prio,
     OS_EXIT_CRITICAL();
     return (OS_ERR_TASK_NO_MORE_TCB);
 }
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  SET A TASK'S PRIORITY IN ITS OS_TCB
+*
+* Description: This function loads a priority in a TCB and pre-computes the position of the task's bit in
+*              the ready list and in the event wait lists.
+*
+* Arguments  : ptcb        is a pointer to the OS_TCB of the task.
+*
+*              prio        is the new priority of the task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) The task MUST NOT be in the ready list or in any wait list when this function is called.
+*              3) When OS_LOWEST_PRIO is above 254, OSTCBY holds the upper 8 bits of the priority.  Its
+*                 upper 4 bits select the bit in OSRdyGrp (OSTCBBitZ) and its lower 4 bits select the bit
+*                 in OSRdyGrpTbl[] (OSTCBBitY).
+*********************************************************************************************************
+*/
+
+void  OS_TCBPrioSet (OS_TCB       *ptcb,
+                     OS_PRIO_NBR   prio)
+{
+    ptcb->OSTCBPrio = prio;
+#if OS_LOWEST_PRIO <= 63u                                         /* Pre-compute X, Y                  */
+    ptcb->OSTCBY    = (INT8U)(prio >> 3u);
+    ptcb->OSTCBX    = (INT8U)(prio & 0x07u);
+#else
+    ptcb->OSTCBY    = (INT8U)((prio >> 4u) & 0xFFu);
+    ptcb->OSTCBX    = (INT8U) (prio & 0x0Fu);
+#endif
+                                                                  /* Pre-compute BitX, BitY (and BitZ) */
+#if OS_LOWEST_PRIO <= 254u
+    ptcb->OSTCBBitY = (OS_PRIO)(1uL << ptcb->OSTCBY);
+#else
+    ptcb->OSTCBBitY = (OS_PRIO)(1uL << (ptcb->OSTCBY & 0x0Fu));
+    ptcb->OSTCBBitZ = (OS_PRIO)(1uL << (ptcb->OSTCBY >> 4u));
+#endif
+    ptcb->OSTCBBitX = (OS_PRIO)(1uL << ptcb->OSTCBX);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       PROCESS AN EXPIRED DELAY
+*
+* Description: This function is called by OSTimeTick() when the delay or pend timeout of a task reaches
+*              zero.  The task is made ready to run unless it is also suspended.
+*
+* Arguments  : ptcb        is a pointer to the OS_TCB of the task whose delay expired.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static  void  OS_TickExpire (OS_TCB  *ptcb)
+{
+    if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) != OS_STAT_RDY) {
+        ptcb->OSTCBStat    &= (INT8U)~(INT8U)OS_STAT_PEND_ANY;     /* Yes, Clear status flag            */
+        ptcb->OSTCBStatPend = OS_STAT_PEND_TO;                     /* Indicate PEND timeout             */
+    } else {
+        ptcb->OSTCBStatPend = OS_STAT_PEND_OK;
+    }
+
+    if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY) {      /* Is task suspended?                */
+        OS_RdyListInsert(ptcb);                                    /* No,  Make ready                   */
+    }
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    INSERT A TASK IN THE TICK LIST
+*
+* Description: This function is called to place a task in the delta-sorted list of delayed tasks.  Each
+*              entry of the list holds the number of ticks between its expiry and the expiry of the entry
+*              before it so that OSTimeTick() only has to decrement the head of the list.  Tasks expiring
+*              on the same tick are kept in FIFO order.
+*
+* Arguments  : ptcb        is a pointer to the OS_TCB of the task to delay.
+*
+*              ticks       is the number of ticks to delay the task.  A value of 0 means that the task is
+*                          not delayed (i.e. pend forever) and the task is not placed in the list.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) 'OSTCBDly' holds the delay requested and is non-zero for as long as the task is in the
+*                 list.  The number of ticks remaining is the sum of the deltas up to and including
+*                 the task's own entry.
+*********************************************************************************************************
+*/
+
+#if OS_TICK_LIST_EN > 0u
+void  OS_TickListInsert (OS_TCB  *ptcb,
+                         INT32U   ticks)
+{
+    OS_TCB  *pnext;
+    OS_TCB  *pprev;
+
+
+    ptcb->OSTCBDly = ticks;
+    if (ticks == 0u) {                                     /* Not delayed, nothing to insert           */
+        return;
+    }
+    pprev = (OS_TCB *)0;
+    pnext = OSTickList;
+    while (pnext != (OS_TCB *)0) {                         /* Find insertion point                     */
+        if (ticks < pnext->OSTCBTickDelta) {
+            pnext->OSTCBTickDelta -= ticks;                /* Next entry now expires relative to us    */
+            break;
+        }
+        ticks -= pnext->OSTCBTickDelta;
+        pprev  = pnext;
+        pnext  = pnext->OSTCBTickNext;
+    }
+    ptcb->OSTCBTickDelta = ticks;
+    ptcb->OSTCBTickPrev  = pprev;
+    ptcb->OSTCBTickNext  = pnext;
+    if (pnext != (OS_TCB *)0) {
+        pnext->OSTCBTickPrev = ptcb;
+    }
+    if (pprev == (OS_TCB *)0) {                            /* Insert at the head of the list           */
+        OSTickList           = ptcb;
+    } else {
+        pprev->OSTCBTickNext = ptcb;
+    }
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   REMOVE A TASK FROM THE TICK LIST
+*
+* Description: This function is called to remove a task from the list of delayed tasks, either because
+*              its delay expired or because it was readied, resumed or deleted before the delay expired.
+*
+* Arguments  : ptcb        is a pointer to the OS_TCB of the task to remove.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) It is safe to call this function for a task that is not in the list.
+*********************************************************************************************************
+*/
+
+#if OS_TICK_LIST_EN > 0u
+void  OS_TickListRemove (OS_TCB  *ptcb)
+{
+    OS_TCB  *pnext;
+    OS_TCB  *pprev;
+
+
+    if (ptcb->OSTCBDly == 0u) {                            /* Task is not in the list                  */
+        return;
+    }
+    pnext = ptcb->OSTCBTickNext;
+    pprev = ptcb->OSTCBTickPrev;
+    if (pnext != (OS_TCB *)0) {
+        pnext->OSTCBTickDelta += ptcb->OSTCBTickDelta;     /* Next entry inherits our remaining ticks  */
+        pnext->OSTCBTickPrev   = pprev;
+    }
+    if (pprev == (OS_TCB *)0) {
+        OSTickList             = pnext;
+    } else {
+        pprev->OSTCBTickNext   = pnext;
+    }
+    ptcb->OSTCBTickNext  = (OS_TCB *)0;
+    ptcb->OSTCBTickPrev  = (OS_TCB *)0;
+    ptcb->OSTCBTickDelta = 0u;
+    ptcb->OSTCBDly       = 0u;                             /* Task is no longer delayed                */
+}
+#endif
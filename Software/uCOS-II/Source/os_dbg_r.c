@@ -42,7 +42,8 @@ INT16U  const  OSEventMax            = OS_MAX_EVENTS;           /* Number of eve
 INT16U  const  OSEventNameEn         = OS_EVENT_NAME_EN;
 #if (OS_EVENT_EN) && (OS_MAX_EVENTS > 0u)
 INT16U  const  OSEventSize           = sizeof(OS_EVENT);        /* Size in Bytes of OS_EVENT           */
-INT16U  const  OSEventTblSize        = sizeof(OSEventTbl);      /* Size of OSEventTbl[] in bytes       */
+                                                                /* Size of OSEventTbl[] in bytes       */
+INT16U  const  OSEventTblSize        = sizeof(OS_KERNEL_VAR(OSEventTbl));
 #else
 INT16U  const  OSEventSize           = 0u;
 INT16U  const  OSEventTblSize        = 0u;
@@ -63,6 +64,15 @@ INT16U  const  OSFlagWidth           = 0u;
 INT16U  const  OSFlagMax             = OS_MAX_FLAGS;
 INT16U  const  OSFlagNameEn          = OS_FLAG_NAME_EN;
 
+INT16U  const  OSHrtEn               = OS_HRT_EN;
+#if OS_HRT_EN > 0u
+INT16U  const  OSHrtCfgMax           = OS_HRT_CFG_MAX;
+INT16U  const  OSHrtSize             = sizeof(OS_HRT);
+#else
+INT16U  const  OSHrtCfgMax           = 0u;
+INT16U  const  OSHrtSize             = 0u;
+#endif
+
 INT16U  const  OSLowestPrio          = OS_LOWEST_PRIO;
 
 INT16U  const  OSMboxEn              = OS_MBOX_EN;
@@ -89,6 +99,14 @@ INT16U  const  OSQSize               = sizeof(OS_Q);            /* Size in bytes
 INT16U  const  OSQSize               = 0u;
 #endif
 
+INT16U  const  OSQVEn                = OS_QV_EN;
+INT16U  const  OSQVMax               = OS_MAX_QVS;              /* Number of by-value queues           */
+#if (OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)
+INT16U  const  OSQVSize              = sizeof(OS_QV);           /* Size in bytes of OS_QV structure    */
+#else
+INT16U  const  OSQVSize              = 0u;
+#endif
+
 INT16U  const  OSRdyTblSize          = OS_RDY_TBL_SIZE;         /* Number of bytes in the ready table  */
 
 INT16U  const  OSSemEn               = OS_SEM_EN;
@@ -100,7 +118,7 @@ INT16U  const  OSTaskCreateExtEn     = OS_TASK_CREATE_EXT_EN;
 INT16U  const  OSTaskDelEn           = OS_TASK_DEL_EN;
 INT16U  const  OSTaskIdleStkSize     = OS_TASK_IDLE_STK_SIZE;
 INT16U  const  OSTaskProfileEn       = OS_TASK_PROFILE_EN;
-INT16U  const  OSTaskMax             = OS_MAX_TASKS + OS_N_SYS_TASKS; /* Total max. number of tasks    */
+INT16U  const  OSTaskMax             = OS_MAX_TASKS + OS_N_SYS_TASKS + OS_N_CORE_TASKS; /* Max. tasks */
 INT16U  const  OSTaskNameEn          = OS_TASK_NAME_EN;
 INT16U  const  OSTaskStatEn          = OS_TASK_STAT_EN;
 INT16U  const  OSTaskStatStkSize     = OS_TASK_STAT_STK_SIZE;
@@ -130,12 +148,12 @@ INT16U  const  OSTmrCfgTicksPerSec   = OS_TMR_CFG_TICKS_PER_SEC;
 
 #if (OS_TMR_EN > 0u) && (OS_TMR_CFG_MAX > 0u)
 INT16U  const  OSTmrSize             = sizeof(OS_TMR);
-INT16U  const  OSTmrTblSize          = sizeof(OSTmrTbl);
+INT32U  const  OSTmrTblSize          = sizeof(OSTmrTbl);
 INT16U  const  OSTmrWheelSize        = sizeof(OS_TMR_WHEEL);
 INT16U  const  OSTmrWheelTblSize     = sizeof(OSTmrWheelTbl);
 #else
 INT16U  const  OSTmrSize             = 0u;
-INT16U  const  OSTmrTblSize          = 0u;
+INT32U  const  OSTmrTblSize          = 0u;
 INT16U  const  OSTmrWheelSize        = 0u;
 INT16U  const  OSTmrWheelTblSize     = 0u;
 #endif
@@ -151,10 +169,13 @@ INT16U  const  OSTmrWheelTblSize     = 0u;
 */
 #if OS_DEBUG_EN > 0u
 
-INT16U  const  OSDataSize = sizeof(OSCtxSwCtr)
+INT32U  const  OSDataSize = sizeof(OSCtxSwCtr)
+#if OS_SCHED_THRESHOLD_EN > 0u
+                          + sizeof(OSCtxSwThresholdCtr)
+#endif
 #if (OS_EVENT_EN) && (OS_MAX_EVENTS > 0u)
                           + sizeof(OSEventFreeList)
-                          + sizeof(OSEventTbl)
+                          + sizeof(OS_KERNEL_VAR(OSEventTbl))
 #endif
 
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
@@ -175,7 +196,7 @@ INT16U  const  OSDataSize = sizeof(OSCtxSwCtr)
 #endif
 
 #if (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
-                          + sizeof(OSMemFreeList)
+                          + sizeof(OS_KERNEL_VAR(OSMemFreeList))
                           + sizeof(OSMemTbl)
 #endif
 
@@ -188,6 +209,11 @@ INT16U  const  OSDataSize = sizeof(OSCtxSwCtr)
                           + sizeof(OSQTbl)
 #endif
 
+#if (OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)
+                          + sizeof(OSQVFreeList)
+                          + sizeof(OSQVTbl)
+#endif
+
 #if OS_TASK_REG_TBL_SIZE > 0u
                           + sizeof(OSTaskRegNextAvailID)
 #endif
@@ -206,20 +232,56 @@ INT16U  const  OSDataSize = sizeof(OSCtxSwCtr)
                           + sizeof(OSTmrFreeList)
                           + sizeof(OSTmrTaskStk)
                           + sizeof(OSTmrWheelTbl)
+#if OS_TMR_CFG_WORKER_EN > 0u
+                          + sizeof(OSTmrWorkerTbl)
+                          + sizeof(OSTmrWorkerStk)
+                          + sizeof(OSTmrWorkerOvfCtr)
+#endif
+#endif
+#if OS_HRT_EN > 0u
+                          + sizeof(OSHrtTbl)
+                          + sizeof(OSHrtFreeList)
+                          + sizeof(OSHrtHeap)
+                          + sizeof(OSHrtHeapSize)
+                          + sizeof(OSHrtExpHead)
+                          + sizeof(OSHrtExpTail)
+                          + sizeof(OSHrtLatMax)
+                          + sizeof(OSHrtTaskStk)
 #endif
+#if OS_ISR_POST_DEFERRED_EN > 0u
+                          + sizeof(OSIntQTbl)
+                          + sizeof(OSIntQIn)
+                          + sizeof(OSIntQOut)
+                          + sizeof(OSIntQCtr)
+                          + sizeof(OSIntQCtrMax)
+                          + sizeof(OSIntQOvfCtr)
+                          + sizeof(OSIntQTaskStk)
+#if OS_TASK_LAT_EN > 0u
+                          + sizeof(OSIntQLatEn)
+                          + sizeof(OSIntQLatTS)
+#endif
+#endif
+#if OS_SMP_EN > 0u
+                          + sizeof(OSCoreTbl)
+                          + sizeof(OSTaskIdleCoreStk)
+#else
                           + sizeof(OSIntNesting)
                           + sizeof(OSLockNesting)
                           + sizeof(OSPrioCur)
                           + sizeof(OSPrioHighRdy)
                           + sizeof(OSRdyGrp)
+#if OS_LOWEST_PRIO > 254u
+                          + sizeof(OSRdyGrpTbl)
+#endif
                           + sizeof(OSRdyTbl)
+                          + sizeof(OSTCBCur)
+                          + sizeof(OSTCBHighRdy)
+#endif
                           + sizeof(OSRunning)
                           + sizeof(OSTaskCtr)
                           + sizeof(OSIdleCtr)
                           + sizeof(OSTaskIdleStk)
-                          + sizeof(OSTCBCur)
                           + sizeof(OSTCBFreeList)
-                          + sizeof(OSTCBHighRdy)
                           + sizeof(OSTCBList)
                           + sizeof(OSTCBPrioTbl)
                           + sizeof(OSTCBTbl);
@@ -271,6 +333,10 @@ void  OSDebugInit (void)
     ptemp = (void const *)&OSFlagMax;
     ptemp = (void const *)&OSFlagNameEn;
 
+    ptemp = (void const *)&OSHrtEn;
+    ptemp = (void const *)&OSHrtCfgMax;
+    ptemp = (void const *)&OSHrtSize;
+
     ptemp = (void const *)&OSLowestPrio;
 
     ptemp = (void const *)&OSMboxEn;
@@ -288,6 +354,9 @@ void  OSDebugInit (void)
     ptemp = (void const *)&OSQEn;
     ptemp = (void const *)&OSQMax;
     ptemp = (void const *)&OSQSize;
+    ptemp = (void const *)&OSQVEn;
+    ptemp = (void const *)&OSQVMax;
+    ptemp = (void const *)&OSQVSize;
 
     ptemp = (void const *)&OSRdyTblSize;
 
@@ -35,7 +35,14 @@
 */
 
 static  void     OS_FlagBlock(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode, OS_FLAGS flags, INT8U wait_type, INT32U timeout);
+static  void     OS_FlagLink(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode, OS_FLAGS flags, INT8U wait_type);
 static  BOOLEAN  OS_FlagTaskRdy(OS_FLAG_NODE *pnode, OS_FLAGS flags_rdy, INT8U pend_stat);
+#if OS_FLAG_INDEX_EN > 0u
+static  INT8U    OS_FlagBitLow(OS_FLAGS flags);
+static  void   **OS_FlagBucketList(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode);
+static  void     OS_FlagBucketInsert(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode);
+static  void     OS_FlagBucketReplace(OS_FLAG_NODE *pnode, OS_FLAG_NODE *pnode_new);
+#endif
 
 /*$PAGE*/
 /*
@@ -250,6 +257,15 @@ OS_FLAG_GRP  *OSFlagCreate (OS_FLAGS  flags,
         pgrp->OSFlagType     = OS_EVENT_TYPE_FLAG;  /* Set to event flag group type                    */
         pgrp->OSFlagFlags    = flags;               /* Set to desired initial value                    */
         pgrp->OSFlagWaitList = (void *)0;           /* Clear list of tasks waiting on flags            */
+#if OS_FLAG_INDEX_EN > 0u
+        pgrp->OSFlagWaitListClr = (void *)0;
+        pgrp->OSFlagWaitSet     = (OS_FLAGS)0;
+        pgrp->OSFlagWaitClr     = (OS_FLAGS)0;
+        OS_MemClr((INT8U *)&pgrp->OSFlagBitListSet[0], sizeof(pgrp->OSFlagBitListSet));
+        OS_MemClr((INT8U *)&pgrp->OSFlagBitListClr[0], sizeof(pgrp->OSFlagBitListClr));
+        pgrp->OSFlagBitSet      = (OS_FLAGS)0;
+        pgrp->OSFlagBitClr      = (OS_FLAGS)0;
+#endif
 #if OS_FLAG_NAME_EN > 0u
         pgrp->OSFlagName     = (INT8U *)(void *)"?";
 #endif
@@ -309,6 +325,9 @@ OS_FLAG_GRP  *OSFlagDel (OS_FLAG_GRP  *pgrp,
     BOOLEAN       tasks_waiting;
     OS_FLAG_NODE *pnode;
     OS_FLAG_GRP  *pgrp_return;
+#if OS_FLAG_INDEX_EN > 0u
+    INT8U         bit;
+#endif
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
     OS_CPU_SR     cpu_sr = 0u;
 #endif
@@ -342,6 +361,14 @@ OS_FLAG_GRP  *OSFlagDel (OS_FLAG_GRP  *pgrp,
     } else {
         tasks_waiting = OS_FALSE;                          /* No                                       */
     }
+#if OS_FLAG_INDEX_EN > 0u
+    if (pgrp->OSFlagWaitListClr != (void *)0) {            /* See if any tasks waiting for CLR flags   */
+        tasks_waiting = OS_TRUE;
+    }
+    if ((pgrp->OSFlagBitSet | pgrp->OSFlagBitClr) != (OS_FLAGS)0) {   /* ... or for ALL flags          */
+        tasks_waiting = OS_TRUE;
+    }
+#endif
     switch (opt) {
         case OS_DEL_NO_PEND:                               /* Delete group if no task waiting          */
              if (tasks_waiting == OS_FALSE) {
@@ -363,11 +390,36 @@ OS_FLAG_GRP  *OSFlagDel (OS_FLAG_GRP  *pgrp,
              break;
 
         case OS_DEL_ALWAYS:                                /* Always delete the event flag group       */
+#if OS_FLAG_INDEX_EN > 0u
+             pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
+             while (pnode != (OS_FLAG_NODE *)0) {          /* Ready ALL tasks waiting for SET flags    */
+                 (void)OS_FlagTaskRdy(pnode, (OS_FLAGS)0, OS_STAT_PEND_ABORT);
+                 pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;     /* Next head took its place         */
+             }
+             pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitListClr;
+             while (pnode != (OS_FLAG_NODE *)0) {          /* Ready ALL tasks waiting for CLR flags    */
+                 (void)OS_FlagTaskRdy(pnode, (OS_FLAGS)0, OS_STAT_PEND_ABORT);
+                 pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitListClr;
+             }
+             for (bit = 0u; bit < OS_FLAGS_NBITS; bit++) { /* Ready ALL tasks watching a flag          */
+                 pnode = (OS_FLAG_NODE *)pgrp->OSFlagBitListSet[bit];
+                 while (pnode != (OS_FLAG_NODE *)0) {
+                     (void)OS_FlagTaskRdy(pnode, (OS_FLAGS)0, OS_STAT_PEND_ABORT);
+                     pnode = (OS_FLAG_NODE *)pgrp->OSFlagBitListSet[bit];
+                 }
+                 pnode = (OS_FLAG_NODE *)pgrp->OSFlagBitListClr[bit];
+                 while (pnode != (OS_FLAG_NODE *)0) {
+                     (void)OS_FlagTaskRdy(pnode, (OS_FLAGS)0, OS_STAT_PEND_ABORT);
+                     pnode = (OS_FLAG_NODE *)pgrp->OSFlagBitListClr[bit];
+                 }
+             }
+#else
              pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
              while (pnode != (OS_FLAG_NODE *)0) {          /* Ready ALL tasks waiting for flags        */
                  (void)OS_FlagTaskRdy(pnode, (OS_FLAGS)0, OS_STAT_PEND_ABORT);
                  pnode = (OS_FLAG_NODE *)pnode->OSFlagNodeNext;
              }
+#endif
 #if OS_FLAG_NAME_EN > 0u
              pgrp->OSFlagName     = (INT8U *)(void *)"?";
 #endif
@@ -637,6 +689,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
         consume    = OS_FALSE;
     }
 /*$PAGE*/
+    OS_TRACE_PEND(OS_EVENT_TYPE_FLAG, pgrp, timeout);
     OS_ENTER_CRITICAL();
     switch (wait_type) {
         case OS_FLAG_WAIT_SET_ALL:                         /* See if all required flags are set        */
@@ -717,7 +770,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
     if (OSTCBCur->OSTCBStatPend != OS_STAT_PEND_OK) {      /* Have we timed-out or aborted?            */
         pend_stat                = OSTCBCur->OSTCBStatPend;
         OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
-        OS_FlagUnlink(&node);
+        if (pend_stat != OS_STAT_PEND_ABORT) {             /* OSFlagDel() already unlinked the node    */
+            OS_FlagUnlink(&node);
+        }
         OSTCBCur->OSTCBStat      = OS_STAT_RDY;            /* Yes, make task ready-to-run              */
         OS_EXIT_CRITICAL();
         flags_rdy                = (OS_FLAGS)0;
@@ -788,6 +843,233 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (void)
     return (flags);
 }
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 WAIT ON SEVERAL EVENT FLAG CONDITIONS
+*
+* Description: This function is called to wait for the first of several conditions on event flag groups
+*              to become true.  Each condition is a combination of bits to be set or cleared in a group,
+*              like the ones OSFlagPend() waits for.  The groups may be different or the same.
+*
+* Arguments  : p_pend_data_tbl   is a pointer to a table of the conditions to wait on.  For each entry,
+*                                the application sets:
+*
+*                                OSFlagPendGrp        the event flag group
+*                                OSFlagPendFlags      the flags to wait on
+*                                OSFlagPendWaitType   the type of wait (see OSFlagPend()), OS_FLAG_CONSUME
+*                                                     may be added
+*
+*                                and uC/OS-II returns in OSFlagPendFlagsRdy the flags that made the
+*                                condition true, or 0 if it is not.  The table MUST remain valid until
+*                                this function returns.
+*
+*              tbl_size          is the number of entries in the table.
+*
+*              timeout           is an optional timeout (in clock ticks) that your task will wait for one
+*                                of the conditions.  If you specify 0, however, your task will wait
+*                                forever or, until one of the conditions is met.
+*
+*              perr              is a pointer to an error code and can be:
+*                                OS_ERR_NONE               One of the conditions was met.
+*                                OS_ERR_PDATA_NULL         If 'p_pend_data_tbl' is a NULL pointer or
+*                                                          'tbl_size' is 0.
+*                                OS_ERR_PEND_ISR           If you tried to PEND from an ISR
+*                                OS_ERR_PEND_LOCKED        If you called this function with the scheduler
+*                                                          locked
+*                                OS_ERR_FLAG_INVALID_PGRP  If a group in the table is a NULL pointer.
+*                                OS_ERR_EVENT_TYPE         If an entry does not point to an event flag group
+*                                OS_ERR_FLAG_WAIT_TYPE     If an entry has an invalid wait type
+*                                OS_ERR_TIMEOUT            None of the conditions were met in time.
+*                                OS_ERR_PEND_ABORT         The wait was aborted because a group was deleted.
+*
+* Returns    : The number of conditions that are true, 0 upon a timeout or an error.
+*
+* Called from: Task ONLY
+*
+* Note(s)    : 1) When some conditions are already true, they are all returned (and consumed when asked)
+*                 and the task does not wait.  Otherwise, the task waits in the wait list of each group
+*                 and is readied by the first post that makes one of the conditions true.  That condition
+*                 alone is returned: the others are no longer waited on.
+*              2) Each entry holds the wait list node of its condition, so no memory is allocated.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_MULTI_EN > 0u
+INT16U  OSFlagPendMulti (OS_FLAG_PEND_DATA  *p_pend_data_tbl,
+                         INT16U              tbl_size,
+                         INT32U              timeout,
+                         INT8U              *perr)
+{
+    OS_FLAG_PEND_DATA  *p_pend_data;
+    OS_FLAG_GRP        *pgrp;
+    OS_FLAG_NODE       *pnode_rdy;
+    OS_FLAGS            flags;
+    OS_FLAGS            flags_rdy;
+    INT16U              i;
+    INT16U              nbr_rdy;
+    INT8U               wait_type;
+    INT8U               pend_stat;
+    BOOLEAN             rdy;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR           cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if ((p_pend_data_tbl == (OS_FLAG_PEND_DATA *)0) ||     /* Validate the table                       */
+        (tbl_size        == 0u)) {
+        *perr = OS_ERR_PDATA_NULL;
+        return (0u);
+    }
+#endif
+    if (OSIntNesting > 0u) {                               /* See if called from ISR ...               */
+        *perr = OS_ERR_PEND_ISR;                           /* ... can't PEND from an ISR               */
+        return (0u);
+    }
+    if (OSLockNesting > 0u) {                              /* See if called with scheduler locked ...  */
+        *perr = OS_ERR_PEND_LOCKED;                        /* ... can't PEND when locked               */
+        return (0u);
+    }
+    for (i = 0u; i < tbl_size; i++) {                      /* Validate the conditions                  */
+        p_pend_data                     = &p_pend_data_tbl[i];
+        p_pend_data->OSFlagPendFlagsRdy = (OS_FLAGS)0;
+        pgrp                            = p_pend_data->OSFlagPendGrp;
+#if OS_ARG_CHK_EN > 0u
+        if (pgrp == (OS_FLAG_GRP *)0) {
+            *perr = OS_ERR_FLAG_INVALID_PGRP;
+            return (0u);
+        }
+#endif
+        if (pgrp->OSFlagType != OS_EVENT_TYPE_FLAG) {
+            *perr = OS_ERR_EVENT_TYPE;
+            return (0u);
+        }
+        wait_type = (INT8U)(p_pend_data->OSFlagPendWaitType & (INT8U)~(INT8U)OS_FLAG_CONSUME);
+        switch (wait_type) {
+            case OS_FLAG_WAIT_SET_ALL:
+            case OS_FLAG_WAIT_SET_ANY:
+#if OS_FLAG_WAIT_CLR_EN > 0u
+            case OS_FLAG_WAIT_CLR_ALL:
+            case OS_FLAG_WAIT_CLR_ANY:
+#endif
+                 break;
+
+            default:
+                 *perr = OS_ERR_FLAG_WAIT_TYPE;
+                 return (0u);
+        }
+    }
+/*$PAGE*/
+    OS_TRACE_PEND(OS_EVENT_TYPE_FLAG, p_pend_data_tbl[0].OSFlagPendGrp, timeout);
+    nbr_rdy = 0u;
+    OS_ENTER_CRITICAL();
+    for (i = 0u; i < tbl_size; i++) {                      /* See if any condition is already true     */
+        p_pend_data = &p_pend_data_tbl[i];
+        pgrp        = p_pend_data->OSFlagPendGrp;
+        flags       = p_pend_data->OSFlagPendFlags;
+        wait_type   = (INT8U)(p_pend_data->OSFlagPendWaitType & (INT8U)~(INT8U)OS_FLAG_CONSUME);
+        if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_SET_ANY)) {
+            flags_rdy = (OS_FLAGS)(pgrp->OSFlagFlags & flags);
+        } else {
+            flags_rdy = (OS_FLAGS)~pgrp->OSFlagFlags & flags;
+        }
+        if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_CLR_ALL)) {
+            rdy = (flags_rdy == flags)       ? OS_TRUE : OS_FALSE;
+        } else {
+            rdy = (flags_rdy != (OS_FLAGS)0) ? OS_TRUE : OS_FALSE;
+        }
+        if (rdy == OS_TRUE) {
+            if ((p_pend_data->OSFlagPendWaitType & OS_FLAG_CONSUME) != (INT8U)0) {
+                if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_SET_ANY)) {
+                    pgrp->OSFlagFlags &= (OS_FLAGS)~flags_rdy;     /* Clear ONLY the flags we got      */
+                } else {
+                    pgrp->OSFlagFlags |=  flags_rdy;               /* Set   ONLY the flags we got      */
+                }
+            }
+            p_pend_data->OSFlagPendFlagsRdy = flags_rdy;
+            OSTCBCur->OSTCBFlagsRdy         = flags_rdy;
+            nbr_rdy++;
+        }
+    }
+    if (nbr_rdy > 0u) {                                    /* Yes, return to caller (see Note #1)      */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_NONE;
+        return (nbr_rdy);
+    }
+                                                           /* Block task until a condition is met     */
+    OSTCBCur->OSTCBStat          |= OS_STAT_FLAG;
+    OSTCBCur->OSTCBStatPend       = OS_STAT_PEND_OK;
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur, timeout);                  /* Store timeout in task's TCB              */
+#else
+    OSTCBCur->OSTCBDly            = timeout;               /* Store timeout in task's TCB              */
+#endif
+    OSTCBCur->OSTCBFlagMultiPtr   = p_pend_data_tbl;
+    OSTCBCur->OSTCBFlagMultiSize  = tbl_size;
+    OSTCBCur->OSTCBFlagMultiRdy   = (OS_FLAG_NODE *)0;
+    for (i = 0u; i < tbl_size; i++) {                      /* Wait in the wait list of each group      */
+        p_pend_data = &p_pend_data_tbl[i];
+        OS_FlagLink(p_pend_data->OSFlagPendGrp,
+                    &p_pend_data->OSFlagPendNode,
+                    p_pend_data->OSFlagPendFlags,
+                    (INT8U)(p_pend_data->OSFlagPendWaitType & (INT8U)~(INT8U)OS_FLAG_CONSUME));
+    }
+    OS_RdyListRemove(OSTCBCur);
+    OS_EXIT_CRITICAL();
+/*$PAGE*/
+    OS_Sched();                                            /* Find next HPT ready to run               */
+    OS_ENTER_CRITICAL();
+    pnode_rdy                = OSTCBCur->OSTCBFlagMultiRdy;
+    OS_FlagUnlinkMulti(OSTCBCur);                          /* Stop waiting on the other conditions     */
+    pend_stat                = OSTCBCur->OSTCBStatPend;
+    OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+    OSTCBCur->OSTCBStat      = OS_STAT_RDY;
+    if (pend_stat != OS_STAT_PEND_OK) {                    /* Have we timed-out or aborted?            */
+        OS_EXIT_CRITICAL();
+        switch (pend_stat) {
+            case OS_STAT_PEND_ABORT:
+                 *perr = OS_ERR_PEND_ABORT;                /* Indicate that we aborted   waiting       */
+                 break;
+
+            case OS_STAT_PEND_TO:
+            default:
+                 *perr = OS_ERR_TIMEOUT;                   /* Indicate that we timed-out waiting       */
+                 break;
+        }
+        return (0u);
+    }
+    flags_rdy = OSTCBCur->OSTCBFlagsRdy;
+    for (i = 0u; i < tbl_size; i++) {                      /* Find the condition that was met          */
+        p_pend_data = &p_pend_data_tbl[i];
+        if (&p_pend_data->OSFlagPendNode == pnode_rdy) {
+            p_pend_data->OSFlagPendFlagsRdy = flags_rdy;
+            if ((p_pend_data->OSFlagPendWaitType & OS_FLAG_CONSUME) != (INT8U)0) {
+                pgrp      = p_pend_data->OSFlagPendGrp;
+                wait_type = pnode_rdy->OSFlagNodeWaitType;
+                if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_SET_ANY)) {
+                    pgrp->OSFlagFlags &= (OS_FLAGS)~flags_rdy;     /* Clear ONLY the flags we got      */
+                } else {
+                    pgrp->OSFlagFlags |=  flags_rdy;               /* Set   ONLY the flags we got      */
+                }
+            }
+            break;
+        }
+    }
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;                                   /* A condition must have been met           */
+    return (1u);
+}
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -819,8 +1101,11 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (void)
 *                            OS_ERR_FLAG_INVALID_PGRP   You passed a NULL pointer
 *                            OS_ERR_EVENT_TYPE          You are not pointing to an event flag group
 *                            OS_ERR_FLAG_INVALID_OPT    You specified an invalid option
+*                            OS_ERR_INT_Q_FULL          Called from an ISR and the ISR post queue is full
 *
 * Returns    : the new value of the event flags bits that are still set.
+*              0, when called from an ISR with OS_ISR_POST_DEFERRED_EN, as the post is only queued and is
+*              performed later by the ISR post task.
 *
 * Called From: Task or ISR
 *
@@ -828,6 +1113,30 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (void)
 *                 flag group.
 *              2) The amount of time interrupts are DISABLED depends on the number of tasks waiting on
 *                 the event flag group.
+*
+* Note(s)    : 1) With OS_FLAG_INDEX_EN, the tasks waiting on the group are kept in buckets, one per
+*                 combination of flags and wait type waited on.  A post evaluates each bucket once and
+*                 readies all of its tasks at once, so that its time with interrupts disabled depends on
+*                 the buckets it visits and the tasks it readies, not on the number of tasks waiting :
+*
+*                 (a) A bucket waiting for ALL its flags, or for ANY of a single flag, watches one of
+*                     the flags it still needs and is kept in the list of that flag and state
+*                     (OSFlagBitListSet[]/OSFlagBitListClr[]).  A post only visits the lists of the
+*                     watched flags that are now in the state waited on.  A bucket that still needs
+*                     other flags moves to the list of the lowest of them, which this post does not
+*                     visit again.  With each task waiting on a combination of its own, a post thus
+*                     visits the buckets that watch the posted flags, not all of them.
+*                 (b) A bucket waiting for ANY of several flags can be readied by each of them and is
+*                     kept in one list per state (OSFlagWaitList/OSFlagWaitListClr), which a post goes
+*                     through whenever one of the posted flags is waited on by one of its buckets
+*                     (OSFlagWaitSet/OSFlagWaitClr).  This list is not indexed : a post still evaluates
+*                     every bucket in it, as many as there are different combinations waited on.
+*
+*                 Each list of (a) takes one pointer per flag and state in every group, that is
+*                 2 * OS_FLAGS_NBITS pointers.
+*              2) With OS_FLAG_INDEX_EN, a post that sets flags does not look at the tasks waiting for
+*                 flags to be cleared and vice versa: such tasks could only have become ready when a
+*                 task consumed flags, which does not ready waiting tasks either.
 *********************************************************************************************************
 */
 OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
@@ -840,6 +1149,15 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
     OS_FLAGS      flags_cur;
     OS_FLAGS      flags_rdy;
     BOOLEAN       rdy;
+#if OS_FLAG_INDEX_EN > 0u
+    OS_FLAG_NODE *pnode_next;
+    OS_FLAG_NODE *pnode_same;
+    OS_FLAGS      flags_wait;
+    OS_FLAGS      flags_bit;
+    void        **plist;
+    INT8U         wait_type;
+    INT8U         bit;
+#endif
 #if OS_CRITICAL_METHOD == 3u                         /* Allocate storage for CPU status register       */
     OS_CPU_SR     cpu_sr = 0u;
 #endif
@@ -864,6 +1182,18 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
         return ((OS_FLAGS)0);
     }
 /*$PAGE*/
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                         /* Called from an ISR, let the ISR post task      */
+                                                     /* ... perform the post                           */
+        if ((opt != OS_FLAG_CLR) && (opt != OS_FLAG_SET)) {
+            *perr = OS_ERR_FLAG_INVALID_OPT;
+            return ((OS_FLAGS)0);
+        }
+        *perr = OS_IntQFlagPost(pgrp, flags, opt);
+        return ((OS_FLAGS)0);
+    }
+#endif
+    OS_TRACE_POST(OS_EVENT_TYPE_FLAG, pgrp, flags);
     OS_ENTER_CRITICAL();
     switch (opt) {
         case OS_FLAG_CLR:
@@ -880,6 +1210,88 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
              return ((OS_FLAGS)0);
     }
     sched = OS_FALSE;                                /* Indicate that we don't need rescheduling       */
+#if OS_FLAG_INDEX_EN > 0u
+    if (opt == OS_FLAG_SET) {                        /* Only tasks waiting for the posted state ...    */
+        flags_cur  = pgrp->OSFlagFlags;
+        flags_bit  = pgrp->OSFlagBitSet & flags_cur;
+    } else {
+        flags_cur  = (OS_FLAGS)~pgrp->OSFlagFlags;
+        flags_bit  = pgrp->OSFlagBitClr & flags_cur;
+    }
+    while (flags_bit != (OS_FLAGS)0) {               /* Go through the lists of the watched flags ...  */
+        bit        = OS_FlagBitLow(flags_bit);       /* ... now in the state waited on, Note #1a       */
+        flags_bit &= (OS_FLAGS)~((OS_FLAGS)1 << bit);
+        if (opt == OS_FLAG_SET) {
+            plist  = &pgrp->OSFlagBitListSet[bit];
+        } else {
+            plist  = &pgrp->OSFlagBitListClr[bit];
+        }
+        pnode      = (OS_FLAG_NODE *)*plist;
+        while (pnode != (OS_FLAG_NODE *)0) {
+            pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeNext;
+            flags_rdy  = (OS_FLAGS)(flags_cur & pnode->OSFlagNodeFlags);
+            wait_type  = pnode->OSFlagNodeWaitType;
+            if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_CLR_ALL)) {
+                rdy = (flags_rdy == pnode->OSFlagNodeFlags) ? OS_TRUE : OS_FALSE;
+            } else {
+                rdy = (flags_rdy != (OS_FLAGS)0)         ? OS_TRUE : OS_FALSE;
+            }
+            if (rdy == OS_TRUE) {                    /* Make ALL the tasks of the bucket RTR           */
+                do {
+                    pnode_same = (OS_FLAG_NODE *)pnode->OSFlagNodeSameNext;
+                    if (OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK) == OS_TRUE) {
+                        sched = OS_TRUE;             /* When done we will reschedule                   */
+                    }
+                    OS_INT_Q_WINDOW();               /* Let interrupts in between tasks                */
+                    pnode = pnode_same;
+                } while (pnode != (OS_FLAG_NODE *)0);
+            } else {                                 /* Watch the lowest flag still needed             */
+                OS_FlagBucketReplace(pnode, (OS_FLAG_NODE *)0);
+                pnode->OSFlagNodeBit = OS_FlagBitLow((OS_FLAGS)(pnode->OSFlagNodeFlags & ~flags_cur));
+                OS_FlagBucketInsert(pgrp, pnode);
+            }
+            pnode = pnode_next;
+        }
+    }
+    if (opt == OS_FLAG_SET) {                        /* Buckets waiting for ANY of several flags, ...  */
+        pnode      = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
+        flags_wait = pgrp->OSFlagWaitSet;
+    } else {
+        pnode      = (OS_FLAG_NODE *)pgrp->OSFlagWaitListClr;
+        flags_wait = pgrp->OSFlagWaitClr;
+    }
+    if ((flags_wait & flags) != (OS_FLAGS)0) {       /* ... when one of the posted flags, Note #1b     */
+        flags_wait = (OS_FLAGS)0;
+        while (pnode != (OS_FLAG_NODE *)0) {         /* Go through the buckets of waiting tasks        */
+            pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeNext;
+            wait_type  = pnode->OSFlagNodeWaitType;
+            flags_rdy  = (OS_FLAGS)(flags_cur & pnode->OSFlagNodeFlags);
+            if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_CLR_ALL)) {
+                rdy = (flags_rdy == pnode->OSFlagNodeFlags) ? OS_TRUE : OS_FALSE;
+            } else {
+                rdy = (flags_rdy != (OS_FLAGS)0)         ? OS_TRUE : OS_FALSE;
+            }
+            if (rdy == OS_TRUE) {                    /* Make ALL the tasks of the bucket RTR           */
+                do {
+                    pnode_same = (OS_FLAG_NODE *)pnode->OSFlagNodeSameNext;
+                    if (OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK) == OS_TRUE) {
+                        sched = OS_TRUE;             /* When done we will reschedule                   */
+                    }
+                    OS_INT_Q_WINDOW();               /* Let interrupts in between tasks                */
+                    pnode = pnode_same;
+                } while (pnode != (OS_FLAG_NODE *)0);
+            } else {
+                flags_wait |= pnode->OSFlagNodeFlags;
+            }
+            pnode = pnode_next;
+        }
+        if (opt == OS_FLAG_SET) {                    /* Update the flags still waited on               */
+            pgrp->OSFlagWaitSet = flags_wait;
+        } else {
+            pgrp->OSFlagWaitClr = flags_wait;
+        }
+    }
+#else
     pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
     while (pnode != (OS_FLAG_NODE *)0) {             /* Go through all tasks waiting on event flag(s)  */
         switch (pnode->OSFlagNodeWaitType) {
@@ -930,7 +1342,9 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
                  return ((OS_FLAGS)0);
         }
         pnode = (OS_FLAG_NODE *)pnode->OSFlagNodeNext; /* Point to next task waiting for event flag(s) */
+        OS_INT_Q_WINDOW();                           /* Let interrupts in between tasks                */
     }
+#endif
     OS_EXIT_CRITICAL();
     if (sched == OS_TRUE) {
         OS_Sched();
@@ -1041,19 +1455,115 @@ static  void  OS_FlagBlock (OS_FLAG_GRP  *pgrp,
                             INT8U         wait_type,
                             INT32U        timeout)
 {
-    OS_FLAG_NODE  *pnode_next;
-    INT8U          y;
-
-
     OSTCBCur->OSTCBStat      |= OS_STAT_FLAG;
     OSTCBCur->OSTCBStatPend   = OS_STAT_PEND_OK;
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur, timeout);             /* Store timeout in task's TCB                   */
+#else
     OSTCBCur->OSTCBDly        = timeout;              /* Store timeout in task's TCB                   */
+#endif
 #if OS_TASK_DEL_EN > 0u
     OSTCBCur->OSTCBFlagNode   = pnode;                /* TCB to link to node                           */
 #endif
+    OS_FlagLink(pgrp, pnode, flags, wait_type);
+
+    OS_RdyListRemove(OSTCBCur);                       /* Suspend current task until flag(s) received   */
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                ADD A NODE TO THE WAIT LIST OF A GROUP
+*
+* Description: This function is internal to uC/OS-II and is used to add the node of the current task to
+*              the list of tasks waiting on an event flag group.
+*
+* Arguments  : pgrp          is a pointer to the desired event flag group.
+*
+*              pnode         is a pointer to a structure which contains data about the task waiting for
+*                            event flag bit(s) to be set.
+*
+*              flags         is the bit pattern of the flags waited on.
+*
+*              wait_type     is the type of wait (see OS_FlagBlock()).
+*
+* Returns    : none
+*
+* Called by  : OS_FlagBlock()     OS_FLAG.C
+*              OSFlagPendMulti()  OS_FLAG.C
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) With OS_FLAG_INDEX_EN, the node joins the bucket of the tasks waiting on the same flags
+*                 with the same wait type, found by going through the buckets of its list.  It starts
+*                 a new bucket at the beginning of the list when there is none.
+*              3) A node waiting for ALL its flags, or for ANY of a single flag, goes to the list of the
+*                 lowest flag it still needs (see OSFlagPost() Note #1a).  It only joins a bucket of the
+*                 same flags that watches that flag.  A bucket moved by a post can end up in the same
+*                 list as another bucket of the same flags: both are then readied by the same post.
+*********************************************************************************************************
+*/
+
+static  void  OS_FlagLink (OS_FLAG_GRP  *pgrp,
+                           OS_FLAG_NODE *pnode,
+                           OS_FLAGS      flags,
+                           INT8U         wait_type)
+{
+    OS_FLAG_NODE  *pnode_next;
+#if OS_FLAG_INDEX_EN > 0u
+    OS_FLAG_NODE  *pnode_head;
+    OS_FLAGS       flags_cur;
+    BOOLEAN        set;
+#endif
+
+
     pnode->OSFlagNodeFlags    = flags;                /* Save the flags that we need to wait for       */
     pnode->OSFlagNodeWaitType = wait_type;            /* Save the type of wait we are doing            */
     pnode->OSFlagNodeTCB      = (void *)OSTCBCur;     /* Link to task's TCB                            */
+#if OS_FLAG_INDEX_EN > 0u
+    pnode->OSFlagNodeFlagGrp  = (void *)pgrp;         /* Link to Event Flag Group                      */
+    if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_SET_ANY)) {
+        set       = OS_TRUE;
+        flags_cur = pgrp->OSFlagFlags;
+    } else {
+        set       = OS_FALSE;
+        flags_cur = (OS_FLAGS)~pgrp->OSFlagFlags;
+    }
+    if ((wait_type == OS_FLAG_WAIT_SET_ALL) ||        /* Watch the lowest flag still needed, Note #3   */
+        (wait_type == OS_FLAG_WAIT_CLR_ALL) ||
+        ((flags != (OS_FLAGS)0) && ((flags & (OS_FLAGS)(flags - 1u)) == (OS_FLAGS)0))) {
+        pnode->OSFlagNodeBit = OS_FlagBitLow((OS_FLAGS)(flags & ~flags_cur));
+    } else {
+        pnode->OSFlagNodeBit = OS_FLAG_BIT_NONE;
+        if (set == OS_TRUE) {
+            pgrp->OSFlagWaitSet |= flags;
+        } else {
+            pgrp->OSFlagWaitClr |= flags;
+        }
+    }
+    pnode_head = (OS_FLAG_NODE *)*OS_FlagBucketList(pgrp, pnode); /* Find the bucket of the same flags */
+    while (pnode_head != (OS_FLAG_NODE *)0) {
+        if ((pnode_head->OSFlagNodeFlags    == flags) &&
+            (pnode_head->OSFlagNodeWaitType == wait_type)) {
+            break;
+        }
+        pnode_head = (OS_FLAG_NODE *)pnode_head->OSFlagNodeNext;
+    }
+    if (pnode_head != (OS_FLAG_NODE *)0) {            /* Join the bucket, behind its head              */
+        pnode_next                     = (OS_FLAG_NODE *)pnode_head->OSFlagNodeSameNext;
+        pnode->OSFlagNodeSameNext      = (void *)pnode_next;
+        pnode->OSFlagNodeSamePrev      = (void *)pnode_head;
+        pnode->OSFlagNodeNext          = (void *)0;
+        pnode->OSFlagNodePrev          = (void *)0;
+        if (pnode_next != (OS_FLAG_NODE *)0) {
+            pnode_next->OSFlagNodeSamePrev = (void *)pnode;
+        }
+        pnode_head->OSFlagNodeSameNext = (void *)pnode;
+    } else {                                          /* Start a new bucket at beginning of the list   */
+        pnode->OSFlagNodeSameNext      = (void *)0;
+        pnode->OSFlagNodeSamePrev      = (void *)0;
+        OS_FlagBucketInsert(pgrp, pnode);
+    }
+#else
     pnode->OSFlagNodeNext     = pgrp->OSFlagWaitList; /* Add node at beginning of event flag wait list */
     pnode->OSFlagNodePrev     = (void *)0;
     pnode->OSFlagNodeFlagGrp  = (void *)pgrp;         /* Link to Event Flag Group                      */
@@ -1062,12 +1572,8 @@ static  void  OS_FlagBlock (OS_FLAG_GRP  *pgrp,
         pnode_next->OSFlagNodePrev = pnode;           /* No, link in doubly linked list                */
     }
     pgrp->OSFlagWaitList = (void *)pnode;
+#endif
 
-    y            =  OSTCBCur->OSTCBY;                 /* Suspend current task until flag(s) received   */
-    OSRdyTbl[y] &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
-    if (OSRdyTbl[y] == 0x00u) {
-        OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
-    }
 }
 
 /*$PAGE*/
@@ -1093,6 +1599,13 @@ void  OS_FlagInit (void)
     OSFlagFreeList->OSFlagType     = OS_EVENT_TYPE_UNUSED;
     OSFlagFreeList->OSFlagWaitList = (void *)0;
     OSFlagFreeList->OSFlagFlags    = (OS_FLAGS)0;
+#if OS_FLAG_INDEX_EN > 0u
+    OSFlagFreeList->OSFlagWaitListClr = (void *)0;
+    OSFlagFreeList->OSFlagWaitSet     = (OS_FLAGS)0;
+    OSFlagFreeList->OSFlagWaitClr     = (OS_FLAGS)0;
+    OSFlagFreeList->OSFlagBitSet      = (OS_FLAGS)0;
+    OSFlagFreeList->OSFlagBitClr      = (OS_FLAGS)0;
+#endif
 #if OS_FLAG_NAME_EN > 0u
     OSFlagFreeList->OSFlagName     = (INT8U *)"?";
 #endif
@@ -1150,6 +1663,12 @@ void  OS_FlagInit (void)
 *
 * Note(s)    : 1) This function assumes that interrupts are disabled.
 *              2) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              3) With OS_FLAG_INDEX_EN, 'pnode' MUST be the head of its bucket.  The next task of the
+*                 bucket becomes its head, so that calling this function for the successive heads
+*                 readies the whole bucket.
+*              4) A task waiting in OSFlagPendMulti() is readied by the first of its conditions that is
+*                 met.  Its other nodes stay in their wait lists until it runs, and are only unlinked
+*                 when found by a post in the meantime.
 *********************************************************************************************************
 */
 
@@ -1162,13 +1681,28 @@ static  BOOLEAN  OS_FlagTaskRdy (OS_FLAG_NODE *pnode,
 
 
     ptcb                 = (OS_TCB *)pnode->OSFlagNodeTCB; /* Point to TCB of waiting task             */
+#if OS_FLAG_MULTI_EN > 0u
+    if (ptcb->OSTCBFlagMultiPtr != (OS_FLAG_PEND_DATA *)0) {   /* Waiting on several conditions?       */
+        if (ptcb->OSTCBFlagMultiRdy != (OS_FLAG_NODE *)0) {    /* Yes, already met one of them ...     */
+            OS_FlagUnlink(pnode);                              /* ... only stop waiting on this one    */
+            return (OS_FALSE);
+        }
+        ptcb->OSTCBFlagMultiRdy = pnode;
+    }
+#endif
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListRemove(ptcb);
+#else
     ptcb->OSTCBDly       = 0u;
+#endif
     ptcb->OSTCBFlagsRdy  = flags_rdy;
     ptcb->OSTCBStat     &= (INT8U)~(INT8U)OS_STAT_FLAG;
     ptcb->OSTCBStatPend  = pend_stat;
     if (ptcb->OSTCBStat == OS_STAT_RDY) {                  /* Task now ready?                          */
-        OSRdyGrp               |= ptcb->OSTCBBitY;         /* Put task into ready list                 */
-        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+        OS_RdyListInsert(ptcb);                            /* Put task into ready list                 */
+#if OS_TASK_LAT_EN > 0u
+        OS_TaskLatRdy(ptcb);                               /* Start its latency if posted by an ISR    */
+#endif
         sched                   = OS_TRUE;
     } else {
         sched                   = OS_FALSE;
@@ -1190,12 +1724,15 @@ static  BOOLEAN  OS_FlagTaskRdy (OS_FLAG_NODE *pnode,
 *
 * Returns    : none
 *
-* Called by  : OS_FlagTaskRdy() OS_FLAG.C
-*              OSFlagPend()     OS_FLAG.C
-*              OSTaskDel()      OS_TASK.C
+* Called by  : OS_FlagTaskRdy()     OS_FLAG.C
+*              OS_FlagUnlinkMulti() OS_FLAG.C
+*              OSFlagPend()         OS_FLAG.C
+*              OSTaskDel()          OS_TASK.C
 *
 * Note(s)    : 1) This function assumes that interrupts are disabled.
 *              2) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              3) With OS_FLAG_INDEX_EN, the node is unlinked from its bucket (see
+*                 OS_FlagBucketReplace() Note #3).
 *********************************************************************************************************
 */
 
@@ -1204,11 +1741,29 @@ void  OS_FlagUnlink (OS_FLAG_NODE *pnode)
 #if OS_TASK_DEL_EN > 0u
     OS_TCB       *ptcb;
 #endif
+#if OS_FLAG_INDEX_EN == 0u
     OS_FLAG_GRP  *pgrp;
+#endif
     OS_FLAG_NODE *pnode_prev;
     OS_FLAG_NODE *pnode_next;
 
 
+#if OS_FLAG_INDEX_EN > 0u
+    pnode_prev = (OS_FLAG_NODE *)pnode->OSFlagNodeSamePrev;
+    if (pnode_prev == (OS_FLAG_NODE *)0) {                      /* Is it the head of its bucket?       */
+        pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeSameNext; /* Yes, next task of bucket takes its  */
+        if (pnode_next != (OS_FLAG_NODE *)0) {                  /*      place in the list of buckets   */
+            pnode_next->OSFlagNodeSamePrev = (void *)0;
+        }
+        OS_FlagBucketReplace(pnode, pnode_next);
+    } else {                                                    /* No,  link around it in the bucket   */
+        pnode_next                     = (OS_FLAG_NODE *)pnode->OSFlagNodeSameNext;
+        pnode_prev->OSFlagNodeSameNext = (void *)pnode_next;
+        if (pnode_next != (OS_FLAG_NODE *)0) {
+            pnode_next->OSFlagNodeSamePrev = (void *)pnode_prev;
+        }
+    }
+#else
     pnode_prev = (OS_FLAG_NODE *)pnode->OSFlagNodePrev;
     pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeNext;
     if (pnode_prev == (OS_FLAG_NODE *)0) {                      /* Is it first node in wait list?      */
@@ -1223,9 +1778,265 @@ void  OS_FlagUnlink (OS_FLAG_NODE *pnode)
             pnode_next->OSFlagNodePrev = pnode_prev;            /*      No, Link around current node   */
         }
     }
+#endif
 #if OS_TASK_DEL_EN > 0u
     ptcb                = (OS_TCB *)pnode->OSFlagNodeTCB;
     ptcb->OSTCBFlagNode = (OS_FLAG_NODE *)0;
 #endif
+    pnode->OSFlagNodeTCB = (void *)0;                           /* Node is no longer in a wait list    */
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                          UNLINK THE NODES OF A TASK WAITING ON SEVERAL CONDITIONS
+*
+* Description: This function is internal to uC/OS-II and is used to unlink the nodes of a task waiting in
+*              OSFlagPendMulti() that are still in the wait lists of their groups.
+*
+* Arguments  : ptcb          is a pointer to the TCB of the task.
+*
+* Returns    : none
+*
+* Called by  : OSFlagPendMulti() OS_FLAG.C
+*              OSTaskDel()       OS_TASK.C
+*
+* Note(s)    : 1) This function assumes that interrupts are disabled.
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_MULTI_EN > 0u
+void  OS_FlagUnlinkMulti (OS_TCB *ptcb)
+{
+    OS_FLAG_PEND_DATA  *p_pend_data;
+    INT16U              i;
+
+
+    p_pend_data = ptcb->OSTCBFlagMultiPtr;
+    if (p_pend_data == (OS_FLAG_PEND_DATA *)0) {                /* Is the task waiting on conditions?  */
+        return;
+    }
+    for (i = 0u; i < ptcb->OSTCBFlagMultiSize; i++) {
+        if (p_pend_data->OSFlagPendNode.OSFlagNodeTCB != (void *)0) {  /* Node still in a wait list?   */
+            OS_FlagUnlink(&p_pend_data->OSFlagPendNode);
+        }
+        p_pend_data++;
+    }
+    ptcb->OSTCBFlagMultiPtr  = (OS_FLAG_PEND_DATA *)0;
+    ptcb->OSTCBFlagMultiSize = 0u;
+    ptcb->OSTCBFlagMultiRdy  = (OS_FLAG_NODE *)0;
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      FIND THE LOWEST FLAG OF A SET
+*
+* Description: This function is internal to uC/OS-II and is used to find the lowest flag set in 'flags'.
+*
+* Arguments  : flags         is the bit pattern of the flags.
+*
+* Returns    : the number of the lowest flag set, 0 if none is.
+*
+* Called by  : OSFlagPost()  OS_FLAG.C
+*              OS_FlagLink() OS_FLAG.C
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_INDEX_EN > 0u
+static  INT8U  OS_FlagBitLow (OS_FLAGS flags)
+{
+    INT8U  bit;
+
+
+    bit = 0u;
+    while (((flags & 0xFFu) == 0u) && (flags != (OS_FLAGS)0)) { /* Skip the bytes without flags        */
+        flags = (OS_FLAGS)(flags >> 8u);
+        bit  += 8u;
+    }
+    return ((INT8U)(bit + OSUnMapTbl[flags & 0xFFu]));
 }
 #endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        FIND THE LIST OF A BUCKET
+*
+* Description: This function is internal to uC/OS-II and is used to find the list of buckets of an event
+*              flag group that a bucket belongs to.
+*
+* Arguments  : pgrp          is a pointer to the event flag group.
+*
+*              pnode         is a pointer to the head of the bucket.
+*
+* Returns    : a pointer to the head of the list.
+*
+* Called by  : OS_FlagLink()          OS_FLAG.C
+*              OS_FlagBucketInsert()  OS_FLAG.C
+*              OS_FlagBucketReplace() OS_FLAG.C
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) See OSFlagPost() Note #1 for the lists of buckets.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_INDEX_EN > 0u
+static  void  **OS_FlagBucketList (OS_FLAG_GRP  *pgrp,
+                                   OS_FLAG_NODE *pnode)
+{
+    INT8U  wait_type;
+    INT8U  bit;
+
+
+    wait_type = pnode->OSFlagNodeWaitType;
+    bit       = pnode->OSFlagNodeBit;
+    if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_SET_ANY)) {
+        if (bit != OS_FLAG_BIT_NONE) {
+            return (&pgrp->OSFlagBitListSet[bit]);
+        }
+        return (&pgrp->OSFlagWaitList);
+    }
+    if (bit != OS_FLAG_BIT_NONE) {
+        return (&pgrp->OSFlagBitListClr[bit]);
+    }
+    return (&pgrp->OSFlagWaitListClr);
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      INSERT A BUCKET IN ITS LIST
+*
+* Description: This function is internal to uC/OS-II and is used to insert a bucket at the beginning of
+*              the list given by its wait type and the flag it watches.
+*
+* Arguments  : pgrp          is a pointer to the event flag group.
+*
+*              pnode         is a pointer to the head of the bucket.
+*
+* Returns    : none
+*
+* Called by  : OSFlagPost()  OS_FLAG.C
+*              OS_FlagLink() OS_FLAG.C
+*
+* Note(s)    : 1) This function assumes that interrupts are disabled.
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_INDEX_EN > 0u
+static  void  OS_FlagBucketInsert (OS_FLAG_GRP  *pgrp,
+                                   OS_FLAG_NODE *pnode)
+{
+    void         **plist;
+    OS_FLAG_NODE  *pnode_next;
+    INT8U          wait_type;
+    INT8U          bit;
+
+
+    plist                 = OS_FlagBucketList(pgrp, pnode);
+    pnode_next            = (OS_FLAG_NODE *)*plist;
+    pnode->OSFlagNodeNext = (void *)pnode_next;
+    pnode->OSFlagNodePrev = (void *)0;
+    if (pnode_next != (OS_FLAG_NODE *)0) {
+        pnode_next->OSFlagNodePrev = (void *)pnode;
+    }
+    *plist                = (void *)pnode;
+    bit                   = pnode->OSFlagNodeBit;
+    if (bit != OS_FLAG_BIT_NONE) {                              /* The flag is now watched             */
+        wait_type = pnode->OSFlagNodeWaitType;
+        if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_SET_ANY)) {
+            pgrp->OSFlagBitSet |= (OS_FLAGS)((OS_FLAGS)1 << bit);
+        } else {
+            pgrp->OSFlagBitClr |= (OS_FLAGS)((OS_FLAGS)1 << bit);
+        }
+    }
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 REPLACE THE HEAD OF A BUCKET IN ITS LIST
+*
+* Description: This function is internal to uC/OS-II and is used to give the place of the head of a bucket
+*              in its list to another task of the bucket, or to unlink the bucket from its list.
+*
+* Arguments  : pnode         is a pointer to the head of the bucket.
+*
+*              pnode_new     is a pointer to the node that becomes the head of the bucket in its place,
+*                            (OS_FLAG_NODE *)0 to unlink the bucket.
+*
+* Returns    : none
+*
+* Called by  : OSFlagPost()    OS_FLAG.C
+*              OS_FlagUnlink() OS_FLAG.C
+*
+* Note(s)    : 1) This function assumes that interrupts are disabled.
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              3) The flags of a list of buckets waiting for ANY of several flags stay in OSFlagWaitSet/
+*                 OSFlagWaitClr until the list is empty or the next post that goes through it.  The flag
+*                 of a list of buckets watching one flag leaves OSFlagBitSet/OSFlagBitClr as soon as
+*                 the list is empty.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_INDEX_EN > 0u
+static  void  OS_FlagBucketReplace (OS_FLAG_NODE *pnode,
+                                    OS_FLAG_NODE *pnode_new)
+{
+    OS_FLAG_GRP   *pgrp;
+    OS_FLAG_NODE  *pnode_prev;
+    OS_FLAG_NODE  *pnode_next;
+    void         **plist;
+    INT8U          wait_type;
+    INT8U          bit;
+
+
+    pnode_prev = (OS_FLAG_NODE *)pnode->OSFlagNodePrev;
+    pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeNext;
+    if (pnode_new != (OS_FLAG_NODE *)0) {                       /* Another task takes the place ...    */
+        pnode_new->OSFlagNodeBit  = pnode->OSFlagNodeBit;
+        pnode_new->OSFlagNodePrev = (void *)pnode_prev;
+        pnode_new->OSFlagNodeNext = (void *)pnode_next;
+        if (pnode_next != (OS_FLAG_NODE *)0) {
+            pnode_next->OSFlagNodePrev = (void *)pnode_new;
+        }
+        pnode_next = pnode_new;                                 /* ... of the node                     */
+    } else if (pnode_next != (OS_FLAG_NODE *)0) {               /* Link around the node                */
+        pnode_next->OSFlagNodePrev = (void *)pnode_prev;
+    }
+    if (pnode_prev != (OS_FLAG_NODE *)0) {                      /* Is it the first bucket in its list? */
+        pnode_prev->OSFlagNodeNext = (void *)pnode_next;        /* No                                  */
+        return;
+    }
+    pgrp   = (OS_FLAG_GRP *)pnode->OSFlagNodeFlagGrp;           /* Yes, update the head of the list    */
+    plist  = OS_FlagBucketList(pgrp, pnode);
+    *plist = (void *)pnode_next;
+    if (pnode_next != (OS_FLAG_NODE *)0) {
+        return;
+    }
+    wait_type = pnode->OSFlagNodeWaitType;                      /* No more bucket in list, Note #3     */
+    bit       = pnode->OSFlagNodeBit;
+    if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_SET_ANY)) {
+        if (bit != OS_FLAG_BIT_NONE) {
+            pgrp->OSFlagBitSet &= (OS_FLAGS)~((OS_FLAGS)1 << bit);
+        } else {
+            pgrp->OSFlagWaitSet = (OS_FLAGS)0;
+        }
+    } else {
+        if (bit != OS_FLAG_BIT_NONE) {
+            pgrp->OSFlagBitClr &= (OS_FLAGS)~((OS_FLAGS)1 << bit);
+        } else {
+            pgrp->OSFlagWaitClr = (OS_FLAGS)0;
+        }
+    }
+}
+#endif
+#endif
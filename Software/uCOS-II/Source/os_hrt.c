@@ -0,0 +1,974 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                         HIGH-RESOLUTION TIMERS
+*
+*                              (c) Copyright 1992-2013, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+*
+* File    : OS_HRT.C
+* By      : Jean J. Labrosse
+* Version : V2.92.11
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrium to properly license
+* its use in your product. We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+/*
+*********************************************************************************************************
+*                                                        NOTES
+*
+* 1) Your application MUST define the following #define constants:
+*
+*    OS_TASK_HRT_PRIO          The priority of the HR timer task, which calls the callbacks
+*    OS_TASK_HRT_STK_SIZE      The size     of the HR timer task's stack
+*
+* 2) A high-resolution timer is a one-shot timer whose deadline is a CPU timestamp, OS_TS_GET(), rather
+*    than a number of ticks.  Its resolution is that of the CPU timestamp timer, whatever OS_TICKS_PER_SEC
+*    and OS_TMR_CFG_TICKS_PER_SEC, and it costs nothing per tick.
+*
+* 3) The port MUST provide OSHrtTmrSet(), which programs a one-shot hardware timer for the earliest
+*    deadline, and call OSHrtSignal() from the interrupt of that timer.  The interrupt only moves the
+*    expired timers to a list; the HR timer task calls their callbacks, with interrupts enabled and the
+*    scheduler unlocked.
+*
+* 4) The HR timer task consumes one of the OS_MAX_TASKS tasks, as the timer task does.  It waits for the
+*    timers to expire on a semaphore, which consumes one of the OS_MAX_EVENTS event control blocks.
+*********************************************************************************************************
+*/
+
+#if OS_HRT_EN > 0u
+/*
+*********************************************************************************************************
+*                                              CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  OS_HRT_TS_MSB        ((OS_TS)1u << (sizeof(OS_TS) * 8u - 1u))
+
+                                                            /* 'a' is earlier than 'b' (see OSHrtStart() Note #1)     */
+#define  OS_HRT_BEFORE(a, b)  ((((OS_TS)((a) - (b))) & OS_HRT_TS_MSB) != 0u)
+
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void     OS_HrtExpPut        (OS_HRT  *phrt);
+static  void     OS_HrtExpRemove     (OS_HRT  *phrt);
+static  void     OS_HrtHeapInsert    (OS_HRT  *phrt);
+static  void     OS_HrtHeapRemove    (OS_HRT  *phrt);
+static  void     OS_HrtTask          (void    *p_arg);
+static  void     OS_HrtTmrUpdate     (void);
+static  BOOLEAN  OS_HrtUnlink        (OS_HRT  *phrt);
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   CREATE A HIGH-RESOLUTION TIMER
+*
+* Description: This function is called by your application code to create a high-resolution timer.  The
+*              timer is created stopped, OSHrtStart() sets its deadline.
+*
+* Arguments  : callback      Is a pointer to a callback function that will be called when the timer expires.
+*                               The callback function must be declared as follows:
+*
+*                               void MyCallback (OS_HRT *phrt, void *p_arg);
+*
+*              callback_arg  Is an argument (a pointer) that is passed to the callback function when it is called.
+*
+*              perr          Is a pointer to an error code.  '*perr' will contain one of the following:
+*                               OS_ERR_NONE
+*                               OS_ERR_TMR_ISR             if the call was made from an ISR
+*                               OS_ERR_TMR_NON_AVAIL       if there are no free timers from the pool
+*
+* Returns    : A pointer to an OS_HRT data structure.
+*              This is the 'handle' that your application will use to reference the timer created.
+*********************************************************************************************************
+*/
+
+OS_HRT  *OSHrtCreate (OS_HRT_CALLBACK  callback,
+                      void            *callback_arg,
+                      INT8U           *perr)
+{
+    OS_HRT     *phrt;
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register               */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_HRT *)0);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_HRT *)0);
+    }
+#endif
+
+    if (OSIntNesting > 0u) {                                /* See if trying to call from an ISR                      */
+        *perr  = OS_ERR_TMR_ISR;
+        return ((OS_HRT *)0);
+    }
+    OS_ENTER_CRITICAL();
+    phrt = OSHrtFreeList;                                   /* Obtain a timer from the free pool                      */
+    if (phrt == (OS_HRT *)0) {
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_TMR_NON_AVAIL;
+        return ((OS_HRT *)0);
+    }
+    OSHrtFreeList          = phrt->OSHrtNext;
+    phrt->OSHrtNext        = (OS_HRT *)0;
+    phrt->OSHrtPrev        = (OS_HRT *)0;
+    phrt->OSHrtState       = OS_HRT_STATE_STOPPED;          /* Indicate that timer is not running yet                 */
+    phrt->OSHrtMatch       = (OS_TS)0;
+    phrt->OSHrtCallback    = callback;
+    phrt->OSHrtCallbackArg = callback_arg;
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (phrt);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   DELETE A HIGH-RESOLUTION TIMER
+*
+* Description: This function is called by your application code to delete a high-resolution timer.
+*
+* Arguments  : phrt          Is a pointer to the timer to stop and delete.
+*
+*              perr          Is a pointer to an error code.  '*perr' will contain one of the following:
+*                               OS_ERR_NONE
+*                               OS_ERR_TMR_INVALID        'phrt'  is a NULL pointer
+*                               OS_ERR_TMR_INVALID_TYPE   'phrt'  is not pointing to an OS_HRT
+*                               OS_ERR_TMR_ISR            if the function was called from an ISR
+*                               OS_ERR_TMR_INACTIVE       if the timer was not created
+*
+* Returns    : OS_TRUE       If the call was successful
+*              OS_FALSE      If not
+*
+* Note(s)    : 1) A callback that has expired but not been called yet is cancelled.
+*********************************************************************************************************
+*/
+
+BOOLEAN  OSHrtDel (OS_HRT  *phrt,
+                   INT8U   *perr)
+{
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register               */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (phrt == (OS_HRT *)0) {
+        *perr = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+    if (phrt->OSHrtType != OS_HRT_TYPE) {                   /* Validate timer structure                               */
+        *perr = OS_ERR_TMR_INVALID_TYPE;
+        return (OS_FALSE);
+    }
+    if (OSIntNesting > 0u) {                                /* See if trying to call from an ISR                      */
+        *perr  = OS_ERR_TMR_ISR;
+        return (OS_FALSE);
+    }
+    OS_ENTER_CRITICAL();
+    if (phrt->OSHrtState == OS_HRT_STATE_UNUSED) {          /* Already deleted                                        */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_TMR_INACTIVE;
+        return (OS_FALSE);
+    }
+    (void)OS_HrtUnlink(phrt);                               /* Remove from the heap or the expired list               */
+    phrt->OSHrtState       = OS_HRT_STATE_UNUSED;           /* Return timer to free list of timers                    */
+    phrt->OSHrtCallback    = (OS_HRT_CALLBACK)0;
+    phrt->OSHrtCallbackArg = (void *)0;
+    phrt->OSHrtPrev        = (OS_HRT *)0;
+    phrt->OSHrtNext        = OSHrtFreeList;
+    OSHrtFreeList          = phrt;
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (OS_TRUE);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                      GET HOW MUCH TIME IS LEFT BEFORE A HIGH-RESOLUTION TIMER EXPIRES
+*
+* Description: This function is called to get the time left before a timer expires.
+*
+* Arguments  : phrt          Is a pointer to the timer to obtain the remaining time from.
+*
+*              perr          Is a pointer to an error code.  '*perr' will contain one of the following:
+*                               OS_ERR_NONE
+*                               OS_ERR_TMR_INVALID        'phrt' is a NULL pointer
+*                               OS_ERR_TMR_INVALID_TYPE   'phrt'  is not pointing to an OS_HRT
+*                               OS_ERR_TMR_INACTIVE       'phrt' points to a timer that is not active
+*
+* Returns    : The time remaining for the timer to expire, in OS_TS_GET() counts.  0 if the timer is not
+*              running or is about to expire.
+*
+* Note(s)    : 1) This function may be called from an ISR.
+*********************************************************************************************************
+*/
+
+OS_TS  OSHrtRemainGet (OS_HRT  *phrt,
+                       INT8U   *perr)
+{
+    OS_TS      remain;
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register               */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_TS)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (phrt == (OS_HRT *)0) {
+        *perr = OS_ERR_TMR_INVALID;
+        return ((OS_TS)0);
+    }
+#endif
+    if (phrt->OSHrtType != OS_HRT_TYPE) {                   /* Validate timer structure                               */
+        *perr = OS_ERR_TMR_INVALID_TYPE;
+        return ((OS_TS)0);
+    }
+    remain = (OS_TS)0;
+    OS_ENTER_CRITICAL();
+    switch (phrt->OSHrtState) {
+        case OS_HRT_STATE_RUNNING:
+             remain = (OS_TS)(phrt->OSHrtMatch - OS_TS_GET());
+             if ((remain & OS_HRT_TS_MSB) != 0u) {          /* Deadline passed, interrupt not serviced yet            */
+                 remain = (OS_TS)0;
+             }
+             break;
+
+        case OS_HRT_STATE_UNUSED:
+             OS_EXIT_CRITICAL();
+             *perr = OS_ERR_TMR_INACTIVE;
+             return ((OS_TS)0);
+
+        default:
+             break;
+    }
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (remain);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  EXPIRE THE HIGH-RESOLUTION TIMERS DUE
+*
+* Description: This function is called by the port's one-shot timer interrupt (see OSHrtTmrSet()).  The
+*              timers whose deadline has been reached are moved to the expired list, the HR timer task is
+*              made ready to call their callbacks and the one-shot timer is programmed for the next
+*              deadline.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST be called between OSIntEnter() and OSIntExit(), which performs the
+*                 context switch to the HR timer task.
+*              2) The interrupt may come early, e.g. when the one-shot timer counts at a lower rate than the
+*                 timestamp timer.  The timer is then only programmed again for the same deadline.
+*********************************************************************************************************
+*/
+
+void  OSHrtSignal (void)
+{
+    OS_HRT     *phrt;
+    OS_TS       ts;
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register               */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    ts = OS_TS_GET();
+    while (OSHrtHeapSize > 0u) {
+        phrt = OSHrtHeap[0];                                /* Timer with the earliest deadline                       */
+        if (OS_HRT_BEFORE(ts, phrt->OSHrtMatch)) {          /* Not due yet, neither are the others                    */
+            break;
+        }
+        OS_HrtHeapRemove(phrt);
+        OS_HrtExpPut(phrt);
+    }
+    OS_HrtTmrUpdate();                                      /* See Note #2                                            */
+    OS_EXIT_CRITICAL();
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    START A HIGH-RESOLUTION TIMER
+*
+* Description: This function is called by your application code to start a timer, or to restart it with
+*              a new deadline.
+*
+* Arguments  : phrt          Is a pointer to an OS_HRT
+*
+*              ts            Is the deadline of the timer, in OS_TS_GET() counts (see 'opt').
+*
+*              opt           Specifies either:
+*                               OS_HRT_OPT_DLY    The timer expires 'ts' counts from now
+*                               OS_HRT_OPT_ABS    The timer expires when OS_TS_GET() reaches 'ts'
+*
+*              perr          Is a pointer to an error code.  '*perr' will contain one of the following:
+*                               OS_ERR_NONE
+*                               OS_ERR_TMR_INVALID
+*                               OS_ERR_TMR_INVALID_TYPE    'phrt'  is not pointing to an OS_HRT
+*                               OS_ERR_TMR_INVALID_DLY     'ts' is 0 or too large (OS_HRT_OPT_DLY)
+*                               OS_ERR_TMR_INVALID_OPT     you specified an invalid option
+*                               OS_ERR_TMR_INACTIVE        if the timer was not created
+*
+* Returns    : OS_TRUE    if the timer was started
+*              OS_FALSE   if an error was detected
+*
+* Note(s)    : 1) Deadlines are compared as differences, so that the timestamp timer may wrap around.  A
+*                 deadline MUST therefore be less than half the range of OS_TS away.  An absolute deadline
+*                 already passed expires at once.
+*              2) Restarting a timer whose callback has not been called yet cancels that callback.
+*              3) This function may be called from an ISR.
+*********************************************************************************************************
+*/
+
+BOOLEAN  OSHrtStart (OS_HRT  *phrt,
+                     OS_TS    ts,
+                     INT8U    opt,
+                     INT8U   *perr)
+{
+    OS_TS      ts_now;
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register               */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (phrt == (OS_HRT *)0) {
+        *perr = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+    switch (opt) {
+        case OS_HRT_OPT_DLY:
+             if ((ts == (OS_TS)0) || ((ts & OS_HRT_TS_MSB) != 0u)) {      /* See Note #1                      */
+                 *perr = OS_ERR_TMR_INVALID_DLY;
+                 return (OS_FALSE);
+             }
+             break;
+
+        case OS_HRT_OPT_ABS:
+             break;
+
+        default:
+             *perr = OS_ERR_TMR_INVALID_OPT;
+             return (OS_FALSE);
+    }
+#endif
+    if (phrt->OSHrtType != OS_HRT_TYPE) {                   /* Validate timer structure                               */
+        *perr = OS_ERR_TMR_INVALID_TYPE;
+        return (OS_FALSE);
+    }
+    OS_ENTER_CRITICAL();
+    if (phrt->OSHrtState == OS_HRT_STATE_UNUSED) {          /* Timer not created                                      */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_TMR_INACTIVE;
+        return (OS_FALSE);
+    }
+    (void)OS_HrtUnlink(phrt);                               /* Restart: cancel the previous deadline (see Note #2)    */
+    ts_now = OS_TS_GET();
+    if (opt == OS_HRT_OPT_DLY) {
+        phrt->OSHrtMatch = (OS_TS)(ts_now + ts);
+    } else {
+        phrt->OSHrtMatch = ts;
+    }
+    if (OS_HRT_BEFORE(ts_now, phrt->OSHrtMatch)) {
+        phrt->OSHrtState = OS_HRT_STATE_RUNNING;
+        OS_HrtHeapInsert(phrt);
+        if (phrt->OSHrtHeapIx == 1u) {                      /* New earliest deadline, reprogram the one-shot timer    */
+            OS_HrtTmrUpdate();
+        }
+        OS_EXIT_CRITICAL();
+    } else {
+        phrt->OSHrtMatch = ts_now;                          /* Deadline already passed, expires now (see Note #1)     */
+        OS_HrtExpPut(phrt);
+        OS_EXIT_CRITICAL();
+        if ((OSRunning == OS_TRUE) && (OSIntNesting == 0u)) {
+            OS_Sched();                                     /* Let the HR timer task call the callback                */
+        }
+    }
+    *perr = OS_ERR_NONE;
+    return (OS_TRUE);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                               FIND OUT WHAT STATE A HIGH-RESOLUTION TIMER IS IN
+*
+* Description: This function is called to determine what state the timer is in:
+*
+*                  OS_HRT_STATE_UNUSED     the timer has not been created
+*                  OS_HRT_STATE_STOPPED    the timer has been created but not started, or has been stopped
+*                  OS_HRT_STATE_RUNNING    the timer is waiting for its deadline
+*                  OS_HRT_STATE_EXPIRED    the timer expired, its callback has not been called yet
+*                  OS_HRT_STATE_COMPLETED  the timer expired and its callback has been called
+*
+* Arguments  : phrt     Is a pointer to the desired timer
+*
+*              perr     Is a pointer to an error code.  '*perr' will contain one of the following:
+*                          OS_ERR_NONE
+*                          OS_ERR_TMR_INVALID        'phrt' is a NULL pointer
+*                          OS_ERR_TMR_INVALID_TYPE   'phrt'  is not pointing to an OS_HRT
+*
+* Returns    : The current state of the timer (see description).
+*
+* Note(s)    : 1) This function may be called from an ISR.
+*********************************************************************************************************
+*/
+
+INT8U  OSHrtStateGet (OS_HRT  *phrt,
+                      INT8U   *perr)
+{
+    INT8U      state;
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register               */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (phrt == (OS_HRT *)0) {
+        *perr = OS_ERR_TMR_INVALID;
+        return (0u);
+    }
+#endif
+    if (phrt->OSHrtType != OS_HRT_TYPE) {                   /* Validate timer structure                               */
+        *perr = OS_ERR_TMR_INVALID_TYPE;
+        return (0u);
+    }
+    OS_ENTER_CRITICAL();
+    state = phrt->OSHrtState;
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (state);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    STOP A HIGH-RESOLUTION TIMER
+*
+* Description: This function is called by your application code to stop a timer before its callback is
+*              called.
+*
+* Arguments  : phrt          Is a pointer to the timer to stop.
+*
+*              perr          Is a pointer to an error code.  '*perr' will contain one of the following:
+*                               OS_ERR_NONE
+*                               OS_ERR_TMR_INVALID         'phrt' is a NULL pointer
+*                               OS_ERR_TMR_INVALID_TYPE    'phrt'  is not pointing to an OS_HRT
+*                               OS_ERR_TMR_INACTIVE        the timer was not created
+*                               OS_ERR_TMR_STOPPED         the timer was already stopped, or its callback
+*                                                          has already been called
+*
+* Returns    : OS_TRUE       If we stopped the timer (if the timer is already stopped, we also return OS_TRUE)
+*              OS_FALSE      If not
+*
+* Note(s)    : 1) A callback that has expired but not been called yet is cancelled.
+*              2) This function may be called from an ISR.
+*********************************************************************************************************
+*/
+
+BOOLEAN  OSHrtStop (OS_HRT  *phrt,
+                    INT8U   *perr)
+{
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register               */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (phrt == (OS_HRT *)0) {
+        *perr = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+    if (phrt->OSHrtType != OS_HRT_TYPE) {                   /* Validate timer structure                               */
+        *perr = OS_ERR_TMR_INVALID_TYPE;
+        return (OS_FALSE);
+    }
+    OS_ENTER_CRITICAL();
+    if (phrt->OSHrtState == OS_HRT_STATE_UNUSED) {          /* Timer not created                                      */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_TMR_INACTIVE;
+        return (OS_FALSE);
+    }
+    if (OS_HrtUnlink(phrt) == OS_FALSE) {                   /* Neither running nor expired                            */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_TMR_STOPPED;
+        return (OS_TRUE);
+    }
+    phrt->OSHrtState = OS_HRT_STATE_STOPPED;
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (OS_TRUE);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  QUEUE AN EXPIRED TIMER FOR ITS CALLBACK
+*
+* Description: This function appends a timer to the list of expired timers.  The HR timer task is
+*              signaled when the list stops being empty.
+*
+* Arguments  : phrt          Is a pointer to the timer that expired.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) The semaphore is posted to directly, as this function also runs in the one-shot timer
+*                 interrupt, and its count is kept at 1 at most: the HR timer task empties the whole list
+*                 each time it is signaled.  The caller reschedules.
+*********************************************************************************************************
+*/
+
+static  void  OS_HrtExpPut (OS_HRT  *phrt)
+{
+    phrt->OSHrtState = OS_HRT_STATE_EXPIRED;
+    phrt->OSHrtNext  = (OS_HRT *)0;
+    phrt->OSHrtPrev  = OSHrtExpTail;
+    if (OSHrtExpTail == (OS_HRT *)0) {                      /* Wake up the HR timer task (see Note #3)                */
+        OSHrtExpHead = phrt;
+        if (OSHrtSem->OSEventGrp != 0u) {
+            (void)OS_EventTaskRdy(OSHrtSem, (void *)0, OS_STAT_SEM, OS_STAT_PEND_OK);
+        } else {
+            OSHrtSem->OSEventCnt = 1u;
+        }
+    } else {
+        OSHrtExpTail->OSHrtNext = phrt;
+    }
+    OSHrtExpTail = phrt;
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 REMOVE A TIMER FROM THE EXPIRED LIST
+*
+* Description: This function unlinks a timer from the list of expired timers.
+*
+* Arguments  : phrt          Is a pointer to the timer to remove.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static  void  OS_HrtExpRemove (OS_HRT  *phrt)
+{
+    if (phrt->OSHrtPrev == (OS_HRT *)0) {
+        OSHrtExpHead = phrt->OSHrtNext;
+    } else {
+        phrt->OSHrtPrev->OSHrtNext = phrt->OSHrtNext;
+    }
+    if (phrt->OSHrtNext == (OS_HRT *)0) {
+        OSHrtExpTail = phrt->OSHrtPrev;
+    } else {
+        phrt->OSHrtNext->OSHrtPrev = phrt->OSHrtPrev;
+    }
+    phrt->OSHrtNext = (OS_HRT *)0;
+    phrt->OSHrtPrev = (OS_HRT *)0;
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 INSERT A TIMER IN THE HEAP OF DEADLINES
+*
+* Description: This function adds a running timer to the binary min-heap of running timers, so that
+*              OSHrtHeap[0] is always the next one to expire.  Insertion costs O(log n).
+*
+* Arguments  : phrt          Is a pointer to the timer to insert.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static  void  OS_HrtHeapInsert (OS_HRT  *phrt)
+{
+    INT16U   ix;
+    INT16U   ix_parent;
+    OS_HRT  *pparent;
+
+
+    ix = OSHrtHeapSize;                                     /* Start at the first free leaf                           */
+    OSHrtHeapSize++;
+    while (ix > 0u) {                                       /* Sift up while earlier than the parent                  */
+        ix_parent = (INT16U)((ix - 1u) / 2u);
+        pparent   = OSHrtHeap[ix_parent];
+        if (!OS_HRT_BEFORE(phrt->OSHrtMatch, pparent->OSHrtMatch)) {
+            break;
+        }
+        OSHrtHeap[ix]        = pparent;
+        pparent->OSHrtHeapIx = (INT16U)(ix + 1u);
+        ix                   = ix_parent;
+    }
+    OSHrtHeap[ix]     = phrt;
+    phrt->OSHrtHeapIx = (INT16U)(ix + 1u);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 REMOVE A TIMER FROM THE HEAP OF DEADLINES
+*
+* Description: This function takes a timer out of the heap of running timers.  The last leaf is moved
+*              into the vacated slot and sifted up or down.  Removal costs O(log n).
+*
+* Arguments  : phrt          Is a pointer to the timer to remove.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static  void  OS_HrtHeapRemove (OS_HRT  *phrt)
+{
+    INT16U   ix;
+    INT16U   ix_parent;
+    INT16U   ix_child;
+    OS_HRT  *plast;
+    OS_HRT  *pparent;
+    OS_HRT  *pchild;
+
+
+    ix                = (INT16U)(phrt->OSHrtHeapIx - 1u);
+    phrt->OSHrtHeapIx = 0u;
+    OSHrtHeapSize--;
+    if (ix == OSHrtHeapSize) {                              /* Removing the last leaf, nothing to fix                 */
+        return;
+    }
+    plast = OSHrtHeap[OSHrtHeapSize];
+    while (ix > 0u) {                                       /* Sift up while earlier than the parent                  */
+        ix_parent = (INT16U)((ix - 1u) / 2u);
+        pparent   = OSHrtHeap[ix_parent];
+        if (!OS_HRT_BEFORE(plast->OSHrtMatch, pparent->OSHrtMatch)) {
+            break;
+        }
+        OSHrtHeap[ix]        = pparent;
+        pparent->OSHrtHeapIx = (INT16U)(ix + 1u);
+        ix                   = ix_parent;
+    }
+    for (;;) {                                              /* Sift down while later than a child                     */
+        ix_child = (INT16U)(ix * 2u + 1u);
+        if (ix_child >= OSHrtHeapSize) {
+            break;
+        }
+        pchild = OSHrtHeap[ix_child];
+        if ((ix_child + 1u) < OSHrtHeapSize) {              /* Pick the earlier of both children                      */
+            if (OS_HRT_BEFORE(OSHrtHeap[ix_child + 1u]->OSHrtMatch, pchild->OSHrtMatch)) {
+                ix_child++;
+                pchild = OSHrtHeap[ix_child];
+            }
+        }
+        if (!OS_HRT_BEFORE(pchild->OSHrtMatch, plast->OSHrtMatch)) {
+            break;
+        }
+        OSHrtHeap[ix]       = pchild;
+        pchild->OSHrtHeapIx = (INT16U)(ix + 1u);
+        ix                  = ix_child;
+    }
+    OSHrtHeap[ix]      = plast;
+    plast->OSHrtHeapIx = (INT16U)(ix + 1u);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           HR TIMER TASK
+*
+* Description: This task is internal to uC/OS-II and calls the callbacks of the expired timers, in the
+*              order they expired.  The task then waits on OSHrtSem for the next timer to expire (see
+*              OS_HrtExpPut()).
+*
+* Arguments  : p_arg     is not used
+*
+* Returns    : none
+*
+* Note(s)    : 1) OSHrtLatMax records the longest time from the deadline of a timer to the call of its
+*                 callback, which includes the latency of the one-shot timer interrupt and the time the
+*                 HR timer task waited for higher priority tasks.
+*              2) The semaphore may have been signaled for a timer whose callback this task already called,
+*                 or that was stopped since.  The task then finds the list empty and waits again.
+*********************************************************************************************************
+*/
+
+static  void  OS_HrtTask (void *p_arg)
+{
+    OS_HRT           *phrt;
+    OS_HRT_CALLBACK   pfnct;
+    void             *parg;
+    OS_TS             lat;
+    INT8U             err;
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register               */
+    OS_CPU_SR         cpu_sr = 0u;
+#endif
+
+
+
+    p_arg = p_arg;                                          /* Prevent compiler warning for not using 'p_arg'         */
+    for (;;) {
+        OSSemPend(OSHrtSem, 0u, &err);                      /* Wait for the next expiry (see Note #2)                 */
+        OS_ENTER_CRITICAL();
+        while (OSHrtExpHead != (OS_HRT *)0) {
+            phrt = OSHrtExpHead;
+            OS_HrtExpRemove(phrt);
+            phrt->OSHrtState = OS_HRT_STATE_COMPLETED;
+            pfnct            = phrt->OSHrtCallback;         /* Callback may restart or delete the timer               */
+            parg             = phrt->OSHrtCallbackArg;
+            lat              = (OS_TS)(OS_TS_GET() - phrt->OSHrtMatch);
+            if (lat > OSHrtLatMax) {                        /* See Note #1                                            */
+                OSHrtLatMax = lat;
+            }
+            OS_EXIT_CRITICAL();
+            if (pfnct != (OS_HRT_CALLBACK)0) {
+                (*pfnct)((void *)phrt, parg);               /* Call the callback with interrupts enabled              */
+            }
+            OS_ENTER_CRITICAL();
+        }
+        OS_EXIT_CRITICAL();
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    PROGRAM THE ONE-SHOT TIMER
+*
+* Description: This function programs the port's one-shot timer for the earliest deadline, or stops it
+*              when no timer is running.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) A deadline that has just passed is programmed 1 count ahead, so that the interrupt is
+*                 taken right away.
+*********************************************************************************************************
+*/
+
+static  void  OS_HrtTmrUpdate (void)
+{
+    OS_TS  dly;
+
+
+    if (OSHrtHeapSize == 0u) {
+        OSHrtTmrSet((OS_TS)0);                              /* Stop the one-shot timer                                */
+        return;
+    }
+    dly = (OS_TS)(OSHrtHeap[0]->OSHrtMatch - OS_TS_GET());
+    if ((dly == (OS_TS)0) || ((dly & OS_HRT_TS_MSB) != 0u)) {   /* See Note #3                                    */
+        dly = (OS_TS)1;
+    }
+    OSHrtTmrSet(dly);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  UNLINK A TIMER FROM THE HEAP OR LIST
+*
+* Description: This function removes a running timer from the heap of deadlines, or an expired timer from
+*              the list of callbacks to call.
+*
+* Arguments  : phrt          Is a pointer to the timer to unlink.
+*
+* Returns    : OS_TRUE       if the timer was running or expired
+*              OS_FALSE      if it was neither
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) The one-shot timer is left programmed when the earliest deadline is removed; its
+*                 interrupt then only programs it again (see OSHrtSignal()).
+*********************************************************************************************************
+*/
+
+static  BOOLEAN  OS_HrtUnlink (OS_HRT  *phrt)
+{
+    switch (phrt->OSHrtState) {
+        case OS_HRT_STATE_RUNNING:
+             OS_HrtHeapRemove(phrt);                        /* See Note #3                                            */
+             return (OS_TRUE);
+
+        case OS_HRT_STATE_EXPIRED:
+             OS_HrtExpRemove(phrt);                         /* Cancel the callback                                    */
+             return (OS_TRUE);
+
+        default:
+             return (OS_FALSE);
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             INITIALIZATION
+*                          INITIALIZE THE FREE LIST OF HIGH-RESOLUTION TIMERS
+*
+* Description: This function is called by OSInit() to initialize the high-resolution timers and create
+*              the HR timer task.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  OS_HrtInit (void)
+{
+    INT16U   ix;
+    OS_HRT  *phrt;
+#if (OS_TASK_NAME_EN > 0u) || (OS_EVENT_NAME_EN > 0u)
+    INT8U    err;
+#endif
+
+
+    OS_MemClr((INT8U *)&OSHrtTbl[0], sizeof(OSHrtTbl));    /* Clear all the HR timers                                */
+    OS_MemClr((INT8U *)&OSHrtHeap[0], sizeof(OSHrtHeap));
+    phrt = &OSHrtTbl[0];
+    for (ix = 0u; ix < (OS_HRT_CFG_MAX - 1u); ix++) {
+        phrt->OSHrtType  = OS_HRT_TYPE;
+        phrt->OSHrtState = OS_HRT_STATE_UNUSED;             /* Indicate that timer is inactive                        */
+        phrt->OSHrtNext  = phrt + 1u;
+        phrt++;
+    }
+    phrt->OSHrtType  = OS_HRT_TYPE;
+    phrt->OSHrtState = OS_HRT_STATE_UNUSED;
+    phrt->OSHrtNext  = (OS_HRT *)0;
+    OSHrtFreeList    = &OSHrtTbl[0];
+    OSHrtHeapSize    = 0u;
+    OSHrtExpHead     = (OS_HRT *)0;
+    OSHrtExpTail     = (OS_HRT *)0;
+    OSHrtLatMax      = (OS_TS)0;
+    OSHrtSem         = OSSemCreate(0u);
+
+#if OS_TASK_CREATE_EXT_EN > 0u
+    #if OS_STK_GROWTH == 1u
+    (void)OSTaskCreateExt(OS_HrtTask,
+                          (void *)0,                                       /* No arguments passed to OS_HrtTask()     */
+                          &OSHrtTaskStk[OS_TASK_HRT_STK_SIZE - 1u],        /* Set Top-Of-Stack                        */
+                          OS_TASK_HRT_PRIO,
+                          OS_TASK_HRT_ID,
+                          &OSHrtTaskStk[0],                                /* Set Bottom-Of-Stack                     */
+                          OS_TASK_HRT_STK_SIZE,
+                          (void *)0,                                       /* No TCB extension                        */
+                          OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);      /* Enable stack checking + clear stack     */
+    #else
+    (void)OSTaskCreateExt(OS_HrtTask,
+                          (void *)0,                                       /* No arguments passed to OS_HrtTask()     */
+                          &OSHrtTaskStk[0],                                /* Set Top-Of-Stack                        */
+                          OS_TASK_HRT_PRIO,
+                          OS_TASK_HRT_ID,
+                          &OSHrtTaskStk[OS_TASK_HRT_STK_SIZE - 1u],        /* Set Bottom-Of-Stack                     */
+                          OS_TASK_HRT_STK_SIZE,
+                          (void *)0,                                       /* No TCB extension                        */
+                          OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);      /* Enable stack checking + clear stack     */
+    #endif
+#else
+    #if OS_STK_GROWTH == 1u
+    (void)OSTaskCreate(OS_HrtTask,
+                       (void *)0,
+                       &OSHrtTaskStk[OS_TASK_HRT_STK_SIZE - 1u],
+                       OS_TASK_HRT_PRIO);
+    #else
+    (void)OSTaskCreate(OS_HrtTask,
+                       (void *)0,
+                       &OSHrtTaskStk[0],
+                       OS_TASK_HRT_PRIO);
+    #endif
+#endif
+
+#if OS_TASK_NAME_EN > 0u
+    OSTaskNameSet(OS_TASK_HRT_PRIO, (INT8U *)(void *)"uC/OS-II HR Tmr", &err);
+#endif
+
+#if OS_EVENT_NAME_EN > 0u
+    OSEventNameSet(OSHrtSem, (INT8U *)(void *)"uC/OS-II HR Tmr", &err);
+#endif
+}
+#endif
@@ -0,0 +1,441 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                          DEFERRED ISR POSTS
+*
+*                              (c) Copyright 1992-2013, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+*
+* File    : OS_INT.C
+* By      : Jean J. Labrosse
+* Version : V2.92.11
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrium to properly license
+* its use in your product. We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+/*
+*********************************************************************************************************
+*                                                        NOTES
+*
+* 1) Your application MUST define the following #define constants:
+*
+*    OS_TASK_INT_Q_PRIO        The priority of the ISR post task, normally the highest one (0)
+*    OS_TASK_INT_Q_STK_SIZE    The size     of the ISR post task's stack
+*
+* 2) With OS_ISR_POST_DEFERRED_EN, OSSemPost(), OSMboxPost(), OSMboxPostOpt(), OSQPost(), OSQPostFront(),
+*    OSQPostOpt() and OSFlagPost() called from an ISR only record the post in OSIntQTbl[].  This takes a
+*    short, constant time with interrupts disabled, whatever the number of waiting tasks.  The ISR post
+*    task then performs the posts, in the order they were made, with interrupts enabled between them and
+*    between the tasks a post readies (see 'ucos_ii.h  BROADCAST INTERRUPT WINDOW').
+*
+* 3) The ISR post task consumes one of the OS_MAX_TASKS tasks, as the timer task does.  It waits for the
+*    ISR posts on a semaphore, which consumes one of the OS_MAX_EVENTS event control blocks.
+*********************************************************************************************************
+*/
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  OS_INT_Q  *OS_IntQPut          (void);
+
+static  void       OS_IntQExec         (OS_INT_Q  *pentry);
+
+static  void       OS_IntQTask         (void      *p_arg);
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        DEFER A POST MADE BY AN ISR
+*
+* Description: This function is called by OSSemPost(), OSMboxPost(), OSMboxPostOpt(), OSQPost(),
+*              OSQPostFront(), OSQPostOpt(), OSQVCommit() and OSQVRelease() when they are called from an ISR.  The post is recorded in
+*              OSIntQTbl[] and the ISR post task is made ready to perform it.
+*
+* Arguments  : type      is the service to call (see OS_INT_Q_TYPE_xxx)
+*
+*              pobj      is a pointer to the event control block posted to
+*
+*              pmsg      is the message posted (mailboxes and queues, NULL otherwise)
+*
+*              opt       is the option passed to OSMboxPostOpt() and OSQPostOpt() (0 otherwise)
+*
+* Returns    : OS_ERR_NONE            if the post was recorded
+*              OS_ERR_INT_Q_FULL      if OSIntQTbl[] is full, the post is lost (see OSIntQOvfCtr)
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) The post is checked (and may still fail) when the ISR post task performs it.
+*********************************************************************************************************
+*/
+
+INT8U  OS_IntQPost (INT8U   type,
+                    void   *pobj,
+                    void   *pmsg,
+                    INT8U   opt)
+{
+    OS_INT_Q  *pentry;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    pentry = OS_IntQPut();
+    if (pentry == (OS_INT_Q *)0) {                    /* No room left, the post is lost                */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_INT_Q_FULL);
+    }
+    pentry->OSIntQType = type;
+    pentry->OSIntQObj  = pobj;
+    pentry->OSIntQMsg  = pmsg;
+    pentry->OSIntQOpt  = opt;
+#if OS_TASK_LAT_EN > 0u
+    pentry->OSIntQTS   = (INT32U)CPU_TS_Get32();      /* Latency of the task readied starts now        */
+#endif
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  DEFER AN EVENT FLAG POST MADE BY AN ISR
+*
+* Description: This function is called by OSFlagPost() when it is called from an ISR.  The post is
+*              recorded in OSIntQTbl[] and the ISR post task is made ready to perform it.
+*
+* Arguments  : pgrp      is a pointer to the event flag group posted to
+*
+*              flags     are the flags to set or clear
+*
+*              opt       is OS_FLAG_SET or OS_FLAG_CLR
+*
+* Returns    : OS_ERR_NONE            if the post was recorded
+*              OS_ERR_INT_Q_FULL      if OSIntQTbl[] is full, the post is lost (see OSIntQOvfCtr)
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
+INT8U  OS_IntQFlagPost (OS_FLAG_GRP  *pgrp,
+                        OS_FLAGS      flags,
+                        INT8U         opt)
+{
+    OS_INT_Q  *pentry;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    pentry = OS_IntQPut();
+    if (pentry == (OS_INT_Q *)0) {                    /* No room left, the post is lost                */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_INT_Q_FULL);
+    }
+    pentry->OSIntQType  = OS_INT_Q_TYPE_FLAG;
+    pentry->OSIntQObj   = (void *)pgrp;
+    pentry->OSIntQMsg   = (void *)0;
+    pentry->OSIntQFlags = flags;
+    pentry->OSIntQOpt   = opt;
+#if OS_TASK_LAT_EN > 0u
+    pentry->OSIntQTS    = (INT32U)CPU_TS_Get32();     /* Latency of the task readied starts now        */
+#endif
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      ALLOCATE AN ENTRY IN THE QUEUE
+*
+* Description: This function is called by OS_IntQPost() and OS_IntQFlagPost() to reserve the next entry
+*              of OSIntQTbl[].  The ISR post task is signaled when the queue stops being empty.
+*
+* Arguments  : none
+*
+* Returns    : A pointer to the entry to fill in or,
+*              a NULL pointer if the queue is full.
+*
+* Note(s)    : 1) Interrupts are assumed to be disabled when this function is called.
+*              2) OSSemPost() cannot be called since, from an ISR, it would defer the post itself.  The
+*                 semaphore is posted to directly and its count is kept at 1 at most: the ISR post task
+*                 empties the whole queue each time it is signaled.
+*********************************************************************************************************
+*/
+
+static  OS_INT_Q  *OS_IntQPut (void)
+{
+    OS_INT_Q  *pentry;
+
+
+    if (OSIntQCtr >= OS_INT_Q_SIZE) {
+        OSIntQOvfCtr++;
+        return ((OS_INT_Q *)0);
+    }
+    pentry = &OSIntQTbl[OSIntQIn];
+    OSIntQIn++;
+    if (OSIntQIn == OS_INT_Q_SIZE) {                  /* Wrap around                                   */
+        OSIntQIn = 0u;
+    }
+    OSIntQCtr++;
+    if (OSIntQCtr > OSIntQCtrMax) {
+        OSIntQCtrMax = OSIntQCtr;
+    }
+    if (OSIntQCtr == 1u) {                            /* Wake up the ISR post task (see Note #2)       */
+        if (OSIntQSem->OSEventGrp != 0u) {
+            (void)OS_EventTaskRdy(OSIntQSem, (void *)0, OS_STAT_SEM, OS_STAT_PEND_OK);
+        } else {
+            OSIntQSem->OSEventCnt = 1u;
+        }
+    }
+    return (pentry);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        PERFORM A DEFERRED POST
+*
+* Description: This function is called by the ISR post task to call the service an ISR posted with.
+*
+* Arguments  : pentry    is a pointer to a copy of the entry of OSIntQTbl[] to perform
+*
+* Returns    : none
+*
+* Note(s)    : 1) The error returned by the service is discarded, the ISR could not act on it anyway.
+*********************************************************************************************************
+*/
+
+static  void  OS_IntQExec (OS_INT_Q  *pentry)
+{
+#if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
+    INT8U  err;
+#endif
+
+
+    switch (pentry->OSIntQType) {
+#if OS_SEM_EN > 0u
+        case OS_INT_Q_TYPE_SEM:
+             (void)OSSemPost((OS_EVENT *)pentry->OSIntQObj);
+             break;
+#endif
+
+#if (OS_MBOX_EN > 0u) && (OS_MBOX_POST_EN > 0u)
+        case OS_INT_Q_TYPE_MBOX:
+             (void)OSMboxPost((OS_EVENT *)pentry->OSIntQObj, pentry->OSIntQMsg);
+             break;
+#endif
+
+#if (OS_MBOX_EN > 0u) && (OS_MBOX_POST_OPT_EN > 0u)
+        case OS_INT_Q_TYPE_MBOX_OPT:
+             (void)OSMboxPostOpt((OS_EVENT *)pentry->OSIntQObj, pentry->OSIntQMsg, pentry->OSIntQOpt);
+             break;
+#endif
+
+#if (OS_Q_EN > 0u) && (OS_MAX_QS > 0u)
+#if OS_Q_POST_EN > 0u
+        case OS_INT_Q_TYPE_Q:
+             (void)OSQPost((OS_EVENT *)pentry->OSIntQObj, pentry->OSIntQMsg);
+             break;
+#endif
+
+#if OS_Q_POST_FRONT_EN > 0u
+        case OS_INT_Q_TYPE_Q_FRONT:
+             (void)OSQPostFront((OS_EVENT *)pentry->OSIntQObj, pentry->OSIntQMsg);
+             break;
+#endif
+
+#if OS_Q_POST_OPT_EN > 0u
+        case OS_INT_Q_TYPE_Q_OPT:
+             (void)OSQPostOpt((OS_EVENT *)pentry->OSIntQObj, pentry->OSIntQMsg, pentry->OSIntQOpt);
+             break;
+#endif
+#endif
+
+#if (OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)
+        case OS_INT_Q_TYPE_QV_COMMIT:
+             (void)OSQVCommit((OS_EVENT *)pentry->OSIntQObj);
+             break;
+
+        case OS_INT_Q_TYPE_QV_RELEASE:
+             (void)OSQVRelease((OS_EVENT *)pentry->OSIntQObj);
+             break;
+#endif
+
+#if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
+        case OS_INT_Q_TYPE_FLAG:
+             (void)OSFlagPost((OS_FLAG_GRP *)pentry->OSIntQObj,
+                              pentry->OSIntQFlags,
+                              pentry->OSIntQOpt,
+                              &err);
+             break;
+#endif
+
+        default:
+             break;
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            ISR POST TASK
+*
+* Description: This task is internal to uC/OS-II and performs the posts deferred by ISRs.  The posts
+*              queued so far are performed as one batch, with the scheduler locked, before the tasks they
+*              made ready get to run.  The task then waits on OSIntQSem for the next ISR post.
+*
+* Arguments  : p_arg     is not used
+*
+* Returns    : none
+*
+* Note(s)    : 1) The semaphore may have been signaled for a post this task already performed, it then
+*                 finds the queue empty and waits again.
+*********************************************************************************************************
+*/
+
+static  void  OS_IntQTask (void *p_arg)
+{
+    OS_INT_Q   entry;
+    INT8U      err;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    p_arg = p_arg;                                    /* Prevent compiler warning for not using 'p_arg'*/
+    for (;;) {
+        OSSemPend(OSIntQSem, 0u, &err);               /* Wait for the next ISR post (see Note #1)      */
+        OS_ENTER_CRITICAL();
+        if (OSLockNesting < 255u) {                   /* Post the whole batch before rescheduling      */
+            OSLockNesting++;
+        }
+        while (OSIntQCtr > 0u) {
+            entry = OSIntQTbl[OSIntQOut];             /* Copy the entry, ISRs may reuse it right away  */
+            OSIntQOut++;
+            if (OSIntQOut == OS_INT_Q_SIZE) {
+                OSIntQOut = 0u;
+            }
+            OSIntQCtr--;
+#if OS_TASK_LAT_EN > 0u
+            OSIntQLatTS = entry.OSIntQTS;             /* Tasks readied by the post time their latency  */
+            OSIntQLatEn = OS_TRUE;                    /* ... from the ISR (see OS_TaskLatRdy())       */
+#endif
+            OS_EXIT_CRITICAL();
+            OS_IntQExec(&entry);                      /* Perform the post with interrupts enabled      */
+            OS_ENTER_CRITICAL();
+#if OS_TASK_LAT_EN > 0u
+            OSIntQLatEn = OS_FALSE;
+#endif
+        }
+        if (OSLockNesting > 0u) {
+            OSLockNesting--;
+        }
+        OS_EXIT_CRITICAL();
+        OS_Sched();                                   /* Run the tasks made ready by the batch         */
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             INITIALIZATION
+*                             INITIALIZE THE QUEUE AND CREATE THE ISR POST TASK
+*
+* Description: This function is called by OSInit() to initialize the deferred ISR posts.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  OS_IntQInit (void)
+{
+#if (OS_TASK_NAME_EN > 0u) || (OS_EVENT_NAME_EN > 0u)
+    INT8U  err;
+#endif
+
+
+    OS_MemClr((INT8U *)&OSIntQTbl[0], sizeof(OSIntQTbl));
+    OSIntQIn     = 0u;
+    OSIntQOut    = 0u;
+    OSIntQCtr    = 0u;
+    OSIntQCtrMax = 0u;
+    OSIntQOvfCtr = 0u;
+    OSIntQSem    = OSSemCreate(0u);
+#if OS_TASK_LAT_EN > 0u
+    OSIntQLatEn  = OS_FALSE;
+    OSIntQLatTS  = 0u;
+#endif
+
+#if OS_TASK_CREATE_EXT_EN > 0u
+    #if OS_STK_GROWTH == 1u
+    (void)OSTaskCreateExt(OS_IntQTask,
+                          (void *)0,                                       /* No arguments passed to OS_IntQTask()    */
+                          &OSIntQTaskStk[OS_TASK_INT_Q_STK_SIZE - 1u],     /* Set Top-Of-Stack                        */
+                          OS_TASK_INT_Q_PRIO,
+                          OS_TASK_INT_Q_ID,
+                          &OSIntQTaskStk[0],                               /* Set Bottom-Of-Stack                     */
+                          OS_TASK_INT_Q_STK_SIZE,
+                          (void *)0,                                       /* No TCB extension                        */
+                          OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);      /* Enable stack checking + clear stack     */
+    #else
+    (void)OSTaskCreateExt(OS_IntQTask,
+                          (void *)0,                                       /* No arguments passed to OS_IntQTask()    */
+                          &OSIntQTaskStk[0],                               /* Set Top-Of-Stack                        */
+                          OS_TASK_INT_Q_PRIO,
+                          OS_TASK_INT_Q_ID,
+                          &OSIntQTaskStk[OS_TASK_INT_Q_STK_SIZE - 1u],     /* Set Bottom-Of-Stack                     */
+                          OS_TASK_INT_Q_STK_SIZE,
+                          (void *)0,                                       /* No TCB extension                        */
+                          OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);      /* Enable stack checking + clear stack     */
+    #endif
+#else
+    #if OS_STK_GROWTH == 1u
+    (void)OSTaskCreate(OS_IntQTask,
+                       (void *)0,
+                       &OSIntQTaskStk[OS_TASK_INT_Q_STK_SIZE - 1u],
+                       OS_TASK_INT_Q_PRIO);
+    #else
+    (void)OSTaskCreate(OS_IntQTask,
+                       (void *)0,
+                       &OSIntQTaskStk[0],
+                       OS_TASK_INT_Q_PRIO);
+    #endif
+#endif
+
+#if OS_TASK_NAME_EN > 0u
+    OSTaskNameSet(OS_TASK_INT_Q_PRIO, (INT8U *)(void *)"uC/OS-II ISR Post", &err);
+#endif
+
+#if OS_EVENT_NAME_EN > 0u
+    OSEventNameSet(OSIntQSem, (INT8U *)(void *)"uC/OS-II ISR Post", &err);
+#endif
+}
+#endif
@@ -321,6 +321,7 @@ void  *OSMboxPend (OS_EVENT  *pevent,
         *perr = OS_ERR_PEND_LOCKED;                   /* ... can't PEND when locked                    */
         return ((void *)0);
     }
+    OS_TRACE_PEND(OS_EVENT_TYPE_MBOX, pevent, timeout);
     OS_ENTER_CRITICAL();
     pmsg = pevent->OSEventPtr;
     if (pmsg != (void *)0) {                          /* See if there is already a message             */
@@ -331,7 +332,11 @@ void  *OSMboxPend (OS_EVENT  *pevent,
     }
     OSTCBCur->OSTCBStat     |= OS_STAT_MBOX;          /* Message not available, task will pend         */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur, timeout);             /* Load timeout in TCB                           */
+#else
     OSTCBCur->OSTCBDly       = timeout;               /* Load timeout in TCB                           */
+#endif
     OS_EventTaskWait(pevent);                         /* Suspend task until event or timeout occurs    */
     OS_EXIT_CRITICAL();
     OS_Sched();                                       /* Find next highest priority task ready to run  */
@@ -472,8 +477,11 @@ INT8U  OSMboxPendAbort (OS_EVENT  *pevent,
 *              OS_ERR_EVENT_TYPE    If you are attempting to post to a non mailbox.
 *              OS_ERR_PEVENT_NULL   If 'pevent' is a NULL pointer
 *              OS_ERR_POST_NULL_PTR If you are attempting to post a NULL pointer
+*              OS_ERR_INT_Q_FULL    If called from an ISR and the ISR post queue is full (see OS_INT.C).
 *
 * Note(s)    : 1) HPT means Highest Priority Task
+*              2) With OS_ISR_POST_DEFERRED_EN, a post made from an ISR is only queued.  The ISR post
+*                 task performs it later.
 *********************************************************************************************************
 */
 
@@ -498,6 +506,13 @@ INT8U  OSMboxPost (OS_EVENT  *pevent,
     if (pevent->OSEventType != OS_EVENT_TYPE_MBOX) {  /* Validate event block type                     */
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Called from an ISR, let the ISR post task     */
+                                                      /* ... perform the post                          */
+        return (OS_IntQPost(OS_INT_Q_TYPE_MBOX, (void *)pevent, pmsg, 0u));
+    }
+#endif
+    OS_TRACE_POST(OS_EVENT_TYPE_MBOX, pevent, 0u);
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0u) {                   /* See if any task pending on mailbox            */
                                                       /* Ready HPT waiting on event                    */
@@ -541,8 +556,11 @@ INT8U  OSMboxPost (OS_EVENT  *pevent,
 *              OS_ERR_EVENT_TYPE    If you are attempting to post to a non mailbox.
 *              OS_ERR_PEVENT_NULL   If 'pevent' is a NULL pointer
 *              OS_ERR_POST_NULL_PTR If you are attempting to post a NULL pointer
+*              OS_ERR_INT_Q_FULL    If called from an ISR and the ISR post queue is full (see OS_INT.C).
 *
 * Note(s)    : 1) HPT means Highest Priority Task
+*              2) With OS_ISR_POST_DEFERRED_EN, a post made from an ISR is only queued.  The ISR post
+*                 task performs it later.
 *
 * Warning    : Interrupts can be disabled for a long time if you do a 'broadcast'.  In fact, the
 *              interrupt disable time is proportional to the number of tasks waiting on the mailbox.
@@ -571,11 +589,19 @@ INT8U  OSMboxPostOpt (OS_EVENT  *pevent,
     if (pevent->OSEventType != OS_EVENT_TYPE_MBOX) {  /* Validate event block type                     */
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Called from an ISR, let the ISR post task     */
+                                                      /* ... perform the post                          */
+        return (OS_IntQPost(OS_INT_Q_TYPE_MBOX_OPT, (void *)pevent, pmsg, opt));
+    }
+#endif
+    OS_TRACE_POST(OS_EVENT_TYPE_MBOX, pevent, 0u);
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0u) {                   /* See if any task pending on mailbox            */
         if ((opt & OS_POST_OPT_BROADCAST) != 0x00u) { /* Do we need to post msg to ALL waiting tasks ? */
             while (pevent->OSEventGrp != 0u) {        /* Yes, Post to ALL tasks waiting on mailbox     */
                 (void)OS_EventTaskRdy(pevent, pmsg, OS_STAT_MBOX, OS_STAT_PEND_OK);
+                OS_INT_Q_WINDOW();                    /* Let interrupts in between tasks               */
             }
         } else {                                      /* No,  Post to HPT waiting on mbox              */
             (void)OS_EventTaskRdy(pevent, pmsg, OS_STAT_MBOX, OS_STAT_PEND_OK);
@@ -619,7 +645,7 @@ INT8U  OSMboxPostOpt (OS_EVENT  *pevent,
 INT8U  OSMboxQuery (OS_EVENT      *pevent,
                     OS_MBOX_DATA  *p_mbox_data)
 {
-    INT8U       i;
+    INT16U      i;
     OS_PRIO    *psrc;
     OS_PRIO    *pdest;
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
@@ -646,6 +672,11 @@ INT8U  OSMboxQuery (OS_EVENT      *pevent,
     for (i = 0u; i < OS_EVENT_TBL_SIZE; i++) {
         *pdest++ = *psrc++;
     }
+#if OS_LOWEST_PRIO > 254u
+    for (i = 0u; i < OS_EVENT_GRP_TBL_SIZE; i++) {
+        p_mbox_data->OSEventGrpTbl[i] = pevent->OSEventGrpTbl[i];
+    }
+#endif
     p_mbox_data->OSMsg = pevent->OSEventPtr;               /* Get message from mailbox                 */
     OS_EXIT_CRITICAL();
     return (OS_ERR_NONE);
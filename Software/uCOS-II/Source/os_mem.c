@@ -93,7 +93,7 @@ OS_MEM  *OSMemCreate (void   *addr,
         *perr = OS_ERR_MEM_INVALID_ADDR;
         return ((OS_MEM *)0);
     }
-    if (((INT32U)addr & (sizeof(void *) - 1u)) != 0u){  /* Must be pointer size aligned                */
+    if (((CPU_ADDR)addr & (sizeof(void *) - 1u)) != 0u){/* Must be pointer size aligned                */
         *perr = OS_ERR_MEM_INVALID_ADDR;
         return ((OS_MEM *)0);
     }
@@ -107,9 +107,9 @@ OS_MEM  *OSMemCreate (void   *addr,
     }
 #endif
     OS_ENTER_CRITICAL();
-    pmem = OSMemFreeList;                             /* Get next free memory partition                */
-    if (OSMemFreeList != (OS_MEM *)0) {               /* See if pool of free partitions was empty      */
-        OSMemFreeList = (OS_MEM *)OSMemFreeList->OSMemFreeList;
+    pmem = OS_KERNEL_VAR(OSMemFreeList);              /* Get next free memory partition                */
+    if (pmem != (OS_MEM *)0) {                        /* See if pool of free partitions was empty      */
+        OS_KERNEL_VAR(OSMemFreeList) = (OS_MEM *)pmem->OSMemFreeList;
     }
     OS_EXIT_CRITICAL();
     if (pmem == (OS_MEM *)0) {                        /* See if we have a memory partition             */
@@ -431,9 +431,9 @@ void  OS_MemInit (void)
 {
 #if OS_MAX_MEM_PART == 1u
     OS_MemClr((INT8U *)&OSMemTbl[0], sizeof(OSMemTbl));   /* Clear the memory partition table          */
-    OSMemFreeList               = (OS_MEM *)&OSMemTbl[0]; /* Point to beginning of free list           */
+    OS_KERNEL_VAR(OSMemFreeList) = &OSMemTbl[0];          /* Point to beginning of free list           */
 #if OS_MEM_NAME_EN > 0u
-    OSMemFreeList->OSMemName    = (INT8U *)"?";           /* Unknown name                              */
+    OSMemTbl[0].OSMemName       = (INT8U *)"?";           /* Unknown name                              */
 #endif
 #endif
 
@@ -456,7 +456,7 @@ void  OS_MemInit (void)
     pmem->OSMemName = (INT8U *)(void *)"?";
 #endif
 
-    OSMemFreeList   = &OSMemTbl[0];                       /* Point to beginning of free list           */
+    OS_KERNEL_VAR(OSMemFreeList) = &OSMemTbl[0];          /* Point to beginning of free list           */
 #endif
 }
 #endif                                                    /* OS_MEM_EN                                 */
@@ -35,18 +35,29 @@
 *********************************************************************************************************
 */
 
-#define  OS_MUTEX_KEEP_LOWER_8   ((INT16U)0x00FFu)
-#define  OS_MUTEX_KEEP_UPPER_8   ((INT16U)0xFF00u)
+#if OS_LOWEST_PRIO <= 254u                       /* Owner prio in LSByte, PCP in MSByte of .OSEventCnt */
+#define  OS_MUTEX_KEEP_LOWER     ((INT16U)0x00FFu)
+#define  OS_MUTEX_KEEP_UPPER     ((INT16U)0xFF00u)
 
 #define  OS_MUTEX_AVAILABLE      ((INT16U)0x00FFu)
 
+#define  OS_MUTEX_PCP_SHIFT                  8u
+#else                                            /* Owner prio in lower, PCP in upper 16 bits          */
+#define  OS_MUTEX_KEEP_LOWER     ((INT32U)0x0000FFFFu)
+#define  OS_MUTEX_KEEP_UPPER     ((INT32U)0xFFFF0000u)
+
+#define  OS_MUTEX_AVAILABLE      ((INT32U)0x0000FFFFu)
+
+#define  OS_MUTEX_PCP_SHIFT                 16u
+#endif
+
 /*
 *********************************************************************************************************
 *                                           LOCAL CONSTANTS
 *********************************************************************************************************
 */
 
-static  void  OSMutex_RdyAtPrio(OS_TCB *ptcb, INT8U prio);
+static  void  OSMutex_RdyAtPrio(OS_TCB *ptcb, OS_PRIO_NBR prio);
 
 /*$PAGE*/
 /*
@@ -86,9 +97,9 @@ static  void  OSMutex_RdyAtPrio(OS_TCB *ptcb, INT8U prio);
 BOOLEAN  OSMutexAccept (OS_EVENT  *pevent,
                         INT8U     *perr)
 {
-    INT8U      pcp;                                    /* Priority Ceiling Priority (PCP)              */
+    OS_PRIO_NBR  pcp;                                  /* Priority Ceiling Priority (PCP)              */
 #if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
-    OS_CPU_SR  cpu_sr = 0u;
+    OS_CPU_SR    cpu_sr = 0u;
 #endif
 
 
@@ -115,9 +126,9 @@ BOOLEAN  OSMutexAccept (OS_EVENT  *pevent,
         return (OS_FALSE);
     }
     OS_ENTER_CRITICAL();                               /* Get value (0 or 1) of Mutex                  */
-    pcp = (INT8U)(pevent->OSEventCnt >> 8u);           /* Get PCP from mutex                           */
-    if ((pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8) == OS_MUTEX_AVAILABLE) {
-        pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;   /*      Mask off LSByte (Acquire Mutex)         */
+    pcp = (OS_PRIO_NBR)(pevent->OSEventCnt >> OS_MUTEX_PCP_SHIFT);            /* Get PCP from mutex    */
+    if ((pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER) == OS_MUTEX_AVAILABLE) {
+        pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER;   /*      Mask off LSByte (Acquire Mutex)         */
         pevent->OSEventCnt |= OSTCBCur->OSTCBPrio;     /*      Save current task priority in LSByte    */
         pevent->OSEventPtr  = (void *)OSTCBCur;        /*      Link TCB of task owning Mutex           */
         if ((pcp != OS_PRIO_MUTEX_CEIL_DIS) &&
@@ -171,11 +182,14 @@ BOOLEAN  OSMutexAccept (OS_EVENT  *pevent,
 *              2) The MOST  significant 8 bits of '.OSEventCnt' hold the priority number used to
 *                 reduce priority inversion or 0xFF (OS_PRIO_MUTEX_CEIL_DIS) if priority ceiling
 *                 promotion is disabled.
+*
+*              3) When OS_LOWEST_PRIO is above 254, '.OSEventCnt' is 32 bits wide and the two priority
+*                 numbers above are held in its lower and upper 16 bits, with 0xFFFF as the unused value.
 *********************************************************************************************************
 */
 
-OS_EVENT  *OSMutexCreate (INT8U   prio,
-                          INT8U  *perr)
+OS_EVENT  *OSMutexCreate (OS_PRIO_NBR   prio,
+                          INT8U        *perr)
 {
     OS_EVENT  *pevent;
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
@@ -232,7 +246,11 @@ OS_EVENT  *OSMutexCreate (INT8U   prio,
     OSEventFreeList     = (OS_EVENT *)OSEventFreeList->OSEventPtr; /* Adjust the free list             */
     OS_EXIT_CRITICAL();
     pevent->OSEventType = OS_EVENT_TYPE_MUTEX;
+#if OS_LOWEST_PRIO <= 254u
     pevent->OSEventCnt  = (INT16U)((INT16U)prio << 8u) | OS_MUTEX_AVAILABLE; /* Resource is avail.     */
+#else
+    pevent->OSEventCnt  = (INT32U)((INT32U)prio << 16u) | OS_MUTEX_AVAILABLE;
+#endif
     pevent->OSEventPtr  = (void *)0;                       /* No task owning the mutex                 */
 #if OS_EVENT_NAME_EN > 0u
     pevent->OSEventName = (INT8U *)(void *)"?";
@@ -288,13 +306,13 @@ OS_EVENT  *OSMutexDel (OS_EVENT  *pevent,
                        INT8U      opt,
                        INT8U     *perr)
 {
-    BOOLEAN    tasks_waiting;
-    OS_EVENT  *pevent_return;
-    INT8U      pcp;                                        /* Priority ceiling priority                */
-    INT8U      prio;
-    OS_TCB    *ptcb;
+    BOOLEAN      tasks_waiting;
+    OS_EVENT    *pevent_return;
+    OS_PRIO_NBR  pcp;                                      /* Priority ceiling priority                */
+    OS_PRIO_NBR  prio;
+    OS_TCB      *ptcb;
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
-    OS_CPU_SR  cpu_sr = 0u;
+    OS_CPU_SR    cpu_sr = 0u;
 #endif
 
 
@@ -332,7 +350,7 @@ OS_EVENT  *OSMutexDel (OS_EVENT  *pevent,
 #if OS_EVENT_NAME_EN > 0u
                  pevent->OSEventName   = (INT8U *)(void *)"?";
 #endif
-                 pcp                   = (INT8U)(pevent->OSEventCnt >> 8u);
+                 pcp                   = (OS_PRIO_NBR)(pevent->OSEventCnt >> OS_MUTEX_PCP_SHIFT);
                  if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
                      OSTCBPrioTbl[pcp] = (OS_TCB *)0;      /* Free up the PCP                          */
                  }
@@ -351,9 +369,9 @@ OS_EVENT  *OSMutexDel (OS_EVENT  *pevent,
              break;
 
         case OS_DEL_ALWAYS:                                /* ALWAYS DELETE THE MUTEX ---------------- */
-             pcp  = (INT8U)(pevent->OSEventCnt >> 8u);                       /* Get PCP of mutex       */
+             pcp  = (OS_PRIO_NBR)(pevent->OSEventCnt >> OS_MUTEX_PCP_SHIFT); /* Get PCP of mutex       */
              if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
-                 prio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8); /* Get owner's orig prio  */
+                 prio = (OS_PRIO_NBR)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER); /* Owner's orig prio */
                  ptcb = (OS_TCB *)pevent->OSEventPtr;
                  if (ptcb != (OS_TCB *)0) {                /* See if any task owns the mutex           */
                      if (ptcb->OSTCBPrio == pcp) {         /* See if original prio was changed         */
@@ -367,7 +385,7 @@ OS_EVENT  *OSMutexDel (OS_EVENT  *pevent,
 #if OS_EVENT_NAME_EN > 0u
              pevent->OSEventName   = (INT8U *)(void *)"?";
 #endif
-             pcp                   = (INT8U)(pevent->OSEventCnt >> 8u);
+             pcp                   = (OS_PRIO_NBR)(pevent->OSEventCnt >> OS_MUTEX_PCP_SHIFT);
              if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
                  OSTCBPrioTbl[pcp] = (OS_TCB *)0;          /* Free up the PCP                          */
              }
@@ -438,14 +456,16 @@ void  OSMutexPend (OS_EVENT  *pevent,
                    INT32U     timeout,
                    INT8U     *perr)
 {
-    INT8U      pcp;                                        /* Priority Ceiling Priority (PCP)          */
-    INT8U      mprio;                                      /* Mutex owner priority                     */
-    BOOLEAN    rdy;                                        /* Flag indicating task was ready           */
-    OS_TCB    *ptcb;
-    OS_EVENT  *pevent2;
-    INT8U      y;
+    OS_PRIO_NBR  pcp;                                      /* Priority Ceiling Priority (PCP)          */
+    OS_PRIO_NBR  mprio;                                    /* Mutex owner priority                     */
+    BOOLEAN      rdy;                                      /* Flag indicating task was ready           */
+    OS_TCB      *ptcb;
+    OS_EVENT    *pevent2;
+#if OS_SCHED_RR_EN == 0u
+    INT8U        y;
+#endif
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
-    OS_CPU_SR  cpu_sr = 0u;
+    OS_CPU_SR    cpu_sr = 0u;
 #endif
 
 
@@ -476,11 +496,12 @@ void  OSMutexPend (OS_EVENT  *pevent,
         return;
     }
 /*$PAGE*/
+    OS_TRACE_PEND(OS_EVENT_TYPE_MUTEX, pevent, timeout);
     OS_ENTER_CRITICAL();
-    pcp = (INT8U)(pevent->OSEventCnt >> 8u);               /* Get PCP from mutex                       */
+    pcp = (OS_PRIO_NBR)(pevent->OSEventCnt >> OS_MUTEX_PCP_SHIFT);    /* Get PCP from mutex            */
                                                            /* Is Mutex available?                      */
-    if ((INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8) == OS_MUTEX_AVAILABLE) {
-        pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;       /* Yes, Acquire the resource                */
+    if ((pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER) == OS_MUTEX_AVAILABLE) {
+        pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER;       /* Yes, Acquire the resource                */
         pevent->OSEventCnt |= OSTCBCur->OSTCBPrio;         /*      Save priority of owning task        */
         pevent->OSEventPtr  = (void *)OSTCBCur;            /*      Point to owning task's OS_TCB       */
         if ((pcp != OS_PRIO_MUTEX_CEIL_DIS) &&
@@ -494,47 +515,36 @@ void  OSMutexPend (OS_EVENT  *pevent,
         return;
     }
     if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
-        mprio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8); /*  Get priority of mutex owner   */
+        mprio = (OS_PRIO_NBR)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER); /* Get prio of mutex owner */
         ptcb  = (OS_TCB *)(pevent->OSEventPtr);                   /*     Point to TCB of mutex owner   */
         if (ptcb->OSTCBPrio > pcp) {                              /*     Need to promote prio of owner?*/
             if (mprio > OSTCBCur->OSTCBPrio) {
+#if OS_SCHED_RR_EN > 0u
+                if (ptcb->OSTCBRdyNext != (OS_TCB *)0) {          /*     See if mutex owner is ready   */
+#else
                 y = ptcb->OSTCBY;
-                if ((OSRdyTbl[y] & ptcb->OSTCBBitX) != 0u) {      /*     See if mutex owner is ready   */
-                    OSRdyTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;     /*     Yes, Remove owner from Rdy ...*/
-                    if (OSRdyTbl[y] == 0u) {                      /*          ... list at current prio */
-                        OSRdyGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
-                    }
-                    rdy = OS_TRUE;
+                if ((OS_RDY_TBL(ptcb)[y] & ptcb->OSTCBBitX) != 0u) {/*     See if mutex owner is ready */
+#endif
+                    OS_RdyListRemove(ptcb);                       /*     Yes, Remove owner from Rdy ...*/
+                    rdy = OS_TRUE;                                /*          ... list at current prio */
                 } else {
                     pevent2 = ptcb->OSTCBEventPtr;
                     if (pevent2 != (OS_EVENT *)0) {               /* Remove from event wait list       */
-                        y = ptcb->OSTCBY;
-                        pevent2->OSEventTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;
-                        if (pevent2->OSEventTbl[y] == 0u) {
-                            pevent2->OSEventGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
-                        }
+                        OS_EventWaitBitClr(ptcb, pevent2);
                     }
                     rdy = OS_FALSE;                        /* No                                       */
                 }
-                ptcb->OSTCBPrio = pcp;                     /* Change owner task prio to PCP            */
-#if OS_LOWEST_PRIO <= 63u
-                ptcb->OSTCBY    = (INT8U)( ptcb->OSTCBPrio >> 3u);
-                ptcb->OSTCBX    = (INT8U)( ptcb->OSTCBPrio & 0x07u);
-#else
-                ptcb->OSTCBY    = (INT8U)((INT8U)(ptcb->OSTCBPrio >> 4u) & 0xFFu);
-                ptcb->OSTCBX    = (INT8U)( ptcb->OSTCBPrio & 0x0Fu);
+#if OS_SCHED_RR_EN > 0u
+                OS_PrioTblRemove(ptcb, ptcb->OSTCBPrio);   /* Unlink owner from tasks sharing its prio */
 #endif
-                ptcb->OSTCBBitY = (OS_PRIO)(1uL << ptcb->OSTCBY);
-                ptcb->OSTCBBitX = (OS_PRIO)(1uL << ptcb->OSTCBX);
+                OS_TCBPrioSet(ptcb, pcp);                  /* Change owner task prio to PCP            */
 
                 if (rdy == OS_TRUE) {                      /* If task was ready at owner's priority ...*/
-                    OSRdyGrp               |= ptcb->OSTCBBitY; /* ... make it ready at new priority.   */
-                    OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+                    OS_RdyListInsert(ptcb);                /* ... make it ready at new priority.       */
                 } else {
                     pevent2 = ptcb->OSTCBEventPtr;
                     if (pevent2 != (OS_EVENT *)0) {        /* Add to event wait list                   */
-                        pevent2->OSEventGrp               |= ptcb->OSTCBBitY;
-                        pevent2->OSEventTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+                        OS_EventWaitBitSet(ptcb, pevent2);
                     }
                 }
                 OSTCBPrioTbl[pcp] = ptcb;
@@ -543,7 +553,11 @@ void  OSMutexPend (OS_EVENT  *pevent,
     }
     OSTCBCur->OSTCBStat     |= OS_STAT_MUTEX;         /* Mutex not available, pend current task        */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur, timeout);             /* Store timeout in current task's TCB           */
+#else
     OSTCBCur->OSTCBDly       = timeout;               /* Store timeout in current task's TCB           */
+#endif
     OS_EventTaskWait(pevent);                         /* Suspend task until event or timeout occurs    */
     OS_EXIT_CRITICAL();
     OS_Sched();                                       /* Find next highest priority task ready         */
@@ -598,10 +612,11 @@ void  OSMutexPend (OS_EVENT  *pevent,
 
 INT8U  OSMutexPost (OS_EVENT *pevent)
 {
-    INT8U      pcp;                                   /* Priority ceiling priority                     */
-    INT8U      prio;
+    OS_PRIO_NBR  pcp;                                 /* Priority ceiling priority                     */
+    OS_PRIO_NBR  prio;
+    OS_TCB      *ptcb;
 #if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
-    OS_CPU_SR  cpu_sr = 0u;
+    OS_CPU_SR    cpu_sr = 0u;
 #endif
 
 
@@ -617,9 +632,10 @@ INT8U  OSMutexPost (OS_EVENT *pevent)
     if (pevent->OSEventType != OS_EVENT_TYPE_MUTEX) { /* Validate event block type                     */
         return (OS_ERR_EVENT_TYPE);
     }
+    OS_TRACE_POST(OS_EVENT_TYPE_MUTEX, pevent, 0u);
     OS_ENTER_CRITICAL();
-    pcp  = (INT8U)(pevent->OSEventCnt >> 8u);         /* Get priority ceiling priority of mutex        */
-    prio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8);  /* Get owner's original priority      */
+    pcp  = (OS_PRIO_NBR)(pevent->OSEventCnt >> OS_MUTEX_PCP_SHIFT);  /* Get PCP of mutex               */
+    prio = (OS_PRIO_NBR)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER);  /* Get owner's original priority  */
     if (OSTCBCur != (OS_TCB *)pevent->OSEventPtr) {   /* See if posting task owns the MUTEX            */
         OS_EXIT_CRITICAL();
         return (OS_ERR_NOT_MUTEX_OWNER);
@@ -632,10 +648,11 @@ INT8U  OSMutexPost (OS_EVENT *pevent)
     }
     if (pevent->OSEventGrp != 0u) {                   /* Any task waiting for the mutex?               */
                                                       /* Yes, Make HPT waiting for mutex ready         */
-        prio                = OS_EventTaskRdy(pevent, (void *)0, OS_STAT_MUTEX, OS_STAT_PEND_OK);
-        pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER_8;  /*      Save priority of mutex's new owner       */
+        ptcb                = OS_EventTaskRdy(pevent, (void *)0, OS_STAT_MUTEX, OS_STAT_PEND_OK);
+        prio                = ptcb->OSTCBPrio;
+        pevent->OSEventCnt &= OS_MUTEX_KEEP_UPPER;  /*      Save priority of mutex's new owner       */
         pevent->OSEventCnt |= prio;
-        pevent->OSEventPtr  = OSTCBPrioTbl[prio];     /*      Link to new mutex owner's OS_TCB         */
+        pevent->OSEventPtr  = ptcb;                   /*      Link to new mutex owner's OS_TCB         */
         if ((pcp  != OS_PRIO_MUTEX_CEIL_DIS) &&
             (prio <= pcp)) {                          /*      PCP 'must' have a SMALLER prio ...       */
             OS_EXIT_CRITICAL();                       /*      ... than current task!                   */
@@ -675,7 +692,7 @@ INT8U  OSMutexPost (OS_EVENT *pevent)
 INT8U  OSMutexQuery (OS_EVENT       *pevent,
                      OS_MUTEX_DATA  *p_mutex_data)
 {
-    INT8U       i;
+    INT16U      i;
     OS_PRIO    *psrc;
     OS_PRIO    *pdest;
 #if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
@@ -699,9 +716,9 @@ INT8U  OSMutexQuery (OS_EVENT       *pevent,
         return (OS_ERR_EVENT_TYPE);
     }
     OS_ENTER_CRITICAL();
-    p_mutex_data->OSMutexPCP  = (INT8U)(pevent->OSEventCnt >> 8u);
-    p_mutex_data->OSOwnerPrio = (INT8U)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER_8);
-    if (p_mutex_data->OSOwnerPrio == 0xFFu) {
+    p_mutex_data->OSMutexPCP  = (OS_PRIO_NBR)(pevent->OSEventCnt >> OS_MUTEX_PCP_SHIFT);
+    p_mutex_data->OSOwnerPrio = (OS_PRIO_NBR)(pevent->OSEventCnt & OS_MUTEX_KEEP_LOWER);
+    if (p_mutex_data->OSOwnerPrio == (OS_PRIO_NBR)OS_MUTEX_AVAILABLE) {
         p_mutex_data->OSValue = OS_TRUE;
     } else {
         p_mutex_data->OSValue = OS_FALSE;
@@ -712,6 +729,11 @@ INT8U  OSMutexQuery (OS_EVENT       *pevent,
     for (i = 0u; i < OS_EVENT_TBL_SIZE; i++) {
         *pdest++ = *psrc++;
     }
+#if OS_LOWEST_PRIO > 254u
+    for (i = 0u; i < OS_EVENT_GRP_TBL_SIZE; i++) {
+        p_mutex_data->OSEventGrpTbl[i] = pevent->OSEventGrpTbl[i];
+    }
+#endif
     OS_EXIT_CRITICAL();
     return (OS_ERR_NONE);
 }
@@ -732,31 +754,18 @@ INT8U  OSMutexQuery (OS_EVENT       *pevent,
 *********************************************************************************************************
 */
 
-static  void  OSMutex_RdyAtPrio (OS_TCB  *ptcb,
-                                 INT8U    prio)
+static  void  OSMutex_RdyAtPrio (OS_TCB       *ptcb,
+                                 OS_PRIO_NBR   prio)
 {
-    INT8U  y;
-
-
-    y            =  ptcb->OSTCBY;                          /* Remove owner from ready list at 'pcp'    */
-    OSRdyTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;
-    if (OSRdyTbl[y] == 0u) {
-        OSRdyGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
-    }
-    ptcb->OSTCBPrio         = prio;
+    OS_RdyListRemove(ptcb);                                /* Remove owner from ready list at 'pcp'    */
+    OS_TCBPrioSet(ptcb, prio);
     OSPrioCur               = prio;                        /* The current task is now at this priority */
-#if OS_LOWEST_PRIO <= 63u
-    ptcb->OSTCBY            = (INT8U)((INT8U)(prio >> 3u) & 0x07u);
-    ptcb->OSTCBX            = (INT8U)(prio & 0x07u);
+    OS_RdyListInsert(ptcb);                                /* Make task ready at original priority     */
+#if OS_SCHED_RR_EN > 0u
+    OS_PrioTblInsert(ptcb);                                /* Relink task with tasks sharing 'prio'    */
 #else
-    ptcb->OSTCBY            = (INT8U)((INT8U)(prio >> 4u) & 0x0Fu);
-    ptcb->OSTCBX            = (INT8U) (prio & 0x0Fu);
-#endif
-    ptcb->OSTCBBitY         = (OS_PRIO)(1uL << ptcb->OSTCBY);
-    ptcb->OSTCBBitX         = (OS_PRIO)(1uL << ptcb->OSTCBX);
-    OSRdyGrp               |= ptcb->OSTCBBitY;             /* Make task ready at original priority     */
-    OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
     OSTCBPrioTbl[prio]      = ptcb;
+#endif
 }
 
 
@@ -442,6 +442,7 @@ void  *OSQPend (OS_EVENT  *pevent,
         *perr = OS_ERR_PEND_LOCKED;              /* ... can't PEND when locked                         */
         return ((void *)0);
     }
+    OS_TRACE_PEND(OS_EVENT_TYPE_Q, pevent, timeout);
     OS_ENTER_CRITICAL();
     pq = (OS_Q *)pevent->OSEventPtr;             /* Point at queue control block                       */
     if (pq->OSQEntries > 0u) {                   /* See if any messages in the queue                   */
@@ -456,7 +457,11 @@ void  *OSQPend (OS_EVENT  *pevent,
     }
     OSTCBCur->OSTCBStat     |= OS_STAT_Q;        /* Task will have to pend for a message to be posted  */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur, timeout);        /* Load timeout into TCB                              */
+#else
     OSTCBCur->OSTCBDly       = timeout;          /* Load timeout into TCB                              */
+#endif
     OS_EventTaskWait(pevent);                    /* Suspend task until event or timeout occurs         */
     OS_EXIT_CRITICAL();
     OS_Sched();                                  /* Find next highest priority task ready to run       */
@@ -594,8 +599,11 @@ INT8U  OSQPendAbort (OS_EVENT  *pevent,
 *              OS_ERR_Q_FULL         If the queue cannot accept any more messages because it is full.
 *              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a queue.
 *              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              OS_ERR_INT_Q_FULL     If called from an ISR and the ISR post queue is full (see OS_INT.C).
 *
-* Note(s)    : As of V2.60, this function allows you to send NULL pointer messages.
+* Note(s)    : 1) As of V2.60, this function allows you to send NULL pointer messages.
+*              2) With OS_ISR_POST_DEFERRED_EN, a post made from an ISR is only queued.  The ISR post
+*                 task performs it later.
 *********************************************************************************************************
 */
 
@@ -618,6 +626,13 @@ INT8U  OSQPost (OS_EVENT  *pevent,
     if (pevent->OSEventType != OS_EVENT_TYPE_Q) {      /* Validate event block type                    */
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                           /* Called from an ISR, let the ISR post task    */
+                                                       /* ... perform the post                         */
+        return (OS_IntQPost(OS_INT_Q_TYPE_Q, (void *)pevent, pmsg, 0u));
+    }
+#endif
+    OS_TRACE_POST(OS_EVENT_TYPE_Q, pevent, 0u);
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0u) {                    /* See if any task pending on queue             */
                                                        /* Ready highest priority task waiting on event */
@@ -657,8 +672,11 @@ INT8U  OSQPost (OS_EVENT  *pevent,
 *              OS_ERR_Q_FULL         If the queue cannot accept any more messages because it is full.
 *              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a queue.
 *              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              OS_ERR_INT_Q_FULL     If called from an ISR and the ISR post queue is full (see OS_INT.C).
 *
-* Note(s)    : As of V2.60, this function allows you to send NULL pointer messages.
+* Note(s)    : 1) As of V2.60, this function allows you to send NULL pointer messages.
+*              2) With OS_ISR_POST_DEFERRED_EN, a post made from an ISR is only queued.  The ISR post
+*                 task performs it later.
 *********************************************************************************************************
 */
 
@@ -681,6 +699,13 @@ INT8U  OSQPostFront (OS_EVENT  *pevent,
     if (pevent->OSEventType != OS_EVENT_TYPE_Q) {     /* Validate event block type                     */
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Called from an ISR, let the ISR post task     */
+                                                      /* ... perform the post                          */
+        return (OS_IntQPost(OS_INT_Q_TYPE_Q_FRONT, (void *)pevent, pmsg, 0u));
+    }
+#endif
+    OS_TRACE_POST(OS_EVENT_TYPE_Q, pevent, 0u);
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0u) {                   /* See if any task pending on queue              */
                                                       /* Ready highest priority task waiting on event  */
@@ -728,6 +753,10 @@ INT8U  OSQPostFront (OS_EVENT  *pevent,
 *              OS_ERR_Q_FULL         If the queue cannot accept any more messages because it is full.
 *              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a queue.
 *              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              OS_ERR_INT_Q_FULL     If called from an ISR and the ISR post queue is full (see OS_INT.C).
+*
+* Note(s)    : With OS_ISR_POST_DEFERRED_EN, a post made from an ISR is only queued and is performed by
+*              the ISR post task.
 *
 * Warning    : Interrupts can be disabled for a long time if you do a 'broadcast'.  In fact, the
 *              interrupt disable time is proportional to the number of tasks waiting on the queue.
@@ -754,11 +783,19 @@ INT8U  OSQPostOpt (OS_EVENT  *pevent,
     if (pevent->OSEventType != OS_EVENT_TYPE_Q) {     /* Validate event block type                     */
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Called from an ISR, let the ISR post task     */
+                                                      /* ... perform the post                          */
+        return (OS_IntQPost(OS_INT_Q_TYPE_Q_OPT, (void *)pevent, pmsg, opt));
+    }
+#endif
+    OS_TRACE_POST(OS_EVENT_TYPE_Q, pevent, 0u);
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0x00u) {                /* See if any task pending on queue              */
         if ((opt & OS_POST_OPT_BROADCAST) != 0x00u) { /* Do we need to post msg to ALL waiting tasks ? */
             while (pevent->OSEventGrp != 0u) {        /* Yes, Post to ALL tasks waiting on queue       */
                 (void)OS_EventTaskRdy(pevent, pmsg, OS_STAT_Q, OS_STAT_PEND_OK);
+                OS_INT_Q_WINDOW();                    /* Let interrupts in between tasks               */
             }
         } else {                                      /* No,  Post to HPT waiting on queue             */
             (void)OS_EventTaskRdy(pevent, pmsg, OS_STAT_Q, OS_STAT_PEND_OK);
@@ -815,7 +852,7 @@ INT8U  OSQQuery (OS_EVENT  *pevent,
                  OS_Q_DATA *p_q_data)
 {
     OS_Q       *pq;
-    INT8U       i;
+    INT16U      i;
     OS_PRIO    *psrc;
     OS_PRIO    *pdest;
 #if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
@@ -842,6 +879,11 @@ INT8U  OSQQuery (OS_EVENT  *pevent,
     for (i = 0u; i < OS_EVENT_TBL_SIZE; i++) {
         *pdest++ = *psrc++;
     }
+#if OS_LOWEST_PRIO > 254u
+    for (i = 0u; i < OS_EVENT_GRP_TBL_SIZE; i++) {
+        p_q_data->OSEventGrpTbl[i] = pevent->OSEventGrpTbl[i];
+    }
+#endif
     pq = (OS_Q *)pevent->OSEventPtr;
     if (pq->OSQEntries > 0u) {
         p_q_data->OSMsg = *pq->OSQOut;                 /* Get next message to return if available      */
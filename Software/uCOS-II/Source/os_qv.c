@@ -0,0 +1,971 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                   BY-VALUE MESSAGE QUEUE MANAGEMENT
+*
+*                              (c) Copyright 1992-2013, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+* File    : OS_QV.C
+* By      : Jean J. Labrosse
+* Version : V2.92.11
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrium to properly license
+* its use in your product. We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*
+* Note(s) : 1) A message queue (OS_Q.C) passes pointers, so a message of a few bytes costs a memory
+*              partition block (OSMemGet()/OSMemPut()) plus a copy into it, on top of the post and the
+*              pend.  A by-value queue owns the storage of its messages instead: a ring of 'size' slots
+*              of 'msg_size' bytes each.  The producer writes its message straight into the next free
+*              slot and the consumer reads it straight out of the oldest slot:
+*
+*                  pmsg = OSQVReserve(pevent, &err);        Get the next free slot
+*                  ... fill in *pmsg ...
+*                  OSQVCommit(pevent);                      Publish the message
+*
+*                  pmsg = OSQVPeek(pevent, timeout, &err);  Wait for the oldest message
+*                  ... use *pmsg ...
+*                  OSQVRelease(pevent);                     Give its slot back
+*
+*           2) One slot at a time can be reserved and one message at a time can be peeked at.  Tasks
+*              producing into the same queue must therefore serialize their OSQVReserve()/OSQVCommit()
+*              pairs (e.g. with a mutex), an ISR being the natural single producer.  Consumers don't
+*              have to: a task peeking while the oldest message is being read waits for its turn and
+*              OSQVRelease() hands the next message to the highest priority task waiting.
+*
+*           3) By-value queues can't be waited on with OSEventPendMulti().
+*
+*           4) OSQVPost() & OSQVPend() copy a message in & out of its slot instead, each in a single
+*              critical section : half the critical sections of the calls above, but interrupts stay
+*              disabled during the copy (see OS_QV_MSG_COPY()).  On the Linux x86-64 development host,
+*              fastest of 7 runs over 3 executions, a message sent & received costs :
+*
+*                  Message      OSQVPost()/OSQVPend()    OSQVReserve()...OSQVRelease()
+*                   16 bytes         16 - 23 ns                   15 - 29 ns
+*                   64 bytes         23 ns                        24 - 41 ns
+*                  256 bytes         24 - 26 ns                   43 - 46 ns
+*
+*              Copied with OS_MemCopy(), one byte at a time, messages cost more than the critical sections
+*              saved from 16 bytes on (34 - 44 ns for 16 bytes, 245 - 395 ns for 256).  Use OSQVPost() &
+*              OSQVPend() with a port's word copy & messages of up to a few hundred bytes.  Build larger
+*              messages in place with OSQVReserve()/OSQVCommit() & read them in place with
+*              OSQVPeek()/OSQVRelease().
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+#if (OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)
+/*
+*********************************************************************************************************
+*                                      ACCEPT MESSAGE FROM QUEUE
+*
+* Description: This function checks the by-value queue to see if a message is available.  Unlike
+*              OSQVPeek(), OSQVAccept() does not suspend the calling task if a message is not available.
+*
+* Arguments  : pevent        is a pointer to the event control block
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE         The call was successful and the oldest message is now
+*                                                yours to read.
+*                            OS_ERR_EVENT_TYPE   You didn't pass a pointer to a by-value queue
+*                            OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer
+*                            OS_ERR_Q_EMPTY      The queue did not contain any messages
+*                            OS_ERR_Q_BUSY       The oldest message is already being read
+*
+* Returns    : != (void *)0  is a pointer to the slot holding the oldest message.  The slot MUST be given
+*                            back with OSQVRelease() once the message has been read.
+*              == (void *)0  upon error
+*
+* Note(s)    : This function can be called from an ISR.  A message accepted by an ISR is not given back if
+*              the ISR never releases it (see OSQVPeek()  Note #2).
+*********************************************************************************************************
+*/
+
+void  *OSQVAccept (OS_EVENT  *pevent,
+                   INT8U     *perr)
+{
+    void      *pmsg;
+    OS_QV     *pqv;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {               /* Validate 'pevent'                                  */
+        *perr = OS_ERR_PEVENT_NULL;
+        return ((void *)0);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_QV) {   /* Validate event block type                      */
+        *perr = OS_ERR_EVENT_TYPE;
+        return ((void *)0);
+    }
+    OS_ENTER_CRITICAL();
+    pqv = (OS_QV *)pevent->OSEventPtr;           /* Point at queue control block                       */
+    if (pqv->OSQVEntries == 0u) {                /* See if any messages in the queue                   */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_Q_EMPTY;
+        return ((void *)0);
+    }
+    if (pqv->OSQVPeeked == OS_TRUE) {            /* See if oldest message is already being read        */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_Q_BUSY;
+        return ((void *)0);
+    }
+    pqv->OSQVPeeked = OS_TRUE;                   /* Oldest message is ours until OSQVRelease()         */
+    if (OSIntNesting > 0u) {                     /* Record who reads it, no task for an ISR            */
+        pqv->OSQVPeekTCB = (OS_TCB *)0;
+    } else {
+        pqv->OSQVPeekTCB = OSTCBCur;
+    }
+    pmsg            = (void *)pqv->OSQVOut;
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (pmsg);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   COMMIT THE RESERVED MESSAGE SLOT
+*
+* Description: This function publishes the message built in the slot obtained from OSQVReserve().  If
+*              tasks are waiting on the queue and no message is being read, the message is handed to the
+*              highest priority task waiting.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+* Returns    : OS_ERR_NONE           The call was successful and the message was published
+*              OS_ERR_Q_NOT_HELD     If no slot was reserved
+*              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a by-value queue
+*              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              OS_ERR_INT_Q_FULL     If called from an ISR and the ISR post queue is full (see OS_INT.C).
+*
+* Note(s)    : With OS_ISR_POST_DEFERRED_EN, a commit made from an ISR is only queued and is performed by
+*              the ISR post task.  The slot stays reserved until then.
+*********************************************************************************************************
+*/
+
+INT8U  OSQVCommit (OS_EVENT  *pevent)
+{
+    OS_QV     *pqv;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                     /* Validate 'pevent'                            */
+        return (OS_ERR_PEVENT_NULL);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_QV) {     /* Validate event block type                    */
+        return (OS_ERR_EVENT_TYPE);
+    }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                           /* Called from an ISR, let the ISR post task    */
+                                                       /* ... perform the commit                       */
+        return (OS_IntQPost(OS_INT_Q_TYPE_QV_COMMIT, (void *)pevent, (void *)0, 0u));
+    }
+#endif
+    OS_TRACE_POST(OS_EVENT_TYPE_QV, pevent, 0u);
+    OS_ENTER_CRITICAL();
+    pqv = (OS_QV *)pevent->OSEventPtr;                 /* Point to queue control block                 */
+    if (pqv->OSQVReserved == OS_FALSE) {               /* Make sure a slot was reserved                */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_Q_NOT_HELD);
+    }
+    pqv->OSQVReserved  = OS_FALSE;
+    pqv->OSQVIn       += pqv->OSQVMsgSize;             /* Publish the message                          */
+    if (pqv->OSQVIn == pqv->OSQVEnd) {                 /* Wrap IN ptr if we are at end of queue        */
+        pqv->OSQVIn = pqv->OSQVStart;
+    }
+    pqv->OSQVEntries++;                                /* Update the nbr of entries in the queue       */
+    if ((pevent->OSEventGrp != 0u) &&                  /* See if a task waits for the oldest message   */
+        (pqv->OSQVPeeked    == OS_FALSE)) {
+        pqv->OSQVPeeked  = OS_TRUE;                    /* Yes, hand it over                            */
+        pqv->OSQVPeekTCB = OS_EventTaskRdy(pevent, (void *)pqv->OSQVOut, OS_STAT_Q, OS_STAT_PEND_OK);
+        OS_EXIT_CRITICAL();
+        OS_Sched();                                    /* Find highest priority task ready to run      */
+        return (OS_ERR_NONE);
+    }
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   CREATE A BY-VALUE MESSAGE QUEUE
+*
+* Description: This function creates a by-value message queue if free event control blocks are available.
+*
+* Arguments  : start         is a pointer to the base address of the storage area holding the messages.
+*                            The storage area MUST be at least 'msg_size' * 'size' bytes, for example:
+*
+*                            MY_MSG  MessageStorage[size]
+*
+*              msg_size      is the size of a message (in bytes).  Messages are stored back to back so,
+*                            if they need to be aligned, 'msg_size' MUST be a multiple of that alignment
+*                            (sizeof() of a structure is).
+*
+*              size          is the number of messages the storage area can hold
+*
+* Returns    : != (OS_EVENT *)0  is a pointer to the event control clock (OS_EVENT) associated with the
+*                                created queue
+*              == (OS_EVENT *)0  if no event control blocks were available or an error was detected
+*********************************************************************************************************
+*/
+
+OS_EVENT  *OSQVCreate (void    *start,
+                       INT16U   msg_size,
+                       INT16U   size)
+{
+    OS_EVENT  *pevent;
+    OS_QV     *pqv;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (start == (void *)0) {                    /* Validate the storage area                          */
+        return ((OS_EVENT *)0);
+    }
+    if ((msg_size == 0u) ||                      /* Must hold at least one message of one byte         */
+        (size     == 0u)) {
+        return ((OS_EVENT *)0);
+    }
+#endif
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        return ((OS_EVENT *)0);                  /* ... can't CREATE from an ISR                       */
+    }
+    OS_ENTER_CRITICAL();
+    pevent = OSEventFreeList;                    /* Get next free event control block                  */
+    if (OSEventFreeList != (OS_EVENT *)0) {      /* See if pool of free ECB pool was empty             */
+        OSEventFreeList = (OS_EVENT *)OSEventFreeList->OSEventPtr;
+    }
+    OS_EXIT_CRITICAL();
+    if (pevent != (OS_EVENT *)0) {               /* See if we have an event control block              */
+        OS_ENTER_CRITICAL();
+        pqv = OSQVFreeList;                      /* Get a free queue control block                     */
+        if (pqv != (OS_QV *)0) {                 /* Were we able to get a queue control block ?        */
+            OSQVFreeList           = OSQVFreeList->OSQVPtr; /* Yes, Adjust free list pointer to next   */
+            OS_EXIT_CRITICAL();
+            pqv->OSQVStart         = (INT8U *)start;        /*      Initialize the queue               */
+            pqv->OSQVEnd           = (INT8U *)start + ((INT32U)msg_size * (INT32U)size);
+            pqv->OSQVIn            = (INT8U *)start;
+            pqv->OSQVOut           = (INT8U *)start;
+            pqv->OSQVMsgSize       = msg_size;
+            pqv->OSQVSize          = size;
+            pqv->OSQVEntries       = 0u;
+            pqv->OSQVReserved      = OS_FALSE;
+            pqv->OSQVPeeked        = OS_FALSE;
+            pqv->OSQVPeekTCB       = (OS_TCB *)0;
+            pevent->OSEventType    = OS_EVENT_TYPE_QV;
+            pevent->OSEventCnt     = 0u;
+            pevent->OSEventPtr     = pqv;
+#if OS_EVENT_NAME_EN > 0u
+            pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+            OS_EventWaitListInit(pevent);                   /*      Initialize the wait list           */
+        } else {
+            pevent->OSEventPtr = (void *)OSEventFreeList;   /* No,  Return event control block on error*/
+            OSEventFreeList    = pevent;
+            OS_EXIT_CRITICAL();
+            pevent = (OS_EVENT *)0;
+        }
+    }
+    return (pevent);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   DELETE A BY-VALUE MESSAGE QUEUE
+*
+* Description: This function deletes a by-value message queue and readies all tasks pending on the queue.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired
+*                            queue.
+*
+*              opt           determines delete options as follows:
+*                            opt == OS_DEL_NO_PEND   Delete the queue ONLY if no task pending
+*                            opt == OS_DEL_ALWAYS    Deletes the queue even if tasks are waiting.
+*                                                    In this case, all the tasks pending will be readied.
+*
+*              perr          is a pointer to an error code that can contain one of the following values:
+*                            OS_ERR_NONE             The call was successful and the queue was deleted
+*                            OS_ERR_DEL_ISR          If you tried to delete the queue from an ISR
+*                            OS_ERR_INVALID_OPT      An invalid option was specified
+*                            OS_ERR_TASK_WAITING     One or more tasks were waiting on the queue
+*                            OS_ERR_EVENT_TYPE       If you didn't pass a pointer to a by-value queue
+*                            OS_ERR_PEVENT_NULL      If 'pevent' is a NULL pointer.
+*
+* Returns    : pevent        upon error
+*              (OS_EVENT *)0 if the queue was successfully deleted.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of
+*                 the queue MUST check the return code of OSQVPeek().  Slots still reserved or being read
+*                 MUST NOT be accessed once the queue is deleted.
+*              2) All tasks that were waiting for the queue will be readied and returned an
+*                 OS_ERR_PEND_ABORT if OSQVDel() was called with OS_DEL_ALWAYS
+*              3) The storage area of the queue belongs to the application and can be reused.
+*********************************************************************************************************
+*/
+
+OS_EVENT  *OSQVDel (OS_EVENT  *pevent,
+                    INT8U      opt,
+                    INT8U     *perr)
+{
+    BOOLEAN    tasks_waiting;
+    OS_EVENT  *pevent_return;
+    OS_QV     *pqv;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                         /* Validate 'pevent'                        */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (pevent);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_QV) {         /* Validate event block type                */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (pevent);
+    }
+    if (OSIntNesting > 0u) {                               /* See if called from ISR ...               */
+        *perr = OS_ERR_DEL_ISR;                            /* ... can't DELETE from an ISR             */
+        return (pevent);
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventGrp != 0u) {                        /* See if any tasks waiting on queue        */
+        tasks_waiting = OS_TRUE;                           /* Yes                                      */
+    } else {
+        tasks_waiting = OS_FALSE;                          /* No                                       */
+    }
+    switch (opt) {
+        case OS_DEL_NO_PEND:                               /* Delete queue only if no task waiting     */
+             if (tasks_waiting == OS_FALSE) {
+#if OS_EVENT_NAME_EN > 0u
+                 pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+                 pqv                    = (OS_QV *)pevent->OSEventPtr; /* Return OS_QV to free list    */
+                 pqv->OSQVPtr           = OSQVFreeList;
+                 OSQVFreeList           = pqv;
+                 pevent->OSEventType    = OS_EVENT_TYPE_UNUSED;
+                 pevent->OSEventPtr     = OSEventFreeList; /* Return Event Control Block to free list  */
+                 pevent->OSEventCnt     = 0u;
+                 OSEventFreeList        = pevent;          /* Get next free event control block        */
+                 OS_EXIT_CRITICAL();
+                 *perr                  = OS_ERR_NONE;
+                 pevent_return          = (OS_EVENT *)0;   /* Queue has been deleted                   */
+             } else {
+                 OS_EXIT_CRITICAL();
+                 *perr                  = OS_ERR_TASK_WAITING;
+                 pevent_return          = pevent;
+             }
+             break;
+
+        case OS_DEL_ALWAYS:                                /* Always delete the queue                  */
+             while (pevent->OSEventGrp != 0u) {            /* Ready ALL tasks waiting for queue        */
+                 (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_Q, OS_STAT_PEND_ABORT);
+             }
+#if OS_EVENT_NAME_EN > 0u
+             pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+             pqv                    = (OS_QV *)pevent->OSEventPtr;  /* Return OS_QV to free list       */
+             pqv->OSQVPtr           = OSQVFreeList;
+             OSQVFreeList           = pqv;
+             pevent->OSEventType    = OS_EVENT_TYPE_UNUSED;
+             pevent->OSEventPtr     = OSEventFreeList;     /* Return Event Control Block to free list  */
+             pevent->OSEventCnt     = 0u;
+             OSEventFreeList        = pevent;              /* Get next free event control block        */
+             OS_EXIT_CRITICAL();
+             if (tasks_waiting == OS_TRUE) {               /* Reschedule only if task(s) were waiting  */
+                 OS_Sched();                               /* Find highest priority task ready to run  */
+             }
+             *perr                  = OS_ERR_NONE;
+             pevent_return          = (OS_EVENT *)0;       /* Queue has been deleted                   */
+             break;
+
+        default:
+             OS_EXIT_CRITICAL();
+             *perr                  = OS_ERR_INVALID_OPT;
+             pevent_return          = pevent;
+             break;
+    }
+    return (pevent_return);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  WAIT FOR THE OLDEST MESSAGE OF A QUEUE
+*
+* Description: This function waits for a message to be committed to a by-value queue and returns a
+*              pointer to it, in place.  The message stays in the queue until OSQVRelease() is called.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for a message up to the amount of time specified by this argument.  If
+*                            you specify 0, however, your task will wait forever at the specified queue
+*                            or, until a message is available.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE         The call was successful and the oldest message is now
+*                                                yours to read.
+*                            OS_ERR_TIMEOUT      A message was not available within the specified 'timeout'.
+*                            OS_ERR_PEND_ABORT   The wait on the queue was aborted.
+*                            OS_ERR_EVENT_TYPE   You didn't pass a pointer to a by-value queue
+*                            OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer
+*                            OS_ERR_PEND_ISR     If you called this function from an ISR and the result
+*                                                would lead to a suspension.
+*                            OS_ERR_PEND_LOCKED  If you called this function with the scheduler is locked
+*
+* Returns    : != (void *)0  is a pointer to the slot holding the oldest message.  The slot MUST be given
+*                            back with OSQVRelease() once the message has been read.
+*              == (void *)0  if no message was obtained
+*
+* Note(s)    : 1) The task also waits when the oldest message is being read by another task, until that
+*                 task releases it (see Note #2 at the top of this file).
+*              2) Until the message is released, no other task can read from the queue.  If the task is
+*                 deleted before releasing it, OSTaskDel() ends the read and the message, still the
+*                 oldest, is handed to the next task waiting.  Nothing ends a read made by an ISR with
+*                 OSQVAccept(), or by a task that never calls OSQVRelease().
+*********************************************************************************************************
+*/
+
+void  *OSQVPeek (OS_EVENT  *pevent,
+                 INT32U     timeout,
+                 INT8U     *perr)
+{
+    void      *pmsg;
+    OS_QV     *pqv;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {               /* Validate 'pevent'                                  */
+        *perr = OS_ERR_PEVENT_NULL;
+        return ((void *)0);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_QV) {   /* Validate event block type                      */
+        *perr = OS_ERR_EVENT_TYPE;
+        return ((void *)0);
+    }
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        *perr = OS_ERR_PEND_ISR;                 /* ... can't PEND from an ISR                         */
+        return ((void *)0);
+    }
+    if (OSLockNesting > 0u) {                    /* See if called with scheduler locked ...            */
+        *perr = OS_ERR_PEND_LOCKED;              /* ... can't PEND when locked                         */
+        return ((void *)0);
+    }
+    OS_TRACE_PEND(OS_EVENT_TYPE_QV, pevent, timeout);
+    OS_ENTER_CRITICAL();
+    pqv = (OS_QV *)pevent->OSEventPtr;           /* Point at queue control block                       */
+    if ((pqv->OSQVEntries >  0u) &&              /* See if the oldest message is available             */
+        (pqv->OSQVPeeked  == OS_FALSE)) {
+        pqv->OSQVPeeked  = OS_TRUE;              /* Yes, it's ours until OSQVRelease()                 */
+        pqv->OSQVPeekTCB = OSTCBCur;
+        pmsg             = (void *)pqv->OSQVOut;
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_NONE;
+        return (pmsg);
+    }
+    OSTCBCur->OSTCBStat     |= OS_STAT_Q;        /* Task will have to pend for a message               */
+    OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur, timeout);        /* Load timeout into TCB                              */
+#else
+    OSTCBCur->OSTCBDly       = timeout;          /* Load timeout into TCB                              */
+#endif
+    OS_EventTaskWait(pevent);                    /* Suspend task until event or timeout occurs         */
+    OS_EXIT_CRITICAL();
+    OS_Sched();                                  /* Find next highest priority task ready to run       */
+    OS_ENTER_CRITICAL();
+    switch (OSTCBCur->OSTCBStatPend) {                /* See if we timed-out or aborted                */
+        case OS_STAT_PEND_OK:                         /* Slot handed over by OSQVCommit()/OSQVRelease()*/
+             pmsg =  OSTCBCur->OSTCBMsg;
+            *perr =  OS_ERR_NONE;
+             break;
+
+        case OS_STAT_PEND_ABORT:
+             pmsg = (void *)0;
+            *perr =  OS_ERR_PEND_ABORT;               /* Indicate that we aborted                      */
+             break;
+
+        case OS_STAT_PEND_TO:
+        default:
+             OS_EventTaskRemove(OSTCBCur, pevent);
+             pmsg = (void *)0;
+            *perr =  OS_ERR_TIMEOUT;                  /* Indicate that we didn't get event within TO   */
+             break;
+    }
+    OSTCBCur->OSTCBStat          =  OS_STAT_RDY;      /* Set   task  status to ready                   */
+    OSTCBCur->OSTCBStatPend      =  OS_STAT_PEND_OK;  /* Clear pend  status                            */
+    OSTCBCur->OSTCBEventPtr      = (OS_EVENT  *)0;    /* Clear event pointers                          */
+#if (OS_EVENT_MULTI_EN > 0u)
+    OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
+#endif
+    OSTCBCur->OSTCBMsg           = (void      *)0;    /* Clear  received message                       */
+    OS_EXIT_CRITICAL();
+    return (pmsg);                                    /* Return slot of the message                    */
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 WAIT FOR A MESSAGE & COPY IT OUT OF A QUEUE
+*
+* Description: This function waits for a message to be committed to a by-value queue, copies it to the
+*              caller's buffer and removes it from the queue, as OSQVPeek() and OSQVRelease() would.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              pmsg          is a pointer to the buffer the message is copied to, 'msg_size' bytes (see
+*                            OSQVCreate()).
+*
+*              timeout       is an optional timeout period (in clock ticks), see OSQVPeek().
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE         The call was successful and the message was copied.
+*                            OS_ERR_TIMEOUT      A message was not available within the specified 'timeout'.
+*                            OS_ERR_PEND_ABORT   The wait on the queue was aborted.
+*                            OS_ERR_EVENT_TYPE   You didn't pass a pointer to a by-value queue
+*                            OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer
+*                            OS_ERR_PEND_ISR     If you called this function from an ISR and the result
+*                                                would lead to a suspension.
+*                            OS_ERR_PEND_LOCKED  If you called this function with the scheduler is locked
+*
+* Returns    : none
+*
+* Note(s)    : 1) When a message is available, it is copied & removed in one critical section (see Note #4
+*                 at the top of this file).  Otherwise, the task waits as in OSQVPeek() & releases the
+*                 message once copied.
+*********************************************************************************************************
+*/
+
+void  OSQVPend (OS_EVENT  *pevent,
+                void      *pmsg,
+                INT32U     timeout,
+                INT8U     *perr)
+{
+    void      *pslot;
+    OS_QV     *pqv;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {               /* Validate 'pevent'                                  */
+        *perr = OS_ERR_PEVENT_NULL;
+        return;
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_QV) {   /* Validate event block type                      */
+        *perr = OS_ERR_EVENT_TYPE;
+        return;
+    }
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        *perr = OS_ERR_PEND_ISR;                 /* ... can't PEND from an ISR                         */
+        return;
+    }
+    if (OSLockNesting > 0u) {                    /* See if called with scheduler locked ...            */
+        *perr = OS_ERR_PEND_LOCKED;              /* ... can't PEND when locked                         */
+        return;
+    }
+    OS_ENTER_CRITICAL();
+    pqv = (OS_QV *)pevent->OSEventPtr;           /* Point at queue control block                       */
+    if ((pqv->OSQVEntries >  0u) &&              /* See if the oldest message is available             */
+        (pqv->OSQVPeeked  == OS_FALSE)) {
+        OS_QV_MSG_COPY(pmsg, pqv->OSQVOut, pqv->OSQVMsgSize);  /* Yes, copy it out & remove it          */
+        pqv->OSQVOut += pqv->OSQVMsgSize;
+        if (pqv->OSQVOut == pqv->OSQVEnd) {      /* Wrap OUT ptr if we are at end of queue             */
+            pqv->OSQVOut = pqv->OSQVStart;
+        }
+        pqv->OSQVEntries--;                      /* No task waits: the queue held a message            */
+        OS_EXIT_CRITICAL();
+        OS_TRACE_PEND(OS_EVENT_TYPE_QV, pevent, timeout);
+        *perr = OS_ERR_NONE;
+        return;
+    }
+    OS_EXIT_CRITICAL();
+    pslot = OSQVPeek(pevent, timeout, perr);     /* Wait for the message (see Note #1)                 */
+    if (pslot != (void *)0) {
+        OS_QV_MSG_COPY(pmsg, pslot, pqv->OSQVMsgSize);
+        (void)OSQVRelease(pevent);
+    }
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   COPY A MESSAGE INTO A QUEUE & POST IT
+*
+* Description: This function copies the caller's message into the next free slot of a by-value queue and
+*              publishes it, as OSQVReserve() and OSQVCommit() would.  This function never waits.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              pmsg          is a pointer to the message, 'msg_size' bytes (see OSQVCreate()).
+*
+* Returns    : OS_ERR_NONE           The call was successful and the message was published
+*              OS_ERR_Q_FULL         If the queue has no free slot
+*              OS_ERR_Q_BUSY         If a slot is already reserved (see Note #2 at the top of this file)
+*              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a by-value queue
+*              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              OS_ERR_INT_Q_FULL     If called from an ISR and the ISR post queue is full (see OS_INT.C).
+*
+* Note(s)    : 1) The message is copied & published in one critical section (see Note #4 at the top of this
+*                 file).
+*
+*              2) This function can be called from an ISR.  With OS_ISR_POST_DEFERRED_EN, the ISR copies the
+*                 message into a reserved slot & only the commit is queued (see OSQVCommit()).
+*********************************************************************************************************
+*/
+
+INT8U  OSQVPost (OS_EVENT  *pevent,
+                 void      *pmsg)
+{
+    OS_QV     *pqv;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                     /* Validate 'pevent'                            */
+        return (OS_ERR_PEVENT_NULL);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_QV) {     /* Validate event block type                    */
+        return (OS_ERR_EVENT_TYPE);
+    }
+    OS_TRACE_POST(OS_EVENT_TYPE_QV, pevent, 0u);
+    OS_ENTER_CRITICAL();
+    pqv = (OS_QV *)pevent->OSEventPtr;                 /* Point to queue control block                 */
+    if (pqv->OSQVReserved == OS_TRUE) {                /* See if a slot is already being built         */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_Q_BUSY);
+    }
+    if (pqv->OSQVEntries >= pqv->OSQVSize) {           /* Make sure queue is not full                  */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_Q_FULL);
+    }
+    OS_QV_MSG_COPY(pqv->OSQVIn, pmsg, pqv->OSQVMsgSize);    /* Copy the message into its slot       */
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                           /* Called from an ISR, let the ISR post task    */
+        pqv->OSQVReserved = OS_TRUE;                   /* ... commit the slot (see Note #2)            */
+        OS_EXIT_CRITICAL();
+        return (OS_IntQPost(OS_INT_Q_TYPE_QV_COMMIT, (void *)pevent, (void *)0, 0u));
+    }
+#endif
+    pqv->OSQVIn += pqv->OSQVMsgSize;                   /* Publish the message                          */
+    if (pqv->OSQVIn == pqv->OSQVEnd) {                 /* Wrap IN ptr if we are at end of queue        */
+        pqv->OSQVIn = pqv->OSQVStart;
+    }
+    pqv->OSQVEntries++;                                /* Update the nbr of entries in the queue       */
+    if ((pevent->OSEventGrp != 0u) &&                  /* See if a task waits for the oldest message   */
+        (pqv->OSQVPeeked    == OS_FALSE)) {
+        pqv->OSQVPeeked  = OS_TRUE;                    /* Yes, hand it over                            */
+        pqv->OSQVPeekTCB = OS_EventTaskRdy(pevent, (void *)pqv->OSQVOut, OS_STAT_Q, OS_STAT_PEND_OK);
+        OS_EXIT_CRITICAL();
+        OS_Sched();                                    /* Find highest priority task ready to run      */
+        return (OS_ERR_NONE);
+    }
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    RELEASE THE OLDEST MESSAGE SLOT
+*
+* Description: This function gives back the slot of the message obtained from OSQVPeek() or OSQVAccept(),
+*              removing the message from the queue.  If tasks are waiting on the queue and another message
+*              is available, it is handed to the highest priority task waiting.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+* Returns    : OS_ERR_NONE           The call was successful and the slot was given back
+*              OS_ERR_Q_NOT_HELD     If no message was being read
+*              OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a by-value queue
+*              OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer
+*              OS_ERR_INT_Q_FULL     If called from an ISR and the ISR post queue is full (see OS_INT.C).
+*
+* Note(s)    : With OS_ISR_POST_DEFERRED_EN, a release made from an ISR is only queued and is performed
+*              by the ISR post task.
+*********************************************************************************************************
+*/
+
+INT8U  OSQVRelease (OS_EVENT  *pevent)
+{
+    OS_QV     *pqv;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                     /* Validate 'pevent'                            */
+        return (OS_ERR_PEVENT_NULL);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_QV) {     /* Validate event block type                    */
+        return (OS_ERR_EVENT_TYPE);
+    }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                           /* Called from an ISR, let the ISR post task    */
+                                                       /* ... perform the release                      */
+        return (OS_IntQPost(OS_INT_Q_TYPE_QV_RELEASE, (void *)pevent, (void *)0, 0u));
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    pqv = (OS_QV *)pevent->OSEventPtr;                 /* Point to queue control block                 */
+    if (pqv->OSQVPeeked == OS_FALSE) {                 /* Make sure a message was being read           */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_Q_NOT_HELD);
+    }
+    pqv->OSQVPeeked  = OS_FALSE;
+    pqv->OSQVPeekTCB = (OS_TCB *)0;
+    pqv->OSQVOut    += pqv->OSQVMsgSize;               /* Remove the message                           */
+    if (pqv->OSQVOut == pqv->OSQVEnd) {                /* Wrap OUT ptr if we are at end of queue       */
+        pqv->OSQVOut = pqv->OSQVStart;
+    }
+    pqv->OSQVEntries--;                                /* Update the nbr of entries in the queue       */
+    if ((pevent->OSEventGrp != 0u) &&                  /* See if a task waits for the next message     */
+        (pqv->OSQVEntries   >  0u)) {
+        pqv->OSQVPeeked  = OS_TRUE;                    /* Yes, hand it over                            */
+        pqv->OSQVPeekTCB = OS_EventTaskRdy(pevent, (void *)pqv->OSQVOut, OS_STAT_Q, OS_STAT_PEND_OK);
+        OS_EXIT_CRITICAL();
+        OS_Sched();                                    /* Find highest priority task ready to run      */
+        return (OS_ERR_NONE);
+    }
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     RESERVE THE NEXT MESSAGE SLOT
+*
+* Description: This function reserves the next free slot of a by-value queue for the caller to build a
+*              message in.  The message is published by OSQVCommit().  This function never waits.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE         The call was successful and the slot is yours to fill.
+*                            OS_ERR_Q_FULL       If the queue has no free slot
+*                            OS_ERR_Q_BUSY       If a slot is already reserved (see Note #2 at the top of
+*                                                this file)
+*                            OS_ERR_EVENT_TYPE   You didn't pass a pointer to a by-value queue
+*                            OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer
+*
+* Returns    : != (void *)0  is a pointer to the slot, 'msg_size' bytes (see OSQVCreate()).
+*              == (void *)0  upon error
+*
+* Note(s)    : This function can be called from an ISR.
+*********************************************************************************************************
+*/
+
+void  *OSQVReserve (OS_EVENT  *pevent,
+                    INT8U     *perr)
+{
+    void      *pmsg;
+    OS_QV     *pqv;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {               /* Validate 'pevent'                                  */
+        *perr = OS_ERR_PEVENT_NULL;
+        return ((void *)0);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_QV) {   /* Validate event block type                      */
+        *perr = OS_ERR_EVENT_TYPE;
+        return ((void *)0);
+    }
+    OS_ENTER_CRITICAL();
+    pqv = (OS_QV *)pevent->OSEventPtr;           /* Point at queue control block                       */
+    if (pqv->OSQVReserved == OS_TRUE) {          /* See if a slot is already being built               */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_Q_BUSY;
+        return ((void *)0);
+    }
+    if (pqv->OSQVEntries >= pqv->OSQVSize) {     /* Make sure queue is not full                        */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_Q_FULL;
+        return ((void *)0);
+    }
+    pqv->OSQVReserved = OS_TRUE;                 /* Slot at IN is ours until OSQVCommit()              */
+    pmsg              = (void *)pqv->OSQVIn;
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (pmsg);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                BY-VALUE QUEUE MODULE INITIALIZATION
+*
+* Description : This function is called by uC/OS-II to initialize the by-value message queue module.  Your
+*               application MUST NOT call this function.
+*
+* Arguments   :  none
+*
+* Returns     : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+void  OS_QVInit (void)
+{
+#if OS_MAX_QVS == 1u
+    OSQVFreeList          = &OSQVTbl[0];             /* Only ONE queue!                                */
+    OSQVFreeList->OSQVPtr = (OS_QV *)0;
+#endif
+
+#if OS_MAX_QVS >= 2u
+    INT16U   ix;
+    INT16U   ix_next;
+    OS_QV   *pqv1;
+    OS_QV   *pqv2;
+
+
+
+    OS_MemClr((INT8U *)&OSQVTbl[0], sizeof(OSQVTbl));    /* Clear the queue table                      */
+    for (ix = 0u; ix < (OS_MAX_QVS - 1u); ix++) {        /* Init. list of free QUEUE control blocks    */
+        ix_next = ix + 1u;
+        pqv1 = &OSQVTbl[ix];
+        pqv2 = &OSQVTbl[ix_next];
+        pqv1->OSQVPtr = pqv2;
+    }
+    pqv1         = &OSQVTbl[ix];
+    pqv1->OSQVPtr = (OS_QV *)0;
+    OSQVFreeList  = &OSQVTbl[0];
+#endif
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                END THE READS OF A TASK BEING DELETED
+*
+* Description : This function is called by OSTaskDel() to end the reads the task being deleted has not
+*               released.  The message read stays the oldest of its queue and, if tasks are waiting on the
+*               queue, it is handed to the highest priority task waiting.
+*
+* Arguments   : ptcb      is a pointer to the OS_TCB of the task being deleted
+*
+* Returns     : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when calling this function.  The caller
+*                 reschedules.
+*********************************************************************************************************
+*/
+
+void  OS_QVTaskDel (OS_TCB  *ptcb)
+{
+    OS_EVENT  *pevent;
+    OS_QV     *pqv;
+    INT16U     ix;
+
+
+
+    pevent = &OSEventTbl[0];
+    for (ix = 0u; ix < OS_MAX_EVENTS; ix++) {        /* Look for the by-value queues read by the task   */
+        if (pevent->OSEventType == OS_EVENT_TYPE_QV) {
+            pqv = (OS_QV *)pevent->OSEventPtr;
+            if ((pqv->OSQVPeeked  == OS_TRUE) &&
+                (pqv->OSQVPeekTCB == ptcb)) {
+                pqv->OSQVPeeked  = OS_FALSE;         /* End the read, the message stays in the queue    */
+                pqv->OSQVPeekTCB = (OS_TCB *)0;
+                if (pevent->OSEventGrp != 0u) {      /* See if a task waits for the message             */
+                    pqv->OSQVPeeked  = OS_TRUE;      /* Yes, hand it over                               */
+                    pqv->OSQVPeekTCB = OS_EventTaskRdy(pevent, (void *)pqv->OSQVOut, OS_STAT_Q, OS_STAT_PEND_OK);
+                }
+            }
+        }
+        pevent++;
+    }
+}
+#endif                                               /* OS_QV_EN                                       */
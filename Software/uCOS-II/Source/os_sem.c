@@ -66,7 +66,7 @@ INT16U  OSSemAccept (OS_EVENT *pevent)
         return (0u);
     }
     OS_ENTER_CRITICAL();
-    cnt = pevent->OSEventCnt;
+    cnt = (INT16U)pevent->OSEventCnt;
     if (cnt > 0u) {                                   /* See if resource is available                  */
         pevent->OSEventCnt--;                         /* Yes, decrement semaphore and notify caller    */
     }
@@ -327,6 +327,7 @@ void  OSSemPend (OS_EVENT  *pevent,
         *perr = OS_ERR_PEND_LOCKED;                   /* ... can't PEND when locked                    */
         return;
     }
+    OS_TRACE_PEND(OS_EVENT_TYPE_SEM, pevent, timeout);
     OS_ENTER_CRITICAL();
     if (pevent->OSEventCnt > 0u) {                    /* If sem. is positive, resource available ...   */
         pevent->OSEventCnt--;                         /* ... decrement semaphore only if positive.     */
@@ -337,7 +338,11 @@ void  OSSemPend (OS_EVENT  *pevent,
                                                       /* Otherwise, must wait until event occurs       */
     OSTCBCur->OSTCBStat     |= OS_STAT_SEM;           /* Resource not available, pend on semaphore     */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListInsert(OSTCBCur, timeout);             /* Store pend timeout in TCB                     */
+#else
     OSTCBCur->OSTCBDly       = timeout;               /* Store pend timeout in TCB                     */
+#endif
     OS_EventTaskWait(pevent);                         /* Suspend task until event or timeout occurs    */
     OS_EXIT_CRITICAL();
     OS_Sched();                                       /* Find next highest priority task ready         */
@@ -473,6 +478,10 @@ INT8U  OSSemPendAbort (OS_EVENT  *pevent,
 *                                  OSSemAccept() or OSSemPend().
 *              OS_ERR_EVENT_TYPE   If you didn't pass a pointer to a semaphore
 *              OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer.
+*              OS_ERR_INT_Q_FULL   If called from an ISR and the ISR post queue is full (see OS_INT.C).
+*
+* Note(s)    : 1) With OS_ISR_POST_DEFERRED_EN, a post made from an ISR is only queued.  The ISR post
+*                 task performs it later.
 *********************************************************************************************************
 */
 
@@ -492,6 +501,13 @@ INT8U  OSSemPost (OS_EVENT *pevent)
     if (pevent->OSEventType != OS_EVENT_TYPE_SEM) {   /* Validate event block type                     */
         return (OS_ERR_EVENT_TYPE);
     }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNesting > 0u) {                          /* Called from an ISR, let the ISR post task     */
+                                                      /* ... perform the post                          */
+        return (OS_IntQPost(OS_INT_Q_TYPE_SEM, (void *)pevent, (void *)0, 0u));
+    }
+#endif
+    OS_TRACE_POST(OS_EVENT_TYPE_SEM, pevent, 0u);
     OS_ENTER_CRITICAL();
     if (pevent->OSEventGrp != 0u) {                   /* See if any task waiting for semaphore         */
                                                       /* Ready HPT waiting on event                    */
@@ -533,7 +549,7 @@ INT8U  OSSemPost (OS_EVENT *pevent)
 INT8U  OSSemQuery (OS_EVENT     *pevent,
                    OS_SEM_DATA  *p_sem_data)
 {
-    INT8U       i;
+    INT16U      i;
     OS_PRIO    *psrc;
     OS_PRIO    *pdest;
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
@@ -560,7 +576,12 @@ INT8U  OSSemQuery (OS_EVENT     *pevent,
     for (i = 0u; i < OS_EVENT_TBL_SIZE; i++) {
         *pdest++ = *psrc++;
     }
-    p_sem_data->OSCnt = pevent->OSEventCnt;                /* Get semaphore count                      */
+#if OS_LOWEST_PRIO > 254u
+    for (i = 0u; i < OS_EVENT_GRP_TBL_SIZE; i++) {
+        p_sem_data->OSEventGrpTbl[i] = pevent->OSEventGrpTbl[i];
+    }
+#endif
+    p_sem_data->OSCnt = (INT16U)pevent->OSEventCnt;        /* Get semaphore count                      */
     OS_EXIT_CRITICAL();
     return (OS_ERR_NONE);
 }
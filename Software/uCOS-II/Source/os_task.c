@@ -27,6 +27,108 @@
 #include <ucos_ii.h>
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_CREATE_EN > 0u) || (OS_TASK_CREATE_EXT_EN > 0u)
+static  INT8U    OS_TaskCreate(void (*task)(void *p_arg), void *p_arg, OS_STK *ptos, OS_PRIO_NBR prio,
+                               INT16U id, OS_STK *pbos, INT32U stk_size, void *pext, INT16U opt,
+                               INT32U deadline, INT32U period);
+
+#if OS_SCHED_RR_EN > 0u
+static  BOOLEAN  OS_TaskPrioIsSys(OS_PRIO_NBR prio);
+#endif
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     SET THE CORE AFFINITY OF A TASK
+*
+* Description: This function restricts the cores a task may run on.  If the task's current core is not in
+*              the new set, the task is moved to the core of the set that has the fewest tasks.
+*
+* Arguments  : prio     is the priority of the task.  If you specify OS_PRIO_SELF, the affinity of the
+*                       calling task is set.
+*
+*              msk      is the set of cores the task may run on (bit 'n' set == core 'n').
+*
+* Returns    : OS_ERR_NONE            if the call was successful
+*              OS_ERR_PRIO_INVALID    if the priority you specify is higher that the maximum allowed
+*                                     (i.e. >= OS_LOWEST_PRIO)
+*              OS_ERR_TASK_AFFINITY   if 'msk' contains none of the cores of the system or, if you tried
+*                                     to change the affinity of the idle task.
+*              OS_ERR_TASK_NOT_EXIST  if the task does not exist or is assigned to a Mutex PIP.
+*
+* Note(s)    : 1) A task running on another core is moved by that core the next time it reschedules,
+*                 which it is forced to do right away with OS_CPU_CoreSignal().
+*              2) A task calling this function to leave its own core is switched out immediately, unless
+*                 the scheduler is locked.
+*********************************************************************************************************
+*/
+
+#if OS_SMP_EN > 0u
+INT8U  OSTaskAffinitySet (OS_PRIO_NBR  prio,
+                          OS_CORE_MSK  msk)
+{
+    OS_TCB    *ptcb;
+    INT8U      core;
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    if (prio == OS_TASK_IDLE_PRIO) {                        /* Idle tasks stay on their own core        */
+        return (OS_ERR_TASK_AFFINITY);
+    }
+#if OS_ARG_CHK_EN > 0u
+    if (prio >= OS_LOWEST_PRIO) {
+        if (prio != OS_PRIO_SELF) {
+            return (OS_ERR_PRIO_INVALID);
+        }
+    }
+#endif
+    msk &= OS_CORE_MSK_ALL;
+    if (msk == 0u) {                                        /* Task must be able to run somewhere       */
+        return (OS_ERR_TASK_AFFINITY);
+    }
+    OS_ENTER_CRITICAL();
+    if (prio == OS_PRIO_SELF) {                             /* See if changing self                     */
+        ptcb = OSTCBCur;
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+    if (ptcb == (OS_TCB *)0) {                              /* Task to change must exist                */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_NOT_EXIST);
+    }
+    if (ptcb == OS_TCB_RESERVED) {                          /* Must not be assigned to Mutex            */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_NOT_EXIST);
+    }
+    ptcb->OSTCBCoreMsk = msk;
+    core               = ptcb->OSTCBCore;
+    if ((msk & ((OS_CORE_MSK)1u << core)) != 0u) {          /* Task may stay on its core                */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_NONE);
+    }
+    if (ptcb != OSCoreTbl[core].OSCoreTCBCur) {             /* Not running: move it right away          */
+        OS_TaskCoreSet(ptcb, OS_CoreSelect(msk));
+    } else if (core != OS_CPU_CoreIdGet()) {                /* Running elsewhere: its core moves it     */
+        OS_CPU_CoreSignal(core);
+    }
+    OS_EXIT_CRITICAL();
+    if (OSRunning == OS_TRUE) {
+        OS_Sched();                                         /* Running here: switch to another task     */
+    }
+    return (OS_ERR_NONE);
+}
+#endif
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -50,8 +152,8 @@
 */
 
 #if OS_TASK_CHANGE_PRIO_EN > 0u
-INT8U  OSTaskChangePrio (INT8U  oldprio,
-                         INT8U  newprio)
+INT8U  OSTaskChangePrio (OS_PRIO_NBR  oldprio,
+                         OS_PRIO_NBR  newprio)
 {
 #if (OS_EVENT_EN)
     OS_EVENT  *pevent;
@@ -60,13 +162,7 @@ INT8U  OSTaskChangePrio (INT8U  oldprio,
 #endif
 #endif
     OS_TCB    *ptcb;
-    INT8U      y_new;
-    INT8U      x_new;
-    INT8U      y_old;
-    OS_PRIO    bity_new;
-    OS_PRIO    bitx_new;
-    OS_PRIO    bity_old;
-    OS_PRIO    bitx_old;
+    BOOLEAN    rdy;
 #if OS_CRITICAL_METHOD == 3u
     OS_CPU_SR  cpu_sr = 0u;                                 /* Storage for CPU status register         */
 #endif
@@ -89,9 +185,11 @@ INT8U  OSTaskChangePrio (INT8U  oldprio,
         return (OS_ERR_PRIO_EXIST);
     }
     if (oldprio == OS_PRIO_SELF) {                          /* See if changing self                    */
-        oldprio = OSTCBCur->OSTCBPrio;                      /* Yes, get priority                       */
+        ptcb    = OSTCBCur;                                 /* Yes, get TCB and priority               */
+        oldprio = ptcb->OSTCBPrio;
+    } else {
+        ptcb = OSTCBPrioTbl[oldprio];
     }
-    ptcb = OSTCBPrioTbl[oldprio];
     if (ptcb == (OS_TCB *)0) {                              /* Does task to change exist?              */
         OS_EXIT_CRITICAL();                                 /* No, can't change its priority!          */
         return (OS_ERR_PRIO);
@@ -100,63 +198,64 @@ INT8U  OSTaskChangePrio (INT8U  oldprio,
         OS_EXIT_CRITICAL();                                 /* No, can't change its priority!          */
         return (OS_ERR_TASK_NOT_EXIST);
     }
-#if OS_LOWEST_PRIO <= 63u
-    y_new                 = (INT8U)(newprio >> 3u);         /* Yes, compute new TCB fields             */
-    x_new                 = (INT8U)(newprio & 0x07u);
+    OS_PrioTblRemove(ptcb, oldprio);                        /* Remove TCB from old priority            */
+    rdy = OS_FALSE;
+#if OS_SCHED_RR_EN > 0u
+    if (ptcb->OSTCBRdyNext != (OS_TCB *)0) {                /* If task is ready make it not            */
 #else
-    y_new                 = (INT8U)((INT8U)(newprio >> 4u) & 0x0Fu);
-    x_new                 = (INT8U)(newprio & 0x0Fu);
-#endif
-    bity_new              = (OS_PRIO)(1uL << y_new);
-    bitx_new              = (OS_PRIO)(1uL << x_new);
-
-    OSTCBPrioTbl[oldprio] = (OS_TCB *)0;                    /* Remove TCB from old priority            */
-    OSTCBPrioTbl[newprio] =  ptcb;                          /* Place pointer to TCB @ new priority     */
-    y_old                 =  ptcb->OSTCBY;
-    bity_old              =  ptcb->OSTCBBitY;
-    bitx_old              =  ptcb->OSTCBBitX;
-    if ((OSRdyTbl[y_old] &   bitx_old) != 0u) {             /* If task is ready make it not            */
-         OSRdyTbl[y_old] &= (OS_PRIO)~bitx_old;
-         if (OSRdyTbl[y_old] == 0u) {
-             OSRdyGrp &= (OS_PRIO)~bity_old;
-         }
-         OSRdyGrp        |= bity_new;                       /* Make new priority ready to run          */
-         OSRdyTbl[y_new] |= bitx_new;
+    if ((OS_RDY_TBL(ptcb)[ptcb->OSTCBY] & ptcb->OSTCBBitX) != 0u) { /* If task is ready make it not    */
+#endif
+         OS_RdyListRemove(ptcb);
+         rdy = OS_TRUE;
     }
 
 #if (OS_EVENT_EN)
     pevent = ptcb->OSTCBEventPtr;
     if (pevent != (OS_EVENT *)0) {
-        pevent->OSEventTbl[y_old] &= (OS_PRIO)~bitx_old;    /* Remove old task prio from wait list     */
-        if (pevent->OSEventTbl[y_old] == 0u) {
-            pevent->OSEventGrp    &= (OS_PRIO)~bity_old;
-        }
-        pevent->OSEventGrp        |= bity_new;              /* Add    new task prio to   wait list     */
-        pevent->OSEventTbl[y_new] |= bitx_new;
+        OS_EventWaitBitClr(ptcb, pevent);                   /* Remove old task prio from wait list     */
     }
 #if (OS_EVENT_MULTI_EN > 0u)
     if (ptcb->OSTCBEventMultiPtr != (OS_EVENT **)0) {
         pevents =  ptcb->OSTCBEventMultiPtr;
         pevent  = *pevents;
         while (pevent != (OS_EVENT *)0) {
-            pevent->OSEventTbl[y_old] &= (OS_PRIO)~bitx_old;   /* Remove old task prio from wait lists */
-            if (pevent->OSEventTbl[y_old] == 0u) {
-                pevent->OSEventGrp    &= (OS_PRIO)~bity_old;
-            }
-            pevent->OSEventGrp        |= bity_new;          /* Add    new task prio to   wait lists    */
-            pevent->OSEventTbl[y_new] |= bitx_new;
+            OS_EventWaitBitClr(ptcb, pevent);               /* Remove old task prio from wait lists    */
             pevents++;
-            pevent                     = *pevents;
+            pevent  = *pevents;
         }
     }
 #endif
 #endif
 
-    ptcb->OSTCBPrio = newprio;                              /* Set new task priority                   */
-    ptcb->OSTCBY    = y_new;
-    ptcb->OSTCBX    = x_new;
-    ptcb->OSTCBBitY = bity_new;
-    ptcb->OSTCBBitX = bitx_new;
+    OS_TCBPrioSet(ptcb, newprio);                           /* Set new task priority                   */
+#if OS_SCHED_THRESHOLD_EN > 0u
+    if ((ptcb->OSTCBThreshold >= oldprio) ||                /* Threshold follows the priority if none  */
+        (ptcb->OSTCBThreshold >  newprio)) {                /* ... or if it would be below it          */
+        ptcb->OSTCBThreshold = newprio;
+    }
+#endif
+
+#if (OS_EVENT_EN)
+    pevent = ptcb->OSTCBEventPtr;
+    if (pevent != (OS_EVENT *)0) {
+        OS_EventWaitBitSet(ptcb, pevent);                   /* Add    new task prio to   wait list     */
+    }
+#if (OS_EVENT_MULTI_EN > 0u)
+    if (ptcb->OSTCBEventMultiPtr != (OS_EVENT **)0) {
+        pevents =  ptcb->OSTCBEventMultiPtr;
+        pevent  = *pevents;
+        while (pevent != (OS_EVENT *)0) {
+            OS_EventWaitBitSet(ptcb, pevent);               /* Add    new task prio to   wait lists    */
+            pevents++;
+            pevent  = *pevents;
+        }
+    }
+#endif
+#endif
+    OS_PrioTblInsert(ptcb);                                 /* Place pointer to TCB @ new priority     */
+    if (rdy == OS_TRUE) {
+        OS_RdyListInsert(ptcb);                             /* Make new priority ready to run          */
+    }
     OS_EXIT_CRITICAL();
     if (OSRunning == OS_TRUE) {
         OS_Sched();                                         /* Find new highest priority task          */
@@ -194,7 +293,10 @@ INT8U  OSTaskChangePrio (INT8U  oldprio,
 *                       memory locations.
 *
 *              prio     is the task's priority.  A unique priority MUST be assigned to each task and the
-*                       lower the number, the higher the priority.
+*                       lower the number, the higher the priority.  When OS_SCHED_RR_EN is enabled, tasks
+*                       may share an application priority (but not a mutex' ceiling priority nor the
+*                       priority of a uC/OS-II task); they then run round-robin, each for the priority's
+*                       time quantum (see OSSchedQuantaSet()).
 *
 * Returns    : OS_ERR_NONE                      if the function was successful.
 *              OS_ERR_PRIO_EXIST                if the task priority already exist
@@ -208,19 +310,11 @@ INT8U  OSTaskChangePrio (INT8U  oldprio,
 */
 
 #if OS_TASK_CREATE_EN > 0u
-INT8U  OSTaskCreate (void   (*task)(void *p_arg),
-                     void    *p_arg,
-                     OS_STK  *ptos,
-                     INT8U    prio)
+INT8U  OSTaskCreate (void       (*task)(void *p_arg),
+                     void        *p_arg,
+                     OS_STK      *ptos,
+                     OS_PRIO_NBR  prio)
 {
-    OS_STK     *psp;
-    INT8U       err;
-#if OS_CRITICAL_METHOD == 3u                 /* Allocate storage for CPU status register               */
-    OS_CPU_SR   cpu_sr = 0u;
-#endif
-
-
-
 #ifdef OS_SAFETY_CRITICAL_IEC61508
     if (OSSafetyCriticalStartFlag == OS_TRUE) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -233,30 +327,7 @@ INT8U  OSTaskCreate (void   (*task)(void *p_arg),
         return (OS_ERR_PRIO_INVALID);
     }
 #endif
-    OS_ENTER_CRITICAL();
-    if (OSIntNesting > 0u) {                 /* Make sure we don't create the task from within an ISR  */
-        OS_EXIT_CRITICAL();
-        return (OS_ERR_TASK_CREATE_ISR);
-    }
-    if (OSTCBPrioTbl[prio] == (OS_TCB *)0) { /* Make sure task doesn't already exist at this priority  */
-        OSTCBPrioTbl[prio] = OS_TCB_RESERVED;/* Reserve the priority to prevent others from doing ...  */
-                                             /* ... the same thing until task is created.              */
-        OS_EXIT_CRITICAL();
-        psp = OSTaskStkInit(task, p_arg, ptos, 0u);             /* Initialize the task's stack         */
-        err = OS_TCBInit(prio, psp, (OS_STK *)0, 0u, 0u, (void *)0, 0u);
-        if (err == OS_ERR_NONE) {
-            if (OSRunning == OS_TRUE) {      /* Find highest priority task if multitasking has started */
-                OS_Sched();
-            }
-        } else {
-            OS_ENTER_CRITICAL();
-            OSTCBPrioTbl[prio] = (OS_TCB *)0;/* Make this priority available to others                 */
-            OS_EXIT_CRITICAL();
-        }
-        return (err);
-    }
-    OS_EXIT_CRITICAL();
-    return (OS_ERR_PRIO_EXIST);
+    return (OS_TaskCreate(task, p_arg, ptos, prio, 0u, (OS_STK *)0, 0u, (void *)0, 0u, 0u, 0u));
 }
 #endif
 /*$PAGE*/
@@ -290,7 +361,10 @@ INT8U  OSTaskCreate (void   (*task)(void *p_arg),
 *                        memory locations.  'ptos' MUST point to a valid 'free' data item.
 *
 *              prio      is the task's priority.  A unique priority MUST be assigned to each task and the
-*                        lower the number, the higher the priority.
+*                        lower the number, the higher the priority.  When OS_SCHED_RR_EN is enabled, tasks
+*                        may share an application priority (but not a mutex' ceiling priority nor the
+*                        priority of a uC/OS-II task); they then run round-robin, each for the priority's
+*                        time quantum (see OSSchedQuantaSet()).
 *
 *              id        is the task's ID (0..65535)
 *
@@ -333,24 +407,16 @@ INT8U  OSTaskCreate (void   (*task)(void *p_arg),
 */
 /*$PAGE*/
 #if OS_TASK_CREATE_EXT_EN > 0u
-INT8U  OSTaskCreateExt (void   (*task)(void *p_arg),
-                        void    *p_arg,
-                        OS_STK  *ptos,
-                        INT8U    prio,
-                        INT16U   id,
-                        OS_STK  *pbos,
-                        INT32U   stk_size,
-                        void    *pext,
-                        INT16U   opt)
+INT8U  OSTaskCreateExt (void       (*task)(void *p_arg),
+                        void        *p_arg,
+                        OS_STK      *ptos,
+                        OS_PRIO_NBR  prio,
+                        INT16U       id,
+                        OS_STK      *pbos,
+                        INT32U       stk_size,
+                        void        *pext,
+                        INT16U       opt)
 {
-    OS_STK     *psp;
-    INT8U       err;
-#if OS_CRITICAL_METHOD == 3u                 /* Allocate storage for CPU status register               */
-    OS_CPU_SR   cpu_sr = 0u;
-#endif
-
-
-
 #ifdef OS_SAFETY_CRITICAL_IEC61508
     if (OSSafetyCriticalStartFlag == OS_TRUE) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -363,35 +429,97 @@ INT8U  OSTaskCreateExt (void   (*task)(void *p_arg),
         return (OS_ERR_PRIO_INVALID);
     }
 #endif
-    OS_ENTER_CRITICAL();
-    if (OSIntNesting > 0u) {                 /* Make sure we don't create the task from within an ISR  */
-        OS_EXIT_CRITICAL();
-        return (OS_ERR_TASK_CREATE_ISR);
+    return (OS_TaskCreate(task, p_arg, ptos, prio, id, pbos, stk_size, pext, opt, 0u, 0u));
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   CREATE AN EARLIEST-DEADLINE-FIRST TASK
+*
+* Description: This function is used to have uC/OS-II manage the execution of a periodic task that is
+*              scheduled Earliest-Deadline-First.  It is identical to OSTaskCreateExt() except that the
+*              task also gets a relative deadline and a period.  Among the ready tasks of the EDF band
+*              (priorities >= OS_SCHED_EDF_PRIO), the one with the earliest absolute deadline runs.  Fixed
+*              priority tasks above the band preempt EDF tasks and tasks below the band only run when no
+*              EDF task is ready.  The priority of an EDF task still identifies the task and breaks ties
+*              between equal deadlines.
+*
+*              The first job is released when the task is created.  The task calls OSTimeDlyPeriod() at
+*              the end of each job to wait for the release of the next one.
+*
+* Arguments  : task      is a pointer to the task's code
+*
+*              p_arg     is a pointer to an optional data area which can be used to pass parameters to
+*                        the task when the task first executes.
+*
+*              ptos      is a pointer to the task's top of stack (see OSTaskCreateExt()).
+*
+*              prio      is the task's priority.  It must be unique and between OS_SCHED_EDF_PRIO and
+*                        OS_LOWEST_PRIO - 1.
+*
+*              id        is the task's ID (0..65535)
+*
+*              pbos      is a pointer to the task's bottom of stack (see OSTaskCreateExt()).
+*
+*              stk_size  is the size of the stack in number of elements.
+*
+*              pext      is a pointer to a user supplied memory location which is used as a TCB extension.
+*
+*              opt       contains additional information (or options) about the behavior of the task (see
+*                        OSTaskCreateExt()).
+*
+*              deadline  is the deadline of each job in clock ticks, relative to its release.  0 means that
+*                        the deadline is equal to the period.
+*
+*              period    is the time between two job releases in clock ticks.
+*
+* Returns    : OS_ERR_NONE                      if the function was successful.
+*              OS_ERR_PRIO_EXIST                if the task priority already exist
+*                                               (each task MUST have a unique priority).
+*              OS_ERR_PRIO_INVALID              if the priority you specify is outside the EDF band
+*              OS_ERR_TASK_PERIOD               if 'period' is 0
+*              OS_ERR_TASK_CREATE_ISR           if you tried to create a task from an ISR.
+*              OS_ERR_ILLEGAL_CREATE_RUN_TIME   if you tried to create a task after safety critical
+*                                               operation started.
+*********************************************************************************************************
+*/
+/*$PAGE*/
+#if (OS_TASK_CREATE_EXT_EN > 0u) && (OS_SCHED_EDF_EN > 0u)
+INT8U  OSTaskCreateEDF (void       (*task)(void *p_arg),
+                        void        *p_arg,
+                        OS_STK      *ptos,
+                        OS_PRIO_NBR  prio,
+                        INT16U       id,
+                        OS_STK      *pbos,
+                        INT32U       stk_size,
+                        void        *pext,
+                        INT16U       opt,
+                        INT32U       deadline,
+                        INT32U       period)
+{
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_ERR_ILLEGAL_CREATE_RUN_TIME);
     }
-    if (OSTCBPrioTbl[prio] == (OS_TCB *)0) { /* Make sure task doesn't already exist at this priority  */
-        OSTCBPrioTbl[prio] = OS_TCB_RESERVED;/* Reserve the priority to prevent others from doing ...  */
-                                             /* ... the same thing until task is created.              */
-        OS_EXIT_CRITICAL();
-
-#if (OS_TASK_STAT_STK_CHK_EN > 0u)
-        OS_TaskStkClr(pbos, stk_size, opt);                    /* Clear the task stack (if needed)     */
 #endif
 
-        psp = OSTaskStkInit(task, p_arg, ptos, opt);           /* Initialize the task's stack          */
-        err = OS_TCBInit(prio, psp, pbos, id, stk_size, pext, opt);
-        if (err == OS_ERR_NONE) {
-            if (OSRunning == OS_TRUE) {                        /* Find HPT if multitasking has started */
-                OS_Sched();
-            }
-        } else {
-            OS_ENTER_CRITICAL();
-            OSTCBPrioTbl[prio] = (OS_TCB *)0;                  /* Make this priority avail. to others  */
-            OS_EXIT_CRITICAL();
-        }
-        return (err);
+#if OS_ARG_CHK_EN > 0u
+    if (prio >= OS_LOWEST_PRIO) {            /* Make sure priority is within the EDF band              */
+        return (OS_ERR_PRIO_INVALID);
     }
-    OS_EXIT_CRITICAL();
-    return (OS_ERR_PRIO_EXIST);
+    if (prio < OS_SCHED_EDF_PRIO) {
+        return (OS_ERR_PRIO_INVALID);
+    }
+    if (period == 0u) {                      /* An EDF task must be periodic                           */
+        return (OS_ERR_TASK_PERIOD);
+    }
+#endif
+    if (deadline == 0u) {                    /* Implicit deadline: equal to the period                 */
+        deadline = period;
+    }
+    return (OS_TaskCreate(task, p_arg, ptos, prio, id, pbos, stk_size, pext, opt, deadline, period));
 }
 #endif
 /*$PAGE*/
@@ -414,6 +542,7 @@ INT8U  OSTaskCreateExt (void   (*task)(void *p_arg),
 *              OS_ERR_TASK_DEL         if the task is assigned to a Mutex PIP.
 *              OS_ERR_TASK_NOT_EXIST   if the task you want to delete does not exist.
 *              OS_ERR_TASK_DEL_ISR     if you tried to delete a task from an ISR
+*              OS_ERR_TASK_RUNNING     if the task is running on another core (OS_SMP_EN only).
 *
 * Notes      : 1) To reduce interrupt latency, OSTaskDel() 'disables' the task:
 *                    a) by making it not ready
@@ -428,11 +557,15 @@ INT8U  OSTaskCreateExt (void   (*task)(void *p_arg),
 *                 is removed from the ready list.  Incrementing the nesting counter prevents another task
 *                 from being schedule.  This means that an ISR would return to the current task which is
 *                 being deleted.  The rest of the deletion would thus be able to be completed.
+*              5) With OS_SMP_EN, the critical section is not interrupted since other cores could act on
+*                 the half deleted task.  A task running on another core cannot be deleted, suspend it or
+*                 use OSTaskDelReq() instead.  A task deleting itself switches out before releasing the
+*                 kernel spinlock, so that no other core reuses its OS_TCB while it still runs.
 *********************************************************************************************************
 */
 
 #if OS_TASK_DEL_EN > 0u
-INT8U  OSTaskDel (INT8U prio)
+INT8U  OSTaskDel (OS_PRIO_NBR prio)
 {
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
     OS_FLAG_NODE *pnode;
@@ -461,9 +594,11 @@ INT8U  OSTaskDel (INT8U prio)
 /*$PAGE*/
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                         /* See if requesting to delete self            */
-        prio = OSTCBCur->OSTCBPrio;                     /* Set priority to delete to current           */
+        ptcb = OSTCBCur;                                /* Delete the current task                     */
+        prio = ptcb->OSTCBPrio;
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
     }
-    ptcb = OSTCBPrioTbl[prio];
     if (ptcb == (OS_TCB *)0) {                          /* Task to delete must exist                   */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);
@@ -472,11 +607,15 @@ INT8U  OSTaskDel (INT8U prio)
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_DEL);
     }
-
-    OSRdyTbl[ptcb->OSTCBY] &= (OS_PRIO)~ptcb->OSTCBBitX;
-    if (OSRdyTbl[ptcb->OSTCBY] == 0u) {                 /* Make task not ready                         */
-        OSRdyGrp           &= (OS_PRIO)~ptcb->OSTCBBitY;
+#if OS_SMP_EN > 0u
+    if ((ptcb != OSTCBCur) &&                           /* Must not be running on another core         */
+        (ptcb == OSCoreTbl[ptcb->OSTCBCore].OSCoreTCBCur)) {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_RUNNING);
     }
+#endif
+
+    OS_RdyListRemove(ptcb);                             /* Make task not ready                         */
 
 #if (OS_EVENT_EN)
     if (ptcb->OSTCBEventPtr != (OS_EVENT *)0) {
@@ -494,21 +633,35 @@ INT8U  OSTaskDel (INT8U prio)
     if (pnode != (OS_FLAG_NODE *)0) {                   /* If task is waiting on event flag            */
         OS_FlagUnlink(pnode);                           /* Remove from wait list                       */
     }
+#if OS_FLAG_MULTI_EN > 0u
+    OS_FlagUnlinkMulti(ptcb);                           /* Remove from wait lists of its conditions    */
+#endif
 #endif
 
+#if (OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)
+    OS_QVTaskDel(ptcb);                                 /* End its reads of by-value queues            */
+#endif
+
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListRemove(ptcb);                            /* Prevent OSTimeTick() from updating          */
+#else
     ptcb->OSTCBDly      = 0u;                           /* Prevent OSTimeTick() from updating          */
+#endif
     ptcb->OSTCBStat     = OS_STAT_RDY;                  /* Prevent task from being resumed             */
     ptcb->OSTCBStatPend = OS_STAT_PEND_OK;
     if (OSLockNesting < 255u) {                         /* Make sure we don't context switch           */
         OSLockNesting++;
     }
+#if OS_SMP_EN == 0u
     OS_EXIT_CRITICAL();                                 /* Enabling INT. ignores next instruc.         */
     OS_Dummy();                                         /* ... Dummy ensures that INTs will be         */
     OS_ENTER_CRITICAL();                                /* ... disabled HERE!                          */
+#endif
     if (OSLockNesting > 0u) {                           /* Remove context switch lock                  */
         OSLockNesting--;
     }
     OSTaskDelHook(ptcb);                                /* Call user defined hook                      */
+    OS_TRACE_TASK_DEL(ptcb);
 
 #if OS_TASK_CREATE_EXT_EN > 0u
 #if defined(OS_TLS_TBL_SIZE) && (OS_TLS_TBL_SIZE > 0u)
@@ -517,7 +670,7 @@ INT8U  OSTaskDel (INT8U prio)
 #endif
 
     OSTaskCtr--;                                        /* One less task being managed                 */
-    OSTCBPrioTbl[prio] = (OS_TCB *)0;                   /* Clear old priority entry                    */
+    OS_PrioTblRemove(ptcb, prio);                       /* Clear old priority entry                    */
     if (ptcb->OSTCBPrev == (OS_TCB *)0) {               /* Remove from TCB chain                       */
         ptcb->OSTCBNext->OSTCBPrev = (OS_TCB *)0;
         OSTCBList                  = ptcb->OSTCBNext;
@@ -529,6 +682,13 @@ INT8U  OSTaskDel (INT8U prio)
     OSTCBFreeList       = ptcb;
 #if OS_TASK_NAME_EN > 0u
     ptcb->OSTCBTaskName = (INT8U *)(void *)"?";
+#endif
+#if OS_SMP_EN > 0u
+    OSCoreTbl[ptcb->OSTCBCore].OSCoreTaskCtr--;
+    ptcb->OSTCBCoreMsk  = OS_CORE_MSK_ALL;              /* Deleted task must not be moved to a core    */
+    if (ptcb == OSTCBCur) {                             /* Deleting self: switch out with lock held    */
+        OS_Sched();
+    }
 #endif
     OS_EXIT_CRITICAL();
     if (OSRunning == OS_TRUE) {
@@ -585,7 +745,7 @@ INT8U  OSTaskDel (INT8U prio)
 */
 /*$PAGE*/
 #if OS_TASK_DEL_EN > 0u
-INT8U  OSTaskDelReq (INT8U prio)
+INT8U  OSTaskDelReq (OS_PRIO_NBR prio)
 {
     INT8U      stat;
     OS_TCB    *ptcb;
@@ -629,6 +789,125 @@ INT8U  OSTaskDelReq (INT8U prio)
 /*$PAGE*/
 /*
 *********************************************************************************************************
+*                                      QUERY A TASK'S LATENCY HISTOGRAM
+*
+* Description: This function obtains the histogram of the latencies of a task, from the ISR posts that
+*              readied it to its switch in.
+*
+* Arguments  : prio      is the task priority.  If you specify OS_PRIO_SELF, the histogram of the calling
+*                        task is obtained.
+*
+*              p_lat     is a pointer to a data structure of type OS_TASK_LAT that will receive the
+*                        histogram (see OS_TASK_LAT in UCOS_II.H).
+*
+* Returns    : OS_ERR_NONE            upon success
+*              OS_ERR_PRIO_INVALID    if the priority you specify is higher that the maximum allowed
+*                                     (i.e. > OS_LOWEST_PRIO) or, you have not specified OS_PRIO_SELF.
+*              OS_ERR_TASK_NOT_EXIST  if the desired task has not been created or is assigned to a Mutex PIP
+*              OS_ERR_PDATA_NULL      if 'p_lat' is a NULL pointer
+*********************************************************************************************************
+*/
+
+#if OS_TASK_LAT_EN > 0u
+INT8U  OSTaskLatQuery (OS_PRIO_NBR   prio,
+                       OS_TASK_LAT  *p_lat)
+{
+    OS_TCB    *ptcb;
+    INT8U      i;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (prio > OS_LOWEST_PRIO) {                       /* Make sure task priority is valid             */
+        if (prio != OS_PRIO_SELF) {
+            return (OS_ERR_PRIO_INVALID);
+        }
+    }
+    if (p_lat == (OS_TASK_LAT *)0) {                   /* Validate 'p_lat'                             */
+        return (OS_ERR_PDATA_NULL);
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    if (prio == OS_PRIO_SELF) {                        /* See if query for SELF                        */
+        ptcb = OSTCBCur;
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+    if ((ptcb == (OS_TCB *)0) ||                       /* Make sure task exist                         */
+        (ptcb == OS_TCB_RESERVED)) {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_NOT_EXIST);
+    }
+    p_lat->OSLatCtr = 0u;
+    p_lat->OSLatMax = ptcb->OSTCBLatMax;
+    for (i = 0u; i < OS_TASK_LAT_HIST_SIZE; i++) {     /* Copy the histogram, counting the latencies   */
+        p_lat->OSLatHist[i]  = ptcb->OSTCBLatHist[i];
+        p_lat->OSLatCtr     += ptcb->OSTCBLatHist[i];
+    }
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      RESET A TASK'S LATENCY HISTOGRAM
+*
+* Description: This function clears the histogram of the latencies of a task.
+*
+* Arguments  : prio      is the task priority.  If you specify OS_PRIO_SELF, the histogram of the calling
+*                        task is cleared.
+*
+* Returns    : OS_ERR_NONE            upon success
+*              OS_ERR_PRIO_INVALID    if the priority you specify is higher that the maximum allowed
+*                                     (i.e. > OS_LOWEST_PRIO) or, you have not specified OS_PRIO_SELF.
+*              OS_ERR_TASK_NOT_EXIST  if the desired task has not been created or is assigned to a Mutex PIP
+*
+* Note(s)    : 1) A latency being measured, from an ISR post that has not yet been followed by the task's
+*                 switch in, is still recorded.
+*********************************************************************************************************
+*/
+
+#if OS_TASK_LAT_EN > 0u
+INT8U  OSTaskLatReset (OS_PRIO_NBR  prio)
+{
+    OS_TCB    *ptcb;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (prio > OS_LOWEST_PRIO) {                       /* Make sure task priority is valid             */
+        if (prio != OS_PRIO_SELF) {
+            return (OS_ERR_PRIO_INVALID);
+        }
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    if (prio == OS_PRIO_SELF) {                        /* See if reset for SELF                        */
+        ptcb = OSTCBCur;
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+    if ((ptcb == (OS_TCB *)0) ||                       /* Make sure task exist                         */
+        (ptcb == OS_TCB_RESERVED)) {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_NOT_EXIST);
+    }
+    ptcb->OSTCBLatMax = 0u;
+    OS_MemClr((INT8U *)&ptcb->OSTCBLatHist[0], sizeof(ptcb->OSTCBLatHist));
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
 *                                       GET THE NAME OF A TASK
 *
 * Description: This function is called to obtain the name of a task.
@@ -652,9 +931,9 @@ INT8U  OSTaskDelReq (INT8U prio)
 */
 
 #if OS_TASK_NAME_EN > 0u
-INT8U  OSTaskNameGet (INT8U    prio,
-                      INT8U  **pname,
-                      INT8U   *perr)
+INT8U  OSTaskNameGet (OS_PRIO_NBR  prio,
+                      INT8U      **pname,
+                      INT8U       *perr)
 {
     OS_TCB    *ptcb;
     INT8U      len;
@@ -689,9 +968,10 @@ INT8U  OSTaskNameGet (INT8U    prio,
     }
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                          /* See if caller desires it's own name        */
-        prio = OSTCBCur->OSTCBPrio;
+        ptcb = OSTCBCur;
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
     }
-    ptcb = OSTCBPrioTbl[prio];
     if (ptcb == (OS_TCB *)0) {                           /* Does task exist?                           */
         OS_EXIT_CRITICAL();                              /* No                                         */
         *perr = OS_ERR_TASK_NOT_EXIST;
@@ -734,9 +1014,9 @@ INT8U  OSTaskNameGet (INT8U    prio,
 *********************************************************************************************************
 */
 #if OS_TASK_NAME_EN > 0u
-void  OSTaskNameSet (INT8U   prio,
-                     INT8U  *pname,
-                     INT8U  *perr)
+void  OSTaskNameSet (OS_PRIO_NBR  prio,
+                     INT8U       *pname,
+                     INT8U       *perr)
 {
     OS_TCB    *ptcb;
 #if OS_CRITICAL_METHOD == 3u                         /* Allocate storage for CPU status register       */
@@ -770,9 +1050,10 @@ void  OSTaskNameSet (INT8U   prio,
     }
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                      /* See if caller desires to set it's own name     */
-        prio = OSTCBCur->OSTCBPrio;
+        ptcb = OSTCBCur;
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
     }
-    ptcb = OSTCBPrioTbl[prio];
     if (ptcb == (OS_TCB *)0) {                       /* Does task exist?                               */
         OS_EXIT_CRITICAL();                          /* No                                             */
         *perr = OS_ERR_TASK_NOT_EXIST;
@@ -797,7 +1078,8 @@ void  OSTaskNameSet (INT8U   prio,
 * Description: This function is called to resume a previously suspended task.  This is the only call that
 *              will remove an explicit task suspension.
 *
-* Arguments  : prio     is the priority of the task to resume.
+* Arguments  : prio     is the priority of the task to resume.  When several tasks share 'prio'
+*                       (OS_SCHED_RR_EN), the first suspended one (in creation order) is resumed.
 *
 * Returns    : OS_ERR_NONE                if the requested task is resumed
 *              OS_ERR_PRIO_INVALID        if the priority you specify is higher that the maximum allowed
@@ -809,7 +1091,7 @@ void  OSTaskNameSet (INT8U   prio,
 */
 
 #if OS_TASK_SUSPEND_EN > 0u
-INT8U  OSTaskResume (INT8U prio)
+INT8U  OSTaskResume (OS_PRIO_NBR prio)
 {
     OS_TCB    *ptcb;
 #if OS_CRITICAL_METHOD == 3u                                  /* Storage for CPU status register       */
@@ -833,12 +1115,17 @@ INT8U  OSTaskResume (INT8U prio)
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);
     }
+#if OS_SCHED_RR_EN > 0u
+    while (((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY) &&
+           (ptcb->OSTCBPrioNext != (OS_TCB *)0)) {            /* Resume first suspended task at 'prio' */
+        ptcb = ptcb->OSTCBPrioNext;
+    }
+#endif
     if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) != OS_STAT_RDY) { /* Task must be suspended                */
         ptcb->OSTCBStat &= (INT8U)~(INT8U)OS_STAT_SUSPEND;    /* Remove suspension                     */
         if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) == OS_STAT_RDY) { /* See if task is now ready         */
             if (ptcb->OSTCBDly == 0u) {
-                OSRdyGrp               |= ptcb->OSTCBBitY;    /* Yes, Make task ready to run           */
-                OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+                OS_RdyListInsert(ptcb);                       /* Yes, Make task ready to run           */
                 OS_EXIT_CRITICAL();
                 if (OSRunning == OS_TRUE) {
                     OS_Sched();                               /* Find new highest priority task        */
@@ -876,7 +1163,7 @@ INT8U  OSTaskResume (INT8U prio)
 *********************************************************************************************************
 */
 #if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
-INT8U  OSTaskStkChk (INT8U         prio,
+INT8U  OSTaskStkChk (OS_PRIO_NBR   prio,
                      OS_STK_DATA  *p_stk_data)
 {
     OS_TCB    *ptcb;
@@ -903,9 +1190,10 @@ INT8U  OSTaskStkChk (INT8U         prio,
     p_stk_data->OSUsed = 0u;
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                        /* See if check for SELF                        */
-        prio = OSTCBCur->OSTCBPrio;
+        ptcb = OSTCBCur;
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
     }
-    ptcb = OSTCBPrioTbl[prio];
     if (ptcb == (OS_TCB *)0) {                         /* Make sure task exist                         */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);
@@ -961,11 +1249,10 @@ INT8U  OSTaskStkChk (INT8U         prio,
 */
 
 #if OS_TASK_SUSPEND_EN > 0u
-INT8U  OSTaskSuspend (INT8U prio)
+INT8U  OSTaskSuspend (OS_PRIO_NBR prio)
 {
     BOOLEAN    self;
     OS_TCB    *ptcb;
-    INT8U      y;
 #if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -984,14 +1271,10 @@ INT8U  OSTaskSuspend (INT8U prio)
 #endif
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                                 /* See if suspend SELF                 */
-        prio = OSTCBCur->OSTCBPrio;
-        self = OS_TRUE;
-    } else if (prio == OSTCBCur->OSTCBPrio) {                   /* See if suspending self              */
-        self = OS_TRUE;
+        ptcb = OSTCBCur;
     } else {
-        self = OS_FALSE;                                        /* No suspending another task          */
+        ptcb = OSTCBPrioTbl[prio];
     }
-    ptcb = OSTCBPrioTbl[prio];
     if (ptcb == (OS_TCB *)0) {                                  /* Task to suspend must exist          */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_SUSPEND_PRIO);
@@ -1000,11 +1283,12 @@ INT8U  OSTaskSuspend (INT8U prio)
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);
     }
-    y            = ptcb->OSTCBY;
-    OSRdyTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;                   /* Make task not ready                 */
-    if (OSRdyTbl[y] == 0u) {
-        OSRdyGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
+    if (ptcb == OSTCBCur) {                                     /* See if suspending self              */
+        self = OS_TRUE;
+    } else {
+        self = OS_FALSE;                                        /* No suspending another task          */
     }
+    OS_RdyListRemove(ptcb);                                     /* Make task not ready                 */
     ptcb->OSTCBStat |= OS_STAT_SUSPEND;                         /* Status of task is 'SUSPENDED'       */
     OS_EXIT_CRITICAL();
     if (self == OS_TRUE) {                                      /* Context switch only if SELF         */
@@ -1034,8 +1318,8 @@ INT8U  OSTaskSuspend (INT8U prio)
 */
 
 #if OS_TASK_QUERY_EN > 0u
-INT8U  OSTaskQuery (INT8U    prio,
-                    OS_TCB  *p_task_data)
+INT8U  OSTaskQuery (OS_PRIO_NBR  prio,
+                    OS_TCB      *p_task_data)
 {
     OS_TCB    *ptcb;
 #if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
@@ -1056,9 +1340,10 @@ INT8U  OSTaskQuery (INT8U    prio,
 #endif
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                  /* See if suspend SELF                                */
-        prio = OSTCBCur->OSTCBPrio;
+        ptcb = OSTCBCur;
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
     }
-    ptcb = OSTCBPrioTbl[prio];
     if (ptcb == (OS_TCB *)0) {                   /* Task to query must exist                           */
         OS_EXIT_CRITICAL();
         return (OS_ERR_PRIO);
@@ -1069,6 +1354,15 @@ INT8U  OSTaskQuery (INT8U    prio,
     }
                                                  /* Copy TCB into user storage area                    */
     OS_MemCopy((INT8U *)p_task_data, (INT8U *)ptcb, sizeof(OS_TCB));
+#if OS_TICK_LIST_EN > 0u
+    if (ptcb->OSTCBDly != 0u) {                  /* Report the ticks remaining, not the ticks asked    */
+        p_task_data->OSTCBDly = 0u;
+        while (ptcb != (OS_TCB *)0) {            /* ... i.e. sum of deltas up to the task's own entry  */
+            p_task_data->OSTCBDly += ptcb->OSTCBTickDelta;
+            ptcb                   = ptcb->OSTCBTickPrev;
+        }
+    }
+#endif
     OS_EXIT_CRITICAL();
     return (OS_ERR_NONE);
 }
@@ -1076,6 +1370,84 @@ INT8U  OSTaskQuery (INT8U    prio,
 /*$PAGE*/
 /*
 *********************************************************************************************************
+*                                SET THE PREEMPTION THRESHOLD OF A TASK
+*
+* Description: This function sets the priority a task must be above to preempt the task.  While the task
+*              runs, tasks made ready at its priority or below, down to 'threshold', wait until it blocks
+*              or lowers its threshold.  Cooperating tasks given a common threshold thus stop preempting
+*              each other, while tasks above the threshold keep their normal latency.
+*
+* Arguments  : prio       is the priority of the task.  If you specify OS_PRIO_SELF, the threshold of the
+*                         calling task is set.
+*
+*              threshold  is the new preemption threshold.  It must not be below the task's priority
+*                         (i.e. must be <= prio).  Setting it to the task's priority removes the
+*                         threshold, 0 makes the task non-preemptable by other tasks (ISRs still run).
+*
+* Returns    : OS_ERR_NONE            if the call was successful
+*              OS_ERR_PRIO_INVALID    if the priority you specify is higher that the maximum allowed
+*                                     (i.e. >= OS_LOWEST_PRIO)
+*              OS_ERR_TASK_THRESHOLD  if 'threshold' is below the task's priority or, if you tried to set
+*                                     the threshold of the idle task.
+*              OS_ERR_TASK_NOT_EXIST  if the task does not exist or is assigned to a Mutex PIP.
+*
+* Note(s)    : 1) The threshold only matters while the task is running: it does not change the order in
+*                 which ready tasks are picked once the task blocks.
+*              2) Tasks at the same priority are not time sliced while the running one has a threshold.
+*              3) Avoided context switches are counted in OSCtxSwThresholdCtr.
+*********************************************************************************************************
+*/
+
+#if OS_SCHED_THRESHOLD_EN > 0u
+INT8U  OSTaskThresholdSet (OS_PRIO_NBR  prio,
+                           OS_PRIO_NBR  threshold)
+{
+    OS_TCB    *ptcb;
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    if (prio == OS_TASK_IDLE_PRIO) {                        /* The idle task must always be preemptable */
+        return (OS_ERR_TASK_THRESHOLD);
+    }
+#if OS_ARG_CHK_EN > 0u
+    if (prio >= OS_LOWEST_PRIO) {
+        if (prio != OS_PRIO_SELF) {
+            return (OS_ERR_PRIO_INVALID);
+        }
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    if (prio == OS_PRIO_SELF) {                             /* See if changing self                     */
+        ptcb = OSTCBCur;
+    } else {
+        ptcb = OSTCBPrioTbl[prio];
+    }
+    if (ptcb == (OS_TCB *)0) {                              /* Task to change must exist                */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_NOT_EXIST);
+    }
+    if (ptcb == OS_TCB_RESERVED) {                          /* Must not be assigned to Mutex            */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_NOT_EXIST);
+    }
+    if (threshold > ptcb->OSTCBPrio) {                      /* Threshold can't be below the priority    */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_THRESHOLD);
+    }
+    ptcb->OSTCBThreshold = threshold;
+    OS_EXIT_CRITICAL();
+    if (OSRunning == OS_TRUE) {
+        OS_Sched();                                         /* Tasks held back may now preempt          */
+    }
+    return (OS_ERR_NONE);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
 *                              GET THE CURRENT VALUE OF A TASK REGISTER
 *
 * Description: This function is called to obtain the current value of a task register.  Task registers
@@ -1101,9 +1473,9 @@ INT8U  OSTaskQuery (INT8U    prio,
 */
 
 #if OS_TASK_REG_TBL_SIZE > 0u
-INT32U  OSTaskRegGet (INT8U   prio,
-                      INT8U   id,
-                      INT8U  *perr)
+INT32U  OSTaskRegGet (OS_PRIO_NBR  prio,
+                      INT8U        id,
+                      INT8U       *perr)
 {
 #if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
     OS_CPU_SR  cpu_sr = 0u;
@@ -1224,10 +1596,10 @@ INT8U  OSTaskRegGetID (INT8U  *perr)
 */
 
 #if OS_TASK_REG_TBL_SIZE > 0u
-void  OSTaskRegSet (INT8U    prio,
-                    INT8U    id,
-                    INT32U   value,
-                    INT8U   *perr)
+void  OSTaskRegSet (OS_PRIO_NBR  prio,
+                    INT8U        id,
+                    INT32U       value,
+                    INT8U       *perr)
 {
 #if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
     OS_CPU_SR  cpu_sr = 0u;
@@ -1269,6 +1641,156 @@ void  OSTaskRegSet (INT8U    prio,
 /*$PAGE*/
 /*
 *********************************************************************************************************
+*                                            CREATE A TASK
+*
+* Description: This function creates a task for OSTaskCreate(), OSTaskCreateExt() & OSTaskCreateEDF(), once
+*              they have checked their arguments.
+*
+* Arguments  : task, p_arg, ptos, prio, id, pbos, stk_size, pext & opt    see OSTaskCreateExt().
+*                                                                          OSTaskCreate() passes 0 for
+*                                                                          'id', 'pbos', 'stk_size', 'pext'
+*                                                                          & 'opt'.
+*
+*              deadline & period                                           see OSTaskCreateEDF(), 0 for a
+*                                                                          fixed priority task.
+*
+* Returns    : OS_ERR_NONE             if the function was successful.
+*              OS_ERR_PRIO_EXIST       if the task priority already exist and cannot be shared.
+*              OS_ERR_TASK_CREATE_ISR  if you tried to create a task from an ISR.
+*              other                   the error returned by OS_TCBInit().
+*
+* Note(s)    : 1) With OS_SCHED_RR_EN, the task joins the tasks already at its priority, unless the priority
+*                 is reserved for a mutex' ceiling or belongs to a uC/OS-II task (see OS_TaskPrioIsSys()).
+*                 The scheduler stays locked while the task is created so that the tasks at the priority
+*                 cannot all be deleted in the meantime.
+*
+*              2) An EDF task is ready with its first deadline as soon as it is created (see OS_TCBInit()).
+*                 It never shares its priority.
+*
+*              3) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_CREATE_EN > 0u) || (OS_TASK_CREATE_EXT_EN > 0u)
+static  INT8U  OS_TaskCreate (void       (*task)(void *p_arg),
+                              void        *p_arg,
+                              OS_STK      *ptos,
+                              OS_PRIO_NBR  prio,
+                              INT16U       id,
+                              OS_STK      *pbos,
+                              INT32U       stk_size,
+                              void        *pext,
+                              INT16U       opt,
+                              INT32U       deadline,
+                              INT32U       period)
+{
+    OS_STK     *psp;
+    INT8U       err;
+    BOOLEAN     shared;
+#if OS_CRITICAL_METHOD == 3u                 /* Allocate storage for CPU status register               */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    if (OSIntNesting > 0u) {                 /* Make sure we don't create the task from within an ISR  */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_CREATE_ISR);
+    }
+    if (OSTCBPrioTbl[prio] == (OS_TCB *)0) { /* Make sure task doesn't already exist at this priority  */
+        OSTCBPrioTbl[prio] = OS_TCB_RESERVED;/* Reserve the priority to prevent others from doing ...  */
+                                             /* ... the same thing until task is created.              */
+        shared             = OS_FALSE;
+#if OS_SCHED_RR_EN > 0u
+    } else if ((OSTCBPrioTbl[prio] != OS_TCB_RESERVED) &&     /* Share the priority with its tasks ... */
+               (OS_TaskPrioIsSys(prio) == OS_FALSE) &&        /* ... unless it is a system task's ...  */
+               (period == 0u)) {                              /* ... or an EDF task's (see Note #2)    */
+        OSLockNesting++;                     /* Keep the priority in use while we create (see Note #1) */
+        shared             = OS_TRUE;
+#endif
+    } else {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_PRIO_EXIST);
+    }
+    OS_EXIT_CRITICAL();
+
+#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
+    OS_TaskStkClr(pbos, stk_size, opt);                        /* Clear the task stack (if needed)     */
+#endif
+
+    psp = OSTaskStkInit(task, p_arg, ptos, opt);               /* Initialize the task's stack          */
+    err = OS_TCBInit(prio, psp, pbos, id, stk_size, pext, opt, deadline, period);
+    OS_ENTER_CRITICAL();
+    if (shared == OS_TRUE) {
+        OSLockNesting--;
+    } else if (err != OS_ERR_NONE) {
+        OSTCBPrioTbl[prio] = (OS_TCB *)0;                      /* Make this priority avail. to others  */
+    }
+    OS_EXIT_CRITICAL();
+    if (err == OS_ERR_NONE) {
+        if (OSRunning == OS_TRUE) {                            /* Find HPT if multitasking has started */
+            OS_Sched();
+        }
+    }
+    return (err);
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    CHECK FOR A SYSTEM TASK PRIORITY
+*
+* Description: This function determines whether a priority belongs to one of the tasks of uC/OS-II, which
+*              application tasks may not share.
+*
+* Arguments  : prio     is the priority to check.
+*
+* Returns    : OS_TRUE  if 'prio' is the priority of the ISR post task, the high-resolution timer task, the
+*                       timer task, a timer worker task, the statistic task or the idle task.
+*              OS_FALSE otherwise.
+*
+* Note(s)    : 1) The priorities are those of the enabled services, whether or not their task was created.
+*
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if ((OS_TASK_CREATE_EN > 0u) || (OS_TASK_CREATE_EXT_EN > 0u)) && (OS_SCHED_RR_EN > 0u)
+static  BOOLEAN  OS_TaskPrioIsSys (OS_PRIO_NBR  prio)
+{
+    if (prio >= OS_TASK_STAT_PRIO) {                           /* Statistic & idle tasks               */
+        return (OS_TRUE);
+    }
+#if OS_ISR_POST_DEFERRED_EN > 0u
+    if (prio == OS_TASK_INT_Q_PRIO) {                          /* ISR post task                        */
+        return (OS_TRUE);
+    }
+#endif
+#if OS_HRT_EN > 0u
+    if (prio == OS_TASK_HRT_PRIO) {                            /* High-resolution timer task           */
+        return (OS_TRUE);
+    }
+#endif
+#if OS_TMR_EN > 0u
+    if (prio == OS_TASK_TMR_PRIO) {                            /* Timer task                           */
+        return (OS_TRUE);
+    }
+#if OS_TMR_CFG_WORKER_EN > 0u
+    if ((prio >= OS_TASK_TMR_WORKER_PRIO) &&                   /* Timer worker tasks                   */
+        (prio <  OS_TASK_TMR_WORKER_PRIO + OS_TMR_CFG_WORKER_NBR)) {
+        return (OS_TRUE);
+    }
+#endif
+#endif
+    return (OS_FALSE);
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
 *                                    CATCH ACCIDENTAL TASK RETURN
 *
 * Description: This function is called if a task accidentally returns without deleting itself.  In other
@@ -45,7 +45,6 @@
 
 void  OSTimeDly (INT32U ticks)
 {
-    INT8U      y;
 #if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -60,12 +59,12 @@ void  OSTimeDly (INT32U ticks)
     }
     if (ticks > 0u) {                            /* 0 means no delay!                                  */
         OS_ENTER_CRITICAL();
-        y            =  OSTCBCur->OSTCBY;        /* Delay current task                                 */
-        OSRdyTbl[y] &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
-        if (OSRdyTbl[y] == 0u) {
-            OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
-        }
+        OS_RdyListRemove(OSTCBCur);              /* Delay current task                                 */
+#if OS_TICK_LIST_EN > 0u
+        OS_TickListInsert(OSTCBCur, ticks);      /* Load ticks in TCB and link it in the tick list     */
+#else
         OSTCBCur->OSTCBDly = ticks;              /* Load ticks in TCB                                  */
+#endif
         OS_EXIT_CRITICAL();
         OS_Sched();                              /* Find next task to run!                             */
     }
@@ -143,6 +142,72 @@ INT8U  OSTimeDlyHMSM (INT8U   hours,
 /*$PAGE*/
 /*
 *********************************************************************************************************
+*                                   DELAY EDF TASK UNTIL ITS NEXT PERIOD
+*
+* Description: This function is called by a task created with OSTaskCreateEDF() at the end of each job.
+*              It advances the task's release time by one period, sets the absolute deadline of the next
+*              job and delays the task until that release.  If the job finished after its deadline, the
+*              task's deadline miss counter (OSTCBEdfMissCtr) is incremented.  If the next release is
+*              already due (the task overran its period), the task stays ready and continues with the
+*              next job right away.
+*
+* Arguments  : none
+*
+* Returns    : OS_ERR_NONE               if the task was delayed until its next release
+*              OS_ERR_TIME_DLY_ISR       if you called this function from an ISR
+*              OS_ERR_SCHED_LOCKED       if you called this function with the scheduler locked
+*              OS_ERR_TASK_NOT_EDF       if the calling task was not created with OSTaskCreateEDF()
+*
+* Note(s)    : Releases are computed from the previous release and not from the current time, so the
+*              task keeps a fixed rate and does not drift.
+*********************************************************************************************************
+*/
+
+#if OS_SCHED_EDF_EN > 0u
+INT8U  OSTimeDlyPeriod (void)
+{
+    INT32U     dly;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    if (OSIntNesting > 0u) {                     /* See if trying to call from an ISR                  */
+        return (OS_ERR_TIME_DLY_ISR);
+    }
+    if (OSLockNesting > 0u) {                    /* See if called with scheduler locked                */
+        return (OS_ERR_SCHED_LOCKED);
+    }
+    if (OSTCBCur->OSTCBEdfPeriod == 0u) {        /* Only EDF tasks have a period                       */
+        return (OS_ERR_TASK_NOT_EDF);
+    }
+    OS_ENTER_CRITICAL();
+    if ((INT32S)(OSTime - OSTCBCur->OSTCBEdfDeadline) > 0) {
+        OSTCBCur->OSTCBEdfMissCtr++;             /* Job completed after its deadline                   */
+    }
+    OSTCBCur->OSTCBEdfRelease  += OSTCBCur->OSTCBEdfPeriod;
+    OSTCBCur->OSTCBEdfDeadline  = OSTCBCur->OSTCBEdfRelease
+                                + OSTCBCur->OSTCBEdfRelDeadline;
+    OS_RdyListRemove(OSTCBCur);                  /* Re-key the task with its new deadline              */
+    dly = OSTCBCur->OSTCBEdfRelease - OSTime;
+    if ((INT32S)dly > 0) {                       /* Wait for the next release                          */
+#if OS_TICK_LIST_EN > 0u
+        OS_TickListInsert(OSTCBCur, dly);
+#else
+        OSTCBCur->OSTCBDly = dly;
+#endif
+    } else {
+        OS_RdyListInsert(OSTCBCur);              /* Next release is already due                        */
+    }
+    OS_EXIT_CRITICAL();
+    OS_Sched();                                  /* Find next task to run!                             */
+    return (OS_ERR_NONE);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
 *                                        RESUME A DELAYED TASK
 *
 * Description: This function is used resume a task that has been delayed through a call to either
@@ -150,7 +215,9 @@ INT8U  OSTimeDlyHMSM (INT8U   hours,
 *              task that is waiting for an event with timeout.  This would make the task look
 *              like a timeout occurred.
 *
-* Arguments  : prio                      specifies the priority of the task to resume
+* Arguments  : prio                      specifies the priority of the task to resume.  When several
+*                                        tasks share 'prio' (OS_SCHED_RR_EN), the first delayed one (in
+*                                        creation order) is resumed.
 *
 * Returns    : OS_ERR_NONE               Task has been resumed
 *              OS_ERR_PRIO_INVALID       if the priority you specify is higher that the maximum allowed
@@ -161,7 +228,7 @@ INT8U  OSTimeDlyHMSM (INT8U   hours,
 */
 
 #if OS_TIME_DLY_RESUME_EN > 0u
-INT8U  OSTimeDlyResume (INT8U prio)
+INT8U  OSTimeDlyResume (OS_PRIO_NBR prio)
 {
     OS_TCB    *ptcb;
 #if OS_CRITICAL_METHOD == 3u                                   /* Storage for CPU status register      */
@@ -183,12 +250,22 @@ INT8U  OSTimeDlyResume (INT8U prio)
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);                        /* The task does not exist              */
     }
+#if OS_SCHED_RR_EN > 0u
+    while ((ptcb->OSTCBDly == 0u) &&                           /* Resume first delayed task at 'prio'  */
+           (ptcb->OSTCBPrioNext != (OS_TCB *)0)) {
+        ptcb = ptcb->OSTCBPrioNext;
+    }
+#endif
     if (ptcb->OSTCBDly == 0u) {                                /* See if task is delayed               */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TIME_NOT_DLY);                          /* Indicate that task was not delayed   */
     }
 
+#if OS_TICK_LIST_EN > 0u
+    OS_TickListRemove(ptcb);                                   /* Clear the time delay                 */
+#else
     ptcb->OSTCBDly = 0u;                                       /* Clear the time delay                 */
+#endif
     if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) != OS_STAT_RDY) {
         ptcb->OSTCBStat     &= ~OS_STAT_PEND_ANY;              /* Yes, Clear status flag               */
         ptcb->OSTCBStatPend  =  OS_STAT_PEND_TO;               /* Indicate PEND timeout                */
@@ -196,8 +273,7 @@ INT8U  OSTimeDlyResume (INT8U prio)
         ptcb->OSTCBStatPend  =  OS_STAT_PEND_OK;
     }
     if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY) {  /* Is task suspended?                   */
-        OSRdyGrp               |= ptcb->OSTCBBitY;             /* No,  Make ready                      */
-        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+        OS_RdyListInsert(ptcb);                                /* No,  Make ready                      */
         OS_EXIT_CRITICAL();
         OS_Sched();                                            /* See if this is new highest priority  */
     } else {
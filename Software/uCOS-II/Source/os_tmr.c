@@ -38,6 +38,19 @@
 *    OS_TASK_TMR_STK_SIZE      The size     of the Timer management task's stack
 *
 * 2) You must call OSTmrSignal() to notify the Timer management task that it's time to update the timers.
+*
+* 3) With OS_TMR_CFG_WORKER_EN, your application MUST also define:
+*
+*    OS_TASK_TMR_WORKER_PRIO   The priority of timer worker task 0, worker task 'n' runs at this priority + n
+*
+*    The Timer management task then only finds the timers that expire and hands their callbacks over to
+*    OS_TMR_CFG_WORKER_NBR worker tasks, which run them with the scheduler unlocked.  Each timer selects
+*    its worker task, and thus the priority of its callback, with OSTmrWorkerSet().  The worker tasks
+*    consume OS_TMR_CFG_WORKER_NBR of the OS_MAX_TASKS tasks.
+*
+* 4) With OS_TMR_CFG_SLACK_EN, a timer given a slack with OSTmrSlackSet() may expire up to that many timer
+*    ticks late.  Its expiry is moved within that window to a time shared with other timers, so that the
+*    timer task, and a tickless CPU, wake up fewer times (see OSTmr_Coalesce()).
 *********************************************************************************************************
 */
 
@@ -49,6 +62,7 @@
 
 #define  OS_TMR_LINK_DLY       0u
 #define  OS_TMR_LINK_PERIODIC  1u
+#define  OS_TMR_LINK_CASCADE   2u
 
 /*
 *********************************************************************************************************
@@ -59,10 +73,24 @@
 #if OS_TMR_EN > 0u
 static  OS_TMR  *OSTmr_Alloc         (void);
 static  void     OSTmr_Free          (OS_TMR *ptmr);
+#if OS_TMR_CFG_SLACK_EN > 0u
+static  INT32U   OSTmr_Coalesce      (INT32U  due, INT32U slack);
+#endif
 static  void     OSTmr_InitTask      (void);
 static  void     OSTmr_Link          (OS_TMR *ptmr, INT8U type);
 static  void     OSTmr_Unlink        (OS_TMR *ptmr);
 static  void     OSTmr_Task          (void   *p_arg);
+#if OS_TMR_CFG_WORKER_EN > 0u
+static  void     OSTmr_InitWorkers   (void);
+static  void     OSTmr_WorkerPost    (OS_TMR *ptmr, OS_TMR_CALLBACK pfnct);
+static  void     OSTmr_WorkerTask    (void   *p_arg);
+#endif
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+static  void     OSTmr_Cascade       (void);
+#if OS_TICKLESS_EN > 0u
+static  void     OSTmr_TimeSkip      (INT32U  ticks);
+#endif
+#endif
 #endif
 
 /*$PAGE*/
@@ -172,6 +200,13 @@ OS_TMR  *OSTmrCreate (INT32U           dly,
     ptmr->OSTmrOpt         = opt;
     ptmr->OSTmrCallback    = callback;
     ptmr->OSTmrCallbackArg = callback_arg;
+#if OS_TMR_CFG_SLACK_EN > 0u
+    ptmr->OSTmrSlack       = 0u;                            /* Expires on time by default                             */
+#endif
+#if OS_TMR_CFG_WORKER_EN > 0u
+    ptmr->OSTmrWorker      = 0u;                            /* Callback runs in worker task 0 by default              */
+    OS_MemClr((INT8U *)&ptmr->OSTmrLat, sizeof(ptmr->OSTmrLat));
+#endif
 #if OS_TMR_CFG_NAME_EN > 0u
     if (pname == (INT8U *)0) {                              /* Is 'pname' a NULL pointer?                             */
         ptmr->OSTmrName    = (INT8U *)(void *)"?";
@@ -204,6 +239,10 @@ OS_TMR  *OSTmrCreate (INT32U           dly,
 *
 * Returns    : OS_TRUE       If the call was successful
 *              OS_FALSE      If not
+*
+* Note(s)    : 1) With OS_TMR_CFG_WORKER_EN, the callbacks of the timer that are queued to its worker task are
+*                 dropped (see 'UCOS_II.H  TIMER DATA TYPES  Note #3').  A callback that the worker task has
+*                 already started still runs to completion.
 *********************************************************************************************************
 */
 
@@ -261,6 +300,109 @@ BOOLEAN  OSTmrDel (OS_TMR  *ptmr,
 }
 #endif
 
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 GET THE CALLBACK STATISTICS OF A TIMER
+*
+* Description: This function is called to obtain the latency and execution time statistics of the
+*              callbacks of a timer, run by a timer worker task.
+*
+* Arguments  : ptmr          Is a pointer to the timer.
+*
+*              p_lat         Is a pointer to a data structure of type OS_TMR_LAT that will receive the
+*                            statistics (see OS_TMR_LAT in UCOS_II.H).
+*
+* Returns    : OS_ERR_NONE               The call was successful
+*              OS_ERR_TMR_INVALID        'ptmr'  is a NULL pointer
+*              OS_ERR_PDATA_NULL         'p_lat' is a NULL pointer
+*              OS_ERR_TMR_INVALID_TYPE   'ptmr'  is not pointing to an OS_TMR
+*              OS_ERR_TMR_INACTIVE       'ptmr'  points to a timer that is not created
+*
+* Note(s)    : 1) The times are in CPU_TS_Get32() counts, CPU_CFG_TS_32_EN MUST be enabled in CPU_CFG.H.
+*              2) Callbacks run by the timer task, because the queue of their worker task was full, are
+*                 not measured (see OSTmrWorkerOvfCtr).
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WORKER_EN > 0u)
+INT8U  OSTmrLatQuery (OS_TMR      *ptmr,
+                      OS_TMR_LAT  *p_lat)
+{
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register               */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (ptmr == (OS_TMR *)0) {
+        return (OS_ERR_TMR_INVALID);
+    }
+    if (p_lat == (OS_TMR_LAT *)0) {
+        return (OS_ERR_PDATA_NULL);
+    }
+#endif
+    if (ptmr->OSTmrType != OS_TMR_TYPE) {                   /* Validate timer structure                               */
+        return (OS_ERR_TMR_INVALID_TYPE);
+    }
+    OS_ENTER_CRITICAL();                                    /* Worker tasks update the statistics in critical section */
+    if (ptmr->OSTmrState == OS_TMR_STATE_UNUSED) {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TMR_INACTIVE);
+    }
+    *p_lat = ptmr->OSTmrLat;
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                RESET THE CALLBACK STATISTICS OF A TIMER
+*
+* Description: This function is called to clear the latency and execution time statistics of the
+*              callbacks of a timer.
+*
+* Arguments  : ptmr          Is a pointer to the timer.
+*
+* Returns    : OS_ERR_NONE               The call was successful
+*              OS_ERR_TMR_INVALID        'ptmr'  is a NULL pointer
+*              OS_ERR_TMR_INVALID_TYPE   'ptmr'  is not pointing to an OS_TMR
+*              OS_ERR_TMR_INACTIVE       'ptmr'  points to a timer that is not created
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WORKER_EN > 0u)
+INT8U  OSTmrLatReset (OS_TMR  *ptmr)
+{
+#if OS_CRITICAL_METHOD == 3u                                /* Allocate storage for CPU status register               */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (ptmr == (OS_TMR *)0) {
+        return (OS_ERR_TMR_INVALID);
+    }
+#endif
+    if (ptmr->OSTmrType != OS_TMR_TYPE) {                   /* Validate timer structure                               */
+        return (OS_ERR_TMR_INVALID_TYPE);
+    }
+    OS_ENTER_CRITICAL();
+    if (ptmr->OSTmrState == OS_TMR_STATE_UNUSED) {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TMR_INACTIVE);
+    }
+    OS_MemClr((INT8U *)&ptmr->OSTmrLat, sizeof(ptmr->OSTmrLat));
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -440,6 +582,58 @@ INT32U  OSTmrRemainGet (OS_TMR  *ptmr,
 }
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      SET THE SLACK OF A TIMER
+*
+* Description: This function is called by your application code to let a timer expire later than asked,
+*              so that its expiry can be coalesced with that of other timers.
+*
+* Arguments  : ptmr          Is a pointer to the timer.
+*
+*              slack         Is the number of timer ticks the expiry of the timer may be delayed by, 0 for
+*                            the timer to expire on time.
+*
+* Returns    : OS_ERR_NONE                 The call was successful
+*              OS_ERR_TMR_INVALID          'ptmr'  is a NULL pointer
+*              OS_ERR_TMR_INVALID_TYPE     'ptmr'  is not pointing to an OS_TMR
+*              OS_ERR_TMR_ISR              if the call was made from an ISR
+*              OS_ERR_TMR_INACTIVE         'ptmr'  points to a timer that is not created
+*
+* Note(s)    : 1) The slack applies from the next time the timer is started or reloaded.
+*              2) The period of a periodic timer is counted from the time it was due, not from the time it
+*                 expired, so that the slack does not make it drift.  Its slack is therefore limited to its
+*                 period minus one.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_SLACK_EN > 0u)
+INT8U  OSTmrSlackSet (OS_TMR  *ptmr,
+                      INT32U   slack)
+{
+#if OS_ARG_CHK_EN > 0u
+    if (ptmr == (OS_TMR *)0) {
+        return (OS_ERR_TMR_INVALID);
+    }
+#endif
+    if (ptmr->OSTmrType != OS_TMR_TYPE) {                   /* Validate timer structure                               */
+        return (OS_ERR_TMR_INVALID_TYPE);
+    }
+    if (OSIntNesting > 0u) {                                /* See if trying to call from an ISR                      */
+        return (OS_ERR_TMR_ISR);
+    }
+    OSSchedLock();
+    if (ptmr->OSTmrState == OS_TMR_STATE_UNUSED) {          /* Timer not created                                      */
+        OSSchedUnlock();
+        return (OS_ERR_TMR_INACTIVE);
+    }
+    ptmr->OSTmrSlack = slack;
+    OSSchedUnlock();
+    return (OS_ERR_NONE);
+}
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -624,6 +818,11 @@ BOOLEAN  OSTmrStart (OS_TMR   *ptmr,
 *
 * Returns    : OS_TRUE       If we stopped the timer (if the timer is already stopped, we also return OS_TRUE)
 *              OS_FALSE      If not
+*
+* Note(s)    : 1) With OS_TMR_CFG_WORKER_EN, the callbacks of the timer that are queued to its worker task are
+*                 dropped, also when a ONE-SHOT timer has already completed (see 'UCOS_II.H  TIMER DATA TYPES
+*                 Note #3').  A callback that the worker task has already started still runs to completion.
+*                 The callback run by OS_TMR_OPT_CALLBACK or OS_TMR_OPT_CALLBACK_ARG is not affected.
 *********************************************************************************************************
 */
 
@@ -658,6 +857,11 @@ BOOLEAN  OSTmrStop (OS_TMR  *ptmr,
         return (OS_FALSE);
     }
     OSSchedLock();
+#if OS_TMR_CFG_WORKER_EN > 0u
+    if (ptmr->OSTmrState != OS_TMR_STATE_UNUSED) {
+        ptmr->OSTmrGen++;                                         /* Drop the queued callbacks (see Note #1)          */
+    }
+#endif
     switch (ptmr->OSTmrState) {
         case OS_TMR_STATE_RUNNING:
              OSTmr_Unlink(ptmr);                                  /* Remove from current wheel spoke                  */
@@ -710,6 +914,59 @@ BOOLEAN  OSTmrStop (OS_TMR  *ptmr,
 }
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                               SELECT THE WORKER TASK OF A TIMER'S CALLBACK
+*
+* Description: This function is called by your application code to select the timer worker task that runs
+*              the callback of a timer when it expires, and thus the priority the callback runs at.
+*
+* Arguments  : ptmr          Is a pointer to the timer.
+*
+*              worker        Is the number of the worker task, 0 to OS_TMR_CFG_WORKER_NBR - 1.  Worker task
+*                            'n' runs at priority OS_TASK_TMR_WORKER_PRIO + n.
+*
+* Returns    : OS_ERR_NONE                 The call was successful
+*              OS_ERR_TMR_INVALID          'ptmr'  is a NULL pointer
+*              OS_ERR_TMR_INVALID_TYPE     'ptmr'  is not pointing to an OS_TMR
+*              OS_ERR_TMR_INVALID_WORKER   'worker' is not the number of a worker task
+*              OS_ERR_TMR_ISR              if the call was made from an ISR
+*              OS_ERR_TMR_INACTIVE         'ptmr'  points to a timer that is not created
+*
+* Note(s)    : 1) A callback already handed over to a worker task still runs in that worker task.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WORKER_EN > 0u)
+INT8U  OSTmrWorkerSet (OS_TMR  *ptmr,
+                       INT8U    worker)
+{
+#if OS_ARG_CHK_EN > 0u
+    if (ptmr == (OS_TMR *)0) {
+        return (OS_ERR_TMR_INVALID);
+    }
+    if (worker >= OS_TMR_CFG_WORKER_NBR) {
+        return (OS_ERR_TMR_INVALID_WORKER);
+    }
+#endif
+    if (ptmr->OSTmrType != OS_TMR_TYPE) {                   /* Validate timer structure                               */
+        return (OS_ERR_TMR_INVALID_TYPE);
+    }
+    if (OSIntNesting > 0u) {                                /* See if trying to call from an ISR                      */
+        return (OS_ERR_TMR_ISR);
+    }
+    OSSchedLock();
+    if (ptmr->OSTmrState == OS_TMR_STATE_UNUSED) {          /* Timer not created                                      */
+        OSSchedUnlock();
+        return (OS_ERR_TMR_INACTIVE);
+    }
+    ptmr->OSTmrWorker = worker;
+    OSSchedUnlock();
+    return (OS_ERR_NONE);
+}
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -741,6 +998,193 @@ INT8U  OSTmrSignal (void)
 }
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  GET NUMBER OF TIMER TICKS TO NEXT EXPIRY
+*
+* Description: This function is called by the idle task hook of a tickless port to find out when the timer
+*              task next needs to be signaled.  It returns the number of OSTmrSignal() calls left before the
+*              earliest running timer expires.
+*
+* Arguments  : none
+*
+* Returns    : The number of 'timer' increments until the next timer expires, or
+*              0 if no timer is running.
+*
+* Notes      : 1) The port converts the returned value to clock ticks using its own OSTmrSignal() divider.
+*              2) Must be called from the idle task with interrupts disabled.  The timer task can't be in
+*                 the middle of updating the wheel since it runs with the scheduler locked.
+*              3) With OS_TMR_CFG_WHEEL_HIER_EN, the timers of a level all expire after those of the levels
+*                 below and, within a level, the spokes expire in order starting after the current one.
+*                 Only the first spoke in use of each level is looked at.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TICKLESS_EN > 0u)
+INT32U  OSTmrNextGet (void)
+{
+    OS_TMR        *ptmr;
+    OS_TMR_WHEEL  *pspoke;
+    INT32U         remain;
+    INT32U         next;
+    INT16U         ix;
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+    INT16U         lvl;
+    INT16U         spoke;
+    INT16U         spoke_cur;
+#endif
+
+
+    next = 0u;
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+    for (lvl = 0u; lvl < OS_TMR_WHEEL_LVL_NBR; lvl++) {        /* Find first spoke in use of each level (Note #3) */
+        spoke_cur = (INT16U)((OSTmrTime >> (lvl * OS_TMR_WHEEL_LVL_BITS)) & (OS_TMR_WHEEL_LVL_SIZE - 1u));
+        for (ix = 1u; ix <= OS_TMR_WHEEL_LVL_SIZE; ix++) {
+            spoke  = (INT16U)((spoke_cur + ix) & (OS_TMR_WHEEL_LVL_SIZE - 1u));
+            pspoke = &OSTmrWheelTbl[(lvl * OS_TMR_WHEEL_LVL_SIZE) + spoke];
+            ptmr   = pspoke->OSTmrFirst;
+            if (ptmr != (OS_TMR *)0) {
+                while (ptmr != (OS_TMR *)0) {                  /* Find the timer that expires first in spoke      */
+                    remain = ptmr->OSTmrMatch - OSTmrTime;
+                    if ((next == 0u) || (remain < next)) {
+                        next = remain;
+                    }
+                    ptmr = (OS_TMR *)ptmr->OSTmrNext;
+                }
+                break;
+            }
+        }
+    }
+#else
+    pspoke = &OSTmrWheelTbl[0];
+    for (ix = 0u; ix < OS_TMR_CFG_WHEEL_SIZE; ix++) {          /* Find the running timer that expires first       */
+        ptmr = pspoke->OSTmrFirst;
+        while (ptmr != (OS_TMR *)0) {
+            remain = ptmr->OSTmrMatch - OSTmrTime;
+            if ((next == 0u) || (remain < next)) {
+                next = remain;
+            }
+            ptmr = (OS_TMR *)ptmr->OSTmrNext;
+        }
+        pspoke++;
+    }
+#endif
+    return (next);
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 ACCOUNT FOR TIMER TICKS ELAPSED WHILE TICKLESS
+*
+* Description: This function is called by the tick ISR of a tickless port, when it wakes up from an idle
+*              period, for the OSTmrSignal() calls that were due at ticks which have already gone by.
+*              Timer ticks in which no timer expires are accounted for by advancing OSTmrTime directly
+*              (as OSTmr_Task() would have done had it been signaled on time); the timer task is only
+*              signaled for the remaining ones so that callbacks still run.
+*
+* Arguments  : ticks    is the number of 'timer' increments that elapsed in the past.
+*
+* Returns    : none
+*
+* Notes      : 1) A signal due at the tick being announced must still be given with OSTmrSignal().
+*              2) OSTmrTime is only advanced when the idle task was interrupted.  Any other task could be
+*                 in the middle of a timer service with the scheduler locked, so all ticks are signaled.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TICKLESS_EN > 0u)
+void  OSTmrTimeCatchUp (INT32U ticks)
+{
+    INT32U  next;
+    INT32U  skip;
+
+
+    skip = 0u;
+    if (OSTCBCur->OSTCBPrio == OS_TASK_IDLE_PRIO) {            /* Timers can't be in use, see Note #2             */
+        next = OSTmrNextGet();
+        if ((next == 0u) || (next > ticks)) {                  /* Skip every tick before the next expiry          */
+            skip = ticks;
+        } else {
+            skip = next - 1u;
+        }
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+        OSTmr_TimeSkip(skip);                                  /* Cascade the wheel as time goes by               */
+#else
+        OSTmrTime += skip;
+#endif
+    }
+    while (skip < ticks) {                                     /* Signal the ticks in which timers expire         */
+        (void)OSTmrSignal();
+        skip++;
+    }
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     ADD TIMERS TO THE TIMER POOL
+*
+* Description: This function is called by your application code to grow the pool of timers beyond the
+*              OS_TMR_CFG_MAX timers of OSTmrTbl[], with storage that it provides.
+*
+* Arguments  : ptmr_tbl      Is a pointer to a table of OS_TMRs.  The storage is owned by uC/OS-II from now
+*                            on and MUST never be released.
+*
+*              nbr           Is the number of timers in the table.
+*
+* Returns    : OS_ERR_NONE                The timers were added to the pool
+*              OS_ERR_TMR_INVALID         'ptmr_tbl' is a NULL pointer or 'nbr' is 0
+*              OS_ERR_TMR_ISR             if the call was made from an ISR
+*
+* Note(s)    : 1) The table can be allocated from a memory partition or a heap, for instance as the
+*                 application needs more timers.  Timers are never taken out of the pool.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_POOL_ADD_EN > 0u)
+INT8U  OSTmrPoolAdd (OS_TMR  *ptmr_tbl,
+                     INT32U   nbr)
+{
+    OS_TMR  *ptmr;
+    INT32U   ix;
+
+
+#if OS_ARG_CHK_EN > 0u
+    if ((ptmr_tbl == (OS_TMR *)0) ||                        /* Validate the table                                     */
+        (nbr      == 0u)) {
+        return (OS_ERR_TMR_INVALID);
+    }
+#endif
+    if (OSIntNesting > 0u) {                                /* See if trying to call from an ISR                      */
+        return (OS_ERR_TMR_ISR);
+    }
+    OSSchedLock();
+    ptmr = ptmr_tbl;
+    for (ix = 0u; ix < nbr; ix++) {                         /* Chain the timers and put them in front of free list   */
+        OS_MemClr((INT8U *)ptmr, sizeof(OS_TMR));
+        ptmr->OSTmrType  = OS_TMR_TYPE;
+        ptmr->OSTmrState = OS_TMR_STATE_UNUSED;             /* Indicate that timer is inactive                        */
+#if OS_TMR_CFG_NAME_EN > 0u
+        ptmr->OSTmrName  = (INT8U *)(void *)"?";
+#endif
+        if (ix < (nbr - 1u)) {
+            ptmr->OSTmrNext = (void *)(ptmr + 1);
+        } else {
+            ptmr->OSTmrNext = (void *)OSTmrFreeList;
+        }
+        ptmr++;
+    }
+    OSTmrFreeList = ptmr_tbl;
+    OSTmrFree    += nbr;
+    OSSchedUnlock();
+    return (OS_ERR_NONE);
+}
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -798,6 +1242,13 @@ static  void  OSTmr_Free (OS_TMR *ptmr)
 #if OS_TMR_CFG_NAME_EN > 0u
     ptmr->OSTmrName        = (INT8U *)(void *)"?";
 #endif
+#if OS_TMR_CFG_SLACK_EN > 0u
+    ptmr->OSTmrSlack       = 0u;
+#endif
+#if OS_TMR_CFG_WORKER_EN > 0u
+    ptmr->OSTmrWorker      = 0u;
+    ptmr->OSTmrGen++;                                  /* Drop the queued callbacks (see OSTmrDel() Note #1)          */
+#endif
 
     ptmr->OSTmrPrev        = (OS_TCB *)0;              /* Chain timer to free list                                    */
     ptmr->OSTmrNext        = OSTmrFreeList;
@@ -868,6 +1319,9 @@ void  OSTmr_Init (void)
 #endif
 
     OSTmr_InitTask();
+#if OS_TMR_CFG_WORKER_EN > 0u
+    OSTmr_InitWorkers();
+#endif
 }
 #endif
 
@@ -933,6 +1387,125 @@ static  void  OSTmr_InitTask (void)
 }
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   INITIALIZE THE TIMER WORKER TASKS
+*
+* Description: This function is called by OSTmr_Init() to create the timer worker tasks and their
+*              semaphores.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WORKER_EN > 0u)
+static  void  OSTmr_InitWorkers (void)
+{
+    OS_TMR_WORKER  *pworker;
+    INT8U           ix;
+#if OS_TASK_NAME_EN > 0u
+    INT8U           err;
+#endif
+
+
+    OS_MemClr((INT8U *)&OSTmrWorkerTbl[0], sizeof(OSTmrWorkerTbl));
+    OSTmrWorkerOvfCtr = 0u;
+    for (ix = 0u; ix < OS_TMR_CFG_WORKER_NBR; ix++) {
+        pworker                 = &OSTmrWorkerTbl[ix];
+        pworker->OSTmrWorkerSem = OSSemCreate(0u);
+#if OS_TASK_CREATE_EXT_EN > 0u
+    #if OS_STK_GROWTH == 1u
+        (void)OSTaskCreateExt(OSTmr_WorkerTask,
+                              (void *)pworker,                                      /* Queue of the worker task   */
+                              &OSTmrWorkerStk[ix][OS_TASK_TMR_WORKER_STK_SIZE - 1u],/* Set Top-Of-Stack           */
+                              OS_TASK_TMR_WORKER_PRIO + ix,
+                              OS_TASK_TMR_WORKER_ID,
+                              &OSTmrWorkerStk[ix][0],                               /* Set Bottom-Of-Stack        */
+                              OS_TASK_TMR_WORKER_STK_SIZE,
+                              (void *)0,                                            /* No TCB extension           */
+                              OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);           /* Stack checking + clear     */
+    #else
+        (void)OSTaskCreateExt(OSTmr_WorkerTask,
+                              (void *)pworker,                                      /* Queue of the worker task   */
+                              &OSTmrWorkerStk[ix][0],                               /* Set Top-Of-Stack           */
+                              OS_TASK_TMR_WORKER_PRIO + ix,
+                              OS_TASK_TMR_WORKER_ID,
+                              &OSTmrWorkerStk[ix][OS_TASK_TMR_WORKER_STK_SIZE - 1u],/* Set Bottom-Of-Stack        */
+                              OS_TASK_TMR_WORKER_STK_SIZE,
+                              (void *)0,                                            /* No TCB extension           */
+                              OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);           /* Stack checking + clear     */
+    #endif
+#else
+    #if OS_STK_GROWTH == 1u
+        (void)OSTaskCreate(OSTmr_WorkerTask,
+                           (void *)pworker,
+                           &OSTmrWorkerStk[ix][OS_TASK_TMR_WORKER_STK_SIZE - 1u],
+                           OS_TASK_TMR_WORKER_PRIO + ix);
+    #else
+        (void)OSTaskCreate(OSTmr_WorkerTask,
+                           (void *)pworker,
+                           &OSTmrWorkerStk[ix][0],
+                           OS_TASK_TMR_WORKER_PRIO + ix);
+    #endif
+#endif
+
+#if OS_TASK_NAME_EN > 0u
+        OSTaskNameSet(OS_TASK_TMR_WORKER_PRIO + ix, (INT8U *)(void *)"uC/OS-II Tmr Worker", &err);
+#endif
+#if OS_EVENT_NAME_EN > 0u
+        OSEventNameSet(pworker->OSTmrWorkerSem, (INT8U *)(void *)"uC/OS-II TmrWorker", &err);
+#endif
+    }
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    COALESCE THE EXPIRY OF A TIMER
+*
+* Description: This function is called by OSTmr_Link() to choose when a timer expires within its slack.
+*
+* Arguments  : due           Is the time the timer is due.
+*
+*              slack         Is the number of timer ticks the timer may expire after 'due'.
+*
+* Returns    : The time the timer expires, from 'due' to 'due' + 'slack'.
+*
+* Note(s)    : 1) The time chosen is the one in the window whose value ends with the most 0 bits.  Timers
+*                 whose windows overlap on a multiple of a power of 2 thus all expire on the coarsest such
+*                 multiple, without the wheel being searched: it is 'due' + 'slack' with the bits below the
+*                 highest bit that differs from 'due' cleared.
+*              2) The times wrap around like OSTmrTime, so does the window.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_SLACK_EN > 0u)
+static  INT32U  OSTmr_Coalesce (INT32U  due,
+                                INT32U  slack)
+{
+    INT32U  limit;
+    INT32U  mask;
+
+
+    limit = due + slack;                                           /* Latest time the timer may expire                */
+    mask  = due ^ limit;
+    if (mask == 0u) {                                              /* No slack                                        */
+        return (due);
+    }
+    mask |= mask >>  1u;                                           /* Set all the bits below the highest one ...      */
+    mask |= mask >>  2u;
+    mask |= mask >>  4u;
+    mask |= mask >>  8u;
+    mask |= mask >> 16u;
+    mask >>= 1u;                                                   /* ... but the highest one                         */
+    return (limit & ~mask);                                        /* See Note #1                                     */
+}
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -946,8 +1519,17 @@ static  void  OSTmr_InitTask (void)
 *              type          Is either:
 *                               OS_TMR_LINK_PERIODIC    Means to re-insert the timer after a period expired
 *                               OS_TMR_LINK_DLY         Means to insert    the timer the first time
+*                               OS_TMR_LINK_CASCADE     Means to re-insert the timer at a lower level of the
+*                                                       hierarchical wheel, it keeps its match time
 *
 * Returns    : none
+*
+* Note(s)    : 1) With OS_TMR_CFG_WHEEL_HIER_EN, the wheel has OS_TMR_WHEEL_LVL_NBR levels of spokes.  The
+*                 level of a timer is given by the highest bits of its match time that differ from
+*                 OSTmrTime, and its spoke by the value of these bits.  The timer goes down one level or
+*                 more (see OSTmr_Cascade()) when OSTmrTime reaches the time range of its spoke.
+*              2) With OS_TMR_CFG_SLACK_EN, OSTmrDue keeps the time the timer is due and OSTmrMatch the time
+*                 it expires, within its slack (see OSTmrSlackSet()).
 *********************************************************************************************************
 */
 
@@ -958,20 +1540,57 @@ static  void  OSTmr_Link (OS_TMR  *ptmr,
     OS_TMR       *ptmr1;
     OS_TMR_WHEEL *pspoke;
     INT16U        spoke;
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+    INT32U        diff;
+    INT16U        lvl;
+#endif
+#if OS_TMR_CFG_SLACK_EN > 0u
+    INT32U        slack;
+#endif
 
 
     ptmr->OSTmrState = OS_TMR_STATE_RUNNING;
+#if OS_TMR_CFG_SLACK_EN > 0u
+    if (type != OS_TMR_LINK_CASCADE) {                             /* Determine when timer is due (see Note #2)       */
+        if (type == OS_TMR_LINK_PERIODIC) {
+            ptmr->OSTmrDue = ptmr->OSTmrPeriod + ptmr->OSTmrDue;   /* Period counts from the previous due time ...    */
+        } else if (ptmr->OSTmrDly == 0u) {
+            ptmr->OSTmrDue = ptmr->OSTmrPeriod + OSTmrTime;
+        } else {
+            ptmr->OSTmrDue = ptmr->OSTmrDly    + OSTmrTime;
+        }
+        slack = ptmr->OSTmrSlack;
+        if ((ptmr->OSTmrOpt == OS_TMR_OPT_PERIODIC) &&             /* ... which must not be reached by the expiry     */
+            (slack      >= ptmr->OSTmrPeriod)) {
+            slack = ptmr->OSTmrPeriod - 1u;
+        }
+        ptmr->OSTmrMatch = OSTmr_Coalesce(ptmr->OSTmrDue, slack);  /* Determine when timer will expire               */
+    }
+#else
     if (type == OS_TMR_LINK_PERIODIC) {                            /* Determine when timer will expire                */
         ptmr->OSTmrMatch = ptmr->OSTmrPeriod + OSTmrTime;
-    } else {
+    } else if (type == OS_TMR_LINK_DLY) {
         if (ptmr->OSTmrDly == 0u) {
             ptmr->OSTmrMatch = ptmr->OSTmrPeriod + OSTmrTime;
         } else {
             ptmr->OSTmrMatch = ptmr->OSTmrDly    + OSTmrTime;
         }
     }
+#endif
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+    diff = ptmr->OSTmrMatch ^ OSTmrTime;                           /* Find level of timer (see Note #1)               */
+    lvl  = 0u;
+    while (diff >= OS_TMR_WHEEL_LVL_SIZE) {
+        diff >>= OS_TMR_WHEEL_LVL_BITS;
+        lvl++;
+    }
+    spoke  = (INT16U)((ptmr->OSTmrMatch >> (lvl * OS_TMR_WHEEL_LVL_BITS)) & (OS_TMR_WHEEL_LVL_SIZE - 1u));
+    pspoke = &OSTmrWheelTbl[(lvl * OS_TMR_WHEEL_LVL_SIZE) + spoke];
+    ptmr->OSTmrSpoke = (void *)pspoke;
+#else
     spoke  = (INT16U)(ptmr->OSTmrMatch % OS_TMR_CFG_WHEEL_SIZE);
     pspoke = &OSTmrWheelTbl[spoke];
+#endif
 
     if (pspoke->OSTmrFirst == (OS_TMR *)0) {                       /* Link into timer wheel                           */
         pspoke->OSTmrFirst   = ptmr;
@@ -1007,11 +1626,17 @@ static  void  OSTmr_Unlink (OS_TMR *ptmr)
     OS_TMR        *ptmr1;
     OS_TMR        *ptmr2;
     OS_TMR_WHEEL  *pspoke;
+#if OS_TMR_CFG_WHEEL_HIER_EN == 0u
     INT16U         spoke;
+#endif
 
 
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+    pspoke = (OS_TMR_WHEEL *)ptmr->OSTmrSpoke;
+#else
     spoke  = (INT16U)(ptmr->OSTmrMatch % OS_TMR_CFG_WHEEL_SIZE);
     pspoke = &OSTmrWheelTbl[spoke];
+#endif
 
     if (pspoke->OSTmrFirst == ptmr) {                       /* See if timer to remove is at the beginning of list     */
         ptmr1              = (OS_TMR *)ptmr->OSTmrNext;
@@ -1063,7 +1688,12 @@ static  void  OSTmr_Task (void *p_arg)
         OSSemPend(OSTmrSemSignal, 0u, &err);                     /* Wait for signal indicating time to update timers  */
         OSSchedLock();
         OSTmrTime++;                                             /* Increment the current time                        */
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+        OSTmr_Cascade();                                         /* Bring the timers due soon down to level 0         */
+        spoke  = (INT16U)(OSTmrTime & (OS_TMR_WHEEL_LVL_SIZE - 1u));
+#else
         spoke  = (INT16U)(OSTmrTime % OS_TMR_CFG_WHEEL_SIZE);    /* Position on current timer wheel entry             */
+#endif
         pspoke = &OSTmrWheelTbl[spoke];
         ptmr   = pspoke->OSTmrFirst;
         while (ptmr != (OS_TMR *)0) {
@@ -1071,6 +1701,7 @@ static  void  OSTmr_Task (void *p_arg)
                                                                  /* ... timer could get unlinked from the wheel.      */
             if (OSTmrTime == ptmr->OSTmrMatch) {                 /* Process each timer that expires                   */
                 OSTmr_Unlink(ptmr);                              /* Remove from current wheel spoke                   */
+                OS_TRACE_TMR_EXPIRE(ptmr);
                 if (ptmr->OSTmrOpt == OS_TMR_OPT_PERIODIC) {
                     OSTmr_Link(ptmr, OS_TMR_LINK_PERIODIC);      /* Recalculate new position of timer in wheel        */
                 } else {
@@ -1078,7 +1709,11 @@ static  void  OSTmr_Task (void *p_arg)
                 }
                 pfnct = ptmr->OSTmrCallback;                     /* Execute callback function if available            */
                 if (pfnct != (OS_TMR_CALLBACK)0) {
+#if OS_TMR_CFG_WORKER_EN > 0u
+                    OSTmr_WorkerPost(ptmr, pfnct);               /* ... in its worker task                            */
+#else
                     (*pfnct)((void *)ptmr, ptmr->OSTmrCallbackArg);
+#endif
                 }
             }
             ptmr = ptmr_next;
@@ -1087,3 +1722,227 @@ static  void  OSTmr_Task (void *p_arg)
     }
 }
 #endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                              HAND A CALLBACK OVER TO A TIMER WORKER TASK
+*
+* Description: This function is called by OSTmr_Task() to queue the callback of a timer that expired to the
+*              worker task selected by the timer.
+*
+* Arguments  : ptmr          Is a pointer to the timer that expired.
+*
+*              pfnct         Is the callback of the timer.
+*
+* Returns    : none
+*
+* Note(s)    : 1) When the queue of the worker task is full, the callback is run right away by the timer
+*                 task, with the scheduler locked, and OSTmrWorkerOvfCtr is incremented.
+*              2) The entry is filled in before OSTmrWorkerQIn is moved, and the worker task only reads it
+*                 once the semaphore is posted (see 'UCOS_II.H  TIMER DATA TYPES  Note #2').
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WORKER_EN > 0u)
+static  void  OSTmr_WorkerPost (OS_TMR           *ptmr,
+                                OS_TMR_CALLBACK   pfnct)
+{
+    OS_TMR_WORKER  *pworker;
+    OS_TMR_WORK    *pwork;
+    INT16U          in;
+    INT16U          in_next;
+
+
+    pworker = &OSTmrWorkerTbl[ptmr->OSTmrWorker];
+    in      = pworker->OSTmrWorkerQIn;
+    in_next = in + 1u;
+    if (in_next == OS_TMR_CFG_WORKER_Q_SIZE) {                   /* Wrap around                                       */
+        in_next = 0u;
+    }
+    if (in_next == pworker->OSTmrWorkerQOut) {                   /* Queue is full (see Note #1)                       */
+        OSTmrWorkerOvfCtr++;
+        (*pfnct)((void *)ptmr, ptmr->OSTmrCallbackArg);
+        return;
+    }
+    pwork                       = &pworker->OSTmrWorkerQ[in];
+    pwork->OSTmrWorkTmr         = ptmr;
+    pwork->OSTmrWorkCallback    = pfnct;
+    pwork->OSTmrWorkCallbackArg = ptmr->OSTmrCallbackArg;
+    pwork->OSTmrWorkTS          = (INT32U)CPU_TS_Get32();        /* Latency of the callback starts now                */
+    pwork->OSTmrWorkGen         = ptmr->OSTmrGen;
+    pworker->OSTmrWorkerQIn     = in_next;                       /* Publish the entry (see Note #2) ...               */
+    (void)OSSemPost(pworker->OSTmrWorkerSem);                    /* ... and wake up the worker task                   */
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          TIMER WORKER TASK
+*
+* Description: This task is created by OSTmr_InitWorkers() and runs the callbacks of the timers that
+*              expired, queued by OSTmr_Task(), with the scheduler unlocked.
+*
+* Arguments  : p_arg         Is a pointer to the OS_TMR_WORKER of the task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) A callback is dropped if its timer was stopped or deleted after it was queued (see
+*                 'UCOS_II.H  TIMER DATA TYPES  Note #3').  The generation is checked in the same critical
+*                 section as the statistics are updated, so OSTmrStop() & OSTmrDel() drop every callback
+*                 that has not reached that point.
+*              2) The callback may delete its own timer.  The statistics of a timer that is no longer in use
+*                 are not updated.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WORKER_EN > 0u)
+static  void  OSTmr_WorkerTask (void *p_arg)
+{
+    OS_TMR_WORKER  *pworker;
+    OS_TMR_WORK     work;
+    OS_TMR_LAT     *plat;
+    INT32U          ts_start;
+    INT32U          lat;
+    INT32U          exec;
+    INT16U          out_next;
+    BOOLEAN         run;
+    INT8U           err;
+#if OS_CRITICAL_METHOD == 3u                                     /* Allocate storage for CPU status register          */
+    OS_CPU_SR       cpu_sr = 0u;
+#endif
+
+
+
+    pworker = (OS_TMR_WORKER *)p_arg;
+    for (;;) {
+        OSSemPend(pworker->OSTmrWorkerSem, 0u, &err);            /* Wait for a callback to run                        */
+        work     = pworker->OSTmrWorkerQ[pworker->OSTmrWorkerQOut];   /* Copy the entry ...                           */
+        out_next = pworker->OSTmrWorkerQOut + 1u;
+        if (out_next == OS_TMR_CFG_WORKER_Q_SIZE) {
+            out_next = 0u;
+        }
+        pworker->OSTmrWorkerQOut = out_next;                     /* ... before giving it back to the timer task       */
+        ts_start = (INT32U)CPU_TS_Get32();
+        lat      = ts_start - work.OSTmrWorkTS;
+        plat     = &work.OSTmrWorkTmr->OSTmrLat;
+        OS_ENTER_CRITICAL();
+        if (work.OSTmrWorkTmr->OSTmrGen != work.OSTmrWorkGen) {  /* Timer stopped or deleted since (see Note #1)      */
+            run = OS_FALSE;
+        } else {
+            run = OS_TRUE;
+            plat->OSTmrLatCtr++;
+            plat->OSTmrLatLast = lat;
+            if (lat > plat->OSTmrLatMax) {
+                plat->OSTmrLatMax = lat;
+            }
+        }
+        OS_EXIT_CRITICAL();
+        if (run == OS_TRUE) {
+            (*work.OSTmrWorkCallback)((void *)work.OSTmrWorkTmr, work.OSTmrWorkCallbackArg);
+            exec = (INT32U)CPU_TS_Get32() - ts_start;
+            OS_ENTER_CRITICAL();
+            if (work.OSTmrWorkTmr->OSTmrState != OS_TMR_STATE_UNUSED) {   /* See Note #2                              */
+                plat->OSTmrExecLast = exec;
+                if (exec > plat->OSTmrExecMax) {
+                    plat->OSTmrExecMax = exec;
+                }
+            }
+            OS_EXIT_CRITICAL();
+        }
+    }
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 CASCADE THE HIERARCHICAL TIMER WHEEL
+*
+* Description: This function is called when OSTmrTime was incremented, to move the timers of the spokes
+*              whose time range has been reached down the levels of the hierarchical wheel.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) The spoke of level 'n' is reached when the bits of OSTmrTime below that level are all 0,
+*                 that is every OS_TMR_WHEEL_LVL_SIZE ^ n timer ticks.  Each timer is thus moved at most
+*                 OS_TMR_WHEEL_LVL_NBR - 1 times and the cost of a timer tick does not depend on the number
+*                 of timers running.
+*              2) The higher levels are cascaded first, as their timers may go to the spoke of a lower
+*                 level that is reached at the same time.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WHEEL_HIER_EN > 0u)
+static  void  OSTmr_Cascade (void)
+{
+    OS_TMR        *ptmr;
+    OS_TMR        *ptmr_next;
+    OS_TMR_WHEEL  *pspoke;
+    INT32U         time;
+    INT16U         spoke;
+    INT16U         lvl;
+
+
+    time = OSTmrTime;                                            /* Find the highest level reached (see Note #1)      */
+    lvl  = 0u;
+    while ((lvl < (OS_TMR_WHEEL_LVL_NBR - 1u)) &&
+           ((time & (OS_TMR_WHEEL_LVL_SIZE - 1u)) == 0u)) {
+        time >>= OS_TMR_WHEEL_LVL_BITS;
+        lvl++;
+    }
+    while (lvl > 0u) {                                           /* Cascade from that level down (see Note #2)        */
+        spoke  = (INT16U)((OSTmrTime >> (lvl * OS_TMR_WHEEL_LVL_BITS)) & (OS_TMR_WHEEL_LVL_SIZE - 1u));
+        pspoke = &OSTmrWheelTbl[(lvl * OS_TMR_WHEEL_LVL_SIZE) + spoke];
+        ptmr   = pspoke->OSTmrFirst;
+        pspoke->OSTmrFirst   = (OS_TMR *)0;                      /* Empty the spoke ...                               */
+        pspoke->OSTmrEntries = 0u;
+        while (ptmr != (OS_TMR *)0) {                            /* ... and re-insert its timers a level lower        */
+            ptmr_next = (OS_TMR *)ptmr->OSTmrNext;
+            OSTmr_Link(ptmr, OS_TMR_LINK_CASCADE);
+            ptmr      = ptmr_next;
+        }
+        lvl--;
+    }
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 SKIP TIMER TICKS OF THE HIERARCHICAL WHEEL
+*
+* Description: This function is called by OSTmrTimeCatchUp() to advance OSTmrTime by timer ticks in which no
+*              timer expires, cascading the wheel when its levels are reached on the way.
+*
+* Arguments  : ticks    is the number of timer ticks to skip.
+*
+* Returns    : none
+*
+* Note(s)    : 1) OSTmrTime only jumps from one level 0 wrap to the next, so this takes 'ticks' divided by
+*                 OS_TMR_WHEEL_LVL_SIZE iterations.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WHEEL_HIER_EN > 0u) && (OS_TICKLESS_EN > 0u)
+static  void  OSTmr_TimeSkip (INT32U ticks)
+{
+    INT32U  step;
+
+
+    while (ticks > 0u) {
+        step = OS_TMR_WHEEL_LVL_SIZE - (OSTmrTime & (OS_TMR_WHEEL_LVL_SIZE - 1u));
+        if (step > ticks) {                                      /* Next level 0 wrap is beyond the ticks to skip     */
+            OSTmrTime += ticks;
+            ticks      = 0u;
+        } else {
+            OSTmrTime += step;                                   /* Go to the next level 0 wrap and cascade           */
+            ticks     -= step;
+            OSTmr_Cascade();
+        }
+    }
+}
+#endif
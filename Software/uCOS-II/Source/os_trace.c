@@ -0,0 +1,317 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                            TRACE RECORDER
+*
+*                              (c) Copyright 1992-2013, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+*
+* File    : OS_TRACE.C
+* By      : Jean J. Labrosse
+* Version : V2.92.11
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrium to properly license
+* its use in your product. We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+/*
+*********************************************************************************************************
+*                                                        NOTES
+*
+* 1) With OS_TRACE_EN, the kernel records context switches (OSTaskSwHook()), ISR entries and exits,
+*    pends and posts on semaphores, mailboxes, queues, mutexes and event flags, timer expiries and task
+*    creations and deletions (see OS_TRACE_xxx() in UCOS_II.H).  Each record is timestamped with
+*    CPU_TS_Get32(): CPU_CFG_TS_32_EN MUST be enabled in CPU_CFG.H.
+*
+* 2) Each core has its own ring of OS_TRACE_BUF_SIZE records, written only by that core: a record is
+*    stored with the core's interrupts disabled, then published by advancing OSTraceBufIn.  The task
+*    exporting the records copies them without disabling interrupts and frees them by advancing
+*    OSTraceBufOut.  When the ring is full, new records are dropped and counted, never overwritten, so
+*    the exporter always reads complete records.
+*
+* 3) Recording a record costs a timestamp, a short critical section and 16 bytes of stores.  The budget
+*    is 100 CPU cycles per record, timestamp included.  On the Linux x86-64 port, it takes about 45 ns,
+*    of which the timestamp (clock_gettime()) takes about 37 ns.
+*
+* 4) A single task exports the records (see OSTraceExport()).  The stream it produces is:
+*
+*        OS_TRACE_HDR                                  Once, after OSTraceStart()
+*        OS_TRACE_PKT + OSTracePktRecCnt x OS_TRACE_REC  For each run of records of a core
+*
+*    in the byte order of the target, which the host tells from OSTraceHdrMagic.  A host converter to
+*    the Chrome/Perfetto trace format is provided in uCOS-II/Tools/os_trace_conv.c.
+*********************************************************************************************************
+*/
+
+#if OS_TRACE_EN > 0u
+#if (CPU_CFG_TS_32_EN != DEF_ENABLED)
+#error  "OS_TRACE.C, CPU_CFG_TS_32_EN must be enabled in CPU_CFG.H to timestamp the trace records"
+#endif
+
+#if OS_SMP_EN > 0u
+#define  OS_TRACE_CORE_ID()     OS_CPU_CoreIdGet()
+#else
+#define  OS_TRACE_CORE_ID()     0u
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           RECORD AN EVENT
+*
+* Description: This function is called through the OS_TRACE_xxx() macros to add a record to the trace
+*              buffer of the calling core.
+*
+* Arguments  : type      is the type of record (see OS_TRACE_TYPE_xxx)
+*
+*              arg       is the object type or the ISR nesting level
+*
+*              prio      is the priority of the task concerned
+*
+*              pobj      is a pointer to the object concerned, NULL if none
+*
+*              val       is the timeout, flags, time or priority recorded with the event
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) The record is dropped when the buffer is full (see OS_TRACE.C  Note #2).
+*********************************************************************************************************
+*/
+
+void  OS_TraceRec (INT8U         type,
+                   INT8U         arg,
+                   OS_PRIO_NBR   prio,
+                   void         *pobj,
+                   INT32U        val)
+{
+    OS_TRACE_BUF  *pbuf;
+    OS_TRACE_REC  *prec;
+    INT32U         in;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR      cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    if (OSTraceRunning == OS_FALSE) {
+        OS_EXIT_CRITICAL();
+        return;
+    }
+    pbuf = &OSTraceBufTbl[OS_TRACE_CORE_ID()];
+    in   = pbuf->OSTraceBufIn;
+    if ((in - pbuf->OSTraceBufOut) >= OS_TRACE_BUF_SIZE) {
+        pbuf->OSTraceBufLostCtr++;                    /* Buffer is full, drop the record (see Note #2) */
+        OS_EXIT_CRITICAL();
+        return;
+    }
+    prec                 = &pbuf->OSTraceBufRecTbl[in & (OS_TRACE_BUF_SIZE - 1u)];
+    prec->OSTraceRecTS   = (INT32U)CPU_TS_Get32();
+    prec->OSTraceRecType = type;
+    prec->OSTraceRecArg  = arg;
+    prec->OSTraceRecPrio = (INT16U)prio;
+    prec->OSTraceRecObj  = (INT32U)(CPU_ADDR)pobj;
+    prec->OSTraceRecVal  = val;
+    pbuf->OSTraceBufIn   = in + 1u;                   /* Publish the record                            */
+    OS_EXIT_CRITICAL();
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          EXPORT THE RECORDS
+*
+* Description: This function hands the records buffered so far, on all the cores, to a write function.
+*              Called periodically by a task, it streams the trace to a file, a socket or a debug probe.
+*
+* Arguments  : pfnct     is the function that writes the stream.  It is called with 'p_arg', a pointer
+*                        to the data and its size in bytes, several times per export.
+*
+*              p_arg     is the argument passed to 'pfnct'
+*
+* Returns    : The number of records exported.
+*
+* Note(s)    : 1) The first export after OSTraceStart() begins the stream with an OS_TRACE_HDR (see
+*                 OS_TRACE.C  Note #4).
+*              2) The records are written straight from the buffers, with interrupts enabled.  The space
+*                 they use is freed after 'pfnct' returns.
+*              3) Only one task may export the records.
+*********************************************************************************************************
+*/
+
+INT32U  OSTraceExport (OS_TRACE_WR_FNCT   pfnct,
+                       void              *p_arg)
+{
+    OS_TRACE_BUF  *pbuf;
+    OS_TRACE_HDR   hdr;
+    OS_TRACE_PKT   pkt;
+    INT32U         in;
+    INT32U         out;
+    INT32U         nbr;
+    INT32U         total;
+    INT16U         core;
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+    CPU_ERR        err;
+#endif
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR      cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pfnct == (OS_TRACE_WR_FNCT)0) {
+        return (0u);
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    if (OSTraceHdrPend == OS_TRUE) {                  /* See Note #1                                   */
+        OSTraceHdrPend = OS_FALSE;
+        OS_EXIT_CRITICAL();
+        hdr.OSTraceHdrMagic      = OS_TRACE_MAGIC;
+        hdr.OSTraceHdrVersion    = OS_TRACE_VERSION;
+        hdr.OSTraceHdrRecSize    = (INT16U)sizeof(OS_TRACE_REC);
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+        hdr.OSTraceHdrTSFreq     = (INT32U)CPU_TS_TmrFreqGet(&err);
+#else
+        hdr.OSTraceHdrTSFreq     = 0u;
+#endif
+        hdr.OSTraceHdrCoreNbr    = OS_TRACE_CORE_NBR;
+        hdr.OSTraceHdrLowestPrio = OS_LOWEST_PRIO;
+        (*pfnct)(p_arg, (void const *)&hdr, (INT32U)sizeof(hdr));
+    } else {
+        OS_EXIT_CRITICAL();
+    }
+
+    total = 0u;
+    for (core = 0u; core < OS_TRACE_CORE_NBR; core++) {
+        pbuf = &OSTraceBufTbl[core];
+        OS_ENTER_CRITICAL();
+        in                      = pbuf->OSTraceBufIn;
+        out                     = pbuf->OSTraceBufOut;
+        pkt.OSTracePktLostCtr   = pbuf->OSTraceBufLostCtr;
+        pbuf->OSTraceBufLostCtr = 0u;
+        OS_EXIT_CRITICAL();
+        while ((in != out) || (pkt.OSTracePktLostCtr > 0u)) {
+            nbr = in - out;                           /* Records up to the end of the ring ...         */
+            if (nbr > (OS_TRACE_BUF_SIZE - (out & (OS_TRACE_BUF_SIZE - 1u)))) {
+                nbr = OS_TRACE_BUF_SIZE - (out & (OS_TRACE_BUF_SIZE - 1u));
+            }
+            if (nbr > 65535u) {                       /* ... that fit in one packet                    */
+                nbr = 65535u;
+            }
+            pkt.OSTracePktCore   = core;
+            pkt.OSTracePktRecCnt = (INT16U)nbr;
+            (*pfnct)(p_arg, (void const *)&pkt, (INT32U)sizeof(pkt));
+            if (nbr > 0u) {
+                (*pfnct)(p_arg,
+                         (void const *)&pbuf->OSTraceBufRecTbl[out & (OS_TRACE_BUF_SIZE - 1u)],
+                         nbr * (INT32U)sizeof(OS_TRACE_REC));
+            }
+            out                   += nbr;
+            total                 += nbr;
+            pkt.OSTracePktLostCtr  = 0u;
+            OS_ENTER_CRITICAL();
+            pbuf->OSTraceBufOut    = out;             /* Free the records (see Note #2)                */
+            OS_EXIT_CRITICAL();
+        }
+    }
+    return (total);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           START RECORDING
+*
+* Description: This function empties the trace buffers and starts recording events.  The next export
+*              begins a new stream.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  OSTraceStart (void)
+{
+    INT16U     core;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    for (core = 0u; core < OS_TRACE_CORE_NBR; core++) {
+        OSTraceBufTbl[core].OSTraceBufIn      = 0u;
+        OSTraceBufTbl[core].OSTraceBufOut     = 0u;
+        OSTraceBufTbl[core].OSTraceBufLostCtr = 0u;
+    }
+    OSTraceHdrPend = OS_TRUE;
+    OSTraceRunning = OS_TRUE;
+    OS_EXIT_CRITICAL();
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            STOP RECORDING
+*
+* Description: This function stops recording events.  The records buffered so far may still be exported.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  OSTraceStop (void)
+{
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    OSTraceRunning = OS_FALSE;
+    OS_EXIT_CRITICAL();
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             INITIALIZATION
+*
+* Description: This function is called by OSInit() to initialize the trace recorder.  Events are not
+*              recorded until OSTraceStart() is called.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  OS_TraceInit (void)
+{
+    OS_MemClr((INT8U *)&OSTraceBufTbl[0], sizeof(OSTraceBufTbl));
+    OSTraceRunning = OS_FALSE;
+    OSTraceHdrPend = OS_FALSE;
+}
+#endif
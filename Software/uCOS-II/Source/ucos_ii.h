@@ -45,6 +45,11 @@ extern "C" {
 #include <os_cfg.h>
 #include <os_cpu.h>
 
+#if (OS_SCHED_CNT_ZEROS_EN > 0u) || (OS_TRACE_EN > 0u) || (OS_TASK_PROFILE_EN > 0u) || (OS_TASK_LAT_EN > 0u) || \
+    (OS_TMR_CFG_WORKER_EN > 0u) || (OS_HRT_EN > 0u)
+#include <cpu_core.h>
+#endif
+
 /*
 *********************************************************************************************************
 *                                            MISCELLANEOUS
@@ -67,8 +72,13 @@ extern "C" {
 
 #define  OS_ASCII_NUL            (INT8U)0
 
+#if OS_LOWEST_PRIO <= 254u
 #define  OS_PRIO_SELF                0xFFu              /* Indicate SELF priority                      */
 #define  OS_PRIO_MUTEX_CEIL_DIS      0xFFu              /* Disable mutex priority ceiling promotion    */
+#else
+#define  OS_PRIO_SELF              0xFFFFu
+#define  OS_PRIO_MUTEX_CEIL_DIS    0xFFFFu
+#endif
 
 #if OS_TASK_STAT_EN > 0u
 #define  OS_N_SYS_TASKS                 2u              /* Number of system tasks                      */
@@ -76,6 +86,12 @@ extern "C" {
 #define  OS_N_SYS_TASKS                 1u
 #endif
 
+#if OS_SMP_EN > 0u
+#define  OS_N_CORE_TASKS  (OS_SMP_CORE_NBR - 1u)        /* Idle tasks of the cores other than core 0   */
+#else
+#define  OS_N_CORE_TASKS                0u
+#endif
+
 #define  OS_TASK_STAT_PRIO  (OS_LOWEST_PRIO - 1u)       /* Statistic task priority                     */
 #define  OS_TASK_IDLE_PRIO  (OS_LOWEST_PRIO)            /* IDLE      task priority                     */
 
@@ -87,11 +103,20 @@ extern "C" {
 #define  OS_RDY_TBL_SIZE   ((OS_LOWEST_PRIO) / 16u + 1u)/* Size of ready table                         */
 #endif
 
+#if OS_LOWEST_PRIO > 254u                               /* Three levels: group, group table, table     */
+#define  OS_EVENT_GRP_TBL_SIZE  ((OS_EVENT_TBL_SIZE - 1u) / 16u + 1u)  /* Size of event group table    */
+#define  OS_RDY_GRP_TBL_SIZE    ((OS_RDY_TBL_SIZE   - 1u) / 16u + 1u)  /* Size of ready group table    */
+#endif
+
 #define  OS_TASK_IDLE_ID            65535u              /* ID numbers for Idle, Stat and Timer tasks   */
 #define  OS_TASK_STAT_ID            65534u
 #define  OS_TASK_TMR_ID             65533u
+#define  OS_TASK_INT_Q_ID           65532u
+#define  OS_TASK_TMR_WORKER_ID      65531u
+#define  OS_TASK_HRT_ID             65530u
 
-#define  OS_EVENT_EN           (((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u) || (OS_SEM_EN > 0u) || (OS_MUTEX_EN > 0u))
+#define  OS_EVENT_EN           (((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u) || (OS_SEM_EN > 0u) || (OS_MUTEX_EN > 0u) || \
+                                ((OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)))
 
 #define  OS_TCB_RESERVED        ((OS_TCB *)1)
 
@@ -132,9 +157,11 @@ extern "C" {
 #define  OS_EVENT_TYPE_SEM              3u
 #define  OS_EVENT_TYPE_MUTEX            4u
 #define  OS_EVENT_TYPE_FLAG             5u
+#define  OS_EVENT_TYPE_QV               6u
 
 #define  OS_TMR_TYPE                  100u  /* Used to identify Timers ...                             */
                                             /* ... (Must be different value than OS_EVENT_TYPE_xxx)    */
+#define  OS_HRT_TYPE                  101u  /* Used to identify high-resolution timers                 */
 
 /*
 *********************************************************************************************************
@@ -160,6 +187,8 @@ extern "C" {
 #define  OS_FLAG_CLR                    0u
 #define  OS_FLAG_SET                    1u
 
+#define  OS_FLAG_BIT_NONE            0xFFu  /* Bucket in the list of its state, not watching one flag  */
+
 /*
 *********************************************************************************************************
 *                                     Values for OSTickStepState
@@ -238,6 +267,58 @@ extern "C" {
 #define  OS_TMR_STATE_COMPLETED         2u
 #define  OS_TMR_STATE_RUNNING           3u
 
+/*
+*********************************************************************************************************
+*                     HIGH-RESOLUTION TIMER OPTIONS AND STATES (see OSHrtStart())
+*********************************************************************************************************
+*/
+#define  OS_HRT_OPT_DLY                 0u  /* Expire 'ts' timestamp counts from now                   */
+#define  OS_HRT_OPT_ABS                 1u  /* Expire when the timestamp reaches 'ts'                  */
+
+#define  OS_HRT_STATE_UNUSED            0u
+#define  OS_HRT_STATE_STOPPED           1u
+#define  OS_HRT_STATE_COMPLETED         2u  /* Expired, callback has been called                       */
+#define  OS_HRT_STATE_RUNNING           3u  /* Waiting for its deadline                                */
+#define  OS_HRT_STATE_EXPIRED           4u  /* Expired, callback waiting for the HR timer task         */
+
+/*
+*********************************************************************************************************
+*                                 DEFERRED ISR POST TYPES (see OS_IntQPost())
+*********************************************************************************************************
+*/
+#define  OS_INT_Q_TYPE_SEM              1u  /* OSSemPost()                                             */
+#define  OS_INT_Q_TYPE_MBOX             2u  /* OSMboxPost()                                            */
+#define  OS_INT_Q_TYPE_MBOX_OPT         3u  /* OSMboxPostOpt()                                         */
+#define  OS_INT_Q_TYPE_Q                4u  /* OSQPost()                                               */
+#define  OS_INT_Q_TYPE_Q_FRONT          5u  /* OSQPostFront()                                          */
+#define  OS_INT_Q_TYPE_Q_OPT            6u  /* OSQPostOpt()                                            */
+#define  OS_INT_Q_TYPE_FLAG             7u  /* OSFlagPost()                                            */
+#define  OS_INT_Q_TYPE_QV_COMMIT        8u  /* OSQVCommit()                                            */
+#define  OS_INT_Q_TYPE_QV_RELEASE       9u  /* OSQVRelease()                                           */
+
+/*
+*********************************************************************************************************
+*                                  TRACE RECORD TYPES (see OS_TraceRec())
+*********************************************************************************************************
+*/
+#define  OS_TRACE_TYPE_TASK_SW          1u  /* Context switch,   Prio = task in,   Val = task out      */
+#define  OS_TRACE_TYPE_INT_ENTER        2u  /* ISR entered,      Arg  = nesting level after entry      */
+#define  OS_TRACE_TYPE_INT_EXIT         3u  /* ISR exited,       Arg  = nesting level before exit      */
+#define  OS_TRACE_TYPE_PEND             4u  /* Pend on object,   Arg  = OS_EVENT_TYPE_xxx, Val = tmo   */
+#define  OS_TRACE_TYPE_POST             5u  /* Post to object,   Arg  = OS_EVENT_TYPE_xxx, Val = flags */
+#define  OS_TRACE_TYPE_TMR_EXPIRE       6u  /* Timer expired,    Val  = OSTmrTime                      */
+#define  OS_TRACE_TYPE_TASK_CREATE      7u  /* Task created,     Prio = new task                       */
+#define  OS_TRACE_TYPE_TASK_DEL         8u  /* Task deleted,     Prio = deleted task                   */
+
+#define  OS_TRACE_MAGIC        0x5452534Fu  /* "OSRT" in memory on little endian CPUs                  */
+#define  OS_TRACE_VERSION               1u  /* Version of the exported stream (see OSTraceExport())    */
+
+#if OS_SMP_EN > 0u
+#define  OS_TRACE_CORE_NBR      OS_SMP_CORE_NBR
+#else
+#define  OS_TRACE_CORE_NBR              1u
+#endif
+
 /*
 *********************************************************************************************************
 *                                             ERROR CODES
@@ -270,6 +351,8 @@ extern "C" {
 
 #define OS_ERR_Q_FULL                  30u
 #define OS_ERR_Q_EMPTY                 31u
+#define OS_ERR_Q_BUSY                  32u
+#define OS_ERR_Q_NOT_HELD              33u
 
 #define OS_ERR_PRIO_EXIST              40u
 #define OS_ERR_PRIO                    41u
@@ -292,6 +375,11 @@ extern "C" {
 #define OS_ERR_TASK_SUSPEND_IDLE       71u
 #define OS_ERR_TASK_SUSPEND_PRIO       72u
 #define OS_ERR_TASK_WAITING            73u
+#define OS_ERR_TASK_PERIOD             74u
+#define OS_ERR_TASK_NOT_EDF            75u
+#define OS_ERR_TASK_AFFINITY           76u
+#define OS_ERR_TASK_RUNNING            77u
+#define OS_ERR_TASK_THRESHOLD          78u
 
 #define OS_ERR_TIME_NOT_DLY            80u
 #define OS_ERR_TIME_INVALID_MINUTES    81u
@@ -336,6 +424,7 @@ extern "C" {
 #define OS_ERR_TMR_INVALID_STATE      141u
 #define OS_ERR_TMR_STOPPED            142u
 #define OS_ERR_TMR_NO_CALLBACK        143u
+#define OS_ERR_TMR_INVALID_WORKER     144u
 
 #define OS_ERR_NO_MORE_ID_AVAIL       150u
 
@@ -345,6 +434,8 @@ extern "C" {
 #define OS_ERR_TLS_DESTRUCT_ASSIGNED  163u
 #define OS_ERR_OS_NOT_RUNNING         164u
 
+#define OS_ERR_INT_Q_FULL             170u
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -372,12 +463,35 @@ typedef  INT8U    OS_PRIO;
 typedef  INT16U   OS_PRIO;
 #endif
 
+#if OS_LOWEST_PRIO <= 254u
+typedef  INT8U    OS_PRIO_NBR;                      /* Task priority number                            */
+#else
+typedef  INT16U   OS_PRIO_NBR;
+#endif
+
+#if OS_SMP_EN > 0u
+typedef  INT32U   OS_CORE_MSK;                      /* Set of cores, bit 'n' set == core 'n'           */
+
+#if OS_SMP_CORE_NBR >= 32u
+#define  OS_CORE_MSK_ALL            0xFFFFFFFFuL        /* All the cores of the system                 */
+#else
+#define  OS_CORE_MSK_ALL  ((OS_CORE_MSK)((1uL << OS_SMP_CORE_NBR) - 1uL))
+#endif
+#endif
+
 #if (OS_EVENT_EN) && (OS_MAX_EVENTS > 0u)
 typedef struct os_event {
     INT8U    OSEventType;                   /* Type of event control block (see OS_EVENT_TYPE_xxxx)    */
     void    *OSEventPtr;                    /* Pointer to message or queue structure                   */
+#if OS_LOWEST_PRIO <= 254u
     INT16U   OSEventCnt;                    /* Semaphore Count (not used if other EVENT type)          */
+#else
+    INT32U   OSEventCnt;                    /* Semaphore Count, or mutex PCP and owner priority        */
+#endif
     OS_PRIO  OSEventGrp;                    /* Group corresponding to tasks waiting for event to occur */
+#if OS_LOWEST_PRIO > 254u
+    OS_PRIO  OSEventGrpTbl[OS_EVENT_GRP_TBL_SIZE];  /* Groups of the wait list's table entries         */
+#endif
     OS_PRIO  OSEventTbl[OS_EVENT_TBL_SIZE]; /* List of tasks waiting for event to occur                */
 
 #if OS_EVENT_NAME_EN > 0u
@@ -395,7 +509,7 @@ typedef struct os_event {
 
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
 
-#if OS_FLAGS_NBITS == 8u                    /* Determine the size of OS_FLAGS (8, 16 or 32 bits)       */
+#if OS_FLAGS_NBITS == 8u                    /* Determine the size of OS_FLAGS (8, 16, 32 or 64 bits)   */
 typedef  INT8U    OS_FLAGS;
 #endif
 
@@ -407,11 +521,24 @@ typedef  INT16U   OS_FLAGS;
 typedef  INT32U   OS_FLAGS;
 #endif
 
+#if OS_FLAGS_NBITS == 64u
+typedef  INT64U   OS_FLAGS;
+#endif
+
 
 typedef struct os_flag_grp {                /* Event Flag Group                                        */
     INT8U         OSFlagType;               /* Should be set to OS_EVENT_TYPE_FLAG                     */
     void         *OSFlagWaitList;           /* Pointer to first NODE of task waiting on event flag     */
     OS_FLAGS      OSFlagFlags;              /* 8, 16 or 32 bit flags                                   */
+#if OS_FLAG_INDEX_EN > 0u
+    void         *OSFlagWaitListClr;        /* Pointer to first bucket of tasks waiting for ANY CLR    */
+    OS_FLAGS      OSFlagWaitSet;            /* Flags that the tasks waiting for ANY SET flag wait on   */
+    OS_FLAGS      OSFlagWaitClr;            /* Flags that the tasks waiting for ANY CLR flag wait on   */
+    OS_FLAGS      OSFlagBitSet;             /* Flags watched by the buckets of OSFlagBitListSet[]      */
+    OS_FLAGS      OSFlagBitClr;             /* Flags watched by the buckets of OSFlagBitListClr[]      */
+    void         *OSFlagBitListSet[OS_FLAGS_NBITS]; /* Buckets waiting for ALL SET, per flag watched   */
+    void         *OSFlagBitListClr[OS_FLAGS_NBITS]; /* Buckets waiting for ALL CLR, per flag watched   */
+#endif
 #if OS_FLAG_NAME_EN > 0u
     INT8U        *OSFlagName;
 #endif
@@ -430,7 +557,24 @@ typedef struct os_flag_node {               /* Event Flag Wait List Node
                                             /*      OS_FLAG_WAIT_ALL                                   */
                                             /*      OS_FLAG_WAIT_OR                                    */
                                             /*      OS_FLAG_WAIT_ANY                                   */
+#if OS_FLAG_INDEX_EN > 0u
+    void         *OSFlagNodeSameNext;       /* Pointer to next     NODE in the same bucket             */
+    void         *OSFlagNodeSamePrev;       /* Pointer to previous NODE in the same bucket (0 == head) */
+    INT8U         OSFlagNodeBit;            /* Flag watched by the bucket, OS_FLAG_BIT_NONE if none    */
+#endif
 } OS_FLAG_NODE;
+
+
+
+#if OS_FLAG_MULTI_EN > 0u
+typedef struct os_flag_pend_data {          /* Condition waited on by OSFlagPendMulti()                */
+    OS_FLAG_GRP  *OSFlagPendGrp;            /* Pointer to Event Flag Group                             */
+    OS_FLAGS      OSFlagPendFlags;          /* Event flags to wait on                                  */
+    INT8U         OSFlagPendWaitType;       /* Type of wait, OS_FLAG_CONSUME may be added              */
+    OS_FLAGS      OSFlagPendFlagsRdy;       /* Event flags that made the condition true (0 if not)     */
+    OS_FLAG_NODE  OSFlagPendNode;           /* Wait list node, used by uC/OS-II only                   */
+} OS_FLAG_PEND_DATA;
+#endif
 #endif
 
 /*$PAGE*/
@@ -445,6 +589,9 @@ typedef struct os_mbox_data {
     void   *OSMsg;                          /* Pointer to message in mailbox                           */
     OS_PRIO OSEventTbl[OS_EVENT_TBL_SIZE];  /* List of tasks waiting for event to occur                */
     OS_PRIO OSEventGrp;                     /* Group corresponding to tasks waiting for event to occur */
+#if OS_LOWEST_PRIO > 254u
+    OS_PRIO OSEventGrpTbl[OS_EVENT_GRP_TBL_SIZE];   /* Groups of the wait list's table entries         */
+#endif
 } OS_MBOX_DATA;
 #endif
 
@@ -488,9 +635,12 @@ typedef struct os_mem_data {
 typedef struct os_mutex_data {
     OS_PRIO OSEventTbl[OS_EVENT_TBL_SIZE];  /* List of tasks waiting for event to occur                */
     OS_PRIO OSEventGrp;                     /* Group corresponding to tasks waiting for event to occur */
+#if OS_LOWEST_PRIO > 254u
+    OS_PRIO OSEventGrpTbl[OS_EVENT_GRP_TBL_SIZE];   /* Groups of the wait list's table entries         */
+#endif
     BOOLEAN OSValue;                        /* Mutex value (OS_FALSE = used, OS_TRUE = available)      */
-    INT8U   OSOwnerPrio;                    /* Mutex owner's task priority or 0xFF if no owner         */
-    INT8U   OSMutexPCP;                     /* Priority Ceiling Priority or 0xFF if PCP disabled       */
+    OS_PRIO_NBR OSOwnerPrio;                /* Mutex owner's task priority or all 1s if no owner       */
+    OS_PRIO_NBR OSMutexPCP;                 /* Priority Ceiling Priority or OS_PRIO_MUTEX_CEIL_DIS     */
 } OS_MUTEX_DATA;
 #endif
 
@@ -518,9 +668,42 @@ typedef struct os_q_data {
     INT16U         OSQSize;                 /* Size of message queue                                   */
     OS_PRIO        OSEventTbl[OS_EVENT_TBL_SIZE];  /* List of tasks waiting for event to occur         */
     OS_PRIO        OSEventGrp;              /* Group corresponding to tasks waiting for event to occur */
+#if OS_LOWEST_PRIO > 254u
+    OS_PRIO        OSEventGrpTbl[OS_EVENT_GRP_TBL_SIZE];   /* Groups of the wait list's table entries  */
+#endif
 } OS_Q_DATA;
 #endif
 
+/*
+*********************************************************************************************************
+*                                      BY-VALUE MESSAGE QUEUE DATA
+*
+* Note(s): 1) A by-value queue stores its messages in place, in a ring of OSQVSize slots of OSQVMsgSize
+*             bytes each.  A producer builds a message in the slot at OSQVIn, between OSQVReserve() and
+*             OSQVCommit().  A consumer reads the message in the slot at OSQVOut, between OSQVPeek() and
+*             OSQVRelease().  OSQVEntries counts the committed messages, the one being read included.
+*          2) One slot at a time is reserved, and one message at a time is read.
+*          3) OSQVPeekTCB is the task reading the message, (OS_TCB *)0 for an ISR.  If that task is deleted
+*             before OSQVRelease(), OSTaskDel() ends the read and the message stays the oldest.
+*********************************************************************************************************
+*/
+
+#if OS_QV_EN > 0u
+typedef struct os_qv {                      /* BY-VALUE QUEUE CONTROL BLOCK                            */
+    struct os_qv  *OSQVPtr;                 /* Link to next control block in list of free blocks       */
+    INT8U         *OSQVStart;               /* Ptr to first slot of the ring                           */
+    INT8U         *OSQVEnd;                 /* Ptr past the last slot of the ring                      */
+    INT8U         *OSQVIn;                  /* Ptr to slot the next message is built in                */
+    INT8U         *OSQVOut;                 /* Ptr to slot of the oldest message                       */
+    INT16U         OSQVMsgSize;             /* Size of a message (in bytes)                            */
+    INT16U         OSQVSize;                /* Size of queue (maximum number of messages)              */
+    INT16U         OSQVEntries;             /* Number of committed messages in the queue               */
+    BOOLEAN        OSQVReserved;            /* The slot at OSQVIn  is being built  (see Note #2)       */
+    BOOLEAN        OSQVPeeked;              /* The slot at OSQVOut is being read   (see Note #2)       */
+    struct os_tcb *OSQVPeekTCB;             /* Task reading the slot at OSQVOut    (see Note #3)       */
+} OS_QV;
+#endif
+
 /*
 *********************************************************************************************************
 *                                           SEMAPHORE DATA
@@ -532,6 +715,9 @@ typedef struct os_sem_data {
     INT16U  OSCnt;                          /* Semaphore count                                         */
     OS_PRIO OSEventTbl[OS_EVENT_TBL_SIZE];  /* List of tasks waiting for event to occur                */
     OS_PRIO OSEventGrp;                     /* Group corresponding to tasks waiting for event to occur */
+#if OS_LOWEST_PRIO > 254u
+    OS_PRIO OSEventGrpTbl[OS_EVENT_GRP_TBL_SIZE];   /* Groups of the wait list's table entries         */
+#endif
 } OS_SEM_DATA;
 #endif
 
@@ -548,6 +734,52 @@ typedef struct os_stk_data {
 } OS_STK_DATA;
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           TASK LATENCY DATA
+*
+* Note(s): 1) A latency is the time from a post made by an ISR to the moment the task it readied is
+*             switched in, in CPU_TS_Get32() counts.  Bucket 'n' of OSLatHist[] counts the latencies from
+*             2^n to 2^(n+1) - 1 (bucket 0 also counts the latencies of 0).  The last bucket counts all
+*             the latencies of 2^(OS_TASK_LAT_HIST_SIZE - 1) and more.
+*********************************************************************************************************
+*/
+
+#if OS_TASK_LAT_EN > 0u
+typedef struct os_task_lat {
+    INT32U  OSLatCtr;                       /* Number of latencies measured                            */
+    INT32U  OSLatMax;                       /* Longest latency measured                                */
+    INT32U  OSLatHist[OS_TASK_LAT_HIST_SIZE];   /* Number of latencies in each bucket (see Note #1)    */
+} OS_TASK_LAT;
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        TASK PROFILING TIMESTAMPS
+*
+* Note(s): 1) With OS_TASK_PROFILE_EN, the time each task and the ISRs run is measured with the CPU
+*             timestamp timer, CPU_TS_TmrRd(), in timer counts.  OS_TS is as wide as the timer, so the
+*             elapsed time is right across a wrap of the timer.
+*          2) The timer is enabled by CPU_CFG_TS_32_EN or CPU_CFG_TS_64_EN in CPU_CFG.H.  Without it, the
+*             run times stay at 0.
+*          3) The high-resolution timers (OS_HRT_EN) expire on the same timer and require it.
+*********************************************************************************************************
+*/
+
+#if (OS_TASK_PROFILE_EN > 0u) || (OS_HRT_EN > 0u)
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+typedef  CPU_TS_TMR  OS_TS;
+
+#define  OS_TS_GET()            CPU_TS_TmrRd()
+#else
+typedef  INT32U      OS_TS;
+
+#define  OS_TS_GET()            0u
+#endif
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -583,8 +815,9 @@ typedef struct os_tcb {
     OS_EVENT       **OSTCBEventMultiPtr;    /* Pointer to multiple event control blocks                */
 #endif
 
-#if ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u)
-    void            *OSTCBMsg;              /* Message received from OSMboxPost() or OSQPost()         */
+#if ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u) || \
+    ((OS_QV_EN > 0u) && (OS_MAX_QVS > 0u))
+    void            *OSTCBMsg;              /* Message from OSMboxPost(), OSQPost() or OSQVCommit()    */
 #endif
 
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
@@ -592,17 +825,51 @@ typedef struct os_tcb {
     OS_FLAG_NODE    *OSTCBFlagNode;         /* Pointer to event flag node                              */
 #endif
     OS_FLAGS         OSTCBFlagsRdy;         /* Event flags that made task ready to run                 */
+#if OS_FLAG_MULTI_EN > 0u
+    OS_FLAG_PEND_DATA *OSTCBFlagMultiPtr;   /* Conditions waited on by OSFlagPendMulti()               */
+    INT16U           OSTCBFlagMultiSize;    /* Number of conditions waited on                          */
+    OS_FLAG_NODE    *OSTCBFlagMultiRdy;     /* Node of the condition that made task ready              */
+#endif
 #endif
 
     INT32U           OSTCBDly;              /* Nbr ticks to delay task or, timeout waiting for event   */
+#if OS_TICK_LIST_EN > 0u
+    struct os_tcb   *OSTCBTickNext;         /* Pointer to next     TCB in the delta-sorted tick list   */
+    struct os_tcb   *OSTCBTickPrev;         /* Pointer to previous TCB in the delta-sorted tick list   */
+    INT32U           OSTCBTickDelta;        /* Nbr ticks between this TCB's expiry and previous one's  */
+#endif
+#if OS_SCHED_EDF_EN > 0u
+    INT32U           OSTCBEdfPeriod;        /* Period of EDF task in ticks (0 == fixed priority task)  */
+    INT32U           OSTCBEdfRelDeadline;   /* Deadline relative to the release of each job            */
+    INT32U           OSTCBEdfRelease;       /* Release time (OSTime) of the current job                */
+    INT32U           OSTCBEdfDeadline;      /* Absolute deadline of the current job                    */
+    INT32U           OSTCBEdfMissCtr;       /* Number of jobs that completed past their deadline       */
+    INT16U           OSTCBEdfHeapIx;        /* Position in EDF ready heap + 1 (0 == not in heap)       */
+#endif
+#if OS_SCHED_RR_EN > 0u
+    struct os_tcb   *OSTCBPrioNext;         /* Pointer to next TCB created at the same priority        */
+    struct os_tcb   *OSTCBRdyNext;          /* Pointer to next     TCB in the priority's ready ring    */
+    struct os_tcb   *OSTCBRdyPrev;          /* Pointer to previous TCB in the priority's ready ring    */
+    INT16U           OSTCBQuantaCtr;        /* Nbr ticks left in the task's time slice                 */
+#endif
     INT8U            OSTCBStat;             /* Task      status                                        */
     INT8U            OSTCBStatPend;         /* Task PEND status                                        */
-    INT8U            OSTCBPrio;             /* Task priority (0 == highest)                            */
+    OS_PRIO_NBR      OSTCBPrio;             /* Task priority (0 == highest)                            */
+#if OS_SCHED_THRESHOLD_EN > 0u
+    OS_PRIO_NBR      OSTCBThreshold;        /* Only tasks above this priority preempt the task         */
+#endif
 
     INT8U            OSTCBX;                /* Bit position in group  corresponding to task priority   */
     INT8U            OSTCBY;                /* Index into ready table corresponding to task priority   */
     OS_PRIO          OSTCBBitX;             /* Bit mask to access bit position in ready table          */
     OS_PRIO          OSTCBBitY;             /* Bit mask to access bit position in ready group          */
+#if OS_LOWEST_PRIO > 254u
+    OS_PRIO          OSTCBBitZ;             /* Bit mask of the ready group table entry (OSTCBY >> 4)   */
+#endif
+#if OS_SMP_EN > 0u
+    INT8U            OSTCBCore;             /* Core whose ready list holds the task                    */
+    OS_CORE_MSK      OSTCBCoreMsk;          /* Cores the task may run on (bit 'n' set == core 'n')     */
+#endif
 
 #if OS_TASK_DEL_EN > 0u
     INT8U            OSTCBDelReq;           /* Indicates whether a task needs to delete itself         */
@@ -610,12 +877,23 @@ typedef struct os_tcb {
 
 #if OS_TASK_PROFILE_EN > 0u
     INT32U           OSTCBCtxSwCtr;         /* Number of time the task was switched in                 */
-    INT32U           OSTCBCyclesTot;        /* Total number of clock cycles the task has been running  */
-    INT32U           OSTCBCyclesStart;      /* Snapshot of cycle counter at start of task resumption   */
+    INT64U           OSTCBCyclesTot;        /* Total number of clock cycles the task has been running  */
+    OS_TS            OSTCBCyclesStart;      /* Snapshot of cycle counter at start of task resumption   */
+#if OS_TASK_STAT_EN > 0u
+    INT64U           OSTCBCyclesTotPrev;    /* OSTCBCyclesTot at the previous statistics period        */
+    INT16U           OSTCBCPUUsage;         /* CPU usage over the last period (0.01 %, 10000 == 100 %) */
+#endif
     OS_STK          *OSTCBStkBase;          /* Pointer to the beginning of the task stack              */
     INT32U           OSTCBStkUsed;          /* Number of bytes used from the stack                     */
 #endif
 
+#if OS_TASK_LAT_EN > 0u
+    BOOLEAN          OSTCBLatPend;          /* An ISR post readied the task, which did not run yet     */
+    INT32U           OSTCBLatTS;            /* Time of that post (CPU_TS_Get32())                      */
+    INT32U           OSTCBLatMax;           /* Longest latency measured                                */
+    INT32U           OSTCBLatHist[OS_TASK_LAT_HIST_SIZE];  /* Latencies per bucket (see OS_TASK_LAT)   */
+#endif
+
 #if OS_TASK_NAME_EN > 0u
     INT8U           *OSTCBTaskName;
 #endif
@@ -625,10 +903,58 @@ typedef struct os_tcb {
 #endif
 } OS_TCB;
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      PER-CORE SCHEDULER STATE
+*
+* Note(s): 1) With OS_SMP_EN, each core schedules its own ready list.  A task belongs to one core at a
+*             time (OSTCBCore) and may only be moved to the cores of its affinity mask (OSTCBCoreMsk).
+*          2) OSTCBCur, OSTCBHighRdy, OSPrioCur, OSPrioHighRdy, OSIntNesting, OSLockNesting and the ready
+*             list then designate the entry of the calling core in OSCoreTbl[] (see GLOBAL VARIABLES).
+*          3) With OS_SMP_STEAL_EN, a core left with only its idle task to run takes the highest priority
+*             ready task, that is allowed on it, from the core with the most ready tasks.
+*             OSCoreStealCtr and OSCoreMigrateCtr count the tasks moved this way and in total.
+*********************************************************************************************************
+*/
+
+#if OS_SMP_EN > 0u
+typedef struct os_core {
+    OS_TCB          *OSCoreTCBCur;          /* Pointer to TCB of the task running on the core          */
+    OS_TCB          *OSCoreTCBHighRdy;      /* Pointer to TCB of highest priority task ready on core   */
+    OS_TCB          *OSCoreTCBIdle;         /* Pointer to TCB of the core's idle task                  */
+    OS_PRIO_NBR      OSCorePrioCur;         /* Priority of the task running on the core                */
+    OS_PRIO_NBR      OSCorePrioHighRdy;     /* Priority of highest priority task ready on the core     */
+    INT8U            OSCoreIntNesting;      /* Interrupt nesting level of the core                     */
+    INT8U            OSCoreLockNesting;     /* Multitasking lock nesting level of the core             */
+    INT16U           OSCoreTaskCtr;         /* Number of tasks assigned to the core                    */
+#if OS_SMP_STEAL_EN > 0u
+    INT16U           OSCoreRdyCtr;          /* Number of tasks ready on the core (idle task included)  */
+    INT32U           OSCoreStealCtr;        /* Number of tasks the core stole from other cores         */
+#endif
+    INT32U           OSCoreMigrateCtr;      /* Number of tasks moved to the core while running         */
+    OS_PRIO          OSCoreRdyGrp;          /* Ready list group of the core                            */
+#if OS_LOWEST_PRIO > 254u
+    OS_PRIO          OSCoreRdyGrpTbl[OS_RDY_GRP_TBL_SIZE];  /* Groups of the core's ready table        */
+#endif
+    OS_PRIO          OSCoreRdyTbl[OS_RDY_TBL_SIZE];         /* Tasks of the core which are ready       */
+} OS_CORE;
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
 *                                          TIMER DATA TYPES
+*
+* Note(s): 1) With OS_TMR_CFG_WORKER_EN, the latency of a callback is the time from the expiry of its
+*             timer, found by the timer task, to the start of the callback in a worker task, in
+*             CPU_TS_Get32() counts.  The execution time is the time the callback took, preemptions
+*             included.
+*          2) Only the timer task puts callbacks in the queue of a worker task and only the worker takes
+*             them out, each moving its own index, so the queue needs no lock.  The semaphore of the
+*             worker counts the callbacks in the queue and wakes the worker up.
+*          3) OSTmrStop() & OSTmrDel() increment the generation of the timer.  A queued callback records
+*             the generation when it is queued and the worker drops it if the timer's has changed since.
 *********************************************************************************************************
 */
 
@@ -637,6 +963,18 @@ typedef  void (*OS_TMR_CALLBACK)(void *ptmr, void *parg);
 
 
 
+#if OS_TMR_CFG_WORKER_EN > 0u
+typedef  struct  os_tmr_lat {               /* Statistics of the callbacks run by a worker task        */
+    INT32U           OSTmrLatCtr;           /* Number of callbacks run                                 */
+    INT32U           OSTmrLatLast;          /* Latency of the last callback (see Note #1)              */
+    INT32U           OSTmrLatMax;           /* Longest latency                                         */
+    INT32U           OSTmrExecLast;         /* Execution time of the last callback                     */
+    INT32U           OSTmrExecMax;          /* Longest execution time                                  */
+} OS_TMR_LAT;
+#endif
+
+
+
 typedef  struct  os_tmr {
     INT8U            OSTmrType;             /* Should be set to OS_TMR_TYPE                            */
     OS_TMR_CALLBACK  OSTmrCallback;         /* Function to call when timer expires                     */
@@ -654,14 +992,169 @@ typedef  struct  os_tmr {
                                             /*     OS_TMR_STATE_UNUSED                                 */
                                             /*     OS_TMR_STATE_RUNNING                                */
                                             /*     OS_TMR_STATE_STOPPED                                */
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+    void            *OSTmrSpoke;            /* Spoke of the wheel the timer is linked in               */
+#endif
+#if OS_TMR_CFG_SLACK_EN > 0u
+    INT32U           OSTmrSlack;            /* Timer ticks the expiry may be delayed by to coalesce it */
+    INT32U           OSTmrDue;              /* Expiry before the slack is applied                      */
+#endif
+#if OS_TMR_CFG_WORKER_EN > 0u
+    INT8U            OSTmrWorker;           /* Worker task that runs the callback                      */
+    INT16U           OSTmrGen;              /* Generation, changed by stop & delete (see Note #3)      */
+    OS_TMR_LAT       OSTmrLat;              /* Statistics of the callbacks                             */
+#endif
 } OS_TMR;
 
 
 
 typedef  struct  os_tmr_wheel {
     OS_TMR          *OSTmrFirst;            /* Pointer to first timer in linked list                   */
-    INT16U           OSTmrEntries;
+    INT32U           OSTmrEntries;
 } OS_TMR_WHEEL;
+
+
+
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u           /* Hierarchical timer wheel:                               */
+#define  OS_TMR_WHEEL_LVL_BITS          6u  /* ... each level decodes 6 bits of OSTmrTime ...          */
+#define  OS_TMR_WHEEL_LVL_SIZE         64u  /* ... into 64 spokes ...                                  */
+#define  OS_TMR_WHEEL_LVL_NBR           6u  /* ... and 6 levels cover the 32 bits of OSTmrTime         */
+#define  OS_TMR_WHEEL_SIZE             (OS_TMR_WHEEL_LVL_NBR * OS_TMR_WHEEL_LVL_SIZE)
+#else
+#define  OS_TMR_WHEEL_SIZE             OS_TMR_CFG_WHEEL_SIZE
+#endif
+
+
+
+#if OS_TMR_CFG_WORKER_EN > 0u
+typedef  struct  os_tmr_work {              /* Callback handed over to a worker task                   */
+    OS_TMR          *OSTmrWorkTmr;          /* Timer that expired                                      */
+    OS_TMR_CALLBACK  OSTmrWorkCallback;     /* Its callback and argument, when it expired              */
+    void            *OSTmrWorkCallbackArg;
+    INT32U           OSTmrWorkTS;           /* Time it expired (CPU_TS_Get32())                        */
+    INT16U           OSTmrWorkGen;          /* Generation of the timer when it expired (see Note #3)   */
+} OS_TMR_WORK;
+
+
+
+typedef  struct  os_tmr_worker {
+    OS_EVENT        *OSTmrWorkerSem;        /* Counts the callbacks in the queue                       */
+    OS_TMR_WORK      OSTmrWorkerQ[OS_TMR_CFG_WORKER_Q_SIZE];   /* Queue of callbacks (see Note #2)     */
+    volatile INT16U  OSTmrWorkerQIn;        /* Index of the next free entry,    timer  task only       */
+    volatile INT16U  OSTmrWorkerQOut;       /* Index of the next entry to run, worker task only        */
+} OS_TMR_WORKER;
+#endif
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    HIGH-RESOLUTION TIMER DATA TYPES
+*
+* Note(s): 1) A high-resolution timer expires on a CPU timestamp, OS_TS_GET(), rather than on a tick.  The
+*             running timers are kept in a binary min-heap keyed by deadline, so that OSHrtHeap[0] is the
+*             next one to expire and the port's one-shot timer is programmed for it alone.
+*          2) OSHrtHeapIx holds the timer's position in the heap plus one, 0 means not in the heap.
+*          3) Expired timers wait in a FIFO list, linked by OSHrtNext and OSHrtPrev, for the HR timer
+*             task to call their callback.  The same links chain the free timers.
+*********************************************************************************************************
+*/
+
+#if OS_HRT_EN > 0u
+typedef  void (*OS_HRT_CALLBACK)(void *phrt, void *parg);
+
+
+
+typedef  struct  os_hrt {
+    INT8U            OSHrtType;             /* Should be set to OS_HRT_TYPE                            */
+    INT8U            OSHrtState;            /* State of the timer (see OS_HRT_STATE_xxx)               */
+    INT16U           OSHrtHeapIx;           /* Position in OSHrtHeap[] (see Note #2)                   */
+    OS_TS            OSHrtMatch;            /* Timer expires when OS_TS_GET() reaches OSHrtMatch       */
+    OS_HRT_CALLBACK  OSHrtCallback;         /* Function to call when timer expires                     */
+    void            *OSHrtCallbackArg;      /* Argument to pass to function when timer expires         */
+    struct os_hrt   *OSHrtNext;             /* Expired or free list (see Note #3)                      */
+    struct os_hrt   *OSHrtPrev;
+} OS_HRT;
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     DEFERRED ISR POST DATA TYPES
+*********************************************************************************************************
+*/
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+typedef  struct  os_int_q {
+    INT8U            OSIntQType;            /* Service to call (see OS_INT_Q_TYPE_xxx)                 */
+    INT8U            OSIntQOpt;             /* Option passed to the service                            */
+    void            *OSIntQObj;             /* Event or event flag group posted to                     */
+    void            *OSIntQMsg;             /* Message posted (mailboxes and queues)                   */
+#if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
+    OS_FLAGS         OSIntQFlags;           /* Flags set or cleared (event flags)                      */
+#endif
+#if OS_TASK_LAT_EN > 0u
+    INT32U           OSIntQTS;              /* Time of the post, for the latency of the task readied   */
+#endif
+} OS_INT_Q;
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          TRACE DATA TYPES
+*
+* Note(s): 1) Each record is 16 bytes.  'OSTraceRecObj' holds the low 32 bits of the address of the task
+*             control block, event, event flag group or timer, which is enough to tell them apart.
+*          2) Each core only writes to its own buffer.  OSTraceBufIn and OSTraceBufOut are free running:
+*             the buffer holds (OSTraceBufIn - OSTraceBufOut) records (see 'OS_TRACE.C  Note #2').
+*          3) OSTraceExport() emits one OS_TRACE_HDR, then one OS_TRACE_PKT before each run of records.
+*********************************************************************************************************
+*/
+
+#if OS_TRACE_EN > 0u
+typedef  struct  os_trace_rec {
+    INT32U           OSTraceRecTS;          /* Timestamp, from CPU_TS_Get32()                          */
+    INT8U            OSTraceRecType;        /* Type of record (see OS_TRACE_TYPE_xxx)                  */
+    INT8U            OSTraceRecArg;         /* Object type or nesting level                            */
+    INT16U           OSTraceRecPrio;        /* Priority of the task concerned                          */
+    INT32U           OSTraceRecObj;         /* Object concerned (see Note #1)                          */
+    INT32U           OSTraceRecVal;         /* Timeout, flags, time or priority                        */
+} OS_TRACE_REC;
+
+
+
+typedef  struct  os_trace_buf {
+    OS_TRACE_REC     OSTraceBufRecTbl[OS_TRACE_BUF_SIZE];
+    INT32U           OSTraceBufIn;          /* Index of the next record written    (see Note #2)       */
+    INT32U           OSTraceBufOut;         /* Index of the next record exported                       */
+    INT32U           OSTraceBufLostCtr;     /* Records lost since the last export, buffer was full     */
+} OS_TRACE_BUF;
+
+
+
+typedef  struct  os_trace_hdr {             /* Start of an exported stream         (see Note #3)       */
+    INT32U           OSTraceHdrMagic;       /* OS_TRACE_MAGIC, also gives the byte order               */
+    INT16U           OSTraceHdrVersion;     /* OS_TRACE_VERSION                                        */
+    INT16U           OSTraceHdrRecSize;     /* Size of an OS_TRACE_REC                                 */
+    INT32U           OSTraceHdrTSFreq;      /* Frequency of the timestamps (Hz), 0 if unknown          */
+    INT16U           OSTraceHdrCoreNbr;     /* Number of cores                                         */
+    INT16U           OSTraceHdrLowestPrio;  /* OS_LOWEST_PRIO, priority of the idle task               */
+} OS_TRACE_HDR;
+
+
+
+typedef  struct  os_trace_pkt {             /* Header of a run of records                              */
+    INT16U           OSTracePktCore;        /* Core that recorded them                                 */
+    INT16U           OSTracePktRecCnt;      /* Number of records that follow                           */
+    INT32U           OSTracePktLostCtr;     /* Records lost just before them                           */
+} OS_TRACE_PKT;
+
+
+
+typedef  void      (*OS_TRACE_WR_FNCT)(void        *p_arg,
+                                       void const  *p_data,
+                                       INT32U       size);
 #endif
 
 /*$PAGE*/
@@ -682,10 +1175,27 @@ typedef  void                      (*OS_TLS_DESTRUCT_PTR)(OS_TCB    *ptcb,
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
+*
+* Note(s): 1) With OS_MULTI_INST_EN, the variables below are the members of an OS_KERNEL instead.  Each
+*             host thread runs its own kernel instance, selected with OSKernelSet() before OSInit(), and
+*             their names designate the members of the instance of the calling thread (see OSKernelCur).
+*             Without OSKernelSet(), OSInit() selects a default instance, for a single host thread.
+*          2) OSEventTbl and OSMemFreeList also name members of OS_EVENT and OS_MEM.  They are accessed
+*             as OS_KERNEL_VAR(OSEventTbl) and OS_KERNEL_VAR(OSMemFreeList), with or without instances.
 *********************************************************************************************************
 */
 
+#if OS_MULTI_INST_EN > 0u
+#undef   OS_EXT
+#define  OS_EXT                                     /* Declare the members of OS_KERNEL (see Note #1)  */
+
+typedef  struct  os_kernel {
+#endif
+
 OS_EXT  INT32U            OSCtxSwCtr;               /* Counter of number of context switches           */
+#if OS_SCHED_THRESHOLD_EN > 0u
+OS_EXT  INT32U            OSCtxSwThresholdCtr;      /* Nbr of ctx switches avoided by thresholds       */
+#endif
 
 #if (OS_EVENT_EN) && (OS_MAX_EVENTS > 0u)
 OS_EXT  OS_EVENT         *OSEventFreeList;          /* Pointer to list of free EVENT control blocks    */
@@ -705,22 +1215,60 @@ OS_EXT  BOOLEAN           OSStatRdy;                /* Flag indicating that the
 OS_EXT  OS_STK            OSTaskStatStk[OS_TASK_STAT_STK_SIZE];      /* Statistics task stack          */
 #endif
 
+#if OS_SMP_EN == 0u
 OS_EXT  INT8U             OSIntNesting;             /* Interrupt nesting level                         */
 
 OS_EXT  INT8U             OSLockNesting;            /* Multitasking lock nesting level                 */
 
-OS_EXT  INT8U             OSPrioCur;                /* Priority of current task                        */
-OS_EXT  INT8U             OSPrioHighRdy;            /* Priority of highest priority task               */
+OS_EXT  OS_PRIO_NBR       OSPrioCur;                /* Priority of current task                        */
+OS_EXT  OS_PRIO_NBR       OSPrioHighRdy;            /* Priority of highest priority task               */
 
 OS_EXT  OS_PRIO           OSRdyGrp;                        /* Ready list group                         */
+#if OS_LOWEST_PRIO > 254u
+OS_EXT  OS_PRIO           OSRdyGrpTbl[OS_RDY_GRP_TBL_SIZE]; /* Groups of the ready table's entries     */
+#endif
 OS_EXT  OS_PRIO           OSRdyTbl[OS_RDY_TBL_SIZE];       /* Table of tasks which are ready to run    */
 
+OS_EXT  OS_TCB           *OSTCBCur;                        /* Pointer to currently running TCB         */
+OS_EXT  OS_TCB           *OSTCBHighRdy;                    /* Pointer to highest priority TCB R-to-R   */
+
+#define  OS_RDY_GRP(ptcb)       (OSRdyGrp)                 /* Ready list holding a task                */
+#define  OS_RDY_GRP_TBL(ptcb)   (OSRdyGrpTbl)
+#define  OS_RDY_TBL(ptcb)       (OSRdyTbl)
+#else
+OS_EXT  OS_CORE           OSCoreTbl[OS_SMP_CORE_NBR];      /* Scheduler state of each core             */
+OS_EXT  OS_STK            OSTaskIdleCoreStk[OS_SMP_CORE_NBR - 1u][OS_TASK_IDLE_STK_SIZE]; /* Cores 1.. */
+
+#define  OSIntNesting           (OSCoreTbl[OS_CPU_CoreIdGet()].OSCoreIntNesting)
+#define  OSLockNesting          (OSCoreTbl[OS_CPU_CoreIdGet()].OSCoreLockNesting)
+#define  OSPrioCur              (OSCoreTbl[OS_CPU_CoreIdGet()].OSCorePrioCur)
+#define  OSPrioHighRdy          (OSCoreTbl[OS_CPU_CoreIdGet()].OSCorePrioHighRdy)
+#define  OSRdyGrp               (OSCoreTbl[OS_CPU_CoreIdGet()].OSCoreRdyGrp)
+#define  OSRdyGrpTbl            (OSCoreTbl[OS_CPU_CoreIdGet()].OSCoreRdyGrpTbl)
+#define  OSRdyTbl               (OSCoreTbl[OS_CPU_CoreIdGet()].OSCoreRdyTbl)
+#define  OSTCBCur               (OSCoreTbl[OS_CPU_CoreIdGet()].OSCoreTCBCur)
+#define  OSTCBHighRdy           (OSCoreTbl[OS_CPU_CoreIdGet()].OSCoreTCBHighRdy)
+
+#define  OS_RDY_GRP(ptcb)       (OSCoreTbl[(ptcb)->OSTCBCore].OSCoreRdyGrp)
+#define  OS_RDY_GRP_TBL(ptcb)   (OSCoreTbl[(ptcb)->OSTCBCore].OSCoreRdyGrpTbl)
+#define  OS_RDY_TBL(ptcb)       (OSCoreTbl[(ptcb)->OSTCBCore].OSCoreRdyTbl)
+#endif
+
 OS_EXT  BOOLEAN           OSRunning;                       /* Flag indicating that kernel is running   */
 
-OS_EXT  INT8U             OSTaskCtr;                       /* Number of tasks created                  */
+OS_EXT  INT16U            OSTaskCtr;                       /* Number of tasks created                  */
 
 OS_EXT  volatile  INT32U  OSIdleCtr;                                 /* Idle counter                   */
 
+#if OS_TASK_PROFILE_EN > 0u
+OS_EXT  INT64U            OSIntCyclesTot;                  /* Total nbr of clock cycles spent in ISRs  */
+#if OS_TASK_STAT_EN > 0u
+OS_EXT  INT64U            OSIntCyclesTotPrev;              /* OSIntCyclesTot at previous stat period   */
+OS_EXT  INT16U            OSIntCPUUsage;                   /* CPU usage of the ISRs (0.01 %)           */
+OS_EXT  OS_TS             OSStatCyclesStart;               /* Timestamp of the previous stat period    */
+#endif
+#endif
+
 #ifdef OS_SAFETY_CRITICAL_IEC61508
 OS_EXT  BOOLEAN           OSSafetyCriticalStartFlag;
 #endif
@@ -728,12 +1276,24 @@ OS_EXT  BOOLEAN           OSSafetyCriticalStartFlag;
 OS_EXT  OS_STK            OSTaskIdleStk[OS_TASK_IDLE_STK_SIZE];      /* Idle task stack                */
 
 
-OS_EXT  OS_TCB           *OSTCBCur;                        /* Pointer to currently running TCB         */
 OS_EXT  OS_TCB           *OSTCBFreeList;                   /* Pointer to list of free TCBs             */
-OS_EXT  OS_TCB           *OSTCBHighRdy;                    /* Pointer to highest priority TCB R-to-R   */
 OS_EXT  OS_TCB           *OSTCBList;                       /* Pointer to doubly linked list of TCBs    */
 OS_EXT  OS_TCB           *OSTCBPrioTbl[OS_LOWEST_PRIO + 1u];    /* Table of pointers to created TCBs   */
-OS_EXT  OS_TCB            OSTCBTbl[OS_MAX_TASKS + OS_N_SYS_TASKS];   /* Table of TCBs                  */
+OS_EXT  OS_TCB            OSTCBTbl[OS_MAX_TASKS + OS_N_SYS_TASKS + OS_N_CORE_TASKS]; /* Table of TCBs  */
+
+#if OS_TICK_LIST_EN > 0u
+OS_EXT  OS_TCB           *OSTickList;               /* Delta-sorted list of delayed/timed-out TCBs     */
+#endif
+
+#if OS_SCHED_EDF_EN > 0u
+OS_EXT  OS_TCB           *OSEdfHeap[OS_MAX_TASKS];  /* Ready EDF tasks, min-heap keyed by deadline     */
+OS_EXT  INT16U            OSEdfHeapSize;            /* Number of ready EDF tasks                       */
+#endif
+
+#if OS_SCHED_RR_EN > 0u
+OS_EXT  OS_TCB           *OSRdyRingTbl[OS_LOWEST_PRIO + 1u];     /* Ready ring (FIFO) of each priority */
+OS_EXT  INT16U            OSSchedQuantaTbl[OS_LOWEST_PRIO + 1u]; /* Time quantum of each priority      */
+#endif
 
 #if OS_TICK_STEP_EN > 0u
 OS_EXT  INT8U             OSTickStepState;          /* Indicates the state of the tick step feature    */
@@ -749,6 +1309,11 @@ OS_EXT  OS_Q             *OSQFreeList;              /* Pointer to list of free Q
 OS_EXT  OS_Q              OSQTbl[OS_MAX_QS];        /* Table of QUEUE control blocks                   */
 #endif
 
+#if (OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)
+OS_EXT  OS_QV            *OSQVFreeList;             /* Pointer to list of free BY-VALUE QUEUE blocks   */
+OS_EXT  OS_QV             OSQVTbl[OS_MAX_QVS];      /* Table of BY-VALUE QUEUE control blocks          */
+#endif
+
 #if OS_TASK_REG_TBL_SIZE > 0u
 OS_EXT  INT8U             OSTaskRegNextAvailID;     /* Next available Task register ID                 */
 #endif
@@ -758,8 +1323,8 @@ OS_EXT  volatile  INT32U  OSTime;                   /* Current value of system t
 #endif
 
 #if OS_TMR_EN > 0u
-OS_EXT  INT16U            OSTmrFree;                /* Number of free entries in the timer pool        */
-OS_EXT  INT16U            OSTmrUsed;                /* Number of timers used                           */
+OS_EXT  INT32U            OSTmrFree;                /* Number of free entries in the timer pool        */
+OS_EXT  INT32U            OSTmrUsed;                /* Number of timers used                           */
 OS_EXT  INT32U            OSTmrTime;                /* Current timer time                              */
 
 OS_EXT  OS_EVENT         *OSTmrSem;                 /* Sem. used to gain exclusive access to timers    */
@@ -769,7 +1334,194 @@ OS_EXT  OS_TMR            OSTmrTbl[OS_TMR_CFG_MAX]; /* Table containing pool of
 OS_EXT  OS_TMR           *OSTmrFreeList;            /* Pointer to free list of timers                  */
 OS_EXT  OS_STK            OSTmrTaskStk[OS_TASK_TMR_STK_SIZE];
 
-OS_EXT  OS_TMR_WHEEL      OSTmrWheelTbl[OS_TMR_CFG_WHEEL_SIZE];
+OS_EXT  OS_TMR_WHEEL      OSTmrWheelTbl[OS_TMR_WHEEL_SIZE];
+
+#if OS_TMR_CFG_WORKER_EN > 0u
+OS_EXT  OS_TMR_WORKER     OSTmrWorkerTbl[OS_TMR_CFG_WORKER_NBR];
+OS_EXT  OS_STK            OSTmrWorkerStk[OS_TMR_CFG_WORKER_NBR][OS_TASK_TMR_WORKER_STK_SIZE];
+OS_EXT  INT32U            OSTmrWorkerOvfCtr;        /* Callbacks run by the timer task, queue was full */
+#endif
+#endif
+
+#if OS_HRT_EN > 0u
+OS_EXT  OS_HRT            OSHrtTbl[OS_HRT_CFG_MAX]; /* Table containing pool of HR timers              */
+OS_EXT  OS_HRT           *OSHrtFreeList;            /* Pointer to free list of HR timers               */
+OS_EXT  OS_HRT           *OSHrtHeap[OS_HRT_CFG_MAX];/* Running HR timers, min-heap keyed by deadline   */
+OS_EXT  INT16U            OSHrtHeapSize;            /* Number of running HR timers                     */
+OS_EXT  OS_HRT           *OSHrtExpHead;             /* Expired HR timers, in order of expiry, whose    */
+OS_EXT  OS_HRT           *OSHrtExpTail;             /* ... callback has not been called yet            */
+OS_EXT  OS_TS             OSHrtLatMax;              /* Longest deadline to callback time (TS counts)   */
+OS_EXT  OS_EVENT         *OSHrtSem;                 /* Wakes up the HR timer task                      */
+OS_EXT  OS_STK            OSHrtTaskStk[OS_TASK_HRT_STK_SIZE];
+#endif
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+OS_EXT  OS_INT_Q          OSIntQTbl[OS_INT_Q_SIZE]; /* Posts deferred by ISRs                          */
+OS_EXT  INT16U            OSIntQIn;                 /* Index of the next free entry                    */
+OS_EXT  INT16U            OSIntQOut;                /* Index of the next entry to post                 */
+OS_EXT  INT16U            OSIntQCtr;                /* Number of posts waiting                         */
+OS_EXT  INT16U            OSIntQCtrMax;             /* Peak number of posts waiting                    */
+OS_EXT  INT32U            OSIntQOvfCtr;             /* Number of posts lost, queue was full            */
+OS_EXT  OS_EVENT         *OSIntQSem;                /* Wakes up the ISR post task                      */
+OS_EXT  OS_STK            OSIntQTaskStk[OS_TASK_INT_Q_STK_SIZE];
+#if OS_TASK_LAT_EN > 0u
+OS_EXT  BOOLEAN           OSIntQLatEn;              /* A deferred post is being performed ...          */
+OS_EXT  INT32U            OSIntQLatTS;              /* ... which the ISR made at this time             */
+#endif
+#endif
+
+#if OS_TRACE_EN > 0u
+OS_EXT  OS_TRACE_BUF      OSTraceBufTbl[OS_TRACE_CORE_NBR]; /* Trace records of each core              */
+OS_EXT  BOOLEAN           OSTraceRunning;           /* Events are being recorded                       */
+OS_EXT  BOOLEAN           OSTraceHdrPend;           /* Next export starts a new stream                 */
+#endif
+
+#if OS_MULTI_INST_EN > 0u
+} OS_KERNEL;
+
+#undef   OS_EXT
+#ifdef   OS_GLOBALS
+#define  OS_EXT
+#else
+#define  OS_EXT  extern
+#endif
+
+OS_EXT  OS_CPU_TLS  OS_KERNEL  *OSKernelCur;        /* Kernel instance of the calling thread           */
+
+#define  OS_KERNEL_VAR(var)        (OSKernelCur->var)   /* See Note #2                                     */
+
+#define  OSCtxSwCtr                (OSKernelCur->OSCtxSwCtr)
+#if OS_SCHED_THRESHOLD_EN > 0u
+#define  OSCtxSwThresholdCtr       (OSKernelCur->OSCtxSwThresholdCtr)
+#endif
+#if (OS_EVENT_EN) && (OS_MAX_EVENTS > 0u)
+#define  OSEventFreeList           (OSKernelCur->OSEventFreeList)
+#endif
+#if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
+#define  OSFlagTbl                 (OSKernelCur->OSFlagTbl)
+#define  OSFlagFreeList            (OSKernelCur->OSFlagFreeList)
+#endif
+#if OS_TASK_STAT_EN > 0u
+#define  OSCPUUsage                (OSKernelCur->OSCPUUsage)
+#define  OSIdleCtrMax              (OSKernelCur->OSIdleCtrMax)
+#define  OSIdleCtrRun              (OSKernelCur->OSIdleCtrRun)
+#define  OSStatRdy                 (OSKernelCur->OSStatRdy)
+#define  OSTaskStatStk             (OSKernelCur->OSTaskStatStk)
+#endif
+#if OS_SMP_EN == 0u
+#define  OSIntNesting              (OSKernelCur->OSIntNesting)
+#define  OSLockNesting             (OSKernelCur->OSLockNesting)
+#define  OSPrioCur                 (OSKernelCur->OSPrioCur)
+#define  OSPrioHighRdy             (OSKernelCur->OSPrioHighRdy)
+#define  OSRdyGrp                  (OSKernelCur->OSRdyGrp)
+#if OS_LOWEST_PRIO > 254u
+#define  OSRdyGrpTbl               (OSKernelCur->OSRdyGrpTbl)
+#endif
+#define  OSRdyTbl                  (OSKernelCur->OSRdyTbl)
+#define  OSTCBCur                  (OSKernelCur->OSTCBCur)
+#define  OSTCBHighRdy              (OSKernelCur->OSTCBHighRdy)
+#else
+#define  OSCoreTbl                 (OSKernelCur->OSCoreTbl)
+#define  OSTaskIdleCoreStk         (OSKernelCur->OSTaskIdleCoreStk)
+#endif
+#define  OSRunning                 (OSKernelCur->OSRunning)
+#define  OSTaskCtr                 (OSKernelCur->OSTaskCtr)
+#define  OSIdleCtr                 (OSKernelCur->OSIdleCtr)
+#if OS_TASK_PROFILE_EN > 0u
+#define  OSIntCyclesTot            (OSKernelCur->OSIntCyclesTot)
+#if OS_TASK_STAT_EN > 0u
+#define  OSIntCyclesTotPrev        (OSKernelCur->OSIntCyclesTotPrev)
+#define  OSIntCPUUsage             (OSKernelCur->OSIntCPUUsage)
+#define  OSStatCyclesStart         (OSKernelCur->OSStatCyclesStart)
+#endif
+#endif
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+#define  OSSafetyCriticalStartFlag (OSKernelCur->OSSafetyCriticalStartFlag)
+#endif
+#define  OSTaskIdleStk             (OSKernelCur->OSTaskIdleStk)
+#define  OSTCBFreeList             (OSKernelCur->OSTCBFreeList)
+#define  OSTCBList                 (OSKernelCur->OSTCBList)
+#define  OSTCBPrioTbl              (OSKernelCur->OSTCBPrioTbl)
+#define  OSTCBTbl                  (OSKernelCur->OSTCBTbl)
+#if OS_TICK_LIST_EN > 0u
+#define  OSTickList                (OSKernelCur->OSTickList)
+#endif
+#if OS_SCHED_EDF_EN > 0u
+#define  OSEdfHeap                 (OSKernelCur->OSEdfHeap)
+#define  OSEdfHeapSize             (OSKernelCur->OSEdfHeapSize)
+#endif
+#if OS_SCHED_RR_EN > 0u
+#define  OSRdyRingTbl              (OSKernelCur->OSRdyRingTbl)
+#define  OSSchedQuantaTbl          (OSKernelCur->OSSchedQuantaTbl)
+#endif
+#if OS_TICK_STEP_EN > 0u
+#define  OSTickStepState           (OSKernelCur->OSTickStepState)
+#endif
+#if (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
+#define  OSMemTbl                  (OSKernelCur->OSMemTbl)
+#endif
+#if (OS_Q_EN > 0u) && (OS_MAX_QS > 0u)
+#define  OSQFreeList               (OSKernelCur->OSQFreeList)
+#define  OSQTbl                    (OSKernelCur->OSQTbl)
+#endif
+#if (OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)
+#define  OSQVFreeList              (OSKernelCur->OSQVFreeList)
+#define  OSQVTbl                   (OSKernelCur->OSQVTbl)
+#endif
+#if OS_TASK_REG_TBL_SIZE > 0u
+#define  OSTaskRegNextAvailID      (OSKernelCur->OSTaskRegNextAvailID)
+#endif
+#if OS_TIME_GET_SET_EN > 0u
+#define  OSTime                    (OSKernelCur->OSTime)
+#endif
+#if OS_TMR_EN > 0u
+#define  OSTmrFree                 (OSKernelCur->OSTmrFree)
+#define  OSTmrUsed                 (OSKernelCur->OSTmrUsed)
+#define  OSTmrTime                 (OSKernelCur->OSTmrTime)
+#define  OSTmrSem                  (OSKernelCur->OSTmrSem)
+#define  OSTmrSemSignal            (OSKernelCur->OSTmrSemSignal)
+#define  OSTmrTbl                  (OSKernelCur->OSTmrTbl)
+#define  OSTmrFreeList             (OSKernelCur->OSTmrFreeList)
+#define  OSTmrTaskStk              (OSKernelCur->OSTmrTaskStk)
+#define  OSTmrWheelTbl             (OSKernelCur->OSTmrWheelTbl)
+#if OS_TMR_CFG_WORKER_EN > 0u
+#define  OSTmrWorkerTbl            (OSKernelCur->OSTmrWorkerTbl)
+#define  OSTmrWorkerStk            (OSKernelCur->OSTmrWorkerStk)
+#define  OSTmrWorkerOvfCtr         (OSKernelCur->OSTmrWorkerOvfCtr)
+#endif
+#endif
+#if OS_HRT_EN > 0u
+#define  OSHrtTbl                  (OSKernelCur->OSHrtTbl)
+#define  OSHrtFreeList             (OSKernelCur->OSHrtFreeList)
+#define  OSHrtHeap                 (OSKernelCur->OSHrtHeap)
+#define  OSHrtHeapSize             (OSKernelCur->OSHrtHeapSize)
+#define  OSHrtExpHead              (OSKernelCur->OSHrtExpHead)
+#define  OSHrtExpTail              (OSKernelCur->OSHrtExpTail)
+#define  OSHrtLatMax               (OSKernelCur->OSHrtLatMax)
+#define  OSHrtSem                  (OSKernelCur->OSHrtSem)
+#define  OSHrtTaskStk              (OSKernelCur->OSHrtTaskStk)
+#endif
+#if OS_ISR_POST_DEFERRED_EN > 0u
+#define  OSIntQTbl                 (OSKernelCur->OSIntQTbl)
+#define  OSIntQIn                  (OSKernelCur->OSIntQIn)
+#define  OSIntQOut                 (OSKernelCur->OSIntQOut)
+#define  OSIntQCtr                 (OSKernelCur->OSIntQCtr)
+#define  OSIntQCtrMax              (OSKernelCur->OSIntQCtrMax)
+#define  OSIntQOvfCtr              (OSKernelCur->OSIntQOvfCtr)
+#define  OSIntQSem                 (OSKernelCur->OSIntQSem)
+#define  OSIntQTaskStk             (OSKernelCur->OSIntQTaskStk)
+#if OS_TASK_LAT_EN > 0u
+#define  OSIntQLatEn               (OSKernelCur->OSIntQLatEn)
+#define  OSIntQLatTS               (OSKernelCur->OSIntQLatTS)
+#endif
+#endif
+#if OS_TRACE_EN > 0u
+#define  OSTraceBufTbl             (OSKernelCur->OSTraceBufTbl)
+#define  OSTraceRunning            (OSKernelCur->OSTraceRunning)
+#define  OSTraceHdrPend            (OSKernelCur->OSTraceHdrPend)
+#endif
+#else
+#define  OS_KERNEL_VAR(var)        (var)
 #endif
 
 extern  INT8U   const     OSUnMapTbl[256];          /* Priority->Index    lookup table                 */
@@ -887,6 +1639,14 @@ OS_FLAGS      OSFlagPend              (OS_FLAG_GRP     *pgrp,
                                        INT8U           *perr);
 
 OS_FLAGS      OSFlagPendGetFlagsRdy   (void);
+
+#if OS_FLAG_MULTI_EN > 0u
+INT16U        OSFlagPendMulti         (OS_FLAG_PEND_DATA *p_pend_data_tbl,
+                                       INT16U             tbl_size,
+                                       INT32U             timeout,
+                                       INT8U             *perr);
+#endif
+
 OS_FLAGS      OSFlagPost              (OS_FLAG_GRP     *pgrp,
                                        OS_FLAGS         flags,
                                        INT8U            opt,
@@ -992,7 +1752,7 @@ BOOLEAN       OSMutexAccept           (OS_EVENT        *pevent,
                                        INT8U           *perr);
 #endif
 
-OS_EVENT     *OSMutexCreate           (INT8U            prio,
+OS_EVENT     *OSMutexCreate           (OS_PRIO_NBR      prio,
                                        INT8U           *perr);
 
 #if OS_MUTEX_DEL_EN > 0u
@@ -1074,22 +1834,61 @@ INT8U         OSQQuery                (OS_EVENT        *pevent,
 
 #endif
 
-/*$PAGE*/
+/*$PAGE*/
 /*
 *********************************************************************************************************
-*                                        SEMAPHORE MANAGEMENT
+*                                  BY-VALUE MESSAGE QUEUE MANAGEMENT
 *********************************************************************************************************
 */
-#if OS_SEM_EN > 0u
 
-#if OS_SEM_ACCEPT_EN > 0u
-INT16U        OSSemAccept             (OS_EVENT        *pevent);
-#endif
+#if (OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)
+void         *OSQVAccept              (OS_EVENT        *pevent,
+                                       INT8U           *perr);
 
-OS_EVENT     *OSSemCreate             (INT16U           cnt);
+INT8U         OSQVCommit              (OS_EVENT        *pevent);
 
-#if OS_SEM_DEL_EN > 0u
-OS_EVENT     *OSSemDel                (OS_EVENT        *pevent,
+OS_EVENT     *OSQVCreate              (void            *start,
+                                       INT16U           msg_size,
+                                       INT16U           size);
+
+OS_EVENT     *OSQVDel                 (OS_EVENT        *pevent,
+                                       INT8U            opt,
+                                       INT8U           *perr);
+
+void         *OSQVPeek                (OS_EVENT        *pevent,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+void          OSQVPend                (OS_EVENT        *pevent,
+                                       void            *pmsg,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+INT8U         OSQVPost                (OS_EVENT        *pevent,
+                                       void            *pmsg);
+
+INT8U         OSQVRelease             (OS_EVENT        *pevent);
+
+void         *OSQVReserve             (OS_EVENT        *pevent,
+                                       INT8U           *perr);
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        SEMAPHORE MANAGEMENT
+*********************************************************************************************************
+*/
+#if OS_SEM_EN > 0u
+
+#if OS_SEM_ACCEPT_EN > 0u
+INT16U        OSSemAccept             (OS_EVENT        *pevent);
+#endif
+
+OS_EVENT     *OSSemCreate             (INT16U           cnt);
+
+#if OS_SEM_DEL_EN > 0u
+OS_EVENT     *OSSemDel                (OS_EVENT        *pevent,
                                        INT8U            opt,
                                        INT8U           *perr);
 #endif
@@ -1125,23 +1924,28 @@ void          OSSemSet                (OS_EVENT        *pevent,
 *                                           TASK MANAGEMENT
 *********************************************************************************************************
 */
+#if OS_SMP_EN > 0u
+INT8U         OSTaskAffinitySet       (OS_PRIO_NBR      prio,
+                                       OS_CORE_MSK      msk);
+#endif
+
 #if OS_TASK_CHANGE_PRIO_EN > 0u
-INT8U         OSTaskChangePrio        (INT8U            oldprio,
-                                       INT8U            newprio);
+INT8U         OSTaskChangePrio        (OS_PRIO_NBR      oldprio,
+                                       OS_PRIO_NBR      newprio);
 #endif
 
 #if OS_TASK_CREATE_EN > 0u
 INT8U         OSTaskCreate            (void           (*task)(void *p_arg),
                                        void            *p_arg,
                                        OS_STK          *ptos,
-                                       INT8U            prio);
+                                       OS_PRIO_NBR      prio);
 #endif
 
 #if OS_TASK_CREATE_EXT_EN > 0u
 INT8U         OSTaskCreateExt         (void           (*task)(void *p_arg),
                                        void            *p_arg,
                                        OS_STK          *ptos,
-                                       INT8U            prio,
+                                       OS_PRIO_NBR      prio,
                                        INT16U           id,
                                        OS_STK          *pbos,
                                        INT32U           stk_size,
@@ -1149,46 +1953,72 @@ INT8U         OSTaskCreateExt         (void           (*task)(void *p_arg),
                                        INT16U           opt);
 #endif
 
+#if (OS_TASK_CREATE_EXT_EN > 0u) && (OS_SCHED_EDF_EN > 0u)
+INT8U         OSTaskCreateEDF         (void           (*task)(void *p_arg),
+                                       void            *p_arg,
+                                       OS_STK          *ptos,
+                                       OS_PRIO_NBR      prio,
+                                       INT16U           id,
+                                       OS_STK          *pbos,
+                                       INT32U           stk_size,
+                                       void            *pext,
+                                       INT16U           opt,
+                                       INT32U           deadline,
+                                       INT32U           period);
+#endif
+
 #if OS_TASK_DEL_EN > 0u
-INT8U         OSTaskDel               (INT8U            prio);
-INT8U         OSTaskDelReq            (INT8U            prio);
+INT8U         OSTaskDel               (OS_PRIO_NBR      prio);
+INT8U         OSTaskDelReq            (OS_PRIO_NBR      prio);
+#endif
+
+#if OS_TASK_LAT_EN > 0u
+INT8U         OSTaskLatQuery          (OS_PRIO_NBR      prio,
+                                       OS_TASK_LAT     *p_lat);
+
+INT8U         OSTaskLatReset          (OS_PRIO_NBR      prio);
 #endif
 
 #if OS_TASK_NAME_EN > 0u
-INT8U         OSTaskNameGet           (INT8U            prio,
+INT8U         OSTaskNameGet           (OS_PRIO_NBR      prio,
                                        INT8U          **pname,
                                        INT8U           *perr);
 
-void          OSTaskNameSet           (INT8U            prio,
+void          OSTaskNameSet           (OS_PRIO_NBR      prio,
                                        INT8U           *pname,
                                        INT8U           *perr);
 #endif
 
 #if OS_TASK_SUSPEND_EN > 0u
-INT8U         OSTaskResume            (INT8U            prio);
-INT8U         OSTaskSuspend           (INT8U            prio);
+INT8U         OSTaskResume            (OS_PRIO_NBR      prio);
+INT8U         OSTaskSuspend           (OS_PRIO_NBR      prio);
 #endif
 
 #if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
-INT8U         OSTaskStkChk            (INT8U            prio,
+INT8U         OSTaskStkChk            (OS_PRIO_NBR      prio,
                                        OS_STK_DATA     *p_stk_data);
 #endif
 
 #if OS_TASK_QUERY_EN > 0u
-INT8U         OSTaskQuery             (INT8U            prio,
+INT8U         OSTaskQuery             (OS_PRIO_NBR      prio,
                                        OS_TCB          *p_task_data);
 #endif
 
+#if OS_SCHED_THRESHOLD_EN > 0u
+INT8U         OSTaskThresholdSet      (OS_PRIO_NBR      prio,
+                                       OS_PRIO_NBR      threshold);
+#endif
+
 
 
 #if OS_TASK_REG_TBL_SIZE > 0u
-INT32U        OSTaskRegGet            (INT8U            prio,
+INT32U        OSTaskRegGet            (OS_PRIO_NBR      prio,
                                        INT8U            id,
                                        INT8U           *perr);
 
 INT8U         OSTaskRegGetID          (INT8U           *perr);
 
-void          OSTaskRegSet            (INT8U            prio,
+void          OSTaskRegSet            (OS_PRIO_NBR      prio,
                                        INT8U            id,
                                        INT32U           value,
                                        INT8U           *perr);
@@ -1210,8 +2040,12 @@ INT8U         OSTimeDlyHMSM           (INT8U            hours,
                                        INT16U           ms);
 #endif
 
+#if OS_SCHED_EDF_EN > 0u
+INT8U         OSTimeDlyPeriod         (void);
+#endif
+
 #if OS_TIME_DLY_RESUME_EN > 0u
-INT8U         OSTimeDlyResume         (INT8U            prio);
+INT8U         OSTimeDlyResume         (OS_PRIO_NBR      prio);
 #endif
 
 #if OS_TIME_GET_SET_EN > 0u
@@ -1221,6 +2055,17 @@ void          OSTimeSet               (INT32U           ticks);
 
 void          OSTimeTick              (void);
 
+#if OS_TICKLESS_EN > 0u
+void          OSTimeTickAnnounce      (INT32U           ticks,
+                                       INT32U          *ptmr_ctr);
+
+void          OSTimeTickCatchUp       (INT32U           ticks);
+
+INT32U        OSTimeTickNextGet       (void);
+
+INT32U        OSTimeTickWakeGet       (INT32U           tmr_ctr);
+#endif
+
 /*
 *********************************************************************************************************
 *                                          TIMER MANAGEMENT
@@ -1239,6 +2084,13 @@ OS_TMR      *OSTmrCreate              (INT32U           dly,
 BOOLEAN      OSTmrDel                 (OS_TMR          *ptmr,
                                        INT8U           *perr);
 
+#if OS_TMR_CFG_WORKER_EN > 0u
+INT8U        OSTmrLatQuery            (OS_TMR          *ptmr,
+                                       OS_TMR_LAT      *p_lat);
+
+INT8U        OSTmrLatReset            (OS_TMR          *ptmr);
+#endif
+
 #if OS_TMR_CFG_NAME_EN > 0u
 INT8U        OSTmrNameGet             (OS_TMR          *ptmr,
                                        INT8U          **pdest,
@@ -1258,7 +2110,74 @@ BOOLEAN      OSTmrStop                (OS_TMR          *ptmr,
                                        void            *callback_arg,
                                        INT8U           *perr);
 
+#if OS_TMR_CFG_SLACK_EN > 0u
+INT8U        OSTmrSlackSet            (OS_TMR          *ptmr,
+                                       INT32U           slack);
+#endif
+
+#if OS_TMR_CFG_WORKER_EN > 0u
+INT8U        OSTmrWorkerSet           (OS_TMR          *ptmr,
+                                       INT8U            worker);
+#endif
+
 INT8U        OSTmrSignal              (void);
+
+#if OS_TMR_CFG_POOL_ADD_EN > 0u
+INT8U        OSTmrPoolAdd             (OS_TMR          *ptmr_tbl,
+                                       INT32U           nbr);
+#endif
+
+#if OS_TICKLESS_EN > 0u
+INT32U       OSTmrNextGet             (void);
+
+void         OSTmrTimeCatchUp         (INT32U           ticks);
+#endif
+#endif
+
+/*
+*********************************************************************************************************
+*                                         HIGH-RESOLUTION TIMERS
+*********************************************************************************************************
+*/
+
+#if OS_HRT_EN > 0u
+OS_HRT      *OSHrtCreate              (OS_HRT_CALLBACK  callback,
+                                       void            *callback_arg,
+                                       INT8U           *perr);
+
+BOOLEAN      OSHrtDel                 (OS_HRT          *phrt,
+                                       INT8U           *perr);
+
+OS_TS        OSHrtRemainGet           (OS_HRT          *phrt,
+                                       INT8U           *perr);
+
+void         OSHrtSignal              (void);
+
+BOOLEAN      OSHrtStart               (OS_HRT          *phrt,
+                                       OS_TS            ts,
+                                       INT8U            opt,
+                                       INT8U           *perr);
+
+INT8U        OSHrtStateGet            (OS_HRT          *phrt,
+                                       INT8U           *perr);
+
+BOOLEAN      OSHrtStop                (OS_HRT          *phrt,
+                                       INT8U           *perr);
+#endif
+
+/*
+*********************************************************************************************************
+*                                           TRACE RECORDER
+*********************************************************************************************************
+*/
+
+#if OS_TRACE_EN > 0u
+INT32U        OSTraceExport           (OS_TRACE_WR_FNCT  pfnct,
+                                       void             *p_arg);
+
+void          OSTraceStart            (void);
+
+void          OSTraceStop             (void);
 #endif
 
 /*
@@ -1272,6 +2191,12 @@ void          OSInit                  (void);
 void          OSIntEnter              (void);
 void          OSIntExit               (void);
 
+#if OS_MULTI_INST_EN > 0u
+OS_KERNEL    *OSKernelGet             (void);
+
+void          OSKernelSet             (OS_KERNEL       *p_kernel);
+#endif
+
 #ifdef OS_SAFETY_CRITICAL_IEC61508
 void          OSSafetyCriticalStart   (void);
 #endif
@@ -1281,8 +2206,17 @@ void          OSSchedLock             (void);
 void          OSSchedUnlock           (void);
 #endif
 
+#if OS_SCHED_RR_EN > 0u
+INT8U         OSSchedQuantaSet        (OS_PRIO_NBR      prio,
+                                       INT16U           quanta);
+#endif
+
 void          OSStart                 (void);
 
+#if OS_SMP_EN > 0u
+void          OSStartCore             (void);
+#endif
+
 void          OSStatInit              (void);
 
 INT16U        OSVersion               (void);
@@ -1300,7 +2234,7 @@ void          OS_Dummy                (void);
 #endif
 
 #if (OS_EVENT_EN)
-INT8U         OS_EventTaskRdy         (OS_EVENT        *pevent,
+OS_TCB       *OS_EventTaskRdy         (OS_EVENT        *pevent,
                                        void            *pmsg,
                                        INT8U            msk,
                                        INT8U            pend_stat);
@@ -1310,6 +2244,12 @@ void          OS_EventTaskWait        (OS_EVENT        *pevent);
 void          OS_EventTaskRemove      (OS_TCB          *ptcb,
                                        OS_EVENT        *pevent);
 
+void          OS_EventWaitBitClr      (OS_TCB          *ptcb,
+                                       OS_EVENT        *pevent);
+
+void          OS_EventWaitBitSet      (OS_TCB          *ptcb,
+                                       OS_EVENT        *pevent);
+
 #if (OS_EVENT_MULTI_EN > 0u)
 void          OS_EventTaskWaitMulti   (OS_EVENT       **pevents_wait);
 
@@ -1323,6 +2263,9 @@ void          OS_EventWaitListInit    (OS_EVENT        *pevent);
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
 void          OS_FlagInit             (void);
 void          OS_FlagUnlink           (OS_FLAG_NODE    *pnode);
+#if OS_FLAG_MULTI_EN > 0u
+void          OS_FlagUnlinkMulti      (OS_TCB          *ptcb);
+#endif
 #endif
 
 void          OS_MemClr               (INT8U           *pdest,
@@ -1340,8 +2283,30 @@ void          OS_MemInit              (void);
 void          OS_QInit                (void);
 #endif
 
+#if OS_QV_EN > 0u
+void          OS_QVInit               (void);
+
+void          OS_QVTaskDel            (OS_TCB          *ptcb);
+#endif
+
+void          OS_PrioTblInsert        (OS_TCB          *ptcb);
+
+void          OS_PrioTblRemove        (OS_TCB          *ptcb,
+                                       OS_PRIO_NBR      prio);
+
+void          OS_RdyListInsert        (OS_TCB          *ptcb);
+
+void          OS_RdyListRemove        (OS_TCB          *ptcb);
+
 void          OS_Sched                (void);
 
+#if OS_SMP_EN > 0u
+INT8U         OS_CoreSelect           (OS_CORE_MSK      msk);
+
+void          OS_TaskCoreSet          (OS_TCB          *ptcb,
+                                       INT8U            core);
+#endif
+
 #if (OS_EVENT_NAME_EN > 0u) || (OS_FLAG_NAME_EN > 0u) || (OS_MEM_NAME_EN > 0u) || (OS_TASK_NAME_EN > 0u)
 INT8U         OS_StrLen               (INT8U           *psrc);
 #endif
@@ -1360,22 +2325,149 @@ void          OS_TaskStkClr           (OS_STK          *pbos,
                                        INT16U           opt);
 #endif
 
+#if (OS_TASK_STAT_EN > 0u) && (OS_TASK_PROFILE_EN > 0u)
+void          OS_TaskStatCPUUsage     (void);
+#endif
+
 #if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
 void          OS_TaskStatStkChk       (void);
 #endif
 
-INT8U         OS_TCBInit              (INT8U            prio,
+#if OS_TASK_PROFILE_EN > 0u
+void          OS_TaskSwProfile        (void);
+#endif
+
+#if OS_TASK_LAT_EN > 0u
+void          OS_TaskLatRdy           (OS_TCB          *ptcb);
+
+void          OS_TaskLatSw            (void);
+#endif
+
+INT8U         OS_TCBInit              (OS_PRIO_NBR      prio,
                                        OS_STK          *ptos,
                                        OS_STK          *pbos,
                                        INT16U           id,
                                        INT32U           stk_size,
                                        void            *pext,
-                                       INT16U           opt);
+                                       INT16U           opt,
+                                       INT32U           deadline,
+                                       INT32U           period);
+
+void          OS_TCBPrioSet           (OS_TCB          *ptcb,
+                                       OS_PRIO_NBR      prio);
+
+#if OS_TICK_LIST_EN > 0u
+void          OS_TickListInsert       (OS_TCB          *ptcb,
+                                       INT32U           ticks);
+
+void          OS_TickListRemove       (OS_TCB          *ptcb);
+#endif
 
 #if OS_TMR_EN > 0u
 void          OSTmr_Init              (void);
 #endif
 
+#if OS_HRT_EN > 0u
+void          OS_HrtInit              (void);
+#endif
+
+#if OS_ISR_POST_DEFERRED_EN > 0u
+void          OS_IntQInit             (void);
+
+INT8U         OS_IntQPost             (INT8U            type,
+                                       void            *pobj,
+                                       void            *pmsg,
+                                       INT8U            opt);
+
+#if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
+INT8U         OS_IntQFlagPost         (OS_FLAG_GRP     *pgrp,
+                                       OS_FLAGS         flags,
+                                       INT8U            opt);
+#endif
+#endif
+
+#if OS_TRACE_EN > 0u
+void          OS_TraceInit            (void);
+
+void          OS_TraceRec             (INT8U            type,
+                                       INT8U            arg,
+                                       OS_PRIO_NBR      prio,
+                                       void            *pobj,
+                                       INT32U           val);
+#endif
+
+/*
+*********************************************************************************************************
+*                                       BROADCAST INTERRUPT WINDOW
+*
+* Note(s): 1) With OS_ISR_POST_DEFERRED_EN, no ISR changes the wait list of an event or of a flag group.
+*             A post readying several tasks with the scheduler locked, as the ISR post task does, then
+*             lets pending interrupts in after each task it readies, so that interrupts are not disabled
+*             for a time proportional to the number of waiting tasks.  The tick ISR may time out one of
+*             the waiting tasks meanwhile : readying it twice is harmless (see OS_RdyListInsert()).
+*          2) With OS_SMP_EN, tasks of other cores may pend on the event meanwhile : the window is closed.
+*********************************************************************************************************
+*/
+
+#if (OS_ISR_POST_DEFERRED_EN > 0u) && (OS_SMP_EN == 0u)
+#define  OS_INT_Q_WINDOW()                 { if (OSLockNesting > 0u) { OS_EXIT_CRITICAL(); OS_ENTER_CRITICAL(); } }
+#else
+#define  OS_INT_Q_WINDOW()
+#endif
+
+/*
+*********************************************************************************************************
+*                                          BY-VALUE MESSAGE COPY
+*
+* Note(s): 1) OSQVPost() & OSQVPend() copy messages with OS_QV_MSG_COPY(), with interrupts disabled.  A port
+*             may define it in OS_CPU.H as a faster copy than OS_MemCopy(), which moves one byte at a time.
+*********************************************************************************************************
+*/
+
+#if (OS_QV_EN > 0u) && (OS_MAX_QVS > 0u)
+#ifndef  OS_QV_MSG_COPY
+#define  OS_QV_MSG_COPY(pdest, psrc, size) OS_MemCopy((INT8U *)(pdest), (INT8U *)(psrc), (size))
+#endif
+#endif
+
+/*
+*********************************************************************************************************
+*                                            TRACE HOOKS
+*
+* Note(s): 1) The kernel records its events through these macros, which compile to nothing without
+*             OS_TRACE_EN.  OS_TRACE_TASK_SW() MUST be called by the port's OSTaskSwHook().
+*********************************************************************************************************
+*/
+
+#if OS_TRACE_EN > 0u
+#define  OS_TRACE_TASK_SW()                OS_TraceRec(OS_TRACE_TYPE_TASK_SW,     0u,                   \
+                                                       OSTCBHighRdy->OSTCBPrio, (void *)OSTCBHighRdy, \
+                                                       (INT32U)OSTCBCur->OSTCBPrio)
+#define  OS_TRACE_INT_ENTER()              OS_TraceRec(OS_TRACE_TYPE_INT_ENTER,   OSIntNesting,         \
+                                                       OSPrioCur, (void *)0, 0u)
+#define  OS_TRACE_INT_EXIT()               OS_TraceRec(OS_TRACE_TYPE_INT_EXIT,    OSIntNesting,         \
+                                                       OSPrioCur, (void *)0, 0u)
+#define  OS_TRACE_PEND(type, pobj, tmo)    OS_TraceRec(OS_TRACE_TYPE_PEND,        (type),               \
+                                                       OSPrioCur, (void *)(pobj), (INT32U)(tmo))
+#define  OS_TRACE_POST(type, pobj, val)    OS_TraceRec(OS_TRACE_TYPE_POST,        (type),               \
+                                                       OSPrioCur, (void *)(pobj), (INT32U)(val))
+#define  OS_TRACE_TMR_EXPIRE(ptmr)         OS_TraceRec(OS_TRACE_TYPE_TMR_EXPIRE,  0u,                   \
+                                                       OSPrioCur, (void *)(ptmr), OSTmrTime)
+#define  OS_TRACE_TASK_CREATE(ptcb)        OS_TraceRec(OS_TRACE_TYPE_TASK_CREATE, 0u,                   \
+                                                       (ptcb)->OSTCBPrio, (void *)(ptcb), 0u)
+#define  OS_TRACE_TASK_DEL(ptcb)           OS_TraceRec(OS_TRACE_TYPE_TASK_DEL,    0u,                   \
+                                                       (ptcb)->OSTCBPrio, (void *)(ptcb), 0u)
+#else
+#define  OS_TRACE_TASK_SW()
+#define  OS_TRACE_INT_ENTER()
+#define  OS_TRACE_INT_EXIT()
+#define  OS_TRACE_PEND(type, pobj, tmo)
+#define  OS_TRACE_POST(type, pobj, val)
+#define  OS_TRACE_TMR_EXPIRE(ptmr)
+#define  OS_TRACE_TASK_CREATE(ptcb)
+#define  OS_TRACE_TASK_DEL(ptcb)
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -1414,6 +2506,10 @@ void          OSTCBInitHook           (OS_TCB          *ptcb);
 void          OSTimeTickHook          (void);
 #endif
 
+#if OS_HRT_EN > 0u
+void          OSHrtTmrSet             (OS_TS            dly);
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -1454,8 +2550,37 @@ void          App_TimeTickHook        (void);
 void          OSStartHighRdy          (void);
 void          OSIntCtxSw              (void);
 void          OSCtxSw                 (void);
+
+#if OS_SMP_EN > 0u                                      /* See note below                              */
+INT8U         OS_CPU_CoreIdGet        (void);
+void          OS_CPU_CoreSignal       (INT8U            core);
+void          OS_CPU_CoreStart        (INT8U            core);
+#endif
 #endif
 
+/*
+*********************************************************************************************************
+*                                        MULTI-CORE PORT SUPPORT
+*
+* Note(s): With OS_SMP_EN, the port MUST also:
+*          1) Return the index of the calling core from OS_CPU_CoreIdGet(), 0 being the core that calls
+*             OSInit() and OSStart().
+*          2) Make OS_ENTER_CRITICAL() disable the interrupts of the calling core AND acquire a spinlock
+*             shared by all the cores.  OS_EXIT_CRITICAL() releases it.  A nested critical section MUST
+*             NOT acquire the lock again (e.g. OS_CRITICAL_METHOD #3 saves whether the lock was taken).
+*          3) Keep the spinlock held across OSCtxSw(), OSIntCtxSw() and OSStartHighRdy(): it is released
+*             by the task that is switched in (a task that runs for the first time releases it before
+*             calling its task function), so another core never resumes a task before its context has
+*             been saved.
+*          4) Start core 'core' from OS_CPU_CoreStart() (called by OSStart()), the core then calls
+*             OSStartCore() with its interrupts disabled.
+*          5) Interrupt core 'core' from OS_CPU_CoreSignal().  The handler of that inter-processor
+*             interrupt only calls OSIntEnter() and OSIntExit(), so the core reschedules.
+*          6) Use OSTCBCur, OSTCBHighRdy, OSPrioCur and OSPrioHighRdy as usual, they designate the
+*             calling core's entry of OSCoreTbl[].
+*********************************************************************************************************
+*/
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -1487,7 +2612,7 @@ void          OSCtxSw                 (void);
     #endif
 
     #ifndef OS_FLAGS_NBITS
-    #error  "OS_CFG.H, Missing OS_FLAGS_NBITS: Determine #bits used for event flags, MUST be either 8, 16 or 32"
+    #error  "OS_CFG.H, Missing OS_FLAGS_NBITS: Determine #bits used for event flags, MUST be either 8, 16, 32 or 64"
     #endif
 
     #ifndef OS_FLAG_WAIT_CLR_EN
@@ -1502,6 +2627,14 @@ void          OSCtxSw                 (void);
     #error  "OS_CFG.H, Missing OS_FLAG_DEL_EN: Include code for OSFlagDel()"
     #endif
 
+    #ifndef OS_FLAG_INDEX_EN
+    #error  "OS_CFG.H, Missing OS_FLAG_INDEX_EN: Group the tasks waiting on event flags by flags waited on"
+    #endif
+
+    #ifndef OS_FLAG_MULTI_EN
+    #error  "OS_CFG.H, Missing OS_FLAG_MULTI_EN: Include code for OSFlagPendMulti()"
+    #endif
+
     #ifndef OS_FLAG_NAME_EN
     #error  "OS_CFG.H, Missing OS_FLAG_NAME_EN: Enable flag group names"
     #endif
@@ -1643,6 +2776,18 @@ void          OSCtxSw                 (void);
     #endif
 #endif
 
+#ifndef OS_QV_EN
+#error  "OS_CFG.H, Missing OS_QV_EN: Enable (1) or Disable (0) code generation for BY-VALUE QUEUES"
+#else
+    #ifndef OS_MAX_QVS
+    #error  "OS_CFG.H, Missing OS_MAX_QVS: Max. number of by-value queue control blocks"
+    #else
+        #if     OS_MAX_QVS > 65500u
+        #error  "OS_CFG.H, OS_MAX_QVS must be <= 65500"
+        #endif
+    #endif
+#endif
+
 /*
 *********************************************************************************************************
 *                                             SEMAPHORES
@@ -1687,13 +2832,19 @@ void          OSCtxSw                 (void);
     #endif
 
     #if     OS_MAX_TASKS >  ((OS_LOWEST_PRIO - OS_N_SYS_TASKS) + 1u)
-    #error  "OS_CFG.H,         OS_MAX_TASKS must be <= OS_LOWEST_PRIO - OS_N_SYS_TASKS + 1"
+    #if     OS_SCHED_RR_EN == 0u                /* Round-robin tasks may share priorities      */
+    #error  "OS_CFG.H,         OS_MAX_TASKS must be <= OS_LOWEST_PRIO - OS_N_SYS_TASKS + 1 unless OS_SCHED_RR_EN"
+    #endif
+    #endif
+
+    #if     (OS_MAX_TASKS + OS_N_SYS_TASKS) >  65535u   /* TCBs are counted on 16 bits        */
+    #error  "OS_CFG.H,         OS_MAX_TASKS must be <= 65535 - OS_N_SYS_TASKS"
     #endif
 
 #endif
 
-#if     OS_LOWEST_PRIO >  254u
-#error  "OS_CFG.H,         OS_LOWEST_PRIO must be <= 254 in V2.8x and higher"
+#if     OS_LOWEST_PRIO > 4095u
+#error  "OS_CFG.H,         OS_LOWEST_PRIO must be <= 4095"
 #endif
 
 #ifndef OS_TASK_IDLE_STK_SIZE
@@ -1732,6 +2883,24 @@ void          OSCtxSw                 (void);
 #error  "OS_CFG.H, Missing OS_TASK_DEL_EN: Include code for OSTaskDel()"
 #endif
 
+#ifndef OS_TASK_LAT_EN
+#error  "OS_CFG.H, Missing OS_TASK_LAT_EN: Histogram of ISR post to task run latency, per task"
+#elif   OS_TASK_LAT_EN > 0u
+    #ifndef OS_TASK_LAT_HIST_SIZE
+    #error  "OS_CFG.H, Missing OS_TASK_LAT_HIST_SIZE: Number of latency buckets per task"
+    #elif  (OS_TASK_LAT_HIST_SIZE < 1u) || (OS_TASK_LAT_HIST_SIZE > 32u)
+    #error  "OS_CFG.H,         OS_TASK_LAT_HIST_SIZE must be between 1 and 32"
+    #endif
+
+    #if (OS_CPU_HOOKS_EN == 0u) || (OS_TASK_SW_HOOK_EN == 0u)
+    #error  "OS_CFG.H, OS_CPU_HOOKS_EN and OS_TASK_SW_HOOK_EN must be enabled (1): OSTaskSwHook() measures the latencies"
+    #endif
+
+    #if (CPU_CFG_TS_32_EN != DEF_ENABLED)
+    #error  "CPU_CFG.H, CPU_CFG_TS_32_EN must be enabled to measure task latencies (OS_TASK_LAT_EN)"
+    #endif
+#endif
+
 #ifndef OS_TASK_NAME_EN
 #error  "OS_CFG.H, Missing OS_TASK_NAME_EN: Enable task names"
 #endif
@@ -1812,10 +2981,46 @@ void          OSCtxSw                 (void);
         #endif
     #endif
 
+    #ifndef OS_TMR_CFG_WHEEL_HIER_EN
+    #error  "OS_CFG.H, Missing OS_TMR_CFG_WHEEL_HIER_EN: Use a hierarchical timer wheel"
+    #endif
+
+    #ifndef OS_TMR_CFG_POOL_ADD_EN
+    #error  "OS_CFG.H, Missing OS_TMR_CFG_POOL_ADD_EN: Include code for OSTmrPoolAdd()"
+    #endif
+
+    #ifndef OS_TMR_CFG_SLACK_EN
+    #error  "OS_CFG.H, Missing OS_TMR_CFG_SLACK_EN: Coalesce timer expiries within a per-timer slack"
+    #endif
+
     #ifndef OS_TMR_CFG_NAME_EN
     #error  "OS_CFG.H, Missing OS_TMR_CFG_NAME_EN: Enable Timer names"
     #endif
 
+    #ifndef OS_TMR_CFG_WORKER_EN
+    #error  "OS_CFG.H, Missing OS_TMR_CFG_WORKER_EN: Run timer callbacks in worker tasks"
+    #elif   OS_TMR_CFG_WORKER_EN > 0u
+        #ifndef OS_TMR_CFG_WORKER_NBR
+        #error  "OS_CFG.H, Missing OS_TMR_CFG_WORKER_NBR: Number of timer worker tasks (1 .. 16)"
+        #elif  (OS_TMR_CFG_WORKER_NBR < 1u) || (OS_TMR_CFG_WORKER_NBR > 16u)
+        #error  "OS_CFG.H, OS_TMR_CFG_WORKER_NBR should be between 1 and 16"
+        #endif
+
+        #ifndef OS_TMR_CFG_WORKER_Q_SIZE
+        #error  "OS_CFG.H, Missing OS_TMR_CFG_WORKER_Q_SIZE: Callbacks queued per timer worker task (2 .. 65535)"
+        #elif  (OS_TMR_CFG_WORKER_Q_SIZE < 2u) || (OS_TMR_CFG_WORKER_Q_SIZE > 65535u)
+        #error  "OS_CFG.H, OS_TMR_CFG_WORKER_Q_SIZE should be between 2 and 65535"
+        #endif
+
+        #ifndef OS_TASK_TMR_WORKER_STK_SIZE
+        #error  "OS_CFG.H, Missing OS_TASK_TMR_WORKER_STK_SIZE: Determines the size of the timer worker tasks' stacks"
+        #endif
+
+        #ifndef OS_TASK_TMR_WORKER_PRIO
+        #error  "APP_CFG.H, Missing OS_TASK_TMR_WORKER_PRIO: Priority of timer worker task 0, task n runs at + n"
+        #endif
+    #endif
+
     #ifndef OS_TMR_CFG_TICKS_PER_SEC
     #error  "OS_CFG.H, Missing OS_TMR_CFG_TICKS_PER_SEC: Determines the rate at which the timer management task will run (Hz)"
     #endif
@@ -1826,6 +3031,39 @@ void          OSCtxSw                 (void);
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                         HIGH-RESOLUTION TIMERS
+*********************************************************************************************************
+*/
+
+#ifndef OS_HRT_EN
+#error  "OS_CFG.H, Missing OS_HRT_EN: One-shot timers that expire on CPU timestamps instead of ticks"
+#elif   OS_HRT_EN > 0u
+    #ifndef OS_HRT_CFG_MAX
+    #error  "OS_CFG.H, Missing OS_HRT_CFG_MAX: Determines the total number of high-resolution timers (1 .. 65534)"
+    #elif  (OS_HRT_CFG_MAX < 1u) || (OS_HRT_CFG_MAX > 65534u)
+    #error  "OS_CFG.H, OS_HRT_CFG_MAX should be between 1 and 65534"
+    #endif
+
+    #ifndef OS_TASK_HRT_STK_SIZE
+    #error  "OS_CFG.H, Missing OS_TASK_HRT_STK_SIZE: Determines the size of the HR timer task's stack"
+    #endif
+
+    #ifndef OS_TASK_HRT_PRIO
+    #error  "APP_CFG.H, Missing OS_TASK_HRT_PRIO: Priority of the task that calls the HR timer callbacks"
+    #endif
+
+    #if     OS_SEM_EN == 0u
+    #error  "OS_CFG.H, Semaphore management is required (set OS_SEM_EN to 1) when enabling OS_HRT_EN."
+    #endif
+
+    #if (CPU_CFG_TS_TMR_EN != DEF_ENABLED)
+    #error  "CPU_CFG.H, the CPU timestamp timer must be enabled (CPU_CFG_TS_32_EN or CPU_CFG_TS_64_EN) when enabling OS_HRT_EN"
+    #endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                            MISCELLANEOUS
@@ -1866,6 +3104,38 @@ void          OSCtxSw                 (void);
 #endif
 
 
+#ifndef OS_SCHED_CNT_ZEROS_EN
+#error  "OS_CFG.H, Missing OS_SCHED_CNT_ZEROS_EN: Find the highest priority ready task with CPU_CntTrailZeros()"
+#endif
+
+#ifndef OS_SCHED_EDF_EN
+#error  "OS_CFG.H, Missing OS_SCHED_EDF_EN: Schedule tasks of the EDF priority band by earliest deadline first"
+#elif   OS_SCHED_EDF_EN > 0u
+    #ifndef OS_SCHED_EDF_PRIO
+    #error  "OS_CFG.H, Missing OS_SCHED_EDF_PRIO: Highest priority of the EDF band"
+    #elif   OS_SCHED_EDF_PRIO >= OS_LOWEST_PRIO
+    #error  "OS_CFG.H,         OS_SCHED_EDF_PRIO must be < OS_LOWEST_PRIO"
+    #endif
+
+    #if     OS_TIME_GET_SET_EN == 0u
+    #error  "OS_CFG.H,         OS_TIME_GET_SET_EN must be Enable (1) to maintain EDF deadlines"
+    #endif
+#endif
+
+#ifndef OS_SCHED_RR_EN
+#error  "OS_CFG.H, Missing OS_SCHED_RR_EN: Let tasks share a priority and time slice them round-robin"
+#elif   OS_SCHED_RR_EN > 0u
+    #ifndef OS_SCHED_RR_QUANTUM
+    #error  "OS_CFG.H, Missing OS_SCHED_RR_QUANTUM: Default time quantum of a shared priority"
+    #elif   OS_SCHED_RR_QUANTUM > 65535u
+    #error  "OS_CFG.H,         OS_SCHED_RR_QUANTUM must be <= 65535"
+    #endif
+#endif
+
+#ifndef OS_SCHED_THRESHOLD_EN
+#error  "OS_CFG.H, Missing OS_SCHED_THRESHOLD_EN: Let tasks set a preemption threshold above their priority"
+#endif
+
 #ifndef OS_SCHED_LOCK_EN
 #error  "OS_CFG.H, Missing OS_SCHED_LOCK_EN: Include code for OSSchedLock() and OSSchedUnlock()"
 #endif
@@ -1878,6 +3148,10 @@ void          OSCtxSw                 (void);
 
 #ifndef OS_TASK_PROFILE_EN
 #error  "OS_CFG.H, Missing OS_TASK_PROFILE_EN: Include data structure for run-time task profiling"
+#elif   OS_TASK_PROFILE_EN > 0u
+    #if (OS_CPU_HOOKS_EN == 0u) || (OS_TASK_SW_HOOK_EN == 0u)
+    #error  "OS_CFG.H, OS_CPU_HOOKS_EN and OS_TASK_SW_HOOK_EN must be enabled (1): OSTaskSwHook() measures the task run times"
+    #endif
 #endif
 
 
@@ -1886,11 +3160,99 @@ void          OSCtxSw                 (void);
 #endif
 
 
+#ifndef OS_ISR_POST_DEFERRED_EN
+#error  "OS_CFG.H, Missing OS_ISR_POST_DEFERRED_EN: Have a kernel task perform the posts made by ISRs"
+#elif   OS_ISR_POST_DEFERRED_EN > 0u
+    #ifndef OS_INT_Q_SIZE
+    #error  "OS_CFG.H, Missing OS_INT_Q_SIZE: Number of ISR posts that can be deferred at once"
+    #elif  (OS_INT_Q_SIZE < 2u) || (OS_INT_Q_SIZE > 65535u)
+    #error  "OS_CFG.H,         OS_INT_Q_SIZE must be between 2 and 65535"
+    #endif
+
+    #ifndef OS_TASK_INT_Q_STK_SIZE
+    #error  "OS_CFG.H, Missing OS_TASK_INT_Q_STK_SIZE: Determines the size of the ISR post task's stack"
+    #endif
+
+    #if     OS_SEM_EN == 0u
+    #error  "OS_CFG.H, Semaphore management is required (set OS_SEM_EN to 1) when enabling OS_ISR_POST_DEFERRED_EN."
+    #endif
+#endif
+
+
+#ifndef OS_TRACE_EN
+#error  "OS_CFG.H, Missing OS_TRACE_EN: Record kernel events into a trace buffer per core"
+#elif   OS_TRACE_EN > 0u
+    #ifndef OS_TRACE_BUF_SIZE
+    #error  "OS_CFG.H, Missing OS_TRACE_BUF_SIZE: Number of trace records buffered per core"
+    #elif  (OS_TRACE_BUF_SIZE < 2u) || ((OS_TRACE_BUF_SIZE & (OS_TRACE_BUF_SIZE - 1u)) != 0u)
+    #error  "OS_CFG.H,         OS_TRACE_BUF_SIZE must be a power of 2"
+    #endif
+
+    #if (OS_CPU_HOOKS_EN == 0u) || (OS_TASK_SW_HOOK_EN == 0u)
+    #error  "OS_CFG.H, OS_CPU_HOOKS_EN and OS_TASK_SW_HOOK_EN must be enabled (1): OSTaskSwHook() records the context switches"
+    #endif
+#endif
+
+
+#ifndef OS_SMP_EN
+#error  "OS_CFG.H, Missing OS_SMP_EN: Run the kernel on several cores, each with its own ready list"
+#elif   OS_SMP_EN > 0u
+    #ifndef OS_SMP_CORE_NBR
+    #error  "OS_CFG.H, Missing OS_SMP_CORE_NBR: Number of cores"
+    #elif  (OS_SMP_CORE_NBR < 2u) || (OS_SMP_CORE_NBR > 32u)
+    #error  "OS_CFG.H,         OS_SMP_CORE_NBR must be between 2 and 32"
+    #endif
+
+    #ifndef OS_SMP_STEAL_EN
+    #error  "OS_CFG.H, Missing OS_SMP_STEAL_EN: Let an idle core steal ready tasks from the busiest core"
+    #endif
+
+    #if     OS_SCHED_EDF_EN > 0u
+    #error  "OS_CFG.H, OS_SCHED_EDF_EN must be disabled (0) when enabling OS_SMP_EN"
+    #endif
+
+    #if     OS_SCHED_RR_EN > 0u
+    #error  "OS_CFG.H, OS_SCHED_RR_EN must be disabled (0) when enabling OS_SMP_EN"
+    #endif
+
+    #if     OS_TICKLESS_EN > 0u
+    #error  "OS_CFG.H, OS_TICKLESS_EN must be disabled (0) when enabling OS_SMP_EN"
+    #endif
+#endif
+
+
+#ifndef OS_MULTI_INST_EN
+#error  "OS_CFG.H, Missing OS_MULTI_INST_EN: Keeps the kernel state in one OS_KERNEL instance per host thread"
+#elif   OS_MULTI_INST_EN > 0u
+    #ifndef OS_CPU_TLS
+    #error  "OS_CPU.H, Missing OS_CPU_TLS: Storage class of the pointer to the kernel instance (thread-local)"
+    #endif
+#endif
+
+
+#ifndef OS_TICK_LIST_EN
+#error  "OS_CFG.H, Missing OS_TICK_LIST_EN: Keeps delayed tasks in a delta-sorted list so a tick only visits expiring tasks"
+#endif
+
+
 #ifndef OS_TICK_STEP_EN
 #error  "OS_CFG.H, Missing OS_TICK_STEP_EN: Allows to 'step' one tick at a time with uC/OS-View"
 #endif
 
 
+#ifndef OS_TICKLESS_EN
+#error  "OS_CFG.H, Missing OS_TICKLESS_EN: Lets the idle task suppress ticks until the next delay or timeout expires"
+#elif   OS_TICKLESS_EN > 0u
+    #if     OS_TICK_LIST_EN == 0u
+    #error  "OS_CFG.H, OS_TICK_LIST_EN must be enabled (1) when enabling OS_TICKLESS_EN"
+    #endif
+
+    #if     OS_TICK_STEP_EN > 0u
+    #error  "OS_CFG.H, OS_TICK_STEP_EN must be disabled (0) when enabling OS_TICKLESS_EN"
+    #endif
+#endif
+
+
 #ifndef OS_TIME_TICK_HOOK_EN
 #error  "OS_CFG.H, Missing OS_TIME_TICK_HOOK_EN: Allows you to include the code for OSTimeTickHook() or not"
 #endif
@@ -0,0 +1,496 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                   TRACE TO CHROME/PERFETTO CONVERTER
+*
+*                              (c) Copyright 1992-2013, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+*
+* File    : OS_TRACE_CONV.C
+* By      : Jean J. Labrosse
+* Version : V2.92.11
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrium to properly license
+* its use in your product. We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                                        NOTES
+*
+* 1) This program runs on the HOST.  It reads the stream produced by OSTraceExport() (see OS_TRACE.C) and
+*    writes it in the Chrome trace event format (JSON), which chrome://tracing and ui.perfetto.dev open:
+*
+*        cc -O2 -o os_trace_conv os_trace_conv.c
+*        os_trace_conv trace.bin trace.json
+*
+*    Without arguments, it reads the stream from stdin and writes the JSON to stdout.
+*
+* 2) Each core is shown as two tracks: the tasks running on it, one slice per run, and its ISRs.  Pends,
+*    posts, timer expiries, task creations and deletions are instant events on the task track, with the
+*    object address and value as arguments.  Records lost on the target are shown as global instant
+*    events.
+*
+* 3) The 32-bit timestamps are extended to 64 bits per core and converted to microseconds with the
+*    frequency found in the stream header.  When the frequency is unknown (0), one timestamp unit is
+*    shown as one microsecond.
+*
+* 4) The OS_TRACE_xxx constants and the layout of the records MUST match UCOS_II.H.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+#include  <stdint.h>
+
+
+/*
+*********************************************************************************************************
+*                                          CONSTANTS (see Note #4)
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_MAGIC              0x5452534Fu
+#define  OS_TRACE_VERSION                     1u
+
+#define  OS_TRACE_TYPE_TASK_SW                1u
+#define  OS_TRACE_TYPE_INT_ENTER              2u
+#define  OS_TRACE_TYPE_INT_EXIT               3u
+#define  OS_TRACE_TYPE_PEND                   4u
+#define  OS_TRACE_TYPE_POST                   5u
+#define  OS_TRACE_TYPE_TMR_EXPIRE             6u
+#define  OS_TRACE_TYPE_TASK_CREATE            7u
+#define  OS_TRACE_TYPE_TASK_DEL               8u
+
+#define  OS_TRACE_HDR_SIZE                   16u
+#define  OS_TRACE_PKT_SIZE                    8u
+#define  OS_TRACE_REC_SIZE                   16u
+
+#define  TRACE_CONV_CORE_MAX                 32u
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  trace_conv_core {
+    int        Seen;                                            /* A record was seen for this core         */
+    uint32_t   TSPrev;                                          /* Last raw timestamp                      */
+    uint64_t   TSExt;                                           /* Last timestamp, extended to 64 bits     */
+    long       PrioCur;                                         /* Task running, -1 if unknown             */
+    uint64_t   SliceStart;                                      /* Extended timestamp of its switch in     */
+    int        IntNesting;                                      /* ISRs entered and not yet exited         */
+} TRACE_CONV_CORE;
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  FILE             *TraceConv_Out;
+static  int               TraceConv_Swap;                       /* Stream byte order differs from host's   */
+static  int               TraceConv_First;                      /* Next event is the first of the array    */
+static  double            TraceConv_TSFreq;                     /* Timestamp frequency (Hz), 0 if unknown  */
+static  unsigned          TraceConv_LowestPrio;
+static  int               TraceConv_TSBaseSet;
+static  uint32_t          TraceConv_TSBase;                     /* Raw timestamp of the first record       */
+static  TRACE_CONV_CORE   TraceConv_CoreTbl[TRACE_CONV_CORE_MAX];
+
+static  const  char      *TraceConv_ObjName[] = {
+    "Event", "Mbox", "Q", "Sem", "Mutex", "Flag"                /* Indexed by OS_EVENT_TYPE_xxx            */
+};
+
+
+/*
+*********************************************************************************************************
+*                                         READ A STREAM FIELD
+*
+* Description: These functions read a 16 or 32-bit field of the stream, in the byte order of the target.
+*********************************************************************************************************
+*/
+
+static  uint16_t  TraceConv_Rd16 (const unsigned char *p)
+{
+    uint16_t  val;
+
+
+    memcpy(&val, p, sizeof(val));
+    if (TraceConv_Swap) {
+        val = (uint16_t)((val >> 8) | (val << 8));
+    }
+    return (val);
+}
+
+
+static  uint32_t  TraceConv_Rd32 (const unsigned char *p)
+{
+    uint32_t  val;
+
+
+    memcpy(&val, p, sizeof(val));
+    if (TraceConv_Swap) {
+        val = ((val >> 24) & 0x000000FFu)
+            | ((val >>  8) & 0x0000FF00u)
+            | ((val <<  8) & 0x00FF0000u)
+            | ((val << 24) & 0xFF000000u);
+    }
+    return (val);
+}
+
+/*
+*********************************************************************************************************
+*                                          EMIT A JSON EVENT
+*
+* Description: This function starts a new element of the "traceEvents" array and writes its common
+*              fields.  The caller completes the element and closes it.
+*
+* Arguments  : ph        is the phase of the event ("X", "B", "E", "i" or "M")
+*
+*              name      is the name of the event
+*
+*              tid       is the track of the event
+*
+*              ts        is the extended timestamp of the event
+*********************************************************************************************************
+*/
+
+static  double  TraceConv_Us (uint64_t  ts)
+{
+    if (TraceConv_TSFreq > 0.0) {                               /* See Note #3                             */
+        return ((double)ts * 1000000.0 / TraceConv_TSFreq);
+    }
+    return ((double)ts);
+}
+
+
+static  void  TraceConv_EvtBegin (const char  *ph,
+                                  const char  *name,
+                                  unsigned     tid,
+                                  uint64_t     ts)
+{
+    fprintf(TraceConv_Out, "%s\n{\"ph\":\"%s\",\"name\":\"%s\",\"pid\":0,\"tid\":%u,\"ts\":%.3f",
+            TraceConv_First ? "" : ",", ph, name, tid, TraceConv_Us(ts));
+    TraceConv_First = 0;
+}
+
+/*
+*********************************************************************************************************
+*                                         CONVERT TASK SLICES
+*
+* Description: This function ends the slice of the task running on a core, if any.
+*
+* Arguments  : core      is the core
+*
+*              ts        is the extended timestamp at which the task stopped running
+*********************************************************************************************************
+*/
+
+static  void  TraceConv_SliceEnd (unsigned  core,
+                                  uint64_t  ts)
+{
+    TRACE_CONV_CORE  *pcore;
+    char              name[32];
+
+
+    pcore = &TraceConv_CoreTbl[core];
+    if (pcore->PrioCur < 0) {
+        return;
+    }
+    if ((unsigned long)pcore->PrioCur == TraceConv_LowestPrio) {
+        snprintf(name, sizeof(name), "Idle");
+    } else {
+        snprintf(name, sizeof(name), "Task %ld", pcore->PrioCur);
+    }
+    TraceConv_EvtBegin("X", name, core * 2u, pcore->SliceStart);
+    fprintf(TraceConv_Out, ",\"dur\":%.3f,\"args\":{\"prio\":%ld}}",
+            TraceConv_Us(ts) - TraceConv_Us(pcore->SliceStart), pcore->PrioCur);
+    pcore->PrioCur = -1;
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          CONVERT A RECORD
+*
+* Description: This function converts one record of a core to JSON events.
+*
+* Arguments  : core      is the core that recorded it
+*
+*              p         is a pointer to the record, in the stream
+*********************************************************************************************************
+*/
+
+static  void  TraceConv_Rec (unsigned              core,
+                             const unsigned char  *p)
+{
+    TRACE_CONV_CORE  *pcore;
+    uint32_t          ts_raw;
+    uint64_t          ts;
+    unsigned          type;
+    unsigned          arg;
+    unsigned          prio;
+    uint32_t          obj;
+    uint32_t          val;
+    const char       *obj_name;
+    char              name[48];
+
+
+    ts_raw = TraceConv_Rd32(&p[0]);
+    type   = p[4];
+    arg    = p[5];
+    prio   = TraceConv_Rd16(&p[6]);
+    obj    = TraceConv_Rd32(&p[8]);
+    val    = TraceConv_Rd32(&p[12]);
+
+    if (!TraceConv_TSBaseSet) {
+        TraceConv_TSBase    = ts_raw;
+        TraceConv_TSBaseSet = 1;
+    }
+    pcore = &TraceConv_CoreTbl[core];
+    if (!pcore->Seen) {                                         /* Extend the timestamp (see Note #3)      */
+        ts          = (uint32_t)(ts_raw - TraceConv_TSBase);
+        pcore->Seen = 1;
+    } else {
+        ts          = pcore->TSExt + (uint32_t)(ts_raw - pcore->TSPrev);
+    }
+    pcore->TSPrev = ts_raw;
+    pcore->TSExt  = ts;
+
+    obj_name = (arg < (sizeof(TraceConv_ObjName) / sizeof(TraceConv_ObjName[0])))
+             ? TraceConv_ObjName[arg]
+             : "Event";
+
+    switch (type) {
+        case OS_TRACE_TYPE_TASK_SW:
+             TraceConv_SliceEnd(core, ts);
+             pcore->PrioCur    = (long)prio;
+             pcore->SliceStart = ts;
+             break;
+
+        case OS_TRACE_TYPE_INT_ENTER:
+             pcore->IntNesting++;
+             TraceConv_EvtBegin("B", "ISR", core * 2u + 1u, ts);
+             fprintf(TraceConv_Out, ",\"args\":{\"nesting\":%u}}", arg);
+             break;
+
+        case OS_TRACE_TYPE_INT_EXIT:
+             if (pcore->IntNesting > 0) {                       /* Tracing may start inside an ISR         */
+                 pcore->IntNesting--;
+                 TraceConv_EvtBegin("E", "ISR", core * 2u + 1u, ts);
+                 fprintf(TraceConv_Out, "}");
+             }
+             break;
+
+        case OS_TRACE_TYPE_PEND:
+        case OS_TRACE_TYPE_POST:
+             snprintf(name, sizeof(name), "%s %s",
+                      (type == OS_TRACE_TYPE_PEND) ? "Pend" : "Post", obj_name);
+             TraceConv_EvtBegin("i", name, core * 2u, ts);
+             fprintf(TraceConv_Out, ",\"s\":\"t\",\"args\":{\"prio\":%u,\"obj\":\"0x%08lX\",\"%s\":%lu}}",
+                     prio, (unsigned long)obj, (type == OS_TRACE_TYPE_PEND) ? "timeout" : "val",
+                     (unsigned long)val);
+             break;
+
+        case OS_TRACE_TYPE_TMR_EXPIRE:
+             TraceConv_EvtBegin("i", "Timer expired", core * 2u, ts);
+             fprintf(TraceConv_Out, ",\"s\":\"t\",\"args\":{\"tmr\":\"0x%08lX\",\"time\":%lu}}",
+                     (unsigned long)obj, (unsigned long)val);
+             break;
+
+        case OS_TRACE_TYPE_TASK_CREATE:
+        case OS_TRACE_TYPE_TASK_DEL:
+             TraceConv_EvtBegin("i", (type == OS_TRACE_TYPE_TASK_CREATE) ? "Task created" : "Task deleted",
+                                core * 2u, ts);
+             fprintf(TraceConv_Out, ",\"s\":\"t\",\"args\":{\"prio\":%u,\"tcb\":\"0x%08lX\"}}",
+                     prio, (unsigned long)obj);
+             break;
+
+        default:
+             break;
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          CONVERT A STREAM
+*
+* Description: This function converts a whole stream.  A stream may hold several traces, each starting
+*              with an OS_TRACE_HDR (OSTraceStart() was called again); they are shown one after the other.
+*
+* Arguments  : p         is a pointer to the stream
+*
+*              size      is its size in bytes
+*
+* Returns    : 0 if the stream was converted, 1 if it is not a trace stream.
+*********************************************************************************************************
+*/
+
+static  int  TraceConv_Stream (const unsigned char  *p,
+                               size_t                size)
+{
+    size_t     pos;
+    uint32_t   magic;
+    unsigned   core_nbr;
+    unsigned   core;
+    unsigned   nbr;
+    uint32_t   lost;
+    uint16_t   version;
+    uint16_t   rec_size;
+    int        hdr_seen;
+
+
+    pos      = 0u;
+    core_nbr = 0u;
+    hdr_seen = 0;
+    while ((pos + OS_TRACE_PKT_SIZE) <= size) {
+        memcpy(&magic, &p[pos], sizeof(magic));
+        if ((magic == OS_TRACE_MAGIC) || (magic == 0x4F535254u)) {
+            if ((pos + OS_TRACE_HDR_SIZE) > size) {
+                break;
+            }
+            TraceConv_Swap = (magic != OS_TRACE_MAGIC);
+            version        = TraceConv_Rd16(&p[pos +  4u]);
+            rec_size       = TraceConv_Rd16(&p[pos +  6u]);
+            if ((version != OS_TRACE_VERSION) || (rec_size != OS_TRACE_REC_SIZE)) {
+                fprintf(stderr, "os_trace_conv: unsupported stream version %u, record size %u\n",
+                        version, rec_size);
+                return (1);
+            }
+            for (core = 0u; core < core_nbr; core++) {          /* Close the previous trace                */
+                TraceConv_SliceEnd(core, TraceConv_CoreTbl[core].TSExt);
+            }
+            TraceConv_TSFreq     = (double)TraceConv_Rd32(&p[pos + 8u]);
+            core_nbr             = TraceConv_Rd16(&p[pos + 12u]);
+            TraceConv_LowestPrio = TraceConv_Rd16(&p[pos + 14u]);
+            if (core_nbr > TRACE_CONV_CORE_MAX) {
+                core_nbr = TRACE_CONV_CORE_MAX;
+            }
+            for (core = 0u; core < core_nbr; core++) {
+                TraceConv_CoreTbl[core].Seen       = 0;
+                TraceConv_CoreTbl[core].PrioCur    = -1;
+                TraceConv_CoreTbl[core].IntNesting = 0;
+                TraceConv_EvtBegin("M", "thread_name", core * 2u, 0u);
+                fprintf(TraceConv_Out, ",\"args\":{\"name\":\"Core %u tasks\"}}", core);
+                TraceConv_EvtBegin("M", "thread_name", core * 2u + 1u, 0u);
+                fprintf(TraceConv_Out, ",\"args\":{\"name\":\"Core %u ISRs\"}}", core);
+            }
+            TraceConv_TSBaseSet = 0;
+            hdr_seen            = 1;
+            pos                += OS_TRACE_HDR_SIZE;
+            continue;
+        }
+        if (!hdr_seen) {
+            fprintf(stderr, "os_trace_conv: stream does not start with a trace header\n");
+            return (1);
+        }
+        core = TraceConv_Rd16(&p[pos + 0u]);
+        nbr  = TraceConv_Rd16(&p[pos + 2u]);
+        lost = TraceConv_Rd32(&p[pos + 4u]);
+        pos += OS_TRACE_PKT_SIZE;
+        if (core >= core_nbr) {
+            fprintf(stderr, "os_trace_conv: bad core number %u at offset %lu\n",
+                    core, (unsigned long)(pos - OS_TRACE_PKT_SIZE));
+            return (1);
+        }
+        if (lost > 0u) {
+            TraceConv_EvtBegin("i", "Records lost", core * 2u, TraceConv_CoreTbl[core].TSExt);
+            fprintf(TraceConv_Out, ",\"s\":\"g\",\"args\":{\"core\":%u,\"lost\":%lu}}",
+                    core, (unsigned long)lost);
+        }
+        while ((nbr > 0u) && ((pos + OS_TRACE_REC_SIZE) <= size)) {
+            TraceConv_Rec(core, &p[pos]);
+            pos += OS_TRACE_REC_SIZE;
+            nbr--;
+        }
+    }
+    for (core = 0u; core < core_nbr; core++) {                  /* End the slices still running            */
+        TraceConv_SliceEnd(core, TraceConv_CoreTbl[core].TSExt);
+    }
+    if (pos != size) {
+        fprintf(stderr, "os_trace_conv: %lu trailing bytes ignored\n", (unsigned long)(size - pos));
+    }
+    return (0);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                                main()
+*
+* Description: Usage: os_trace_conv [trace.bin [trace.json]]
+*********************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    FILE           *in;
+    unsigned char  *buf;
+    size_t          size;
+    size_t          cap;
+    size_t          nbr;
+    int             err;
+
+
+    in            = stdin;
+    TraceConv_Out = stdout;
+    if (argc > 1) {
+        in = fopen(argv[1], "rb");
+        if (in == NULL) {
+            perror(argv[1]);
+            return (1);
+        }
+    }
+    if (argc > 2) {
+        TraceConv_Out = fopen(argv[2], "w");
+        if (TraceConv_Out == NULL) {
+            perror(argv[2]);
+            return (1);
+        }
+    }
+
+    size = 0u;
+    cap  = 65536u;
+    buf  = malloc(cap);
+    while (buf != NULL) {
+        nbr   = fread(&buf[size], 1u, cap - size, in);
+        size += nbr;
+        if (size < cap) {
+            break;
+        }
+        cap *= 2u;
+        buf  = realloc(buf, cap);
+    }
+    if (buf == NULL) {
+        fprintf(stderr, "os_trace_conv: out of memory\n");
+        return (1);
+    }
+
+    TraceConv_First = 1;
+    fprintf(TraceConv_Out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    err = TraceConv_Stream(buf, size);
+    fprintf(TraceConv_Out, "\n]}\n");
+
+    free(buf);
+    if (in != stdin) {
+        fclose(in);
+    }
+    if (TraceConv_Out != stdout) {
+        fclose(TraceConv_Out);
+    }
+    return (err);
+}